@@ -0,0 +1,87 @@
+/*
+ *  private/output/FileBuffer.h
+ *  avida-core
+ *
+ *  Copyright 2026 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef AvidaOutputFileBuffer_h
+#define AvidaOutputFileBuffer_h
+
+#include "apto/platform.h"
+
+#include <ios>
+#include <streambuf>
+#include <vector>
+
+
+namespace Avida {
+  namespace Output {
+
+    // Output::FileBuffer - stream buffer that hands large blocks of output to a background writer thread
+    // --------------------------------------------------------------------------------------------------------------
+    //
+    //  Output is gathered into fixed size blocks in memory as a sequence of records: runs of text written through the
+    //  stream, and typed values added by Put(), which are stored unformatted.  Completed blocks are queued to a single
+    //  writer thread shared by all buffers, which formats the typed values with default stream formatting and writes
+    //  everything to the underlying file buffer in the order it was added.  Stream flushes (std::endl, std::flush) are
+    //  deferred; Flush() queues the partially filled block and waits until everything written so far has reached the
+    //  file.  Buffers that are still open at process exit are flushed from an atexit handler.
+
+    class FileBuffer : public std::streambuf
+    {
+    private:
+      std::filebuf* m_sink;
+      std::vector<char>* m_block;
+      int m_used;                     // Bytes of m_block taken by completed records
+      int m_run;                      // Offset of the header of the text run the put area currently fills
+
+      FileBuffer(); // @not_implemented
+      FileBuffer(const FileBuffer&); // @not_implemented
+      FileBuffer& operator=(const FileBuffer&); // @not_implemented
+
+    public:
+      LIB_LOCAL explicit FileBuffer(std::filebuf* sink);
+      LIB_LOCAL ~FileBuffer();
+
+      LIB_LOCAL void Flush();
+
+      // Typed values can be deferred only while stream uses default formatting, otherwise the writer thread would
+      // format them differently than the stream would have
+      LIB_LOCAL static bool CanPut(const std::ios& stream);
+
+      // Append a value followed by a single space, formatted later by the writer thread
+      LIB_LOCAL void Put(int i);
+      LIB_LOCAL void Put(long i);
+      LIB_LOCAL void Put(unsigned int i);
+      LIB_LOCAL void Put(double x);
+
+    protected:
+      LIB_LOCAL int_type overflow(int_type c);
+      LIB_LOCAL int sync();
+
+    private:
+      LIB_LOCAL void submitBlock(bool flush);
+      LIB_LOCAL void putRecord(char type, const void* value, int size);
+      LIB_LOCAL void openRun();
+      LIB_LOCAL void closeRun();
+    };
+
+  };
+};
+
+#endif
@@ -0,0 +1,167 @@
+/*
+ *  private/output/SeriesFormat.h
+ *  avida-core
+ *
+ *  Copyright 2026 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef AvidaOutputSeriesFormat_h
+#define AvidaOutputSeriesFormat_h
+
+#include "apto/platform.h"
+
+#include <cstring>
+#include <vector>
+
+
+namespace Avida {
+  namespace Output {
+    namespace SeriesFormat {
+
+      // Layout of binary data series files (all integers little endian)
+      // --------------------------------------------------------------------------------------------------------------
+      //
+      //  header:  "AVTS" u32:version u32:num_columns, then per column u8:type u32:name_length name_bytes
+      //  chunk:   "CHNK" u32:num_rows i32:first_update i32:last_update u32:payload_size payload
+      //           payload holds the update column, then each value column as u32:size followed by its encoded values.
+      //           Updates and int values are zigzag varints of the difference to the previous row, double values are
+      //           varints of their bits XORed with those of the previous row, so slowly changing series stay small.
+      //           Updates start from the first update of the chunk and values from zero, so each chunk decodes on its own.
+      //  index:   "AVTI" u32:num_chunks, then per chunk u64:offset u32:num_rows i32:first_update i32:last_update
+      //  trailer: u64:index_offset "AVTE"
+      //
+      //  The index is written when the file is closed.  Files without one (an interrupted run) are read by walking the
+      //  chunk headers instead.
+
+      const char HEADER_MAGIC[] = "AVTS";
+      const char CHUNK_MAGIC[] = "CHNK";
+      const char INDEX_MAGIC[] = "AVTI";
+      const char TRAILER_MAGIC[] = "AVTE";
+      const unsigned int VERSION = 1;
+
+      const int CHUNK_HEADER_SIZE = 20;
+      const int INDEX_ENTRY_SIZE = 20;
+      const int TRAILER_SIZE = 12;
+
+
+      typedef std::vector<unsigned char> Bytes;
+
+      inline void PutU32(Bytes& out, unsigned int value)
+      {
+        for (int i = 0; i < 4; i++) out.push_back(static_cast<unsigned char>(value >> (8 * i)));
+      }
+
+      inline void PutU64(Bytes& out, unsigned long long value)
+      {
+        for (int i = 0; i < 8; i++) out.push_back(static_cast<unsigned char>(value >> (8 * i)));
+      }
+
+      inline void PutVarint(Bytes& out, unsigned long long value)
+      {
+        while (value >= 0x80) {
+          out.push_back(static_cast<unsigned char>(value | 0x80));
+          value >>= 7;
+        }
+        out.push_back(static_cast<unsigned char>(value));
+      }
+
+      inline unsigned long long ZigZag(long long value)
+      {
+        return (static_cast<unsigned long long>(value) << 1) ^ static_cast<unsigned long long>(value >> 63);
+      }
+
+      inline long long UnZigZag(unsigned long long value)
+      {
+        return static_cast<long long>(value >> 1) ^ -static_cast<long long>(value & 1);
+      }
+
+      inline unsigned long long DoubleBits(double value)
+      {
+        unsigned long long bits;
+        memcpy(&bits, &value, sizeof(bits));
+        return bits;
+      }
+
+      inline double BitsDouble(unsigned long long bits)
+      {
+        double value;
+        memcpy(&value, &bits, sizeof(value));
+        return value;
+      }
+
+
+      // Sequential reader over a byte range, that fails (rather than reading past the end) on truncated data
+      class Cursor
+      {
+      private:
+        const unsigned char* m_cur;
+        const unsigned char* m_end;
+        bool m_ok;
+
+      public:
+        LIB_LOCAL inline Cursor(const unsigned char* begin, const unsigned char* end) : m_cur(begin), m_end(end), m_ok(true) { ; }
+
+        LIB_LOCAL inline bool Ok() const { return m_ok; }
+        LIB_LOCAL inline const unsigned char* Position() const { return m_cur; }
+        LIB_LOCAL inline size_t Remaining() const { return m_end - m_cur; }
+
+        LIB_LOCAL inline bool Skip(size_t count)
+        {
+          if (!m_ok || Remaining() < count) return (m_ok = false);
+          m_cur += count;
+          return true;
+        }
+
+        LIB_LOCAL inline bool Magic(const char* magic)
+        {
+          if (!m_ok || Remaining() < 4 || memcmp(m_cur, magic, 4) != 0) return (m_ok = false);
+          m_cur += 4;
+          return true;
+        }
+
+        LIB_LOCAL inline unsigned long long Fixed(int size)
+        {
+          if (!m_ok || Remaining() < static_cast<size_t>(size)) { m_ok = false; return 0; }
+          unsigned long long value = 0;
+          for (int i = 0; i < size; i++) value |= static_cast<unsigned long long>(m_cur[i]) << (8 * i);
+          m_cur += size;
+          return value;
+        }
+
+        LIB_LOCAL inline unsigned int U32() { return static_cast<unsigned int>(Fixed(4)); }
+        LIB_LOCAL inline int I32() { return static_cast<int>(static_cast<unsigned int>(Fixed(4))); }
+        LIB_LOCAL inline unsigned long long U64() { return Fixed(8); }
+
+        LIB_LOCAL inline unsigned long long Varint()
+        {
+          unsigned long long value = 0;
+          for (int shift = 0; shift < 64; shift += 7) {
+            if (!m_ok || m_cur == m_end) break;
+            const unsigned char byte = *m_cur++;
+            value |= static_cast<unsigned long long>(byte & 0x7f) << shift;
+            if ((byte & 0x80) == 0) return value;
+          }
+          m_ok = false;
+          return 0;
+        }
+      };
+
+    };
+  };
+};
+
+#endif
@@ -122,6 +122,7 @@ namespace Avida {
       int NumUnits() const;
       
       const PropertyMap& Properties() const;
+      const Genome* RepresentativeGenome() const;
       
       bool Serialize(ArchivePtr ar) const;
       bool LegacySave(void* df) const;
@@ -62,6 +62,7 @@ enum eTIMESLICE
   SLICE_DEME_PROB_MERIT,
   SLICE_PROB_DEMESIZE_PROB_MERIT,
   SLICE_PROB_INTEGRATED_MERIT,
+  SLICE_PROB_MERIT_TREE,
 };
 
 enum ePOSITION_OFFSPRING
@@ -174,6 +175,11 @@ enum eMP_SCHEDULING {
 	MP_SCHEDULING_INTEGRATED
 };
 
+enum eMP_MIGRATION {
+	MP_MIGRATION_SYNCHRONOUS = 0,
+	MP_MIGRATION_OVERLAPPED
+};
+
 enum eVerbosity {
   VERBOSE_SILENT = 0,   // 0: No output at all
   VERBOSE_NORMAL,       // 1: Notification at start of commands.
@@ -28,6 +28,7 @@
 #include <cassert>
 
 #include "apto/platform.h"
+#include "apto/core/Atomic.h"
 #include "avida/core/GeneticRepresentation.h"
 
 
@@ -62,13 +63,103 @@ namespace Avida {
 
   
   
+  // InstructionArray - reference counted, copy-on-write storage for instruction sequences
+  // --------------------------------------------------------------------------------------------------------------
+  //
+  //  Copies share the same storage until one of them is written to, at which point the writer gets its own copy.
+  //  Any non-const access counts as a write, so references obtained through it must not be held across a copy of
+  //  the array; loops that only read should go through GetData().  A content hash of the leading sites is cached
+  //  alongside the handle and dropped on every write.  Once a mutable reference or pointer has been handed out
+  //  (non-const operator[], GetWritableData()) later writes through it cannot be seen, so that storage is marked
+  //  exposed and its hash is never cached again; SetInst() writes a site without exposing the storage.  Storage
+  //  counts and the cache are updated atomically, so a sequence may be read and hashed from several threads at once
+  //  as long as none of them writes to it.
+
+  class InstructionArray
+  {
+  private:
+    struct Block
+    {
+      volatile int refs;
+      bool exposed;                   // A mutable reference into insts was handed out, only set while refs is 1
+      Apto::Array<Instruction> insts;
+      
+      Block(int size) : refs(1), exposed(false), insts(size) { ; }
+    };
+    
+    Block* m_block;
+    Instruction* m_data;
+    int m_size;
+    mutable volatile int m_hash;      // Bits of the unsigned hash
+    mutable volatile int m_hash_len;  // Number of sites covered by m_hash, -1 if not computed (or being updated)
+    
+  public:
+    LIB_EXPORT inline InstructionArray() : m_block(NULL), m_data(NULL), m_size(0), m_hash(0), m_hash_len(-1) { ; }
+    LIB_EXPORT explicit InstructionArray(int size);
+    LIB_EXPORT InstructionArray(const InstructionArray& rhs);
+    LIB_EXPORT ~InstructionArray();
+    
+    LIB_EXPORT InstructionArray& operator=(const InstructionArray& rhs);
+    
+    LIB_EXPORT inline int GetSize() const { return m_size; }
+    
+    LIB_EXPORT inline const Instruction& operator[](int idx) const { assert(idx >= 0 && idx < m_size); return m_data[idx]; }
+    LIB_EXPORT inline Instruction& operator[](int idx)
+    {
+      assert(idx >= 0 && idx < m_size);
+      return GetWritableData()[idx];
+    }
+    LIB_EXPORT inline void SetInst(int idx, const Instruction& inst)
+    {
+      assert(idx >= 0 && idx < m_size);
+      writableData()[idx] = inst;
+    }
+    
+    // Direct access for loops: GetData() never copies, GetWritableData() detaches once and exposes the storage
+    LIB_EXPORT inline const Instruction* GetData() const { return m_data; }
+    LIB_EXPORT inline Instruction* GetWritableData()
+    {
+      Instruction* data = writableData();
+      if (m_block) m_block->exposed = true;
+      return data;
+    }
+    
+    LIB_EXPORT void Resize(int new_size);
+    LIB_EXPORT void ResizeClear(int new_size);
+    
+    LIB_EXPORT inline bool SharesStorage(const InstructionArray& other) const { return m_block && m_block == other.m_block; }
+    
+    // Hash of the first len sites, computed on demand.  Concurrent callers on the same array must pass the same len.
+    LIB_EXPORT unsigned int Hash(int len) const;
+    LIB_EXPORT inline bool HasHash(int len) const { return Apto::Atomic::Get(&m_hash_len) == len; }
+    LIB_EXPORT inline bool IsExposed() const { return m_block && m_block->exposed; }
+    
+  private:
+    friend class InstructionSequence;
+    
+    // Write access for callers that do not keep the pointer past their own update
+    inline Instruction* writableData()
+    {
+      m_hash_len = -1;
+      if (m_block && Apto::Atomic::Get(&m_block->refs) != 1) detach();
+      return m_data;
+    }
+    
+
+    void attach(Block* block);
+    void release();
+    void detach();
+    void copyHash(const InstructionArray& rhs);
+  };
+  
+  
   // InstructionSequence - a series of bytes containing a base level genetic sequence
   // --------------------------------------------------------------------------------------------------------------
 
   class InstructionSequence : public GeneticRepresentation
   {
   protected:
-    Apto::Array<Instruction> m_seq;
+    InstructionArray m_seq;
     int m_active_size;
     
   public:
@@ -84,6 +175,16 @@ namespace Avida {
     
     LIB_EXPORT inline Instruction& operator[](int idx) { assert(idx >= 0 && idx < m_active_size);  return m_seq[idx]; }
     LIB_EXPORT inline const Instruction& operator[](int idx) const { assert(idx >= 0 && idx < m_active_size);  return m_seq[idx]; }
+    LIB_EXPORT inline void SetInst(int idx, const Instruction& inst) { assert(idx >= 0 && idx < m_active_size);  m_seq.SetInst(idx, inst); }
+    
+    // Content hash of the active sites; equal sequences always hash equal
+    LIB_EXPORT inline unsigned int Hash() const { return m_seq.Hash(m_active_size); }
+    
+    // True while both sequences read the same storage, which implies equal contents (any write detaches)
+    LIB_EXPORT inline bool SharesStorage(const InstructionSequence& seq) const
+    {
+      return m_active_size == seq.m_active_size && m_seq.SharesStorage(seq.m_seq);
+    }
 
 
     // GeneticRepresentation Interface
@@ -43,6 +43,18 @@ namespace Avida {
       typedef Apto::Set<Apto::String, Apto::DefaultHashBTree, Apto::Multi> ArgMultiSet;
       typedef Apto::SmartPtr<ArgMultiSet> ArgMultiSetPtr;
       
+      struct ValueSource
+      {
+        DataID data_id;
+        DataID raw_id;                        // Argumented values only, data id of the provider
+        Apto::String argument;                // Argumented values only
+        ProviderPtr provider;                 // Provider of a standard value
+        ArgumentedProviderPtr arg_provider;   // Provider of an argumented value
+        int refs;                             // Attached recorders that requested the value, 0 once released
+        
+        ValueSource() : refs(0) { ; }
+      };
+      
     private:
       World* m_world;
       
@@ -61,8 +73,12 @@ namespace Avida {
       Apto::Map<DataID, ArgumentedProviderPtr> m_active_arg_provider_map;
       Apto::Map<DataID, ArgMultiSetPtr> m_active_args;
       
-      mutable Apto::Mutex m_current_value_mutex;
-      mutable Apto::Map<DataID, PackagePtr> m_current_values;
+      // Values requested by the attached recorders, indexed by handle.  Both are only changed while holding the recorder
+      // mutex, the snapshot being filled before recorders are notified, so notification reads them without locking.
+      Apto::Map<DataID, DataHandle> m_value_handles;
+      Apto::Array<ValueSource, Apto::Smart> m_value_sources;
+      Apto::Array<PackagePtr> m_snapshot;
+      Apto::Array<DataHandle> m_free_handles;   // Released by detached recorders, reused before the arrays grow
       
       static bool s_registered_with_facet_factory;
       
@@ -79,6 +95,11 @@ namespace Avida {
       LIB_EXPORT bool AttachRecorder(RecorderPtr recorder, bool concurrent_update = false);
       LIB_EXPORT bool DetachRecorder(RecorderPtr recorder);
       
+      // Handle of a value requested by an attached recorder, or -1 if no recorder requested it (not callable from NotifyData)
+      LIB_EXPORT DataHandle ResolveHandle(const DataID& data_id) const;
+      // Value of the current update, only valid while recorders are being notified
+      LIB_EXPORT PackagePtr GetSnapshotValue(DataHandle handle) const;
+      
       LIB_EXPORT bool Register(const DataID& data_id, ProviderActivateFunctor functor);
       LIB_EXPORT bool Register(const DataID& data_id, ArgumentedProviderActivateFunctor functor);
       
@@ -95,6 +116,11 @@ namespace Avida {
       
     public:
       LIB_LOCAL PackagePtr GetCurrentValue(const DataID& data_id) const;
+      
+    private:
+      LIB_LOCAL void resolveValue(const DataID& data_id, ValueSource& source) const;
+      LIB_LOCAL PackagePtr retrieveValue(const ValueSource& source) const;
+      LIB_LOCAL PackagePtr lookupValue(const DataID& data_id) const;
     };
     
   };
@@ -0,0 +1,61 @@
+/*
+ *  data/SeriesRecorder.h
+ *  avida-core
+ *
+ *  Copyright 2026 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef AvidaDataSeriesRecorder_h
+#define AvidaDataSeriesRecorder_h
+
+#include "avida/data/Recorder.h"
+#include "avida/output/SeriesFile.h"
+
+
+namespace Avida {
+  namespace Data {
+    
+    // Data::SeriesRecorder - records data values into a binary series file as the run progresses
+    // --------------------------------------------------------------------------------------------------------------
+    //
+    //  Unlike TimeSeriesRecorder, no samples are kept in memory; each recorded update becomes one row of the file.
+    
+    class SeriesRecorder : public Recorder
+    {
+    private:
+      Output::SeriesFilePtr m_file;
+      int m_interval;
+      
+      DataSetPtr m_requested;
+      Apto::Array<DataID, Apto::Smart> m_data_ids;
+      Apto::Array<int> m_columns;
+      
+    public:
+      LIB_EXPORT SeriesRecorder(Output::SeriesFilePtr file, int interval = 1);
+      
+      // Values must be added before the recorder is attached to the data manager
+      LIB_EXPORT bool AddValue(const DataID& data_id, Output::SeriesColumnType type);
+      
+      // Data::Recorder Interface
+      LIB_EXPORT ConstDataSetPtr RequestedData() const;
+      LIB_EXPORT void NotifyData(Update current_update, DataRetrievalFunctor retrieve_data);
+    };
+    
+  };
+};
+
+#endif
@@ -66,6 +66,8 @@ namespace Avida {
     
     typedef Apto::Functor<PackagePtr, Apto::TL::Create<const DataID&>, SmallObjectMalloc> DataRetrievalFunctor;
     
+    typedef int DataHandle;
+    
     typedef Apto::SmartPtr<Manager, Apto::InternalRCObject> ManagerPtr;
   };
 };
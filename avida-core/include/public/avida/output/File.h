@@ -34,6 +34,10 @@
 namespace Avida {
   namespace Output {
     
+    // Forward Declarations
+    class FileBuffer;
+    
+    
     // Output::Socket - Protocol defining interface for output sockets that can be managed by the output manager
     // --------------------------------------------------------------------------------------------------------------
     
@@ -49,6 +53,7 @@ namespace Avida {
       int m_num_cols;
       
       std::ofstream m_fp;
+      FileBuffer* m_async;  // Replaces the stream buffer of m_fp when values are formatted and written by the writer thread
 
       
     public:
@@ -89,14 +94,14 @@ namespace Avida {
       LIB_EXPORT void Write(long i, const char* descr, const char* format = "");
       LIB_EXPORT void Write(unsigned int i, const char* descr, const char* format = "");
       LIB_EXPORT void Write(const char* data_str, const char* descr, const char* format = "");
-      LIB_EXPORT void Write(Apto::Array<int> list, const char* descr, const char* format);
+      LIB_EXPORT void Write(const Apto::Array<int>& list, const char* descr, const char* format);
       
       
       // The following methods output a value into the data file anonymously (no column descriptor).
       //  first argument (x, i, data_str, etc.) - the value to write (as double, int, const char *, etc.)
-      LIB_EXPORT inline void WriteAnonymous(double x) { m_fp << x << " "; }
-      LIB_EXPORT inline void WriteAnonymous(int i) { m_fp << i << " "; }
-      LIB_EXPORT inline void WriteAnonymous(long i) { m_fp << i << " "; }
+      LIB_EXPORT void WriteAnonymous(double x);
+      LIB_EXPORT void WriteAnonymous(int i);
+      LIB_EXPORT void WriteAnonymous(long i);
       LIB_EXPORT inline void WriteAnonymous(const char* data_str) { m_fp << data_str << " "; }
       
       // The following methods are useful for outputting tables of values with row size x
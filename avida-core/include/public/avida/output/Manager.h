@@ -43,6 +43,7 @@ namespace Avida {
       World* m_world;
       
       Apto::String m_output_path;
+      bool m_async_files;
       
       mutable Apto::Mutex m_mutex;
       Apto::Map<OutputID, SocketWeakRef> m_sockets;
@@ -54,6 +55,10 @@ namespace Avida {
       
       LIB_EXPORT inline const Apto::String& OutputPath() const { return m_output_path; }
       
+      // When enabled, files opened from now on hand their output to a background writer thread
+      LIB_EXPORT inline bool AsyncFiles() const { return m_async_files; }
+      LIB_EXPORT inline void SetAsyncFiles(bool async_files) { m_async_files = async_files; }
+      
       LIB_EXPORT OutputID OutputIDFromPath(Apto::String path) const;
 
       LIB_EXPORT bool IsOpen(const OutputID& output_id) const;
@@ -0,0 +1,122 @@
+/*
+ *  output/SeriesFile.h
+ *  avida-core
+ *
+ *  Copyright 2026 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef AvidaOutputSeriesFile_h
+#define AvidaOutputSeriesFile_h
+
+#include "avida/output/Socket.h"
+
+#include <fstream>
+#include <vector>
+
+
+namespace Avida {
+  namespace Output {
+    
+    enum SeriesColumnType {
+      SERIES_INT = 0,
+      SERIES_DOUBLE = 1
+    };
+    
+    
+    // Output::SeriesFile - binary, columnar time series output
+    // --------------------------------------------------------------------------------------------------------------
+    //
+    //  Rows of typed values, keyed by update, are appended one at a time.  Each column is delta encoded into its own
+    //  buffer, and the buffers are written out together as a chunk once it holds a fixed number of rows, so memory use
+    //  does not grow with the length of the run.  An index of the chunks by update is written when the file is closed.
+    //  Files are read back with Output::SeriesReader, which can also convert them to the text .dat layout.
+    
+    class SeriesFile : public Socket
+    {
+    public:
+      static const int DEFAULT_CHUNK_ROWS = 4096;
+      
+    private:
+      struct Column
+      {
+        Apto::String name;
+        SeriesColumnType type;
+        long long last_int;       // Value of the previous row
+        unsigned long long last_bits;
+        bool is_set;              // Set in the current row
+        std::vector<unsigned char> data;
+      };
+      
+      struct ChunkEntry
+      {
+        unsigned long long offset;
+        int num_rows;
+        Update first_update;
+        Update last_update;
+      };
+      
+      std::ofstream m_fp;
+      int m_chunk_rows;
+      bool m_header_written;
+      
+      Apto::Array<Column, Apto::Smart> m_columns;
+      std::vector<unsigned char> m_updates;
+      Update m_first_update;
+      Update m_last_update;
+      int m_num_rows;           // Rows in the current chunk
+      bool m_row_open;
+      
+      Apto::Array<ChunkEntry, Apto::Smart> m_index;
+      
+      
+    public:
+      LIB_EXPORT static SeriesFilePtr CreateWithPath(World* world, Apto::String path, Feedback* feedback = NULL,
+                                                     int chunk_rows = DEFAULT_CHUNK_ROWS);
+      
+      LIB_EXPORT ~SeriesFile();
+      
+      LIB_EXPORT inline const OutputID& Name() const { return m_output_id; }
+      LIB_EXPORT inline bool Good() const { return m_fp.good(); }
+      
+      // Columns must all be added before the first row is written, the update is always stored as the first column
+      LIB_EXPORT int AddColumn(const Apto::String& name, SeriesColumnType type);
+      LIB_EXPORT inline int NumColumns() const { return m_columns.GetSize(); }
+      LIB_EXPORT inline SeriesColumnType ColumnType(int column) const { return m_columns[column].type; }
+      
+      // Rows are written by setting the columns between BeginRow and EndRow, columns left unset repeat their last value
+      LIB_EXPORT void BeginRow(Update update);
+      LIB_EXPORT void SetValue(int column, int value);
+      LIB_EXPORT void SetValue(int column, double value);
+      LIB_EXPORT void EndRow();
+      
+      // Writes the rows buffered so far as a (possibly short) chunk
+      LIB_EXPORT void Flush();
+      
+    private:
+      LIB_LOCAL SeriesFile(World* world, const OutputID& output_id, int chunk_rows);
+      
+      LIB_LOCAL void putInt(Column& col, long long value);
+      LIB_LOCAL void putBits(Column& col, unsigned long long bits);
+      LIB_LOCAL void writeHeader();
+      LIB_LOCAL void writeChunk();
+      LIB_LOCAL void writeIndex();
+    };
+    
+  };
+};
+
+#endif
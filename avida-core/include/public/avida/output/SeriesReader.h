@@ -0,0 +1,102 @@
+/*
+ *  output/SeriesReader.h
+ *  avida-core
+ *
+ *  Copyright 2026 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef AvidaOutputSeriesReader_h
+#define AvidaOutputSeriesReader_h
+
+#include "avida/output/SeriesFile.h"
+
+
+namespace Avida {
+  namespace Output {
+    
+    // Output::SeriesReader - memory mapped access to files written by Output::SeriesFile
+    // --------------------------------------------------------------------------------------------------------------
+    //
+    //  The file is mapped read only and decoded a chunk at a time, so any part of a long run can be read without
+    //  loading the rest.  Values of both column types are returned as doubles, which hold int columns exactly.
+    
+    class SeriesReader
+    {
+    private:
+      struct Column
+      {
+        Apto::String name;
+        SeriesColumnType type;
+      };
+      
+      struct Chunk
+      {
+        size_t offset;
+        int num_rows;
+        Update first_update;
+        Update last_update;
+      };
+      
+      const unsigned char* m_data;
+      size_t m_size;
+      void* m_mapping;            // Mapped file (NULL when not mapped)
+      unsigned char* m_buffer;    // File contents, when the file could not be mapped
+      
+      Apto::Array<Column, Apto::Smart> m_columns;
+      Apto::Array<Chunk, Apto::Smart> m_chunks;
+      int m_num_rows;
+      
+      SeriesReader(const SeriesReader&); // @not_implemented
+      SeriesReader& operator=(const SeriesReader&); // @not_implemented
+      
+    public:
+      LIB_EXPORT SeriesReader();
+      LIB_EXPORT ~SeriesReader();
+      
+      LIB_EXPORT bool Open(const Apto::String& path);
+      LIB_EXPORT void Close();
+      
+      LIB_EXPORT inline int NumColumns() const { return m_columns.GetSize(); }
+      LIB_EXPORT inline const Apto::String& ColumnName(int column) const { return m_columns[column].name; }
+      LIB_EXPORT inline SeriesColumnType ColumnType(int column) const { return m_columns[column].type; }
+      
+      LIB_EXPORT inline int NumRows() const { return m_num_rows; }
+      LIB_EXPORT inline int NumChunks() const { return m_chunks.GetSize(); }
+      LIB_EXPORT inline int ChunkNumRows(int chunk) const { return m_chunks[chunk].num_rows; }
+      LIB_EXPORT inline Update ChunkFirstUpdate(int chunk) const { return m_chunks[chunk].first_update; }
+      LIB_EXPORT inline Update ChunkLastUpdate(int chunk) const { return m_chunks[chunk].last_update; }
+      
+      // First chunk holding rows at or after the update, -1 if there are none
+      LIB_EXPORT int FindChunk(Update update) const;
+      
+      LIB_EXPORT bool ReadUpdates(int chunk, Apto::Array<Update>& updates) const;
+      LIB_EXPORT bool ReadColumn(int chunk, int column, Apto::Array<double>& values) const;
+      
+      // Writes the whole series as a text data file, in the layout of Output::File
+      LIB_EXPORT bool ExportDat(const Apto::String& path) const;
+      
+    private:
+      LIB_LOCAL bool mapFile(const Apto::String& path);
+      LIB_LOCAL bool readIndex();
+      LIB_LOCAL bool scanChunks(size_t offset);
+      LIB_LOCAL const unsigned char* columnData(int chunk, int column, size_t& size) const;
+    };
+    
+  };
+};
+
+#endif
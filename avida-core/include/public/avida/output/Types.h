@@ -35,6 +35,7 @@ namespace Avida {
     
     class File;
     class Manager;
+    class SeriesFile;
     class Socket;
     
     
@@ -45,6 +46,7 @@ namespace Avida {
     typedef Socket* SocketWeakRef;
     typedef Apto::SmartPtr<File, Apto::InternalRCObject> FilePtr;
     typedef Apto::SmartPtr<Manager, Apto::InternalRCObject> ManagerPtr;
+    typedef Apto::SmartPtr<SeriesFile, Apto::InternalRCObject> SeriesFilePtr;
     typedef Apto::SmartPtr<Socket, Apto::InternalRCObject> SocketPtr;
   };
 };
@@ -47,6 +47,16 @@ namespace Avida {
     };
     
     
+    // Role Interning
+    // --------------------------------------------------------------------------------------------------------------
+    
+    //! Returns the atom for the given role, interning it if it has not been seen before.
+    LIB_EXPORT RoleAtom InternRole(const RoleID& role);
+    
+    //! Returns the atom for the given role, or -1 if it has never been interned.  Lookups of interned roles do not lock.
+    LIB_EXPORT RoleAtom FindRole(const RoleID& role);
+    
+    
     // Group
     // --------------------------------------------------------------------------------------------------------------
     
@@ -55,13 +65,17 @@ namespace Avida {
       GroupID m_id;
       mutable int m_a_refs;
       mutable int m_p_refs;
+      const RoleAtom m_role_atom;
       Apto::Map<Apto::String, Apto::SmartPtr<GroupData> > m_data;
       
     public:
-      LIB_EXPORT inline Group(GroupID in_id) : m_id(in_id), m_a_refs(0), m_p_refs(0) { ; }
+      //! role_atom must be the interned atom of the role the group will report, see InternRole().
+      LIB_EXPORT inline Group(GroupID in_id, RoleAtom role_atom)
+        : m_id(in_id), m_a_refs(0), m_p_refs(0), m_role_atom(role_atom) { ; }
       LIB_EXPORT virtual ~Group() = 0;
       
       LIB_EXPORT virtual RoleID Role() const = 0;
+      LIB_EXPORT inline RoleAtom InternedRole() const { return m_role_atom; }
       LIB_EXPORT inline GroupID ID() const { return m_id; }
       LIB_EXPORT virtual ArbiterPtr Arbiter() const = 0;
       
@@ -74,6 +88,10 @@ namespace Avida {
       
       LIB_EXPORT virtual const PropertyMap& Properties() const = 0;
       
+      //! The genome shared by all units of this group, if the group has one (avoids formatting and re-parsing the
+      //! "genome" string property).
+      LIB_EXPORT virtual const Genome* RepresentativeGenome() const;
+      
       LIB_EXPORT virtual bool Serialize(ArchivePtr ar) const;
       LIB_EXPORT virtual bool LegacySave(void* df) const;
       
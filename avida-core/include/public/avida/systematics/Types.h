@@ -69,6 +69,11 @@ namespace Avida {
     
     typedef Apto::String RoleID;
     
+    // Interned role identifier, see InternRole().  The built-in roles are always interned to these values.
+    typedef int RoleAtom;
+    const RoleAtom ROLE_GENOTYPE = 0;
+    const RoleAtom ROLE_CLADE = 1;
+    
     enum TransmissionType {
       UNKNOWN = 0,
       DIVISION,
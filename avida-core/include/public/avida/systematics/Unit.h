@@ -115,6 +115,7 @@ namespace Avida {
       
       LIB_EXPORT inline ConstGroupMembershipPtr SystematicsGroupMembership() const { return m_groups; }
       LIB_EXPORT GroupPtr SystematicsGroup(const RoleID& role) const;
+      LIB_EXPORT GroupPtr SystematicsGroup(RoleAtom role) const;
       
       LIB_EXPORT bool AddClassification(GroupPtr g);
       LIB_EXPORT void Reclassify(GroupPtr g);
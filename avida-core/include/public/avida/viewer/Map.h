@@ -87,15 +87,63 @@ namespace Avida {
       virtual bool SetProperty(const Apto::String& property, const Apto::String& value) = 0;
       virtual Apto::String GetProperty(const Apto::String& property) const = 0;
       
-      virtual void Update(cPopulation& pop) = 0;
+      // Brings the mode up to date.  Only the listed cells have changed occupant or organism state since the
+      // previous call; the first call (and any call after the population has been resized) lists every cell.
+      virtual void Update(cPopulation& pop, const Apto::Array<int>& changed_cells) = 0;
     };
     
     
     // Map Definition
     // --------------------------------------------------------------------------------------------------------------  
+    //
+    //  Only the modes currently selected as the color, symbol and tag modes are recomputed after each update, and
+    //  each of them only for the cells whose occupant has been born, died or moved, or has divided, since that mode
+    //  was last computed.  Results are published through a triple buffered frame: viewers read the front frame
+    //  between Retain() and Release() while the next frame is being filled, so reading never waits on an update and
+    //  an update never waits on a reader.
     
     class Map
     {
+    public:
+      class FrameScale : public DiscreteScale
+      {
+        friend class Map;
+      private:
+        int m_range;
+        Apto::Array<Entry> m_entries;
+        bool m_categorical;
+        
+      public:
+        FrameScale() : m_range(0), m_categorical(false) { ; }
+        ~FrameScale() { ; }
+        
+        int GetScaleRange() const { return m_range; }
+        int GetNumLabeledEntries() const { return m_entries.GetSize(); }
+        Entry GetEntry(int index) const { return m_entries[index]; }
+        bool IsCategorical() const { return m_categorical; }
+      };
+      
+    protected:
+      struct FrameLayer
+      {
+        Apto::Array<int> values;
+        Apto::Array<int> counts;
+        FrameScale scale;
+        Apto::String scale_label;
+      };
+      
+      struct Frame
+      {
+        int width;
+        int height;
+        FrameLayer color;
+        FrameLayer symbol;
+        FrameLayer tag;
+        
+        Frame() : width(0), height(0) { ; }
+      };
+      
+      
     protected:
       int m_width;
       int m_height;
@@ -106,7 +154,23 @@ namespace Avida {
       int m_symbol_mode;     // Current map symbol mode (index into m_view_modes, -1 = off)
       int m_tag_mode;        // Current map tag mode (index into m_view_modes, -1 = off)
       
-      Apto::RWLock m_rw_lock;
+      // Change tracking, all guarded by m_update_mutex
+      Apto::Mutex m_update_mutex;
+      int m_update_serial;                  // Incremented on every UpdateMaps
+      Apto::Array<int> m_cell_org_id;       // Occupant organism ID at the last scan (-1 = empty)
+      Apto::Array<int> m_cell_divides;      // Occupant divide count at the last scan
+      Apto::Array<int> m_cell_changed_at;   // Serial of the scan that last saw the cell change
+      Apto::Array<int> m_mode_serial;       // Serial each mode was last computed at (0 = never)
+      Apto::Array<int> m_changed_cells;
+      
+      // Published frames: the writer fills m_back, readers use m_front, m_ready holds the latest complete frame
+      Frame m_frames[3];
+      int m_front;
+      int m_ready;
+      int m_back;
+      bool m_ready_fresh;
+      int m_readers;
+      Apto::Mutex m_frame_mutex;
       
       
     public:
@@ -114,8 +178,8 @@ namespace Avida {
       ~Map();
       
       
-      inline int GetWidth() const { return m_width; }
-      inline int GetHeight() const { return m_height; }
+      inline int GetWidth() const { return m_frames[m_front].width; }
+      inline int GetHeight() const { return m_frames[m_front].height; }
       
       
       inline int GetColorMode() const { return m_color_mode; }
@@ -123,21 +187,21 @@ namespace Avida {
       inline int GetTagMode() const { return m_tag_mode; }
       
       
-      inline const Apto::Array<int>& GetColors() const { return m_view_modes[m_color_mode]->GetGridValues(); }
-      inline const Apto::Array<int>& GetSymbols() const { return m_view_modes[m_symbol_mode]->GetGridValues(); }
-      inline const Apto::Array<int>& GetTags() const { return m_view_modes[m_tag_mode]->GetGridValues(); }
+      inline const Apto::Array<int>& GetColors() const { return m_frames[m_front].color.values; }
+      inline const Apto::Array<int>& GetSymbols() const { return m_frames[m_front].symbol.values; }
+      inline const Apto::Array<int>& GetTags() const { return m_frames[m_front].tag.values; }
       
-      inline const Apto::Array<int>& GetColorCounts() const { return m_view_modes[m_color_mode]->GetValueCounts(); }
-      inline const Apto::Array<int>& GetSymbolCounts() const { return m_view_modes[m_symbol_mode]->GetValueCounts(); }
-      inline const Apto::Array<int>& GetTagCounts() const { return m_view_modes[m_tag_mode]->GetValueCounts(); }
+      inline const Apto::Array<int>& GetColorCounts() const { return m_frames[m_front].color.counts; }
+      inline const Apto::Array<int>& GetSymbolCounts() const { return m_frames[m_front].symbol.counts; }
+      inline const Apto::Array<int>& GetTagCounts() const { return m_frames[m_front].tag.counts; }
       
-      inline const DiscreteScale& GetColorScale() const { return m_view_modes[m_color_mode]->GetScale(); }
-      inline const DiscreteScale& GetSymbolScale() const { return m_view_modes[m_symbol_mode]->GetScale(); }
-      inline const DiscreteScale& GetTagScale() const { return m_view_modes[m_tag_mode]->GetScale(); }
+      inline const DiscreteScale& GetColorScale() const { return m_frames[m_front].color.scale; }
+      inline const DiscreteScale& GetSymbolScale() const { return m_frames[m_front].symbol.scale; }
+      inline const DiscreteScale& GetTagScale() const { return m_frames[m_front].tag.scale; }
       
-      inline const Apto::String& GetColorScaleLabel() const { return m_view_modes[m_color_mode]->GetScaleLabel(); }
-      inline const Apto::String& GetSymbolScaleLabel() const { return m_view_modes[m_symbol_mode]->GetScaleLabel(); }
-      inline const Apto::String& GetTagScaleLabel() const { return m_view_modes[m_tag_mode]->GetScaleLabel(); }
+      inline const Apto::String& GetColorScaleLabel() const { return m_frames[m_front].color.scale_label; }
+      inline const Apto::String& GetSymbolScaleLabel() const { return m_frames[m_front].symbol.scale_label; }
+      inline const Apto::String& GetTagScaleLabel() const { return m_frames[m_front].tag.scale_label; }
       
       inline int GetNumModes() const { return m_view_modes.GetSize(); }
       inline const Apto::String& GetModeName(int idx) const { return m_view_modes[idx]->GetName(); }
@@ -149,16 +213,25 @@ namespace Avida {
       inline void SetNumViewerColors(int num_colors) { m_num_viewer_colors = num_colors; }
       
       
-      inline void Retain() { m_rw_lock.ReadLock(); }
-      inline void Release() { m_rw_lock.ReadUnlock(); }
+      void Retain();
+      void Release();
       
       
       // Core Viewer Internal Methods
-      void UpdateMaps(cPopulation& pop);
+      // - all_modes brings the modes not currently displayed up to date as well (used when the driver pauses, so
+      //   that switching modes while paused shows current data)
+      void UpdateMaps(cPopulation& pop, bool all_modes = false);
       
       
     protected:
+      void scanCells(cPopulation& pop);
       void updateMap(cPopulation& pop, int map_id);
+      void publishFrame();
+      void fillLayer(FrameLayer& layer, int map_id);
+      inline bool isActiveMode(int map_id) const
+      {
+        return map_id == m_color_mode || map_id == m_symbol_mode || map_id == m_tag_mode;
+      }
     };
     
   };
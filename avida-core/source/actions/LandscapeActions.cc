@@ -916,7 +916,7 @@ public:
         cOrganism* organism = orgdata->GetOrganism();
         cPhenotype& phenotype = organism->GetPhenotype();
         
-        Systematics::GroupPtr genotype = organism->SystematicsGroup("genotype");
+        Systematics::GroupPtr genotype = organism->SystematicsGroup(Systematics::ROLE_GENOTYPE);
         
         ConstInstructionSequencePtr seq;
         seq.DynamicCastFrom(organism->GetGenome().Representation());
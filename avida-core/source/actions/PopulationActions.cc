@@ -1370,7 +1370,7 @@ public:
     Apto::Array<int, Apto::Smart> doomed_orgs;
     
     for (int i = 0; i < live_orgs.GetSize(); i++) {
-      if (live_orgs[i]->SystematicsGroup("genotype")->ID() == dom_id) doomed_orgs.Push(live_orgs[i]->GetCellID());
+      if (live_orgs[i]->SystematicsGroup(Systematics::ROLE_GENOTYPE)->ID() == dom_id) doomed_orgs.Push(live_orgs[i]->GetCellID());
     }
     cPopulation& pop = m_world->GetPopulation();                                                
     
@@ -1410,7 +1410,7 @@ public:
     
     
     for (int i = 0; i < live_orgs.GetSize(); i++) {
-      //if (live_orgs[i]->SystematicsGroup("genotype")->ID() == dom_id) doomed_orgs.Push(live_orgs[i]->GetCellID());
+      //if (live_orgs[i]->SystematicsGroup(Systematics::ROLE_GENOTYPE)->ID() == dom_id) doomed_orgs.Push(live_orgs[i]->GetCellID());
       if (live_orgs[i]->GetGenome() == arg_genome & ctx.GetRandom().P(m_killprob)) doomed_orgs.Push(live_orgs[i]->GetCellID());
     }
     cPopulation& pop = m_world->GetPopulation();
@@ -4209,8 +4209,8 @@ public:
       cerr << "cellB: " << temp_x << " " << temp_y << endl;
 #endif
       
-      tList<cPopulationCell>& cellA_list = cellA.ConnectionList();
-      tList<cPopulationCell>& cellB_list = cellB.ConnectionList();
+      cCellConnections& cellA_list = cellA.ConnectionList();
+      cCellConnections& cellB_list = cellB.ConnectionList();
       cellA_list.Remove(&m_world->GetPopulation().GetCell(idB));
       cellA_list.Remove(&m_world->GetPopulation().GetCell(idB0));
       cellA_list.Remove(&m_world->GetPopulation().GetCell(idB1));
@@ -4218,6 +4218,7 @@ public:
       cellB_list.Remove(&m_world->GetPopulation().GetCell(idA0));
       cellB_list.Remove(&m_world->GetPopulation().GetCell(idA1));
     }
+    m_world->GetPopulation().ConnectionsChanged();
   }
 };
 
@@ -4286,8 +4287,8 @@ public:
       cerr << "cellB: " << temp_x << " " << temp_y << endl;
 #endif
       
-      tList<cPopulationCell>& cellA_list = cellA.ConnectionList();
-      tList<cPopulationCell>& cellB_list = cellB.ConnectionList();
+      cCellConnections& cellA_list = cellA.ConnectionList();
+      cCellConnections& cellB_list = cellB.ConnectionList();
       cellA_list.Remove(&m_world->GetPopulation().GetCell(idB));
       cellA_list.Remove(&m_world->GetPopulation().GetCell(idB0));
       cellA_list.Remove(&m_world->GetPopulation().GetCell(idB1));
@@ -4295,6 +4296,7 @@ public:
       cellB_list.Remove(&m_world->GetPopulation().GetCell(idA0));
       cellB_list.Remove(&m_world->GetPopulation().GetCell(idA1));
     }
+    m_world->GetPopulation().ConnectionsChanged();
   }
 };
 
@@ -4348,8 +4350,8 @@ public:
       cPopulationCell& cellB = m_world->GetPopulation().GetCell(idB);
       
       //grab the cell lists
-      tList<cPopulationCell>& cellA_list = cellA.ConnectionList();
-      tList<cPopulationCell>& cellB_list = cellB.ConnectionList();
+      cCellConnections& cellA_list = cellA.ConnectionList();
+      cCellConnections& cellB_list = cellB.ConnectionList();
       
       //these cells are always joined
       if (cellA_list.FindPtr(&cellB)  == NULL) cellA_list.Push(&cellB);
@@ -4371,6 +4373,7 @@ public:
         if (cellB_list.FindPtr(&cellA1) == NULL) cellB_list.Push(&cellA1);
       }
     }
+    m_world->GetPopulation().ConnectionsChanged();
   }
 };
 
@@ -4424,8 +4427,8 @@ public:
       cPopulationCell& cellB = m_world->GetPopulation().GetCell(idB);
       
       //grab the cell lists
-      tList<cPopulationCell>& cellA_list = cellA.ConnectionList();
-      tList<cPopulationCell>& cellB_list = cellB.ConnectionList();
+      cCellConnections& cellA_list = cellA.ConnectionList();
+      cCellConnections& cellB_list = cellB.ConnectionList();
       
       //these cells are always joined
       if (cellA_list.FindPtr(&cellB)  == NULL) cellA_list.Push(&cellB);
@@ -4447,6 +4450,7 @@ public:
         if (cellB_list.FindPtr(&cellA1) == NULL) cellB_list.Push(&cellA1);
       }
     }
+    m_world->GetPopulation().ConnectionsChanged();
   }
 };
 
@@ -4483,10 +4487,11 @@ public:
     int idB = m_b_y * world_x + m_b_x;
     cPopulationCell& cellA = m_world->GetPopulation().GetCell(idA);
     cPopulationCell& cellB = m_world->GetPopulation().GetCell(idB);
-    tList<cPopulationCell>& cellA_list = cellA.ConnectionList();
-    tList<cPopulationCell>& cellB_list = cellB.ConnectionList();
+    cCellConnections& cellA_list = cellA.ConnectionList();
+    cCellConnections& cellB_list = cellB.ConnectionList();
     cellA_list.PushRear(&cellB);
     cellB_list.PushRear(&cellA);
+    m_world->GetPopulation().ConnectionsChanged();
   }
 };
 
@@ -4523,10 +4528,11 @@ public:
     int idB = m_b_y * world_x + m_b_x;
     cPopulationCell& cellA = m_world->GetPopulation().GetCell(idA);
     cPopulationCell& cellB = m_world->GetPopulation().GetCell(idB);
-    tList<cPopulationCell>& cellA_list = cellA.ConnectionList();
-    tList<cPopulationCell>& cellB_list = cellB.ConnectionList();
+    cCellConnections& cellA_list = cellA.ConnectionList();
+    cCellConnections& cellB_list = cellB.ConnectionList();
     cellA_list.Remove(&cellB);
     cellB_list.Remove(&cellA);
+    m_world->GetPopulation().ConnectionsChanged();
   }
 };
 
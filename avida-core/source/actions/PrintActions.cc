@@ -27,7 +27,9 @@
 #include "avida/data/Manager.h"
 #include "avida/data/Package.h"
 #include "avida/data/Recorder.h"
+#include "avida/data/SeriesRecorder.h"
 #include "avida/output/File.h"
+#include "avida/output/SeriesFile.h"
 #include "avida/systematics/Arbiter.h"
 #include "avida/systematics/Group.h"
 #include "avida/systematics/Manager.h"
@@ -45,7 +47,9 @@
 #include "cHardwareBase.h"
 #include "cHardwareManager.h"
 #include "cHistogram.h"
+#include "cInstProfiler.h"
 #include "cInstSet.h"
+#include "cMeritSchedule.h"
 #include "cMigrationMatrix.h"
 #include "cOrganism.h"
 #include "cPhenPlastGenotype.h"
@@ -53,9 +57,12 @@
 #include "cPlasticPhenotype.h"
 #include "cPopulation.h"
 #include "cPopulationCell.h"
+#include "cPopulationSnapshot.h"
 #include "cReaction.h"
 #include "cReactionLib.h"
 #include "cStats.h"
+#include "cUpdateProfiler.h"
+#include "cUpdateSchedule.h"
 #include "cWorld.h"
 #include "cUserFeedback.h"
 #include "cParasite.h"
@@ -243,6 +250,240 @@ POP_OUT_FILE(PrintDemeTestamentStats,  deme_testament.dat  );
 POP_OUT_FILE(PrintCurrentMeanDemeDensity,  deme_currentMeanDensity.dat  );
 
 
+/*
+ Prints the wall clock time spent in each phase of the update loop, averaged over all updates completed since the
+ previous print.  Nested phases (births, deaths, resources) are included in the time of the phase that triggered them.
+*/
+class cActionPrintUpdateProfile : public cAction
+{
+private:
+  cString m_filename;
+  cUpdateProfiler::PhaseStats m_prev_total[cUpdateProfiler::NUM_PHASES];
+  int m_prev_updates;
+  
+public:
+  cActionPrintUpdateProfile(cWorld* world, const cString& args, Feedback&) : cAction(world, args), m_prev_updates(0)
+  {
+    cString largs(args);
+    m_filename = (largs.GetSize()) ? largs.PopWord() : "update_profile.dat";
+    m_world->GetUpdateProfiler().Enable();
+  }
+  static const cString GetDescription() { return "Arguments: [string fname=\"update_profile.dat\"]"; }
+  void Process(cAvidaContext&)
+  {
+    const cUpdateProfiler& profiler = m_world->GetUpdateProfiler();
+    Avida::Output::FilePtr df = Avida::Output::File::StaticWithPath(m_world->GetNewWorld(), (const char*)m_filename);
+    
+    df->WriteComment("Avida update profile");
+    df->WriteComment("Wall clock milliseconds per update, averaged since the previous line");
+    df->WriteTimeStamp();
+    
+    const int num_updates = profiler.GetNumUpdates() - m_prev_updates;
+    const double scale = (num_updates > 0) ? (1.0e-6 / num_updates) : 0.0;
+    
+    df->Write(m_world->GetStats().GetUpdate(), "Update");
+    df->Write(num_updates, "Updates Averaged");
+    for (int i = 0; i < cUpdateProfiler::NUM_PHASES; i++) {
+      const cUpdateProfiler::PhaseStats& total = profiler.GetTotal(i);
+      cString desc(cUpdateProfiler::PhaseDescription(i));
+      df->Write((total.inclusive_ns - m_prev_total[i].inclusive_ns) * scale, desc + " (ms)");
+    }
+    const cUpdateProfiler::PhaseStats& update_total = profiler.GetTotal(cUpdateProfiler::PHASE_UPDATE);
+    df->Write((update_total.self_ns - m_prev_total[cUpdateProfiler::PHASE_UPDATE].self_ns) * scale, "Untracked (ms)");
+    const int counted_phases[] = { cUpdateProfiler::PHASE_BIRTHS, cUpdateProfiler::PHASE_DEATHS, cUpdateProfiler::PHASE_RESOURCES };
+    for (int c = 0; c < 3; c++) {
+      const int i = counted_phases[c];
+      const long long calls = profiler.GetTotal(i).calls - m_prev_total[i].calls;
+      df->Write((num_updates > 0) ? (double)calls / num_updates : 0.0, cString(cUpdateProfiler::PhaseDescription(i)) + " (calls)");
+    }
+    df->Endl();
+    
+    for (int i = 0; i < cUpdateProfiler::NUM_PHASES; i++) m_prev_total[i] = profiler.GetTotal(i);
+    m_prev_updates = profiler.GetNumUpdates();
+  }
+};
+
+/*
+ Prints statistics of the pre-sampled schedule of the last completed update: how many slices were drawn and discarded
+ because of merit changes, and how evenly the executed slices were spread over cells.  Requires PRESAMPLE_SCHEDULE.
+*/
+class cActionPrintUpdateSchedule : public cAction
+{
+private:
+  cString m_filename;
+  
+public:
+  cActionPrintUpdateSchedule(cWorld* world, const cString& args, Feedback&) : cAction(world, args)
+  {
+    cString largs(args);
+    m_filename = (largs.GetSize()) ? largs.PopWord() : "update_schedule.dat";
+  }
+  static const cString GetDescription() { return "Arguments: [string fname=\"update_schedule.dat\"]"; }
+  void Process(cAvidaContext& ctx)
+  {
+    const cUpdateSchedule* schedule = m_world->GetPopulation().GetUpdateSchedule();
+    if (!schedule) {
+      ctx.Driver().Feedback().Warning("PrintUpdateSchedule requires PRESAMPLE_SCHEDULE 1 and SLICING_METHOD 6");
+      return;
+    }
+    const cUpdateSchedule::sUpdateStats& stats = schedule->GetLastUpdateStats();
+    Avida::Output::FilePtr df = Avida::Output::File::StaticWithPath(m_world->GetNewWorld(), (const char*)m_filename);
+    
+    df->WriteComment("Avida pre-sampled update schedule");
+    df->WriteComment("Statistics of the last completed update");
+    df->WriteTimeStamp();
+    
+    df->Write(m_world->GetStats().GetUpdate(), "Update");
+    df->Write(stats.slices, "Slices");
+    df->Write(stats.executed, "Executed");
+    df->Write(stats.drawn, "Drawn");
+    df->Write(stats.discarded, "Discarded");
+    df->Write(stats.invalidations, "Invalidations");
+    df->Write(stats.runs, "Runs");
+    df->Write(stats.cells, "Cells Executed");
+    df->Write(stats.mean_slices, "Mean Slices per Cell");
+    df->Write(stats.var_slices, "Variance of Slices per Cell");
+    df->Write(stats.max_slices, "Max Slices per Cell");
+    df->Write(stats.fairness, "Fairness (Jain's index of slices per merit)");
+    df->Endl();
+  }
+};
+
+/*
+ Prints the work done by the merit tree scheduler since the previous print: slices drawn, merit changes applied and
+ the tree nodes each of them touched, and how many batched changes were summed at once.  Requires SLICING_METHOD 6.
+*/
+class cActionPrintMeritSchedule : public cAction
+{
+private:
+  cString m_filename;
+  cMeritSchedule::sStats m_prev;
+  
+public:
+  cActionPrintMeritSchedule(cWorld* world, const cString& args, Feedback&) : cAction(world, args)
+  {
+    cString largs(args);
+    m_filename = (largs.GetSize()) ? largs.PopWord() : "merit_schedule.dat";
+  }
+  static const cString GetDescription() { return "Arguments: [string fname=\"merit_schedule.dat\"]"; }
+  void Process(cAvidaContext& ctx)
+  {
+    const cMeritSchedule* schedule = m_world->GetPopulation().GetMeritSchedule();
+    if (!schedule) {
+      ctx.Driver().Feedback().Warning("PrintMeritSchedule requires SLICING_METHOD 6");
+      return;
+    }
+    const cMeritSchedule::sStats& stats = schedule->GetStats();
+    const long long draws = stats.draws - m_prev.draws;
+    const long long adjustments = stats.adjustments - m_prev.adjustments;
+    Avida::Output::FilePtr df = Avida::Output::File::StaticWithPath(m_world->GetNewWorld(), (const char*)m_filename);
+    
+    df->WriteComment("Avida merit tree scheduler");
+    df->WriteComment("Totals since the previous line");
+    df->WriteTimeStamp();
+    
+    df->Write(m_world->GetStats().GetUpdate(), "Update");
+    df->Write((long)draws, "Draws");
+    df->Write((draws > 0) ? (double)(stats.draw_nodes - m_prev.draw_nodes) / draws : 0.0, "Nodes per Draw");
+    df->Write((long)adjustments, "Merit Changes");
+    df->Write((adjustments > 0) ? (double)(stats.adjust_nodes - m_prev.adjust_nodes) / adjustments : 0.0, "Nodes per Merit Change");
+    df->Write((long)(stats.batches - m_prev.batches), "Batches");
+    df->Write((long)(stats.rebuilds - m_prev.rebuilds), "Batches Rebuilt");
+    df->Endl();
+    
+    m_prev = stats;
+  }
+};
+
+/*
+ Prints a table of instruction implementations ranked by their estimated share of execution cost, accumulated since
+ the previous print (or since profiling was enabled).  Each print writes a separate file, suffixed with the update.
+ Profiling is enabled for all instruction sets when this action is loaded; roughly one in every 'sample_interval'
+ executions is timed.
+
+ Parameters:
+   filename (string) default: inst_profile
+     The base name of the files to write
+   sample_interval (int) default: 16
+     Mean number of executions between timing samples
+   reset (int) default: 1
+     Clear the accumulated counts after each print
+*/
+class cActionPrintInstProfile : public cAction
+{
+private:
+  cString m_filename;
+  int m_sample_interval;
+  bool m_reset;
+  
+  struct sProfileRow
+  {
+    const cInstSet* inst_set;
+    int lib_idx;
+    cInstProfiler::Entry entry;
+  };
+  static bool compareRows(const sProfileRow& a, const sProfileRow& b)
+  {
+    return a.entry.EstimatedCycles() > b.entry.EstimatedCycles();
+  }
+  
+public:
+  cActionPrintInstProfile(cWorld* world, const cString& args, Feedback&) : cAction(world, args)
+  {
+    cString largs(args);
+    m_filename = (largs.GetSize()) ? largs.PopWord() : "inst_profile";
+    m_sample_interval = (largs.GetSize()) ? largs.PopWord().AsInt() : 16;
+    m_reset = (largs.GetSize()) ? (largs.PopWord().AsInt() != 0) : true;
+    m_world->GetHardwareManager().EnableInstProfiling(m_sample_interval);
+  }
+  static const cString GetDescription() { return "Arguments: [string filename='inst_profile'] [int sample_interval=16] [int reset=1]"; }
+  void Process(cAvidaContext&)
+  {
+    cHardwareManager& hw_mgr = m_world->GetHardwareManager();
+    
+    std::vector<sProfileRow> rows;
+    double total_cycles = 0.0;
+    for (int is = 0; is < hw_mgr.GetNumInstSets(); is++) {
+      const cInstSet& inst_set = hw_mgr.GetInstSet(is);
+      cInstProfiler* profiler = inst_set.GetProfiler();
+      if (!profiler) continue;
+      for (int i = 0; i < profiler->GetSize(); i++) {
+        if (profiler->Get(i).executions == 0) continue;
+        sProfileRow row;
+        row.inst_set = &inst_set;
+        row.lib_idx = i;
+        row.entry = profiler->Get(i);
+        rows.push_back(row);
+        total_cycles += row.entry.EstimatedCycles();
+      }
+      if (m_reset) profiler->Reset();
+    }
+    std::sort(rows.begin(), rows.end(), compareRows);
+    
+    cString filename = m_filename + "-" + cStringUtil::Convert(m_world->GetStats().GetUpdate()) + ".dat";
+    Avida::Output::FilePtr df = Avida::Output::File::CreateWithPath(m_world->GetNewWorld(), (const char*)filename);
+    df->WriteComment("Avida instruction profile");
+    df->WriteComment(cStringUtil::Stringf("Approximately 1 in %d executions sampled; costs are in %s", m_sample_interval,
+                                          (cHighResTimer::CyclesAreTicks()) ? "time stamp counter ticks" : "nanoseconds"));
+    df->WriteTimeStamp();
+    
+    for (unsigned int r = 0; r < rows.size(); r++) {
+      const sProfileRow& row = rows[r];
+      const double est_cycles = row.entry.EstimatedCycles();
+      df->Write((int)(r + 1), "Rank");
+      df->Write((const char*)row.inst_set->GetInstSetName(), "Instruction Set");
+      df->Write((const char*)row.inst_set->GetInstLib()->GetName(row.lib_idx), "Instruction");
+      df->Write((double)row.entry.executions, "Executions", "%.0f");
+      df->Write((double)row.entry.samples, "Sampled Executions", "%.0f");
+      df->Write(row.entry.MeanCycles(), "Mean Cost per Execution");
+      df->Write((double)row.entry.max_cycles, "Max Sampled Cost", "%.0f");
+      df->Write(est_cycles, "Estimated Total Cost", "%.0f");
+      df->Write((total_cycles > 0.0) ? (100.0 * est_cycles / total_cycles) : 0.0, "Percent of Total Cost");
+      df->Endl();
+    }
+  }
+};
+
 class cActionPrintResourceData : public cAction
 {
 private:
@@ -413,6 +654,7 @@ private:
   cString m_filename;
   Apto::String m_inst_set;
   Data::DataID m_data_id;
+  Data::DataHandle m_data_handle;
   Data::PackagePtr m_data;
   
 public:
@@ -434,6 +676,7 @@ public:
     Data::RecorderPtr thisPtr(this);
     this->AddReference();
     m_world->GetDataManager()->AttachRecorder(thisPtr);
+    m_data_handle = m_world->GetDataManager()->ResolveHandle(m_data_id);
   }
   
   static const cString GetDescription() { return "Arguments: [string fname=\"instruction-${inst_set}.dat\"] [string inst_set]"; }
@@ -448,7 +691,7 @@ public:
   
   void NotifyData(Update, Data::DataRetrievalFunctor retrieve_data)
   {
-    m_data = retrieve_data(m_data_id);
+    m_data = (m_data_handle >= 0) ? m_world->GetDataManager()->GetSnapshotValue(m_data_handle) : retrieve_data(m_data_id);
   }
   
   void Process(cAvidaContext&)
@@ -477,6 +720,7 @@ private:
   cString m_filename;
   Apto::String m_inst_set;
   Data::DataID m_data_id;
+  Data::DataHandle m_data_handle;
   Data::PackagePtr m_data;
   
 public:
@@ -498,6 +742,7 @@ public:
     Data::RecorderPtr thisPtr(this);
     this->AddReference();
     m_world->GetDataManager()->AttachRecorder(thisPtr);
+    m_data_handle = m_world->GetDataManager()->ResolveHandle(m_data_id);
   }
   
   static const cString GetDescription() { return "Arguments: [string fname=\"from_msg_instruction-${inst_set}.dat\"] [string inst_set]"; }
@@ -512,7 +757,7 @@ public:
   
   void NotifyData(Update, Data::DataRetrievalFunctor retrieve_data)
   {
-    m_data = retrieve_data(m_data_id);
+    m_data = (m_data_handle >= 0) ? m_world->GetDataManager()->GetSnapshotValue(m_data_handle) : retrieve_data(m_data_id);
   }
   
   void Process(cAvidaContext&)
@@ -536,6 +781,57 @@ public:
 };
 
 
+class cActionRecordDataSeries : public cAction
+{
+private:
+  Data::RecorderPtr m_recorder;
+  bool m_attached;
+  
+public:
+  cActionRecordDataSeries(cWorld* world, const cString& args, Feedback& feedback)
+  : cAction(world, args), m_attached(false)
+  {
+    cString largs(args);
+    largs.Trim();
+    cString filename = (largs.GetSize()) ? largs.PopWord() : cString("data_series.avts");
+    int interval = (largs.GetSize()) ? largs.PopWord().AsInt() : 1;
+    
+    Avida::Output::SeriesFilePtr file = Avida::Output::SeriesFile::CreateWithPath(m_world->GetNewWorld(), (const char*)filename, &feedback);
+    if (!file) return;
+    
+    Data::SeriesRecorder* recorder = new Data::SeriesRecorder(file, interval);
+    m_recorder = Data::RecorderPtr(recorder);
+    while (largs.GetSize()) {
+      cString data_id = largs.PopWord();
+      Avida::Output::SeriesColumnType type = Avida::Output::SERIES_DOUBLE;
+      if (data_id.IsSubstring("int:", 0)) {
+        data_id.ClipFront(4);
+        type = Avida::Output::SERIES_INT;
+      }
+      if (!m_world->GetDataManager()->IsAvailable((const char*)data_id)) {
+        feedback.Warning("RecordDataSeries: data id '%s' is not available", (const char*)data_id);
+        continue;
+      }
+      recorder->AddValue((const char*)data_id, type);
+    }
+  }
+  
+  static const cString GetDescription()
+  {
+    return "Arguments: [string fname=\"data_series.avts\"] [int interval=1] [string data_id ...]\n"
+           "  Records the given data values into a binary series file, one row per interval updates.  Values are\n"
+           "  stored as doubles, unless the data id is prefixed with 'int:'.";
+  }
+  
+  void Process(cAvidaContext&)
+  {
+    if (m_attached || !m_recorder) return;
+    m_world->GetDataManager()->AttachRecorder(m_recorder);
+    m_attached = true;
+  }
+};
+
+
 class cActionPrintPreyInstructionData : public cAction
 {
 private:
@@ -1133,13 +1429,13 @@ public:
     const double generation = m_world->GetStats().SumGeneration().Average();
     
     //only loop through living organisms
-    const Apto::Array<cOrganism*, Apto::Smart>& living_orgs = m_world->GetPopulation().GetLiveOrgList();
+    const cPopulationSnapshot& snapshot = m_world->GetPopulation().GetSnapshot();
     
     Apto::Map<int, int> lineage_label_counts;
     
     //build hash of lineage_label -> count
-    for(int i = 0; i < living_orgs.GetSize(); i++) {
-      const int cur_lineage_label = living_orgs[i]->GetLineageLabel();
+    for(int i = 0; i < snapshot.GetNumOrgs(); i++) {
+      const int cur_lineage_label = snapshot.GetLineageLabel(i);
       if (lineage_label_counts.Has(cur_lineage_label)) lineage_label_counts[cur_lineage_label]++;
       else lineage_label_counts[cur_lineage_label] = 1;
     }
@@ -1202,9 +1498,8 @@ public:
     if (bg) {
       cString filename(m_filename);
       if (filename == "") filename.Set("archive/%s.org", (const char*)bg->Properties().Get("name").StringValue());
-      cTestCPU* testcpu = m_world->GetHardwareManager().CreateTestCPU(ctx);
-      testcpu->PrintGenome(ctx, Genome(bg->Properties().Get("genome")), filename, m_world->GetStats().GetUpdate());
-      delete testcpu;
+      cTestCPULease testcpu(ctx, m_world->GetHardwareManager());
+      testcpu->PrintGenome(ctx, Genome(*bg->RepresentativeGenome()), filename, m_world->GetStats().GetUpdate());
     }
   }
 };
@@ -1266,9 +1561,8 @@ public:
         // need a random number generator to pass to testcpu that does not affect any other random number pulls (since this is just for printing the genome)
         Apto::RNG::AvidaRNG rng(0);
         cAvidaContext ctx2(&m_world->GetDriver(), rng);
-        cTestCPU* testcpu = m_world->GetHardwareManager().CreateTestCPU(ctx2);
-        testcpu->PrintGenome(ctx2, Genome(bg->Properties().Get("genome")), filename, m_world->GetStats().GetUpdate(), true, last_birth_cell, last_birth_group_id, last_birth_forager_type);
-        delete testcpu;
+        cTestCPULease testcpu(ctx2, m_world->GetHardwareManager());
+        testcpu->PrintGenome(ctx2, Genome(*bg->RepresentativeGenome()), filename, m_world->GetStats().GetUpdate(), true, last_birth_cell, last_birth_group_id, last_birth_forager_type);
       }
     }
   }
@@ -1331,9 +1625,8 @@ public:
         // need a random number generator to pass to testcpu that does not affect any other random number pulls (since this is just for printing the genome)
         Apto::RNG::AvidaRNG rng(0);
         cAvidaContext ctx2(&m_world->GetDriver(), rng);
-        cTestCPU* testcpu = m_world->GetHardwareManager().CreateTestCPU(ctx2);
-        testcpu->PrintGenome(ctx2, Genome(bg->Properties().Get("genome")), filename, m_world->GetStats().GetUpdate(), true, last_birth_cell, last_birth_group_id, last_birth_forager_type);
-        delete testcpu;
+        cTestCPULease testcpu(ctx2, m_world->GetHardwareManager());
+        testcpu->PrintGenome(ctx2, Genome(*bg->RepresentativeGenome()), filename, m_world->GetStats().GetUpdate(), true, last_birth_cell, last_birth_group_id, last_birth_forager_type);
       }
     }
   }
@@ -1415,16 +1708,16 @@ public:
     double max_fitness = -1; // we set this to -1, so that even 0 is larger...
     Systematics::GroupPtr max_f_genotype;
     
-    cTestCPU* testcpu = m_world->GetHardwareManager().CreateTestCPU(ctx);
+    cTestCPULease testcpu(ctx, m_world->GetHardwareManager());
     
     for (int i = 0; i < pop.GetSize(); i++) {
       if (pop.GetCell(i).IsOccupied() == false) continue;  // One use organisms.
       
       cOrganism* organism = pop.GetCell(i).GetOrganism();
-      Systematics::GroupPtr genotype = organism->SystematicsGroup("genotype");
+      Systematics::GroupPtr genotype = organism->SystematicsGroup(Systematics::ROLE_GENOTYPE);
       
       cCPUTestInfo test_info;
-      testcpu->TestGenome(ctx, test_info, Genome(genotype->Properties().Get("genome")));
+      testcpu->TestGenome(ctx, test_info, Genome(*genotype->RepresentativeGenome()));
       // We calculate the fitness based on the current merit,
       // but with the true gestation time. Also, we set the fitness
       // to zero if the creature is not viable.
@@ -1463,7 +1756,7 @@ public:
       max_f_name = max_f_genotype->Properties().Get("name").StringValue();
     else {
       // we put the current update into the name, so that it becomes unique.
-      Genome gen(max_f_genotype->Properties().Get("genome"));
+      Genome gen(*max_f_genotype->RepresentativeGenome());
       InstructionSequencePtr seq;
       seq.DynamicCastFrom(gen.Representation());
       max_f_name.Set("%03d-no_name-u%i", seq->GetSize(), update);
@@ -1482,10 +1775,9 @@ public:
     if (m_save_max) {
       cString filename;
       filename.Set("archive/%s", static_cast<const char*>(max_f_name));
-      testcpu->PrintGenome(ctx, Genome(max_f_genotype->Properties().Get("genome")), filename);
+      testcpu->PrintGenome(ctx, Genome(*max_f_genotype->RepresentativeGenome()), filename);
     }
     
-    delete testcpu;
     
     if (m_print_fitness_histo) {
       Avida::Output::FilePtr hdf = Avida::Output::File::StaticWithPath(m_world->GetNewWorld(), (const char*)m_filenames[1]);
@@ -1561,15 +1853,13 @@ public:
     Apto::Map<int, int> cclade_count;  //A count for each clade in the population
     set<int>             clade_ids;
     
-    cPopulation& pop = m_world->GetPopulation();
+    const cPopulationSnapshot& snapshot = m_world->GetPopulation().GetSnapshot();
     const int update = m_world->GetStats().GetUpdate();
     
     //For each organism in the population, find what coalescence clade it belongs to and count
-    for (int k = 0; k < pop.GetSize(); k++)
+    for (int k = 0; k < snapshot.GetNumOrgs(); k++)
     {
-      if (!pop.GetCell(k).IsOccupied())
-        continue;
-      int cclade_id = pop.GetCell(k).GetOrganism()->GetCCladeLabel();
+      int cclade_id = snapshot.GetCCladeLabel(k);
       int count = 0;
       if (!cclade_count.Get(cclade_id, count))
         clade_ids.insert(cclade_id);
@@ -1689,7 +1979,7 @@ public:
     int num_bins = static_cast<int>(ceil( (max - min) / step)) + 3;
     max  = min + (num_bins - 3) * step;
     histogram.Resize(num_bins, 0);
-    cTestCPU* testcpu = world->GetHardwareManager().CreateTestCPU(ctx);
+    cTestCPULease testcpu(ctx, world->GetHardwareManager());
     
     
     // We calculate the fitness based on the current merit,
@@ -1700,7 +1990,7 @@ public:
       double fitness = 0.0;
       if (mode == "TEST_CPU" || mode == "ACTUAL"){
         test_info.UseManualInputs(orgs[i]->GetOrgInterface().GetInputs());
-        testcpu->TestGenome(ctx, test_info, Genome(gens[i]->Properties().Get("genome")));
+        testcpu->TestGenome(ctx, test_info, Genome(*gens[i]->RepresentativeGenome()));
       }
       
       if (mode == "TEST_CPU"){
@@ -1737,7 +2027,6 @@ public:
       
       histogram[update_bin]++;
     }
-    delete testcpu;
     return histogram;
   }
   
@@ -1765,7 +2054,7 @@ public:
     {
       if (pop.GetCell(i).IsOccupied() == false) continue;  //Skip unoccupied cells
       cOrganism* organism = pop.GetCell(i).GetOrganism();
-      Systematics::GroupPtr genotype = organism->SystematicsGroup("genotype");
+      Systematics::GroupPtr genotype = organism->SystematicsGroup(Systematics::ROLE_GENOTYPE);
       orgs.Push(organism);
       gens.Push(genotype);
     }
@@ -1864,7 +2153,7 @@ public:
     int num_bins = static_cast<int>(ceil( (max - min) / step)) + 3;
     max  = min + (num_bins - 3) * step;
     histogram.Resize(num_bins, 0);
-    cTestCPU* testcpu = world->GetHardwareManager().CreateTestCPU(ctx);
+    cTestCPULease testcpu(ctx, world->GetHardwareManager());
     
     
     // We calculate the fitness based on the current merit,
@@ -1883,7 +2172,7 @@ public:
       
       if (mode == "TEST_CPU" || mode == "ACTUAL"){
         test_info.UseManualInputs( orgs[i]->GetOrgInterface().GetInputs() );
-        testcpu->TestGenome(ctx, test_info, Genome(gens[i]->Properties().Get("genome")));
+        testcpu->TestGenome(ctx, test_info, Genome(*gens[i]->RepresentativeGenome()));
       }
       
       if (mode == "TEST_CPU"){
@@ -1920,7 +2209,6 @@ public:
       
       histogram[update_bin]++;
     }
-    delete testcpu;
     return histogram;
   }
   
@@ -1945,7 +2233,7 @@ public:
     {
       if (pop.GetCell(i).IsOccupied() == false) continue;  //Skip unoccupied cells
       cOrganism* organism = pop.GetCell(i).GetOrganism();
-      Systematics::GroupPtr genotype = organism->SystematicsGroup("genotype");
+      Systematics::GroupPtr genotype = organism->SystematicsGroup(Systematics::ROLE_GENOTYPE);
       orgs.Push(organism);
       gens.Push(genotype);
     }
@@ -2041,7 +2329,7 @@ public:
     for (int i = 0; i < pop.GetSize(); i++){
       if (pop.GetCell(i).IsOccupied() == false) continue;  //Skip unoccupied cells
       cOrganism* organism = pop.GetCell(i).GetOrganism();
-      Systematics::GroupPtr genotype = organism->SystematicsGroup("genotype");
+      Systematics::GroupPtr genotype = organism->SystematicsGroup(Systematics::ROLE_GENOTYPE);
       int cladeID = organism->GetCCladeLabel();
       
       map< int, Apto::Array<cOrganism*> >::iterator oit = org_map.find(cladeID);
@@ -2170,7 +2458,7 @@ public:
     for (int i = 0; i < pop.GetSize(); i++) {
       if (pop.GetCell(i).IsOccupied() == false) continue;  //Skip unoccupied cells
       cOrganism* organism = pop.GetCell(i).GetOrganism();
-      Systematics::GroupPtr genotype = organism->SystematicsGroup("genotype");
+      Systematics::GroupPtr genotype = organism->SystematicsGroup(Systematics::ROLE_GENOTYPE);
       int cladeID = organism->GetCCladeLabel();
       
       map< int, Apto::Array<cOrganism*> >::iterator oit = org_map.find(cladeID);
@@ -2438,7 +2726,7 @@ public:
       Systematics::Arbiter::IteratorPtr it = classmgr->ArbiterForRole("genotype")->Begin();
       while (it->Next()) {
         Systematics::GroupPtr bg = it->Get();
-        Apto::SmartPtr<cPhenPlastGenotype> ppgen(new cPhenPlastGenotype(Genome(bg->Properties().Get("genome")), m_num_trials, test_info, m_world, ctx));
+        Apto::SmartPtr<cPhenPlastGenotype> ppgen(new cPhenPlastGenotype(Genome(*bg->RepresentativeGenome()), m_num_trials, test_info, m_world, ctx));
         PrintPPG(fot, ppgen, bg->ID(), (const char*)bg->Properties().Get("parents").StringValue());
       }
     }
@@ -2733,7 +3021,7 @@ public:
     Systematics::ManagerPtr classmgr = Systematics::Manager::Of(m_world->GetNewWorld());
     Systematics::Arbiter::IteratorPtr it = classmgr->ArbiterForRole("genotype")->Begin();
     it->Next();
-    Genome best_genome(it->Get()->Properties().Get("genome"));
+    Genome best_genome(*it->Get()->RepresentativeGenome());
     InstructionSequencePtr best_seq;
     best_seq.DynamicCastFrom(best_genome.Representation());
     dom_dist = InstructionSequence::FindHammingDistance(*m_r_seq, *best_seq);
@@ -2742,7 +3030,7 @@ public:
     count += it->Get()->NumUnits();
     // now cycle over the remaining genotypes
     while ((it->Next())) {
-      Genome cur_gen(it->Get()->Properties().Get("genome"));
+      Genome cur_gen(*it->Get()->RepresentativeGenome());
       InstructionSequencePtr cur_seq;
       cur_seq.DynamicCastFrom(cur_gen.Representation());
       int dist = InstructionSequence::FindHammingDistance(*m_r_seq, *cur_seq);
@@ -2820,7 +3108,7 @@ public:
     Systematics::Arbiter::IteratorPtr it = classmgr->ArbiterForRole("genotype")->Begin();
     while ((it->Next())) {
       Systematics::GroupPtr bg = it->Get();
-      const Genome genome(bg->Properties().Get("genome"));
+      const Genome genome(*bg->RepresentativeGenome());
       ConstInstructionSequencePtr seq;
       seq.DynamicCastFrom(genome.Representation());
       const int num_orgs = bg->NumUnits();
@@ -2839,9 +3127,8 @@ public:
       
       // save into archive
       if (m_save_genotypes) {
-        cTestCPU* testcpu = m_world->GetHardwareManager().CreateTestCPU(ctx);
+        cTestCPULease testcpu(ctx, m_world->GetHardwareManager());
         testcpu->PrintGenome(ctx, genome, cStringUtil::Stringf("archive/%s.org", (const char*)(bg->Properties().Get("name").StringValue())));
-        delete testcpu;
       }
       
       df->Endl();
@@ -2869,14 +3156,13 @@ public:
     Systematics::ManagerPtr classmgr = Systematics::Manager::Of(m_world->GetNewWorld());
     Systematics::Arbiter::IteratorPtr it = classmgr->ArbiterForRole("genotype")->Begin();
     Systematics::GroupPtr bg = it->Next();
-    Genome genome(bg->Properties().Get("genome"));
+    Genome genome(*bg->RepresentativeGenome());
     InstructionSequencePtr seq;
     seq.DynamicCastFrom(genome.Representation());
     
-    cTestCPU* testcpu = m_world->GetHardwareManager().CreateTestCPU(ctx);
+    cTestCPULease testcpu(ctx, m_world->GetHardwareManager());
     cCPUTestInfo test_info;
     testcpu->TestGenome(ctx, test_info, genome);
-    delete testcpu;
     
     cPhenotype& colony_phenotype = test_info.GetColonyOrganism()->GetPhenotype();
     
@@ -2913,7 +3199,7 @@ public:
     Avida::Output::FilePtr df = Avida::Output::File::CreateWithPath(m_world->GetNewWorld(), (const char*)m_filename);
     
     cPopulation& pop = m_world->GetPopulation();
-    cTestCPU* testcpu = m_world->GetHardwareManager().CreateTestCPU(ctx);
+    cTestCPULease testcpu(ctx, m_world->GetHardwareManager());
     
     for (int i = 0; i < pop.GetSize(); i++) {
       if (pop.GetCell(i).IsOccupied() == false) continue;
@@ -2959,11 +3245,10 @@ public:
       df->Write(parent_sum_tasks_rewarded, "Parent Number of Tasks Rewared");
       df->Write(parent_sum_tasks_all, "Parent Total Number of Tasks Done");
       df->Write(test_info.GetColonyFitness(), "Genotype Fitness");
-      df->Write(organism->SystematicsGroup("genotype")->ID(), "Genotype ID");
+      df->Write(organism->SystematicsGroup(Systematics::ROLE_GENOTYPE)->ID(), "Genotype ID");
       df->Endl();
     }
     
-    delete testcpu;
   }
 };
 
@@ -2982,19 +3267,12 @@ public:
   void Process(cAvidaContext&)
   {
     Avida::Output::FilePtr df = Avida::Output::File::StaticWithPath(m_world->GetNewWorld(), (const char*)m_filename);
-    cPopulation& pop = m_world->GetPopulation();
+    const cPopulationSnapshot& snapshot = m_world->GetPopulation().GetSnapshot();
     
     int ave_tot_tasks = 0;
     int num_task_orgs = 0;
-    for (int i = 0; i < pop.GetSize(); i++) {
-      if (pop.GetCell(i).IsOccupied() == false) continue;
-      
-      cPhenotype& phenotype = pop.GetCell(i).GetOrganism()->GetPhenotype();
-      int num_tasks = m_world->GetEnvironment().GetNumTasks();
-      
-      int sum_tasks = 0;
-      for (int j = 0; j < num_tasks; j++)
-        sum_tasks += ( phenotype.GetLastTaskCount()[j] == 0 ) ? 0 : 1;
+    for (int i = 0; i < snapshot.GetNumOrgs(); i++) {
+      const int sum_tasks = snapshot.GetNumLastTasks(i);
       if (sum_tasks>0) {
         ave_tot_tasks += sum_tasks;
         num_task_orgs++;
@@ -3095,7 +3373,7 @@ public:
     while ((it->Next())) {
       Systematics::GroupPtr bg = it->Get();
       const int num_organisms = bg->NumUnits();
-      const Genome genome(bg->Properties().Get("genome"));
+      const Genome genome(*bg->RepresentativeGenome());
       ConstInstructionSequencePtr seq;
       seq.DynamicCastFrom(genome.Representation());
       const int length = seq->GetSize();
@@ -3167,7 +3445,7 @@ public:
     cDoubleSum distance_sum;
     while ((it->Next())) {
       const int num_organisms = it->Get()->NumUnits();
-      Genome cur_gen(it->Get()->Properties().Get("genome"));
+      Genome cur_gen(*it->Get()->RepresentativeGenome());
       InstructionSequencePtr cur_seq;
       cur_seq.DynamicCastFrom(cur_gen.Representation());
       const int cur_dist = InstructionSequence::FindEditDistance(con_genome, *cur_seq);
@@ -3179,7 +3457,7 @@ public:
     //    cGenotype* con_genotype = classmgr.FindGenotype(con_genome, -1);
     
     it = classmgr->ArbiterForRole("genotype")->Begin();
-    Genome best_genome(it->Next()->Properties().Get("genome"));
+    Genome best_genome(*it->Next()->RepresentativeGenome());
     InstructionSequencePtr best_seq;
     best_seq.DynamicCastFrom(best_genome.Representation());
     const int best_dist = InstructionSequence::FindEditDistance(con_genome, *best_seq);
@@ -3190,13 +3468,12 @@ public:
     
     cString con_name;
     con_name.Set("archive/%03d-consensus-u%i.gen", con_genome.GetSize(),update);
-    cTestCPU* testcpu = m_world->GetHardwareManager().CreateTestCPU(ctx);
+    cTestCPULease testcpu(ctx, m_world->GetHardwareManager());
     testcpu->PrintGenome(ctx, mg, con_name);
     
     
     cCPUTestInfo test_info;
     testcpu->TestGenome(ctx, test_info, mg);
-    delete testcpu;
     
     cPhenotype& colony_phenotype = test_info.GetColonyOrganism()->GetPhenotype();
     
@@ -3223,7 +3500,6 @@ public:
     df->Endl();
     //    }
     
-    delete testcpu;
   }
 };
 
@@ -3432,11 +3708,12 @@ public:
     if (filename == "") filename.Set("grid_fitness-%d.dat", m_world->GetStats().GetUpdate());
     Avida::Output::FilePtr df = Avida::Output::File::CreateWithPath(m_world->GetNewWorld(), (const char*)filename);
     ofstream& fp = df->OFStream();
+    const cPopulationSnapshot& snapshot = m_world->GetPopulation().GetSnapshot();
     
     for (int j = 0; j < m_world->GetPopulation().GetWorldY(); j++) {
       for (int i = 0; i < m_world->GetPopulation().GetWorldX(); i++) {
-        cPopulationCell& cell = m_world->GetPopulation().GetCell(j * m_world->GetPopulation().GetWorldX() + i);
-        double fitness = (cell.IsOccupied()) ? cell.GetOrganism()->GetPhenotype().GetFitness() : 0.0;
+        const int row = snapshot.GetRow(j * m_world->GetPopulation().GetWorldX() + i);
+        double fitness = (row >= 0) ? snapshot.GetFitness(row) : 0.0;
         fp << fitness << " ";
       }
       fp << endl;
@@ -3467,10 +3744,19 @@ public:
     Avida::Output::FilePtr df = Avida::Output::File::CreateWithPath(m_world->GetNewWorld(), (const char*)filename);
     ofstream& fp = df->OFStream();
     
+    // Genotype ids are already collected in the population snapshot, other roles are looked up per organism
+    const cPopulationSnapshot* snapshot = (m_role == "genotype") ? &m_world->GetPopulation().GetSnapshot() : NULL;
+    
     for (int j = 0; j < m_world->GetPopulation().GetWorldY(); j++) {
       for (int i = 0; i < m_world->GetPopulation().GetWorldX(); i++) {
         cPopulationCell& cell = m_world->GetPopulation().GetCell(j * m_world->GetPopulation().GetWorldX() + i);
-        int id = (cell.IsOccupied() && cell.GetOrganism()->SystematicsGroup((const char*)m_role)) ? cell.GetOrganism()->SystematicsGroup((const char*)m_role)->ID() : -1;
+        int id = -1;
+        if (snapshot) {
+          const int row = snapshot->GetRow(cell.GetID());
+          if (row >= 0) id = snapshot->GetGenotypeID(row);
+        } else if (cell.IsOccupied() && cell.GetOrganism()->SystematicsGroup((const char*)m_role)) {
+          id = cell.GetOrganism()->SystematicsGroup((const char*)m_role)->ID();
+        }
         fp << id << " ";
       }
       fp << endl;
@@ -3530,7 +3816,7 @@ public:
     for (int j = 0; j < m_world->GetPopulation().GetWorldY(); j++) {
       for (int i = 0; i < m_world->GetPopulation().GetWorldX(); i++) {
         cPopulationCell& cell = m_world->GetPopulation().GetCell(j * m_world->GetPopulation().GetWorldX() + i);
-        Systematics::GroupPtr bg = (cell.IsOccupied()) ? cell.GetOrganism()->SystematicsGroup("genotype") : Systematics::GroupPtr(NULL);
+        Systematics::GroupPtr bg = (cell.IsOccupied()) ? cell.GetOrganism()->SystematicsGroup(Systematics::ROLE_GENOTYPE) : Systematics::GroupPtr(NULL);
         if (bg) {
           int color = 0;
           for (; color < m_num_colors; color++) if (m_genotype_chart[color] == bg->ID()) break;
@@ -3616,11 +3902,12 @@ public:
     if (filename == "") filename.Set("id_grid.%d.dat", m_world->GetStats().GetUpdate());
     Avida::Output::FilePtr df = Avida::Output::File::CreateWithPath(m_world->GetNewWorld(), (const char*)filename);
     ofstream& fp = df->OFStream();
+    const cPopulationSnapshot& snapshot = m_world->GetPopulation().GetSnapshot();
     
     for (int j = 0; j < m_world->GetPopulation().GetWorldY(); j++) {
       for (int i = 0; i < m_world->GetPopulation().GetWorldX(); i++) {
-        cPopulationCell& cell = m_world->GetPopulation().GetCell(j * m_world->GetPopulation().GetWorldX() + i);
-        int id = (cell.IsOccupied()) ? cell.GetOrganism()->GetID() : -1;
+        const int row = snapshot.GetRow(j * m_world->GetPopulation().GetWorldX() + i);
+        int id = (row >= 0) ? snapshot.GetOrgID(row) : -1;
         fp << id << " ";
       }
       fp << endl;
@@ -3698,12 +3985,13 @@ public:
       if (filename == "") filename.Set("grid_dumps/target_grid.%d.dat", m_world->GetStats().GetUpdate());
       Avida::Output::FilePtr df = Avida::Output::File::CreateWithPath(m_world->GetNewWorld(), (const char*)filename);
       ofstream& fp = df->OFStream();
+      const cPopulationSnapshot& snapshot = m_world->GetPopulation().GetSnapshot();
       
       for (int j = 0; j < m_world->GetPopulation().GetWorldY(); j++) {
         for (int i = 0; i < worldx; i++) {
-          cPopulationCell& cell = m_world->GetPopulation().GetCell(j * worldx + i);
+          const int row = snapshot.GetRow(j * worldx + i);
           int target = -99;
-          if (cell.IsOccupied()) target = cell.GetOrganism()->GetForageTarget();
+          if (row >= 0) target = snapshot.GetForageTarget(row);
           fp << target << " ";
         }
         fp << endl;
@@ -3854,7 +4142,7 @@ public:
     ofstream& fp = df->OFStream();
     
     cPopulation* pop = &m_world->GetPopulation();
-    cTestCPU* testcpu = m_world->GetHardwareManager().CreateTestCPU(ctx);
+    cTestCPULease testcpu(ctx, m_world->GetHardwareManager());
     
     const int num_tasks = m_world->GetEnvironment().GetNumTasks();
     
@@ -3877,7 +4165,6 @@ public:
       fp << endl;
     }
     
-    delete testcpu;
   }
 };
 
@@ -4500,7 +4787,7 @@ public:
         if (pop->GetCell(cell_num).IsOccupied() == true)
         {
           cOrganism* organism = pop->GetCell(cell_num).GetOrganism();
-          Genome host_genome(organism->Properties().Get("genome"));
+          const Genome& host_genome = organism->GetGenome();
           ConstInstructionSequencePtr seq;
           seq.DynamicCastFrom(host_genome.Representation());
           genome_seq = seq->AsString();
@@ -4682,12 +4969,11 @@ public:
     
     fp << "# org_id,age,num_divides" << endl;
     
-    const Apto::Array <cOrganism*, Apto::Smart> live_orgs = m_world->GetPopulation().GetLiveOrgList();
-    for (int i = 0; i < live_orgs.GetSize(); i++) {  
-      cOrganism* org = live_orgs[i];
-      const int id = org->GetID();
-      const int age = org->GetPhenotype().GetAge();
-      const int num_divs = org->GetPhenotype().GetNumDivides();
+    const cPopulationSnapshot& snapshot = m_world->GetPopulation().GetSnapshot();
+    for (int i = 0; i < snapshot.GetNumOrgs(); i++) {
+      const int id = snapshot.GetOrgID(i);
+      const int age = snapshot.GetAge(i);
+      const int num_divs = snapshot.GetNumDivides(i);
       
       fp << id << "," << age << "," << num_divs;
       fp << endl;
@@ -4721,17 +5007,18 @@ public:
     
     const int worldx = m_world->GetConfig().WORLD_X.Get();
     
+    // Snapshot rows follow the live organism list, which still supplies the facing and avatar values
     const Apto::Array <cOrganism*, Apto::Smart> live_orgs = m_world->GetPopulation().GetLiveOrgList();
-    for (int i = 0; i < live_orgs.GetSize(); i++) {  
+    const cPopulationSnapshot& snapshot = m_world->GetPopulation().GetSnapshot();
+    for (int i = 0; i < snapshot.GetNumOrgs(); i++) {
       cOrganism* org = live_orgs[i];
-      const int id = org->GetID();
-      const int loc = org->GetCellID();
+      const int id = snapshot.GetOrgID(i);
+      const int loc = snapshot.GetCellID(i);
       const int locx = loc % worldx;
       const int locy = loc / worldx;
-      const int ft = org->GetForageTarget();
+      const int ft = snapshot.GetForageTarget(i);
       const int faced_dir = org->GetFacedDir();
-      int opinion = -1;
-      if (org->HasOpinion()) opinion = org->GetOpinion().first;
+      const int opinion = snapshot.GetGroup(i);
       
       fp << id << "," << locx << "," << locy << "," << ft << "," <<  opinion << "," <<  faced_dir;
       if (use_av) {
@@ -4837,17 +5124,18 @@ public:
     
     const int worldx = m_world->GetConfig().WORLD_X.Get();
     
+    // Snapshot rows follow the live organism list, which still supplies the facing, avatar and guard values
     const Apto::Array<cOrganism*, Apto::Smart> live_orgs = m_world->GetPopulation().GetLiveOrgList();
-    for (int i = 0; i < live_orgs.GetSize(); i++) {
+    const cPopulationSnapshot& snapshot = m_world->GetPopulation().GetSnapshot();
+    for (int i = 0; i < snapshot.GetNumOrgs(); i++) {
       cOrganism* org = live_orgs[i];
-      const int id = org->GetID();
-      const int loc = org->GetCellID();
+      const int id = snapshot.GetOrgID(i);
+      const int loc = snapshot.GetCellID(i);
       const int locx = loc % worldx;
       const int locy = loc / worldx;
-      const int ft = org->GetForageTarget();
+      const int ft = snapshot.GetForageTarget(i);
       const int faced_dir = org->GetFacedDir();
-      int opinion = -1;
-      if (org->HasOpinion()) opinion = org->GetOpinion().first;
+      const int opinion = snapshot.GetGroup(i);
       
       fp << id << "," << locx << "," << locy << "," << ft << "," <<  opinion << "," <<  faced_dir;
       if (use_av) {
@@ -5186,12 +5474,10 @@ public:
     df->WriteComment("Avida population mating type histogram");
     df->WriteTimeStamp();
     df->Write(m_world->GetStats().GetUpdate(), "Update");
-    cPopulation& pop = m_world->GetPopulation();
-    for (int cell_num = 0; cell_num < pop.GetSize(); cell_num++) {
+    const cPopulationSnapshot& snapshot = m_world->GetPopulation().GetSnapshot();
+    for (int i = 0; i < snapshot.GetNumOrgs(); i++) {
       //Count totals of each mating type
-      if (pop.GetCell(cell_num).IsOccupied()) {
-        type_counts[pop.GetCell(cell_num).GetOrganism()->GetPhenotype().GetMatingType()+1]++;
-      }
+      type_counts[snapshot.GetMatingType(i)+1]++;
     }
     df->Write(type_counts[0], "Mating type -1 (juvenile)");
     df->Write(type_counts[1], "Mating type 0 (female)");
@@ -5446,7 +5732,7 @@ public:
     df->Write(bg->Properties().Get("ave_fitness").DoubleValue(),     "Average Fitness of the Dominant Genotype");
     df->Write(bg->Properties().Get("ave_repro_rate").DoubleValue(),  "Repro Rate?");
     
-    Genome gen(bg->Properties().Get("genome"));
+    Genome gen(*bg->RepresentativeGenome());
     InstructionSequencePtr seq;
     seq.DynamicCastFrom(gen.Representation());
     df->Write(seq->GetSize(),        "Size of Dominant Genotype");
@@ -5538,6 +5824,7 @@ void RegisterPrintActions(cActionLibrary* action_lib)
   action_lib->Register<cActionPrintSenseData>("PrintSenseData");
   action_lib->Register<cActionPrintSenseExeData>("PrintSenseExeData");
   action_lib->Register<cActionPrintInstructionData>("PrintInstructionData");
+  action_lib->Register<cActionRecordDataSeries>("RecordDataSeries");
   action_lib->Register<cActionPrintInternalTasksData>("PrintInternalTasksData");
   action_lib->Register<cActionPrintInternalTasksQualData>("PrintInternalTasksQualData");
   action_lib->Register<cActionPrintSleepData>("PrintSleepData");
@@ -5641,6 +5928,10 @@ void RegisterPrintActions(cActionLibrary* action_lib)
   
   action_lib->Register<cActionPrintMultiProcessData>("PrintMultiProcessData");
   action_lib->Register<cActionPrintProfilingData>("PrintProfilingData");
+  action_lib->Register<cActionPrintUpdateProfile>("PrintUpdateProfile");
+  action_lib->Register<cActionPrintMeritSchedule>("PrintMeritSchedule");
+  action_lib->Register<cActionPrintUpdateSchedule>("PrintUpdateSchedule");
+  action_lib->Register<cActionPrintInstProfile>("PrintInstProfile");
   action_lib->Register<cActionPrintOrganismLocation>("PrintOrganismLocation");
   action_lib->Register<cActionPrintOrgLocData>("PrintOrgLocData");
   action_lib->Register<cActionPrintPreyFlockingData>("PrintPreyFlockingData");
@@ -48,6 +48,7 @@
 #include "cAvidaContext.h"
 #include "cCPUTestInfo.h"
 #include "cEnvironment.h"
+#include "cGenotypeFileLoader.h"
 #include "cHardwareBase.h"
 #include "cHardwareManager.h"
 #include "cHardwareStatusPrinter.h"
@@ -775,21 +776,31 @@ void cAnalyze::LoadFile(cString cur_string)
   
   cout << "Loading: " << filename << endl;
   
-  cInitFile input_file(filename, m_world->GetWorkingDir());
-  if (!input_file.WasOpened()) {
-    const cUserFeedback& feedback = input_file.GetFeedback();
-    for (int i = 0; i < feedback.GetNumMessages(); i++) {
-      switch (feedback.GetMessageType(i)) {
+  // Genotype files are read by the streaming loader, files that use other init file features through cInitFile
+  cGenotypeFileLoader loader(m_world, filename);
+  cUserFeedback open_feedback;
+  cGenotypeFileLoader::eLoadResult load_result = loader.Open(open_feedback);
+  
+  cInitFile* input_file = NULL;
+  if (load_result == cGenotypeFileLoader::LOAD_UNSUPPORTED) {
+    input_file = new cInitFile(filename, m_world->GetWorkingDir());
+    if (!input_file->WasOpened()) open_feedback.Append(input_file->GetFeedback());
+  }
+  
+  if (open_feedback.GetNumMessages()) {
+    for (int i = 0; i < open_feedback.GetNumMessages(); i++) {
+      switch (open_feedback.GetMessageType(i)) {
         case cUserFeedback::UF_ERROR:    cerr << "error: "; break;
         case cUserFeedback::UF_WARNING:  cerr << "warning: "; break;
         default: break;
       };
-      cerr << feedback.GetMessage(i) << endl;
+      cerr << open_feedback.GetMessage(i) << endl;
     }
     if (exit_on_error) exit(1);
   }
   
-  const cString filetype = input_file.GetFiletype();
+  const cString filetype = (input_file) ? input_file->GetFiletype() : loader.GetFiletype();
+  const cStringList& format = (input_file) ? input_file->GetFormat() : loader.GetFormat();
   if (filetype != "population_data" &&  // Deprecated
       filetype != "genotype_data") {
     cerr << "error: cannot load files of type \"" << filetype << "\"." << endl;
@@ -805,7 +816,40 @@ void cAnalyze::LoadFile(cString cur_string)
   tList< tDataEntryCommand<cAnalyzeGenotype> > output_list;
   tListIterator< tDataEntryCommand<cAnalyzeGenotype> > output_it(output_list);
   cUserFeedback feedback;
-  cAnalyzeGenotype::GetDataCommandManager().LoadCommandList(input_file.GetFormat(), output_list, &feedback);
+  cAnalyzeGenotype::GetDataCommandManager().LoadCommandList(format, output_list, &feedback);
+  
+  bool id_inc = format.HasString("id");
+  
+  // Setup the genome...
+  const cInstSet& is = m_world->GetHardwareManager().GetDefaultInstSet();
+  HashPropertyMap props;
+  cHardwareManager::SetupPropertyMap(props, (const char*)is.GetInstSetName());
+  Genome default_genome(is.GetHardwareType(), props, GeneticRepresentationPtr(new InstructionSequence(1)));
+  
+  Apto::Array<cAnalyzeGenotype*, Apto::Smart> genotypes;
+  if (!feedback.GetNumErrors()) {
+    if (input_file == NULL) {
+      // Lines are parsed in parallel, with any problems reported by file line number
+      load_result = loader.Load(output_list, default_genome, genotypes, feedback);
+      if (load_result == cGenotypeFileLoader::LOAD_UNSUPPORTED) input_file = new cInitFile(filename, m_world->GetWorkingDir());
+    }
+    
+    if (input_file) {
+      for (int line_id = 0; line_id < input_file->GetNumLines(); line_id++) {
+        cString cur_line = input_file->GetLine(line_id);
+        
+        cAnalyzeGenotype* genotype = new cAnalyzeGenotype(m_world, default_genome);
+        
+        output_it.Reset();
+        tDataEntryCommand<cAnalyzeGenotype>* data_command = NULL;
+        while ((data_command = output_it.Next()) != NULL) {
+          data_command->SetValue(genotype, cur_line.PopWord());
+        }
+        genotypes.Push(genotype);
+      }
+    }
+  }
+  delete input_file;
   
   for (int i = 0; i < feedback.GetNumMessages(); i++) {
     switch (feedback.GetMessageType(i)) {
@@ -818,25 +862,9 @@ void cAnalyze::LoadFile(cString cur_string)
   
   if (feedback.GetNumErrors()) return;
   
-  bool id_inc = input_file.GetFormat().HasString("id");
-  
-  // Setup the genome...
-  const cInstSet& is = m_world->GetHardwareManager().GetDefaultInstSet();
-  HashPropertyMap props;
-  cHardwareManager::SetupPropertyMap(props, (const char*)is.GetInstSetName());
-  Genome default_genome(is.GetHardwareType(), props, GeneticRepresentationPtr(new InstructionSequence(1)));
   int load_count = 0;
-  
-  for (int line_id = 0; line_id < input_file.GetNumLines(); line_id++) {
-    cString cur_line = input_file.GetLine(line_id);
-    
-    cAnalyzeGenotype* genotype = new cAnalyzeGenotype(m_world, default_genome);
-    
-    output_it.Reset();
-    tDataEntryCommand<cAnalyzeGenotype>* data_command = NULL;
-    while ((data_command = output_it.Next()) != NULL) {
-      data_command->SetValue(genotype, cur_line.PopWord());
-    }
+  for (int i = 0; i < genotypes.GetSize(); i++) {
+    cAnalyzeGenotype* genotype = genotypes[i];
     
     // Give this genotype a name.  Base it on the ID if possible.
     if (id_inc == false) {
@@ -916,16 +944,20 @@ void cAnalyze::CommandFilter(cString cur_string)
   }
   
   
-  // Loop through the genotypes and remove the entries that don't match.
-  tListIterator<cAnalyzeGenotype> batch_it(batch[cur_batch].List());
-  cAnalyzeGenotype * cur_genotype = NULL;
-  while ((cur_genotype = batch_it.Next()) != NULL) {
-    const cFlexVar value = stat_command->GetValue(cur_genotype);
-    int compare = 1 + CompareFlexStat(value, test_value);
-    
-    // Check if we should eliminate this genotype...
-    if (rel_ok[compare] == false) {
-      delete batch_it.Remove();
+  // The core statistics are filtered by scanning the columnar copy of the batch...
+  const bool column_rel_ok[3] = { rel_ok[0], rel_ok[1], rel_ok[2] };
+  if (!batch[cur_batch].FilterColumn(stat_name, test_value.AsDouble(), column_rel_ok)) {
+    // ...otherwise loop through the genotypes and remove the entries that don't match.
+    tListIterator<cAnalyzeGenotype> batch_it(batch[cur_batch].List());
+    cAnalyzeGenotype * cur_genotype = NULL;
+    while ((cur_genotype = batch_it.Next()) != NULL) {
+      const cFlexVar value = stat_command->GetValue(cur_genotype);
+      int compare = 1 + CompareFlexStat(value, test_value);
+      
+      // Check if we should eliminate this genotype...
+      if (rel_ok[compare] == false) {
+        delete batch_it.Remove();
+      }
     }
   }
   delete stat_command;
@@ -945,7 +977,6 @@ void cAnalyze::FindGenotype(cString cur_string)
     cout << "Reducing batch " << cur_batch << " to genotypes: ";
   }
   
-  tListPlus<cAnalyzeGenotype> & gen_list = batch[cur_batch].List();
   tListPlus<cAnalyzeGenotype> found_list;
   while (cur_string.CountNumWords() > 0) {
     cString gen_desc(cur_string.PopWord());
@@ -965,6 +996,7 @@ void cAnalyze::FindGenotype(cString cur_string)
   cout << endl;
   
   // Delete all genotypes other than the ones found!
+  tListPlus<cAnalyzeGenotype> & gen_list = batch[cur_batch].List();
   while (gen_list.GetSize() > 0) delete gen_list.Pop();
   
   // And fill it back in with the good stuff.
@@ -1076,20 +1108,9 @@ void cAnalyze::FindLineage(cString cur_string)
   tListPlus<cAnalyzeGenotype> found_list;
   found_list.Push(found_gen);
   int next_id = found_gen->GetParentID();
-  bool found = true;
-  while (found == true) {
-    found = false;
-    
-    tListIterator<cAnalyzeGenotype> batch_it(batch[cur_batch].List());
-    while ((found_gen = batch_it.Next()) != NULL) {
-      if (found_gen->GetID() == next_id) {
-        batch_it.Remove();
-        found_list.Push(found_gen);
-        next_id = found_gen->GetParentID();
-        found = true;
-        break;
-      }
-    }
+  while ((found_gen = batch[cur_batch].RemoveGenotypeID(next_id)) != NULL) {
+    found_list.Push(found_gen);
+    next_id = found_gen->GetParentID();
   }
   
   // We now have all of the genotypes in this lineage, delete everything
@@ -10891,25 +10912,26 @@ int cAnalyze::PopBatch(const cString & in_string)
 cAnalyzeGenotype * cAnalyze::PopGenotype(cString gen_desc, int batch_id)
 {
   if (batch_id == -1) batch_id = cur_batch;
-  tListPlus<cAnalyzeGenotype> & gen_list = batch[batch_id].List();
+  cGenotypeBatch & gen_batch = batch[batch_id];
   gen_desc.ToLower();
   
+  // Stored statistics are searched in the batch columns, which stay valid across repeated pops
   cAnalyzeGenotype * found_gen = NULL;
   if (gen_desc == "num_cpus")
-    found_gen = gen_list.PopMax(&cAnalyzeGenotype::GetNumCPUs);
+    found_gen = gen_batch.RemoveGenotypeMax(cGenotypeColumns::COL_NUM_CPUS);
   else if (gen_desc == "total_cpus")
-    found_gen = gen_list.PopMax(&cAnalyzeGenotype::GetTotalCPUs);
+    found_gen = gen_batch.RemoveGenotypeMax(cGenotypeColumns::COL_TOTAL_CPUS);
   else if (gen_desc == "merit")
-    found_gen = gen_list.PopMax(&cAnalyzeGenotype::GetMerit);
+    found_gen = gen_batch.RemoveGenotypeMax(cGenotypeColumns::COL_MERIT);
   else if (gen_desc == "fitness")
-    found_gen = gen_list.PopMax(&cAnalyzeGenotype::GetFitness);
+    found_gen = gen_batch.RemoveGenotypeMax(cGenotypeColumns::COL_FITNESS);
   else if (gen_desc == "length")
-    found_gen = gen_list.PopMax(&cAnalyzeGenotype::GetLength);
+    found_gen = gen_batch.List().PopMax(&cAnalyzeGenotype::GetLength);
   else if (gen_desc.IsNumeric(0))
-    found_gen = gen_list.PopValue(&cAnalyzeGenotype::GetID, gen_desc.AsInt());
+    found_gen = gen_batch.RemoveGenotypeID(gen_desc.AsInt());
   else if (gen_desc == "random") {
-    int gen_pos = random.GetUInt(gen_list.GetSize());
-    found_gen = gen_list.PopPos(gen_pos);
+    int gen_pos = random.GetUInt(gen_batch.GetSize());
+    found_gen = gen_batch.RemoveGenotypePos(gen_pos);
   }
   else {
     cout << "  Error: unknown type " << gen_desc << endl;
@@ -22,9 +22,10 @@
 #include "cGenotypeBatch.h"
 
 #include "cAnalyzeGenotype.h"
+#include "cGenotypeColumns.h"
 
 
-cGenotypeBatch::cGenotypeBatch(const cGenotypeBatch& rhs) : m_list(rhs.m_list), m_name(rhs.m_name), m_is_lineage(rhs.m_is_lineage), m_is_aligned(rhs.m_is_aligned)
+cGenotypeBatch::cGenotypeBatch(const cGenotypeBatch& rhs) : m_list(rhs.m_list), m_name(rhs.m_name), m_is_lineage(rhs.m_is_lineage), m_is_aligned(rhs.m_is_aligned), m_columns(NULL)
 {
   if (rhs.m_lineage_head) {
     m_lineage_head = new cAnalyzeGenotype(*(rhs.m_lineage_head));
@@ -43,6 +44,7 @@ cGenotypeBatch::~cGenotypeBatch()
   
   delete m_lineage_head;
   delete m_clade_head;
+  delete m_columns;
 }
 
 cGenotypeBatch& cGenotypeBatch::operator=(const cGenotypeBatch& rhs)
@@ -51,6 +53,7 @@ cGenotypeBatch& cGenotypeBatch::operator=(const cGenotypeBatch& rhs)
   if (this == &rhs) return *this;
 
   // shallow-copiable or have their own deep copy functionality
+  invalidateColumns();
   m_list =       rhs.m_list;
   m_name =       rhs.m_name;
   m_is_lineage = rhs.m_is_lineage;
@@ -71,63 +74,116 @@ cGenotypeBatch& cGenotypeBatch::operator=(const cGenotypeBatch& rhs)
 }
 
 
+const cGenotypeColumns& cGenotypeBatch::Columns() const
+{
+  // A size mismatch means the list was changed through a stale List() reference; never scan such a copy
+  if (m_columns && m_columns->GetSize() != m_list.GetSize()) {
+    delete m_columns;
+    m_columns = NULL;
+  }
+  if (!m_columns) m_columns = new cGenotypeColumns(m_list);
+  return *m_columns;
+}
+
+
+bool cGenotypeBatch::FilterColumn(const cString& stat_name, double value, const bool rel_ok[3])
+{
+  int task_id = 0;
+  cGenotypeColumns::eColumn column = cGenotypeColumns::LookupColumn(stat_name, task_id);
+  if (column == cGenotypeColumns::COL_NONE) return false;
+  
+  const cGenotypeColumns& columns = Columns();
+  Apto::Array<bool> keep;
+  columns.Select(column, task_id, value, rel_ok, keep);
+  
+  // Rebuild the list from the kept rows, so that the columns stay valid for the next query
+  m_list.Clear();
+  for (int row = 0; row < columns.GetSize(); row++) {
+    if (keep[row]) m_list.PushRear(columns.GetGenotype(row));
+    else delete columns.GetGenotype(row);
+  }
+  m_columns->Compact(keep);
+  
+  return true;
+}
+
+
+cAnalyzeGenotype* cGenotypeBatch::RemoveGenotypeMax(cGenotypeColumns::eColumn column)
+{
+  return popRow(Columns().FindMax(column));
+}
+
+cAnalyzeGenotype* cGenotypeBatch::RemoveGenotypeID(int gid)
+{
+  return popRow(Columns().FindID(gid));
+}
+
+cAnalyzeGenotype* cGenotypeBatch::RemoveGenotypePos(int pos)
+{
+  if (pos >= m_list.GetSize()) return NULL;
+  return popRow(pos);
+}
+
+
 cAnalyzeGenotype* cGenotypeBatch::FindGenotypeNumCPUs() const
 {
-  return new cAnalyzeGenotype(*(m_list.FindMax(&cAnalyzeGenotype::GetNumCPUs)));
+  return new cAnalyzeGenotype(*(Columns().GetGenotype(Columns().FindMax(cGenotypeColumns::COL_NUM_CPUS))));
 }
 
 cAnalyzeGenotype* cGenotypeBatch::PopGenotypeNumCPUs()
 {
   clearFlags();
-  return m_list.PopMax(&cAnalyzeGenotype::GetNumCPUs);
+  return popRow(Columns().FindMax(cGenotypeColumns::COL_NUM_CPUS));
 }
 
 
 cAnalyzeGenotype* cGenotypeBatch::FindGenotypeTotalCPUs() const
 {
-  return new cAnalyzeGenotype(*(m_list.FindMax(&cAnalyzeGenotype::GetTotalCPUs)));
+  return new cAnalyzeGenotype(*(Columns().GetGenotype(Columns().FindMax(cGenotypeColumns::COL_TOTAL_CPUS))));
 }
 
 cAnalyzeGenotype* cGenotypeBatch::PopGenotypeTotalCPUs()
 {
   clearFlags();
-  return m_list.PopMax(&cAnalyzeGenotype::GetTotalCPUs);
+  return popRow(Columns().FindMax(cGenotypeColumns::COL_TOTAL_CPUS));
 }
 
 
 cAnalyzeGenotype* cGenotypeBatch::FindGenotypeMetabolicRate() const
 {
-  return new cAnalyzeGenotype(*(m_list.FindMax(&cAnalyzeGenotype::GetMerit)));
+  return new cAnalyzeGenotype(*(Columns().GetGenotype(Columns().FindMax(cGenotypeColumns::COL_MERIT))));
 }
 
 cAnalyzeGenotype* cGenotypeBatch::PopGenotypeMetabolicRate()
 {
   clearFlags();
-  return m_list.PopMax(&cAnalyzeGenotype::GetMerit);
+  return popRow(Columns().FindMax(cGenotypeColumns::COL_MERIT));
 }
 
 
 cAnalyzeGenotype* cGenotypeBatch::FindGenotypeFitness() const
 {
-  return new cAnalyzeGenotype(*(m_list.FindMax(&cAnalyzeGenotype::GetFitness)));
+  return new cAnalyzeGenotype(*(Columns().GetGenotype(Columns().FindMax(cGenotypeColumns::COL_FITNESS))));
 }
 
 cAnalyzeGenotype* cGenotypeBatch::PopGenotypeFitness()
 {
   clearFlags();
-  return m_list.PopMax(&cAnalyzeGenotype::GetFitness);
+  return popRow(Columns().FindMax(cGenotypeColumns::COL_FITNESS));
 }
 
 
 cAnalyzeGenotype* cGenotypeBatch::FindGenotypeID(int gid) const
 {
-  return new cAnalyzeGenotype(*(m_list.FindValue(&cAnalyzeGenotype::GetID, gid)));
+  const int row = Columns().FindID(gid);
+  if (row < 0) return NULL;
+  return new cAnalyzeGenotype(*(Columns().GetGenotype(row)));
 }
 
 cAnalyzeGenotype* cGenotypeBatch::PopGenotypeID(int gid)
 {
   clearFlags();
-  return m_list.PopValue(&cAnalyzeGenotype::GetID, gid);
+  return popRow(Columns().FindID(gid));
 }
 
 
@@ -135,7 +191,9 @@ cAnalyzeGenotype* cGenotypeBatch::FindGenotypeRandom(Apto::Random& rng) const
 {
   if (m_list.GetSize() == 0) return NULL;
   
-  return new cAnalyzeGenotype(*(m_list.GetPos(rng.GetUInt(m_list.GetSize()))));
+  // A single row does not justify building the columns, so they are only used when already present
+  const int pos = rng.GetUInt(m_list.GetSize());
+  return new cAnalyzeGenotype(*((m_columns) ? m_columns->GetGenotype(pos) : m_list.GetPos(pos)));
 }
 
 cAnalyzeGenotype* cGenotypeBatch::PopGenotypeRandom(Apto::Random& rng)
@@ -143,7 +201,7 @@ cAnalyzeGenotype* cGenotypeBatch::PopGenotypeRandom(Apto::Random& rng)
   if (m_list.GetSize() == 0) return NULL;
 
   clearFlags();
-  return m_list.PopPos(rng.GetUInt(m_list.GetSize()));
+  return popRow(rng.GetUInt(m_list.GetSize()));
 }
 
 
@@ -168,11 +226,13 @@ cAnalyzeGenotype* cGenotypeBatch::PopOrganismRandom(Apto::Random& rng)
   while (true) {
     cAnalyzeGenotype* genotype = m_list.FindSummedValue(rng.GetUInt(num_orgs), &cAnalyzeGenotype::GetNumCPUs);
     if (genotype->GetNumCPUs()) {
+      invalidateColumns();
       genotype->SetNumCPUs(genotype->GetNumCPUs() - 1);
       return new cAnalyzeGenotype(*genotype);
     }
   }
   
+  invalidateColumns();
   return m_list.PopPos(rng.GetUInt(m_list.GetSize()));
 }
 
@@ -183,6 +243,9 @@ cAnalyzeGenotype* cGenotypeBatch::FindLastCommonAncestor()
   // Finds the last common ancestor among all current organisms that are still alive,
   // i.e. have an update_died of -1.
   
+  // Linking and popping child lists changes the genotypes, so the columns are dropped like any other mutation
+  invalidateColumns();
+  
   // Connect each genotype to its parent.
   tListIterator<cAnalyzeGenotype> it(m_list);
   tListIterator<cAnalyzeGenotype> parent_it(m_list);
@@ -422,6 +485,8 @@ void cGenotypeBatch::RemoveClade(int start_genotype_id)
       }
     }
   }
+  
+  invalidateColumns();
 }
 
 
@@ -437,6 +502,7 @@ void cGenotypeBatch::PruneExtinctGenotypes()
     }
   }
   
+  invalidateColumns();
   clearFlags();
 }
 
@@ -452,6 +518,25 @@ void cGenotypeBatch::PruneNonViableGenotypes()
     }
   }
   
+  invalidateColumns();
   clearFlags();
 }
 
+
+void cGenotypeBatch::invalidateColumns()
+{
+  delete m_columns;
+  m_columns = NULL;
+}
+
+
+cAnalyzeGenotype* cGenotypeBatch::popRow(int row)
+{
+  if (row < 0) return NULL;
+  if (!m_columns) return m_list.PopPos(row);
+  
+  cAnalyzeGenotype* genotype = m_columns->GetGenotype(row);
+  m_list.Remove(genotype);
+  m_columns->RemoveRow(row);
+  return genotype;
+}
@@ -23,6 +23,9 @@
 #ifndef cGenotypeBatch_h
 #define cGenotypeBatch_h
 
+#ifndef cGenotypeColumns_h
+#include "cGenotypeColumns.h"
+#endif
 #ifndef cString_h
 #include "cString.h"
 #endif
@@ -44,15 +47,19 @@ private:
   cAnalyzeGenotype* m_clade_head;
   bool m_is_lineage;
   bool m_is_aligned;
+  mutable cGenotypeColumns* m_columns;  // Columnar copy of m_list, NULL until needed or after the list may have changed
   
 public:
-  cGenotypeBatch() : m_name(""), m_lineage_head(NULL), m_clade_head(NULL), m_is_lineage(false), m_is_aligned(false) { ; }
+  cGenotypeBatch() : m_name(""), m_lineage_head(NULL), m_clade_head(NULL), m_is_lineage(false), m_is_aligned(false), m_columns(NULL) { ; }
   cGenotypeBatch(const cGenotypeBatch&);
   ~cGenotypeBatch();
 
   cGenotypeBatch& operator=(const cGenotypeBatch&);
 
-  tListPlus<cAnalyzeGenotype>& List() { return m_list; }
+  // Mutable access to the list (or to its genotypes) discards the columnar copy; the returned reference must not be
+  // held across other calls on the batch, since those may rebuild the columns from the list as it was then
+  tListPlus<cAnalyzeGenotype>& List() { invalidateColumns(); return m_list; }
+  const cGenotypeColumns& Columns() const;
   cString& Name() { return m_name; }
   const cString& GetName() const { return m_name; }
   
@@ -65,7 +72,16 @@ public:
   void SetLineage(bool _val = true) { m_is_lineage = _val; }
   void SetAligned(bool _val = true) { m_is_aligned = _val; }
   
-  void MergeWith(cGenotypeBatch* batch) { m_list.Append(batch->m_list); }
+  void MergeWith(cGenotypeBatch* batch) { invalidateColumns(); m_list.Append(batch->m_list); }
+  
+  // Removes (and deletes) the genotypes whose stat does not compare to value with an allowed relation, scanning the
+  // columnar copy.  Returns false, leaving the batch unchanged, if the stat is not one of the stored columns.
+  bool FilterColumn(const cString& stat_name, double value, const bool rel_ok[3]);
+  
+  // Remove and return the genotype selected, leaving the lineage and clade flags to the caller (NULL if none)
+  cAnalyzeGenotype* RemoveGenotypeMax(cGenotypeColumns::eColumn column);
+  cAnalyzeGenotype* RemoveGenotypeID(int gid);
+  cAnalyzeGenotype* RemoveGenotypePos(int pos);
   
   cAnalyzeGenotype* FindGenotypeNumCPUs() const;
   cAnalyzeGenotype* PopGenotypeNumCPUs();
@@ -107,6 +123,8 @@ public:
   
 private:
   inline void clearFlags() { m_lineage_head = NULL; m_is_lineage = false; m_clade_head = NULL; m_is_aligned = false; }
+  void invalidateColumns();
+  cAnalyzeGenotype* popRow(int row);
 };
 
 
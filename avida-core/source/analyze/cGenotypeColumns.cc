@@ -0,0 +1,204 @@
+/*
+ *  cGenotypeColumns.cc
+ *  Avida
+ *
+ *  Copyright 2026 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "cGenotypeColumns.h"
+
+#include "cAnalyzeGenotype.h"
+
+
+namespace {
+  template<typename T> void compactColumn(Apto::Array<T, Apto::Smart>& column, const Apto::Array<bool>& keep)
+  {
+    int out = 0;
+    for (int row = 0; row < keep.GetSize(); row++) if (keep[row]) column[out++] = column[row];
+    column.Resize(out);
+  }
+}
+
+
+cGenotypeColumns::cGenotypeColumns(const tList<cAnalyzeGenotype>& list) : m_num_tasks(0)
+{
+  const int num_rows = list.GetSize();
+  m_rows.Resize(num_rows);
+  m_id.Resize(num_rows);
+  m_parent_id.Resize(num_rows);
+  m_num_cpus.Resize(num_rows);
+  m_total_cpus.Resize(num_rows);
+  m_update_born.Resize(num_rows);
+  m_gest_time.Resize(num_rows);
+  m_fitness.Resize(num_rows);
+  m_merit.Resize(num_rows);
+
+  tConstListIterator<cAnalyzeGenotype> list_it(list);
+  const cAnalyzeGenotype* genotype = NULL;
+  for (int row = 0; (genotype = list_it.Next()) != NULL; row++) {
+    m_rows[row] = const_cast<cAnalyzeGenotype*>(genotype);
+    m_id[row] = genotype->GetID();
+    m_parent_id[row] = genotype->GetParentID();
+    m_num_cpus[row] = genotype->GetNumCPUs();
+    m_total_cpus[row] = genotype->GetTotalCPUs();
+    m_update_born[row] = genotype->GetUpdateBorn();
+    m_gest_time[row] = genotype->GetGestTime();
+    m_fitness[row] = genotype->GetFitness();
+    m_merit[row] = genotype->GetMerit();
+    if (genotype->GetNumTasks() > m_num_tasks) m_num_tasks = genotype->GetNumTasks();
+  }
+
+  // Genotypes that were never tested have no task counts, which reads as zero for every task
+  m_task_counts.Resize(num_rows * m_num_tasks);
+  m_task_counts.SetAll(0);
+  for (int row = 0; row < num_rows; row++) {
+    const Apto::Array<int>& task_counts = m_rows[row]->GetTaskCounts();
+    for (int task = 0; task < task_counts.GetSize(); task++) m_task_counts[row * m_num_tasks + task] = task_counts[task];
+  }
+}
+
+
+cGenotypeColumns::eColumn cGenotypeColumns::LookupColumn(const cString& stat_name, int& task_id)
+{
+  // Split the name as tDataCommandManager::GetDataCommand does; entries with arguments are not stored here
+  cString arg_list = stat_name;
+  cString idx = arg_list.Pop(':');
+  cString entry_name = idx.Pop('.');
+  if (arg_list.GetSize()) return COL_NONE;
+
+  if (entry_name == "task") {
+    if (idx.GetSize() == 0 || !idx.IsNumeric()) return COL_NONE;
+    task_id = idx.AsInt();
+    return COL_TASK;
+  }
+
+  if (idx.GetSize()) return COL_NONE;
+  if (entry_name == "id") return COL_ID;
+  if (entry_name == "parent_id") return COL_PARENT_ID;
+  if (entry_name == "num_cpus") return COL_NUM_CPUS;
+  if (entry_name == "total_cpus") return COL_TOTAL_CPUS;
+  if (entry_name == "update_born") return COL_UPDATE_BORN;
+  if (entry_name == "gest_time") return COL_GEST_TIME;
+  if (entry_name == "fitness") return COL_FITNESS;
+  if (entry_name == "merit") return COL_MERIT;
+  return COL_NONE;
+}
+
+
+template<typename T> int cGenotypeColumns::findMax(const Apto::Array<T, Apto::Smart>& column) const
+{
+  if (column.GetSize() == 0) return -1;
+
+  int best = 0;
+  for (int row = 1; row < column.GetSize(); row++) if (column[row] > column[best]) best = row;
+  return best;
+}
+
+
+int cGenotypeColumns::FindMax(eColumn column) const
+{
+  switch (column) {
+    case COL_ID:          return findMax(m_id);
+    case COL_PARENT_ID:   return findMax(m_parent_id);
+    case COL_NUM_CPUS:    return findMax(m_num_cpus);
+    case COL_TOTAL_CPUS:  return findMax(m_total_cpus);
+    case COL_UPDATE_BORN: return findMax(m_update_born);
+    case COL_GEST_TIME:   return findMax(m_gest_time);
+    case COL_FITNESS:     return findMax(m_fitness);
+    case COL_MERIT:       return findMax(m_merit);
+    default:              return -1;
+  }
+}
+
+
+int cGenotypeColumns::FindID(int id) const
+{
+  for (int row = 0; row < m_id.GetSize(); row++) if (m_id[row] == id) return row;
+  return -1;
+}
+
+
+template<typename T> void cGenotypeColumns::selectRows(const Apto::Array<T, Apto::Smart>& column, double value,
+                                                       const bool rel_ok[3], Apto::Array<bool>& keep) const
+{
+  // cFlexVar compares numeric entries against the FILTER argument as doubles
+  for (int row = 0; row < column.GetSize(); row++) {
+    const double cur_value = static_cast<double>(column[row]);
+    keep[row] = rel_ok[(cur_value < value) ? 0 : ((cur_value == value) ? 1 : 2)];
+  }
+}
+
+
+void cGenotypeColumns::Select(eColumn column, int task_id, double value, const bool rel_ok[3], Apto::Array<bool>& keep) const
+{
+  const int num_rows = m_rows.GetSize();
+  keep.Resize(num_rows);
+
+  switch (column) {
+    case COL_ID:          selectRows(m_id, value, rel_ok, keep); break;
+    case COL_PARENT_ID:   selectRows(m_parent_id, value, rel_ok, keep); break;
+    case COL_NUM_CPUS:    selectRows(m_num_cpus, value, rel_ok, keep); break;
+    case COL_TOTAL_CPUS:  selectRows(m_total_cpus, value, rel_ok, keep); break;
+    case COL_UPDATE_BORN: selectRows(m_update_born, value, rel_ok, keep); break;
+    case COL_GEST_TIME:   selectRows(m_gest_time, value, rel_ok, keep); break;
+    case COL_FITNESS:     selectRows(m_fitness, value, rel_ok, keep); break;
+    case COL_MERIT:       selectRows(m_merit, value, rel_ok, keep); break;
+    case COL_TASK:
+      for (int row = 0; row < num_rows; row++) {
+        const double cur_value = (task_id < m_num_tasks) ? m_task_counts[row * m_num_tasks + task_id] : 0;
+        keep[row] = rel_ok[(cur_value < value) ? 0 : ((cur_value == value) ? 1 : 2)];
+      }
+      break;
+    default:
+      keep.SetAll(true);
+      break;
+  }
+}
+
+
+void cGenotypeColumns::Compact(const Apto::Array<bool>& keep)
+{
+  // Task counts are compacted first, while the row count still describes their layout
+  int out = 0;
+  for (int row = 0; row < keep.GetSize(); row++) {
+    if (!keep[row]) continue;
+    for (int task = 0; task < m_num_tasks; task++) {
+      m_task_counts[out * m_num_tasks + task] = m_task_counts[row * m_num_tasks + task];
+    }
+    out++;
+  }
+  m_task_counts.Resize(out * m_num_tasks);
+
+  compactColumn(m_rows, keep);
+  compactColumn(m_id, keep);
+  compactColumn(m_parent_id, keep);
+  compactColumn(m_num_cpus, keep);
+  compactColumn(m_total_cpus, keep);
+  compactColumn(m_update_born, keep);
+  compactColumn(m_gest_time, keep);
+  compactColumn(m_fitness, keep);
+  compactColumn(m_merit, keep);
+}
+
+
+void cGenotypeColumns::RemoveRow(int row)
+{
+  Apto::Array<bool> keep(m_rows.GetSize());
+  keep.SetAll(true);
+  keep[row] = false;
+  Compact(keep);
+}
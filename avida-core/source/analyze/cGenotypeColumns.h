@@ -0,0 +1,107 @@
+/*
+ *  cGenotypeColumns.h
+ *  Avida
+ *
+ *  Copyright 2026 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef cGenotypeColumns_h
+#define cGenotypeColumns_h
+
+#include "apto/core.h"
+
+#ifndef cString_h
+#include "cString.h"
+#endif
+#ifndef tList_h
+#include "tList.h"
+#endif
+
+class cAnalyzeGenotype;
+
+
+// cGenotypeColumns - columnar copy of the most commonly queried statistics of a genotype batch
+// --------------------------------------------------------------------------------------------------------------
+//
+//  Row i holds the statistics of the i-th genotype of the batch list, stored as one flat typed array per statistic so
+//  that filters and searches scan contiguous memory rather than walking the list through the virtual data entry
+//  accessors.  The columns are a snapshot: they must be rebuilt whenever the genotypes or the list change.
+
+class cGenotypeColumns
+{
+public:
+  enum eColumn {
+    COL_ID = 0,
+    COL_PARENT_ID,
+    COL_NUM_CPUS,
+    COL_TOTAL_CPUS,
+    COL_UPDATE_BORN,
+    COL_GEST_TIME,
+    COL_FITNESS,
+    COL_MERIT,
+    COL_TASK,         // Task counts, one sub-column per task
+    COL_NONE
+  };
+
+private:
+  Apto::Array<cAnalyzeGenotype*, Apto::Smart> m_rows;
+
+  Apto::Array<int, Apto::Smart> m_id;
+  Apto::Array<int, Apto::Smart> m_parent_id;
+  Apto::Array<int, Apto::Smart> m_num_cpus;
+  Apto::Array<int, Apto::Smart> m_total_cpus;
+  Apto::Array<int, Apto::Smart> m_update_born;
+  Apto::Array<int, Apto::Smart> m_gest_time;
+  Apto::Array<double, Apto::Smart> m_fitness;
+  Apto::Array<double, Apto::Smart> m_merit;
+
+  int m_num_tasks;
+  Apto::Array<int, Apto::Smart> m_task_counts;  // Row major, m_num_tasks entries per row
+
+
+  template<typename T> int findMax(const Apto::Array<T, Apto::Smart>& column) const;
+  template<typename T> void selectRows(const Apto::Array<T, Apto::Smart>& column, double value, const bool rel_ok[3],
+                                       Apto::Array<bool>& keep) const;
+
+  cGenotypeColumns(); // @not_implemented
+  cGenotypeColumns(const cGenotypeColumns&); // @not_implemented
+  cGenotypeColumns& operator=(const cGenotypeColumns&); // @not_implemented
+
+public:
+  explicit cGenotypeColumns(const tList<cAnalyzeGenotype>& list);
+
+  int GetSize() const { return m_rows.GetSize(); }
+  cAnalyzeGenotype* GetGenotype(int row) const { return m_rows[row]; }
+
+  // Maps a genotype data entry name (as used by FILTER) to a column, returning COL_NONE if it is not stored here
+  static eColumn LookupColumn(const cString& stat_name, int& task_id);
+
+  // Row holding the largest value of the column (the first such row on ties, as tListPlus::FindMax), -1 if empty
+  int FindMax(eColumn column) const;
+  // First row with the given genotype id, -1 if none
+  int FindID(int id) const;
+
+  // Flags each row as kept if comparing its value to the given value yields an allowed relation
+  // (rel_ok[0] = less, rel_ok[1] = same, rel_ok[2] = greater), exactly as FILTER compares data entries
+  void Select(eColumn column, int task_id, double value, const bool rel_ok[3], Apto::Array<bool>& keep) const;
+
+  // Drops every row that is not kept, preserving the order of the remaining rows
+  void Compact(const Apto::Array<bool>& keep);
+  void RemoveRow(int row);
+};
+
+#endif
@@ -0,0 +1,327 @@
+/*
+ *  cGenotypeFileLoader.cc
+ *  Avida
+ *
+ *  Copyright 2026 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "cGenotypeFileLoader.h"
+
+#include "apto/core/FileSystem.h"
+#include "apto/platform.h"
+
+#include "cAnalyzeGenotype.h"
+#include "cAvidaConfig.h"
+#include "cUserFeedback.h"
+#include "cWorkerPool.h"
+#include "cWorld.h"
+#include "tDataEntryCommand.h"
+
+#include <cstdio>
+#include <cstring>
+
+#if !APTO_PLATFORM(WINDOWS)
+# include <fcntl.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <unistd.h>
+#endif
+
+
+namespace {
+  // Smallest chunk worth handing to a separate thread
+  const size_t MIN_CHUNK_SIZE = 64 * 1024;
+
+  inline bool isFieldSeparator(char c) { return c == ' ' || c == '\t' || c == '\r'; }
+}
+
+
+// Parses the data lines of each chunk into that chunk's own genotype list and feedback
+class cGenotypeFileLoader::cParseJob : public cWorkerPool::Job
+{
+private:
+  cGenotypeFileLoader& m_loader;
+  const Apto::Array<tDataEntryCommand<cAnalyzeGenotype>*>& m_columns;
+  Apto::Array<Genome*>& m_genomes;
+  Apto::Array<Apto::Array<cAnalyzeGenotype*, Apto::Smart> >& m_results;
+  Apto::Array<cUserFeedback>& m_feedback;
+  Apto::Array<bool>& m_unsupported;
+
+public:
+  cParseJob(cGenotypeFileLoader& loader, const Apto::Array<tDataEntryCommand<cAnalyzeGenotype>*>& columns,
+            Apto::Array<Genome*>& genomes, Apto::Array<Apto::Array<cAnalyzeGenotype*, Apto::Smart> >& results,
+            Apto::Array<cUserFeedback>& feedback, Apto::Array<bool>& unsupported)
+    : m_loader(loader), m_columns(columns), m_genomes(genomes), m_results(results), m_feedback(feedback)
+    , m_unsupported(unsupported) { ; }
+
+  void Run(int part)
+  {
+    const sChunk& chunk = m_loader.m_chunks[part];
+    const Genome& default_genome = *m_genomes[part];
+    Apto::Array<cAnalyzeGenotype*, Apto::Smart>& genotypes = m_results[part];
+    const int num_columns = m_columns.GetSize();
+
+    int line_num = chunk.first_line;
+    for (const char* line = chunk.begin; line < chunk.end; line_num++) {
+      const char* eol = static_cast<const char*>(memchr(line, '\n', chunk.end - line));
+      if (eol == NULL) eol = chunk.end;
+      const char* next_line = eol + 1;
+
+      // Everything past a comment mark is ignored
+      const char* comment = static_cast<const char*>(memchr(line, '#', eol - line));
+      if (comment != NULL) eol = comment;
+
+      while (line < eol && isFieldSeparator(*line)) line++;
+      while (eol > line && isFieldSeparator(eol[-1])) eol--;
+      if (line == eol) {
+        line = next_line;
+        continue;
+      }
+
+      if (eol[-1] == '\\') {
+        m_unsupported[part] = true;
+        return;
+      }
+
+      cAnalyzeGenotype* genotype = new cAnalyzeGenotype(m_loader.m_world, default_genome);
+      int num_fields = 0;
+      const char* cur = line;
+      for (;;) {
+        while (cur < eol && isFieldSeparator(*cur)) cur++;
+        if (cur == eol) break;
+        const char* field_end = cur;
+        while (field_end < eol && !isFieldSeparator(*field_end)) field_end++;
+
+        if (num_fields < num_columns) m_columns[num_fields]->SetValue(genotype, cString(cur, static_cast<int>(field_end - cur)));
+        num_fields++;
+        cur = field_end;
+      }
+
+      // Columns without a value are set from an empty field, as the cInitFile based loader does
+      for (int i = num_fields; i < num_columns; i++) m_columns[i]->SetValue(genotype, cString());
+
+      if (num_fields != num_columns) {
+        m_feedback[part].Warning("%s:%d: expected %d fields, found %d", (const char*)m_loader.m_filename, line_num,
+                                 num_columns, num_fields);
+      }
+
+      genotypes.Push(genotype);
+      line = next_line;
+    }
+  }
+};
+
+
+cGenotypeFileLoader::cGenotypeFileLoader(cWorld* world, const cString& filename)
+  : m_world(world), m_filename(filename), m_data(NULL), m_size(0), m_mapping(NULL), m_buffer(NULL), m_filetype("unknown")
+{
+}
+
+cGenotypeFileLoader::~cGenotypeFileLoader()
+{
+  unmapFile();
+}
+
+
+cGenotypeFileLoader::eLoadResult cGenotypeFileLoader::Open(cUserFeedback& feedback)
+{
+  cString path = cString(Apto::FileSystem::GetAbsolutePath(Apto::String(m_filename), Apto::String(m_world->GetWorkingDir())));
+  if (!mapFile(path)) {
+    feedback.Error("unable to open file '%s'.", (const char*)m_filename);
+    return LOAD_FAILED;
+  }
+
+  int num_threads = m_world->GetConfig().MAX_CONCURRENCY.Get();
+  if (num_threads < 1) num_threads = Apto::Platform::AvailableCPUs();
+
+  // Several chunks per thread keep the threads busy when line lengths vary across the file
+  return scanDirectives(num_threads * 4, feedback);
+}
+
+
+cGenotypeFileLoader::eLoadResult cGenotypeFileLoader::Load(tList<tDataEntryCommand<cAnalyzeGenotype> >& columns,
+                                                           const Genome& default_genome,
+                                                           Apto::Array<cAnalyzeGenotype*, Apto::Smart>& genotypes,
+                                                           cUserFeedback& feedback)
+{
+  const int num_chunks = m_chunks.GetSize();
+
+  // List iterators register themselves with their list, so the workers are given the columns as an array
+  Apto::Array<tDataEntryCommand<cAnalyzeGenotype>*> column_array(columns.GetSize());
+  tListIterator<tDataEntryCommand<cAnalyzeGenotype> > column_it(columns);
+  tDataEntryCommand<cAnalyzeGenotype>* column = NULL;
+  for (int i = 0; (column = column_it.Next()) != NULL; i++) column_array[i] = column;
+
+  // Copying a genome touches the reference counts of its properties, so every chunk copies from its own genome
+  Apto::Array<Genome*> genomes(num_chunks);
+  for (int i = 0; i < num_chunks; i++) genomes[i] = new Genome(default_genome);
+
+  Apto::Array<Apto::Array<cAnalyzeGenotype*, Apto::Smart> > results(num_chunks);
+  Apto::Array<cUserFeedback> chunk_feedback(num_chunks);
+  Apto::Array<bool> unsupported(num_chunks);
+  unsupported.SetAll(false);
+
+  if (num_chunks > 0) {
+    cParseJob job(*this, column_array, genomes, results, chunk_feedback, unsupported);
+    cWorkerPool workers((num_chunks > 1) ? m_world->GetConfig().MAX_CONCURRENCY.Get() : 1);
+    workers.Run(job, num_chunks);
+  }
+
+  for (int i = 0; i < num_chunks; i++) delete genomes[i];
+
+  bool is_supported = true;
+  for (int i = 0; i < num_chunks; i++) if (unsupported[i]) is_supported = false;
+  if (!is_supported) {
+    for (int i = 0; i < num_chunks; i++) {
+      for (int j = 0; j < results[i].GetSize(); j++) delete results[i][j];
+    }
+    return LOAD_UNSUPPORTED;
+  }
+
+  // Concatenate in chunk order, preserving the order of the file
+  for (int i = 0; i < num_chunks; i++) {
+    feedback.Append(chunk_feedback[i]);
+    for (int j = 0; j < results[i].GetSize(); j++) genotypes.Push(results[i][j]);
+  }
+
+  return LOAD_OK;
+}
+
+
+bool cGenotypeFileLoader::mapFile(const cString& path)
+{
+#if !APTO_PLATFORM(WINDOWS)
+  int fd = open(path, O_RDONLY);
+  if (fd < 0) return false;
+
+  struct stat file_stat;
+  if (fstat(fd, &file_stat) != 0) {
+    close(fd);
+    return false;
+  }
+
+  m_size = static_cast<size_t>(file_stat.st_size);
+  if (m_size == 0) {
+    close(fd);
+    m_data = "";
+    return true;
+  }
+
+  void* mapping = mmap(NULL, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (mapping != MAP_FAILED) {
+    m_mapping = mapping;
+    m_data = static_cast<const char*>(mapping);
+    return true;
+  }
+#endif
+
+  // Mapping is unavailable, read the whole file instead
+  FILE* fp = fopen(path, "rb");
+  if (fp == NULL) return false;
+
+  fseek(fp, 0, SEEK_END);
+  long file_size = ftell(fp);
+  fseek(fp, 0, SEEK_SET);
+  if (file_size < 0) {
+    fclose(fp);
+    return false;
+  }
+
+  m_size = static_cast<size_t>(file_size);
+  m_buffer = new char[m_size + 1];
+  const bool success = (fread(m_buffer, 1, m_size, fp) == m_size);
+  fclose(fp);
+  m_data = m_buffer;
+  return success;
+}
+
+
+void cGenotypeFileLoader::unmapFile()
+{
+#if !APTO_PLATFORM(WINDOWS)
+  if (m_mapping != NULL) munmap(m_mapping, m_size);
+#endif
+  m_mapping = NULL;
+  delete [] m_buffer;
+  m_buffer = NULL;
+  m_data = NULL;
+  m_size = 0;
+}
+
+
+/*! Process the directives of the file and split its data into chunks.
+
+ Directives must start at the first column of a line, as with cInitFile.  Their lines are
+ left in the chunks, where they are skipped as comments.
+ */
+cGenotypeFileLoader::eLoadResult cGenotypeFileLoader::scanDirectives(int num_chunks, cUserFeedback& feedback)
+{
+  size_t target_size = m_size / ((num_chunks > 0) ? num_chunks : 1);
+  if (target_size < MIN_CHUNK_SIZE) target_size = MIN_CHUNK_SIZE;
+
+  const char* const end = m_data + m_size;
+  sChunk chunk;
+  chunk.begin = m_data;
+  chunk.first_line = 1;
+
+  int line_num = 1;
+  for (const char* line = m_data; line < end; line_num++) {
+    if (static_cast<size_t>(line - chunk.begin) >= target_size) {
+      chunk.end = line;
+      m_chunks.Push(chunk);
+      chunk.begin = line;
+      chunk.first_line = line_num;
+    }
+
+    const char* eol = static_cast<const char*>(memchr(line, '\n', end - line));
+    if (eol == NULL) eol = end;
+
+    if (*line == '#') {
+      const char* cmd_end = eol;
+      while (cmd_end > line && isFieldSeparator(cmd_end[-1])) cmd_end--;
+      cString cmdstr(line, static_cast<int>(cmd_end - line));
+      cString cmd = cmdstr.PopWord();
+
+      if (cmd == "#include" || cmd == "#import" || cmd == "#define") {
+        return LOAD_UNSUPPORTED;
+      } else if (cmd == "#filetype") {
+        cString ft = cmdstr.PopWord();
+        if (m_filetype != "unknown" && m_filetype != ft) {
+          feedback.Error("%s:%d: duplicate filetype directive", (const char*)m_filename, line_num);
+          return LOAD_FAILED;
+        }
+        m_filetype = ft;
+      } else if (cmd == "#format") {
+        if (m_format.GetSize() != 0) {
+          feedback.Error("%s:%d: duplicate format directive", (const char*)m_filename, line_num);
+          return LOAD_FAILED;
+        }
+        m_format.Load(cmdstr);
+      }
+    }
+
+    line = eol + 1;
+  }
+
+  if (chunk.begin < end) {
+    chunk.end = end;
+    m_chunks.Push(chunk);
+  }
+
+  return LOAD_OK;
+}
@@ -0,0 +1,102 @@
+/*
+ *  cGenotypeFileLoader.h
+ *  Avida
+ *
+ *  Copyright 2026 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef cGenotypeFileLoader_h
+#define cGenotypeFileLoader_h
+
+#include "avida/core/Genome.h"
+
+#include "cString.h"
+#include "cStringList.h"
+#include "tList.h"
+
+class cAnalyzeGenotype;
+class cUserFeedback;
+class cWorld;
+template <class TargetType> class tDataEntryCommand;
+
+using namespace Avida;
+
+
+// cGenotypeFileLoader - streaming loader for genotype_data (.spop and detail) files
+// --------------------------------------------------------------------------------------------------------------
+//
+//  The file is mapped into memory and split into chunks at line boundaries, which are parsed in parallel directly
+//  into cAnalyzeGenotype objects.  The genotypes of each chunk are kept in their own slot and concatenated in chunk
+//  order, so the result is in file order regardless of thread scheduling.
+//
+//  Only the subset of the cInitFile syntax that appears in genotype files is handled here: comments, blank lines and
+//  the #filetype and #format directives.  Files using #include, #import, #define or line continuations report
+//  LOAD_UNSUPPORTED, and should be loaded through cInitFile instead.
+
+class cGenotypeFileLoader
+{
+public:
+  enum eLoadResult { LOAD_OK, LOAD_FAILED, LOAD_UNSUPPORTED };
+
+private:
+  struct sChunk
+  {
+    const char* begin;
+    const char* end;
+    int first_line;   // 1-based line number of the first line in the chunk
+  };
+
+  class cParseJob;
+  friend class cParseJob;
+
+  cWorld* m_world;
+  cString m_filename;
+
+  const char* m_data;
+  size_t m_size;
+  void* m_mapping;          // Platform specific handle of the mapped file (NULL when not mapped)
+  char* m_buffer;           // File contents, when the file could not be mapped
+
+  cString m_filetype;
+  cStringList m_format;
+  Apto::Array<sChunk, Apto::Smart> m_chunks;
+
+
+  bool mapFile(const cString& path);
+  void unmapFile();
+  eLoadResult scanDirectives(int num_chunks, cUserFeedback& feedback);
+
+  cGenotypeFileLoader(); // @not_implemented
+  cGenotypeFileLoader(const cGenotypeFileLoader&); // @not_implemented
+  cGenotypeFileLoader& operator=(const cGenotypeFileLoader&); // @not_implemented
+
+public:
+  cGenotypeFileLoader(cWorld* world, const cString& filename);
+  ~cGenotypeFileLoader();
+
+  // Maps the file and processes its directives
+  eLoadResult Open(cUserFeedback& feedback);
+
+  const cString& GetFiletype() const { return m_filetype; }
+  const cStringList& GetFormat() const { return m_format; }
+
+  // Parses every data line into a new genotype (owned by the caller), applying the columns of the format in order
+  eLoadResult Load(tList<tDataEntryCommand<cAnalyzeGenotype> >& columns, const Genome& default_genome,
+                   Apto::Array<cAnalyzeGenotype*, Apto::Smart>& genotypes, cUserFeedback& feedback);
+};
+
+#endif
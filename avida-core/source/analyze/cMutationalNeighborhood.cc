@@ -61,7 +61,7 @@ void cMutationalNeighborhood::Process(cAvidaContext& ctx)
 
     if (cur_site < m_base_genome_size) {
       // Create test infrastructure
-      cTestCPU* testcpu = m_world->GetHardwareManager().CreateTestCPU(ctx);
+      cTestCPULease testcpu(ctx, m_world->GetHardwareManager());
       cCPUTestInfo test_info;
       
       // Setup One Step Data
@@ -115,9 +115,9 @@ void cMutationalNeighborhood::Process(cAvidaContext& ctx)
       
       
       // Do the processing, starting with One Step
-      ProcessOneStepPoint(ctx, testcpu, test_info, cur_site);
-      ProcessOneStepInsert(ctx, testcpu, test_info, cur_site);
-      ProcessOneStepDelete(ctx, testcpu, test_info, cur_site);
+      ProcessOneStepPoint(ctx, testcpu.Get(), test_info, cur_site);
+      ProcessOneStepInsert(ctx, testcpu.Get(), test_info, cur_site);
+      ProcessOneStepDelete(ctx, testcpu.Get(), test_info, cur_site);
 
       // Process the hanging insertion on the first cycle through (to balance execution time)
       if (cur_site == 0) {
@@ -143,11 +143,8 @@ void cMutationalNeighborhood::Process(cAvidaContext& ctx)
         tiddata2.peak_genome = m_base_genome;
         tiddata2.site_count.Resize(m_base_genome_size + 1, 0);
         
-        ProcessOneStepInsert(ctx, testcpu, test_info, cur_site); 
+        ProcessOneStepInsert(ctx, testcpu.Get(), test_info, cur_site); 
       }
-
-      // Cleanup
-      delete testcpu;
     }
   } else {
     ProcessInitialize(ctx);
@@ -163,7 +160,7 @@ void cMutationalNeighborhood::Process(cAvidaContext& ctx)
 void cMutationalNeighborhood::ProcessInitialize(cAvidaContext& ctx)
 {
   // Generate base information
-  cTestCPU* testcpu = m_world->GetHardwareManager().CreateTestCPU(ctx);
+  cTestCPULease testcpu(ctx, m_world->GetHardwareManager());
   cCPUTestInfo test_info;
   testcpu->TestGenome(ctx, test_info, m_base_genome);
   
@@ -178,8 +175,6 @@ void cMutationalNeighborhood::ProcessInitialize(cAvidaContext& ctx)
   
   // If invalid target supplied, set to the last task
   if (m_target >= m_base_tasks.GetSize() || m_target < 0) m_target = m_base_tasks.GetSize() - 1;
-  
-  delete testcpu;
 
   // Setup state to begin processing
   m_onestep_point.ResizeClear(m_base_genome_size);
@@ -34,10 +34,133 @@ const double MEMORY_INCREASE_FACTOR = 1.5;
 const double MEMORY_SHRINK_TEST_FACTOR = 4.0;
 
 
+Avida::InstructionArray::InstructionArray(int size) : m_block(NULL), m_data(NULL), m_size(0), m_hash(0), m_hash_len(-1)
+{
+  attach(new Block(size));
+}
+
+Avida::InstructionArray::InstructionArray(const InstructionArray& rhs)
+  : m_block(rhs.m_block), m_data(rhs.m_data), m_size(rhs.m_size), m_hash(0), m_hash_len(-1)
+{
+  // Storage blocks may be shared by sequences owned by different threads, so their counts are updated atomically
+  if (m_block) Apto::Atomic::Inc(&m_block->refs);
+  copyHash(rhs);
+}
+
+Avida::InstructionArray::~InstructionArray()
+{
+  release();
+}
+
+
+Avida::InstructionArray& Avida::InstructionArray::operator=(const InstructionArray& rhs)
+{
+  if (m_block == rhs.m_block) {
+    m_size = rhs.m_size;
+    m_data = rhs.m_data;
+  } else {
+    if (rhs.m_block) Apto::Atomic::Inc(&rhs.m_block->refs);
+    release();
+    m_block = rhs.m_block;
+    m_data = rhs.m_data;
+    m_size = rhs.m_size;
+  }
+  copyHash(rhs);
+  return *this;
+}
+
+
+void Avida::InstructionArray::Resize(int new_size)
+{
+  m_hash_len = -1;
+  if (m_block && Apto::Atomic::Get(&m_block->refs) == 1) {
+    m_block->insts.Resize(new_size);
+    m_size = new_size;
+    m_data = (new_size) ? &m_block->insts[0] : NULL;
+    return;
+  }
+  
+  Block* block = new Block(new_size);
+  const int num_kept = (m_size < new_size) ? m_size : new_size;
+  for (int i = 0; i < num_kept; i++) block->insts[i] = m_data[i];
+  release();
+  attach(block);
+}
+
+void Avida::InstructionArray::ResizeClear(int new_size)
+{
+  m_hash_len = -1;
+  if (m_block && Apto::Atomic::Get(&m_block->refs) == 1) {
+    m_block->insts.ResizeClear(new_size);
+    m_size = new_size;
+    m_data = (new_size) ? &m_block->insts[0] : NULL;
+    return;
+  }
+  
+  release();
+  attach(new Block(new_size));
+}
+
+
+unsigned int Avida::InstructionArray::Hash(int len) const
+{
+  assert(len >= 0 && len <= m_size);
+  if (Apto::Atomic::Get(&m_hash_len) == len) return static_cast<unsigned int>(Apto::Atomic::Get(&m_hash));
+  
+  // 32-bit FNV-1a over the operands
+  unsigned int hash = 2166136261u;
+  for (int i = 0; i < len; i++) {
+    hash ^= static_cast<unsigned int>(m_data[i].GetOp());
+    hash *= 16777619u;
+  }
+  
+  // Exposed storage can change behind the handle's back, so its hash is never kept
+  if (IsExposed()) return hash;
+  
+  // Other threads may be reading (or storing the same value), so the length is withdrawn while the hash changes
+  Apto::Atomic::Set(&m_hash_len, -1);
+  Apto::Atomic::Set(&m_hash, static_cast<int>(hash));
+  Apto::Atomic::Set(&m_hash_len, len);
+  return hash;
+}
+
+
+void Avida::InstructionArray::attach(Block* block)
+{
+  m_block = block;
+  m_size = block->insts.GetSize();
+  m_data = (m_size) ? &block->insts[0] : NULL;
+}
+
+void Avida::InstructionArray::release()
+{
+  if (m_block && Apto::Atomic::DecAndTest(&m_block->refs)) delete m_block;
+  m_block = NULL;
+  m_data = NULL;
+  m_size = 0;
+}
+
+void Avida::InstructionArray::detach()
+{
+  Block* block = new Block(m_size);
+  for (int i = 0; i < m_size; i++) block->insts[i] = m_data[i];
+  release();
+  attach(block);
+}
+
+void Avida::InstructionArray::copyHash(const InstructionArray& rhs)
+{
+  // Only take a hash whose length did not change while it was read (see Hash)
+  const int len = Apto::Atomic::Get(&rhs.m_hash_len);
+  const int hash = Apto::Atomic::Get(&rhs.m_hash);
+  m_hash = hash;
+  m_hash_len = (Apto::Atomic::Get(&rhs.m_hash_len) == len) ? len : -1;
+}
+
+
 Avida::InstructionSequence::InstructionSequence(const InstructionSequence& seq)
-: GeneticRepresentation(seq), m_seq(seq.GetSize()), m_active_size(seq.GetSize())
+: GeneticRepresentation(seq), m_seq(seq.m_seq), m_active_size(seq.m_active_size)
 {
-  for (int i = 0; i < m_active_size; i++)  m_seq[i] = seq[i];
 }
 
 Avida::InstructionSequence::InstructionSequence(const Apto::String& str)
@@ -51,11 +174,11 @@ Avida::InstructionSequence::InstructionSequence(const Apto::String& str)
       case '-':
       case '~':
       case '?':
-        if (!m_seq[size].SetSymbol(str.Substring(i, 2))) continue;
+        if (!m_seq.writableData()[size].SetSymbol(str.Substring(i, 2))) continue;
         i++;
         break;
       default:
-        if (!m_seq[size].SetSymbol(str.Substring(i, 1))) continue;
+        if (!m_seq.writableData()[size].SetSymbol(str.Substring(i, 1))) continue;
     }
     size++;
   }
@@ -181,7 +304,8 @@ void Avida::InstructionSequence::prepareInsert(int pos, int num_sites)
   adjustCapacity(new_size);
   
   // Shift any sites needed...
-  for (int i = old_size - 1; i >= pos; i--) m_seq[i + num_sites] = m_seq[i];
+  Instruction* data = m_seq.writableData();
+  for (int i = old_size - 1; i >= pos; i--) data[i + num_sites] = data[i];
 }
 
 
@@ -189,7 +313,8 @@ void Avida::InstructionSequence::Copy(int to, int from)
 {
   assert(to   >= 0   && to   < m_active_size);
   assert(from >= 0   && from < m_active_size);
-  m_seq[to] = m_seq[from];
+  const Instruction inst = m_seq.GetData()[from];
+  m_seq.SetInst(to, inst);
 }
  
 
@@ -223,7 +348,10 @@ void Avida::InstructionSequence::Resize(int new_size)
   const int old_size = m_active_size;
   adjustCapacity(new_size);
   
-  for (int i = old_size; i < new_size; i++) m_seq[i].SetOp(0);
+  if (new_size > old_size) {
+    Instruction* data = m_seq.writableData();
+    for (int i = old_size; i < new_size; i++) data[i].SetOp(0);
+  }
 }
 
 void Avida::InstructionSequence::Insert(int pos, const Instruction& inst)
@@ -232,7 +360,7 @@ void Avida::InstructionSequence::Insert(int pos, const Instruction& inst)
   assert(pos <= m_seq.GetSize());
   
   prepareInsert(pos, 1);
-  m_seq[pos] = inst;
+  m_seq.SetInst(pos, inst);
 }
 
 void Avida::InstructionSequence::Insert(int pos, const InstructionSequence& seq)
@@ -241,7 +369,9 @@ void Avida::InstructionSequence::Insert(int pos, const InstructionSequence& seq)
   assert(pos <= m_seq.GetSize());
   
   prepareInsert(pos, seq.GetSize());
-  for (int i = 0; i < seq.GetSize(); i++) m_seq[i + pos] = seq[i];
+  const Instruction* src = seq.m_seq.GetData();
+  Instruction* data = m_seq.writableData();
+  for (int i = 0; i < seq.GetSize(); i++) data[i + pos] = src[i];
 }
 
 void Avida::InstructionSequence::Remove(int pos, int num_sites)
@@ -251,7 +381,8 @@ void Avida::InstructionSequence::Remove(int pos, int num_sites)
   assert(pos + num_sites <= m_active_size); // Cannot extend past end of sequence
   
   const int new_size = m_active_size - num_sites;
-  for (int i = pos; i < new_size; i++) m_seq[i] = m_seq[i + num_sites];
+  Instruction* data = m_seq.writableData();
+  for (int i = pos; i < new_size; i++) data[i] = data[i + num_sites];
   adjustCapacity(new_size);
 }
 
@@ -268,7 +399,9 @@ void Avida::InstructionSequence::Replace(int pos, int num_sites, const Instructi
   else if (size_change < 0) Remove(pos, -size_change);
   
   // Now just copy everything over!
-  for (int i = 0; i < seq.GetSize(); i++) m_seq[i + pos] = seq[i];
+  const Instruction* src = seq.m_seq.GetData();
+  Instruction* data = m_seq.writableData();
+  for (int i = 0; i < seq.GetSize(); i++) data[i + pos] = src[i];
 }
 
 
@@ -345,11 +478,9 @@ void Avida::InstructionSequence::Rotate(int n)
 
 void Avida::InstructionSequence::operator=(const InstructionSequence& other_seq)
 {
+  // Storage is shared until either sequence is modified
+  m_seq = other_seq.m_seq;
   m_active_size = other_seq.m_active_size;
-  m_seq.ResizeClear(m_active_size);
-  
-  // Now that both code arrays are the same size, copy the other one over
-  for (int i = 0; i < m_active_size; i++) m_seq[i] = other_seq[i];
 }
 
 
@@ -361,6 +492,11 @@ bool Avida::InstructionSequence::operator==(const GeneticRepresentation& other_s
   // Make sure the sizes are the same.
   if (m_active_size != seq->m_active_size) return false;
   
+  // Sequences sharing storage are identical, and differing hashes rule out a match without a scan
+  if (m_seq.SharesStorage(seq->m_seq)) return true;
+  if (m_seq.HasHash(m_active_size) && seq->m_seq.HasHash(m_active_size) &&
+      m_seq.Hash(m_active_size) != seq->m_seq.Hash(m_active_size)) return false;
+  
   // Then go through line by line.
   for (int i = 0; i < m_active_size; i++)
     if (m_seq[i] != (*seq)[i]) return false;
@@ -436,7 +572,9 @@ Avida::InstructionSequence Avida::InstructionSequence::Crop(int start, int end)
   
   const int out_length = end - start;
   InstructionSequence out_seq(out_length);
-  for (int i = 0; i < out_length; i++) out_seq[i] = m_seq[i+start];
+  const Instruction* src = m_seq.GetData();
+  Instruction* data = out_seq.m_seq.writableData();
+  for (int i = 0; i < out_length; i++) data[i] = src[i + start];
   
   return out_seq;
 }
@@ -454,8 +592,10 @@ Avida::InstructionSequence Avida::InstructionSequence::Cut(int start, int end) c
   assert(out_length > 0);             // Can't cut everything!
   
   InstructionSequence out_seq(out_length);
-  for (int i = 0; i < start; i++) out_seq[i] = m_seq[i];
-  for (int i = start; i < out_length; i++) out_seq[i] = m_seq[i + cut_length];
+  const Instruction* src = m_seq.GetData();
+  Instruction* data = out_seq.m_seq.writableData();
+  for (int i = 0; i < start; i++) data[i] = src[i];
+  for (int i = start; i < out_length; i++) data[i] = src[i + cut_length];
   
   return out_seq;
 }  
@@ -467,8 +607,11 @@ Avida::InstructionSequence Avida::InstructionSequence::Join(const InstructionSeq
   const int out_length = length1 + length2;
   
   InstructionSequence out_seq(out_length);
-  for (int i = 0; i < length1; i++) out_seq[i] = lhs[i];
-  for (int i = 0; i < length2; i++) out_seq[i + length1] = rhs[i];
+  const Instruction* src1 = lhs.m_seq.GetData();
+  const Instruction* src2 = rhs.m_seq.GetData();
+  Instruction* data = out_seq.m_seq.writableData();
+  for (int i = 0; i < length1; i++) data[i] = src1[i];
+  for (int i = 0; i < length2; i++) data[i + length1] = src2[i];
   
   return out_seq;
 }
@@ -25,7 +25,8 @@
 using namespace std;
 using namespace Avida;
 
-cCPUMemory::cCPUMemory(const cCPUMemory& in_memory) : InstructionSequence(in_memory), m_flag_array(in_memory.GetSize())
+cCPUMemory::cCPUMemory(const cCPUMemory& in_memory)
+  : InstructionSequence(in_memory), m_flag_array(in_memory.GetSize()), m_copy_true_size(-1), m_copy_true_sites(0)
 {
   for (int i = 0; i < m_flag_array.GetSize(); i++) m_flag_array[i] = in_memory.m_flag_array[i];
 }
@@ -49,7 +50,8 @@ void cCPUMemory::prepareInsert(int pos, int num_sites)
   adjustCapacity(new_size);
   
   // Shift any sites needed...
-  for (int i = old_size - 1; i >= pos; i--) m_seq[i + num_sites] = m_seq[i];
+  Instruction* data = m_seq.GetWritableData();
+  for (int i = old_size - 1; i >= pos; i--) data[i + num_sites] = data[i];
   for (int i = old_size - 1; i >= pos; i--) m_flag_array[i + num_sites] = m_flag_array[i];
 }
 
@@ -70,10 +72,15 @@ void cCPUMemory::Resize(int new_size)
   const int old_size = m_active_size;
   adjustCapacity(new_size);
   
-  for (int i = old_size; i < new_size; i++) {
-    m_seq[i].SetOp(0);
-    m_flag_array[i] = 0;
+  if (new_size > old_size) {
+    Instruction* data = m_seq.GetWritableData();
+    for (int i = old_size; i < new_size; i++) {
+      data[i].SetOp(0);
+      m_flag_array[i] = 0;
+    }
   }
+  
+  if (new_size < copyTrueExtent()) ClearCopyTrue();
 }
 
 
@@ -85,6 +92,8 @@ void cCPUMemory::ResizeOld(int new_size)
   adjustCapacity(new_size);
 
   for (int i = old_size; i < new_size; i++) m_flag_array[i] = 0;
+  
+  if (new_size < copyTrueExtent()) ClearCopyTrue();
 }
 
 
@@ -97,6 +106,7 @@ void cCPUMemory::Copy(int to, int from)
   
   m_seq[to] = m_seq[from];
   m_flag_array[to] = m_flag_array[from];
+  if (to < copyTrueExtent()) ClearCopyTrue();
 }
 
 
@@ -108,6 +118,7 @@ void cCPUMemory::Insert(int pos, const Instruction& inst)
   prepareInsert(pos, 1);
   m_seq[pos] = inst;
   m_flag_array[pos] = 0;
+  ClearCopyTrue();
 }
 
 void cCPUMemory::Insert(int pos, const InstructionSequence& genome)
@@ -116,10 +127,12 @@ void cCPUMemory::Insert(int pos, const InstructionSequence& genome)
   assert(pos <= m_seq.GetSize());
 
   prepareInsert(pos, genome.GetSize());
+  Instruction* data = m_seq.GetWritableData();
   for (int i = 0; i < genome.GetSize(); i++) {
-    m_seq[i + pos] = genome[i];
+    data[i + pos] = genome[i];
     m_flag_array[i + pos] = 0;
   }
+  ClearCopyTrue();
 }
 
 void cCPUMemory::Remove(int pos, int num_sites)
@@ -129,11 +142,13 @@ void cCPUMemory::Remove(int pos, int num_sites)
   assert(pos + num_sites <= m_active_size); // Cannot extend past end of genome.
 
   const int new_size = m_active_size - num_sites;
+  Instruction* data = m_seq.GetWritableData();
   for (int i = pos; i < new_size; i++) {
-    m_seq[i] = m_seq[i + num_sites];
+    data[i] = data[i + num_sites];
     m_flag_array[i] = m_flag_array[i + num_sites];
   }
   adjustCapacity(new_size);
+  ClearCopyTrue();
 }
 
 void cCPUMemory::Replace(int pos, int num_sites, const InstructionSequence& genome)
@@ -149,33 +164,29 @@ void cCPUMemory::Replace(int pos, int num_sites, const InstructionSequence& geno
   else if (size_change < 0) Remove(pos, -size_change);
   
   // Now just copy everything over!
+  Instruction* data = m_seq.GetWritableData();
   for (int i = 0; i < genome.GetSize(); i++) {
-    m_seq[i + pos] = genome[i];
+    data[i + pos] = genome[i];
     m_flag_array[i + pos] = 0;
   }
+  ClearCopyTrue();
 }
 
 
 void cCPUMemory::operator=(const cCPUMemory& other_memory)
 {
-  adjustCapacity(other_memory.m_active_size);
-  
-  // Fill in the new information...
-  for (int i = 0; i < m_active_size; i++) {
-    m_seq[i] = other_memory.m_seq[i];
-    m_flag_array[i] = other_memory.m_flag_array[i];
-  }
+  // The instructions are shared until the first write, only the flags are copied
+  InstructionSequence::operator=(other_memory);
+  m_flag_array = other_memory.m_flag_array;
+  ClearCopyTrue();
 }
 
 
 void cCPUMemory::operator=(const InstructionSequence& other_genome)
 {
-  adjustCapacity(other_genome.GetSize());
-  
-  // Fill in the new information...
-  for (int i = 0; i < m_active_size; i++) {
-    m_seq[i] = other_genome[i];
-    m_flag_array[i] = 0;
-  }
+  InstructionSequence::operator=(other_genome);
+  m_flag_array.ResizeClear(m_seq.GetSize());
+  ClearFlags();
+  ClearCopyTrue();
 }
 
@@ -39,15 +39,28 @@ private:
 	static const unsigned char MASK_UNUSED2  = 0x80; // unused bit
   
   Apto::Array<unsigned char> m_flag_array;
+  
+  // Copy true tracking - whether an exact copy of the genome is being laid down after it (see ArmCopyTrue)
+  int m_copy_true_size;             // Size of the genome the memory held when armed, -1 once it may have diverged
+  int m_copy_true_sites;            // Leading genome sites copied, unmutated and in order, directly after it
 
   void adjustCapacity(int new_size);
   void prepareInsert(int pos, int num_sites);
+  
+  // Writes below this position can break either the armed genome or the copy laid down so far
+  inline int copyTrueExtent() const { return m_copy_true_size + m_copy_true_sites; }
 
 public:
   cCPUMemory(const cCPUMemory& in_memory);
-  cCPUMemory(const InstructionSequence& in_genome) : InstructionSequence(in_genome), m_flag_array(in_genome.GetSize()) { ; }
-  explicit cCPUMemory(int size = 1)  : InstructionSequence(size), m_flag_array(size) { ClearFlags(); }
-  cCPUMemory(const Apto::String& in_string) : InstructionSequence(in_string), m_flag_array(in_string.GetSize()) { ; }
+  cCPUMemory(const InstructionSequence& in_genome)
+    : InstructionSequence(in_genome), m_flag_array(in_genome.GetSize()), m_copy_true_size(-1), m_copy_true_sites(0) { ; }
+  explicit cCPUMemory(int size = 1)
+    : InstructionSequence(size), m_flag_array(size), m_copy_true_size(-1), m_copy_true_sites(0)
+  {
+    ClearFlags();
+  }
+  cCPUMemory(const Apto::String& in_string)
+    : InstructionSequence(in_string), m_flag_array(in_string.GetSize()), m_copy_true_size(-1), m_copy_true_sites(0) { ; }
   ~cCPUMemory() { ; }
 
   inline bool FlagCopied(int pos) const     { return (MASK_COPIED   & m_flag_array[pos]) != 0; }
@@ -78,8 +91,44 @@ public:
 			m_seq[i].SetOp(0);
 			m_flag_array[i] = 0;
 		}
+    ClearCopyTrue();
 	}
   inline void ClearFlags() { m_flag_array.SetAll(0); }
+  
+  
+  // Site access - shadows InstructionSequence so that writes through the memory can clear copy true tracking
+  inline Avida::Instruction& operator[](int idx)
+  {
+    if (idx < copyTrueExtent()) ClearCopyTrue();
+    return InstructionSequence::operator[](idx);
+  }
+  inline const Avida::Instruction& operator[](int idx) const { return InstructionSequence::operator[](idx); }
+  inline void SetInst(int idx, const Avida::Instruction& inst)
+  {
+    if (idx < copyTrueExtent()) ClearCopyTrue();
+    InstructionSequence::SetInst(idx, inst);
+  }
+  
+  // Copy instruction write - from is the genome site the instruction was read from, -1 if it was mutated
+  inline void SetCopiedInst(int pos, const Avida::Instruction& inst, int from)
+  {
+    if (from == m_copy_true_sites && from < m_copy_true_size && pos == copyTrueExtent()) m_copy_true_sites++;
+    else if (pos < copyTrueExtent()) ClearCopyTrue();
+    InstructionSequence::operator[](pos) = inst;
+  }
+  
+  
+  // Copy true tracking, always on and cleared by any write that may break the copy.  Armed by the hardware while the
+  // memory holds exactly its organism's genome; copies through SetCopiedInst that lay each site down unmutated, in
+  // order, directly after the genome count towards a true copy.  Writes through InstructionSequence references (e.g.
+  // slip mutations) are not seen, so callers must clear the state around them.
+  inline void ArmCopyTrue() { m_copy_true_size = m_active_size; m_copy_true_sites = 0; }
+  inline void ClearCopyTrue() { m_copy_true_size = -1; m_copy_true_sites = 0; }
+  inline bool IsCopyTrue(int parent_size, int child_size) const
+  {
+    return m_copy_true_size == parent_size && child_size == parent_size && m_copy_true_sites == parent_size;
+  }
+
   void Reset(int new_size);     // Reset size, clearing contents...
   void ResizeOld(int new_size); // Reset size, save contents, init to previous
     
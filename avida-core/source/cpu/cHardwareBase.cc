@@ -53,6 +53,7 @@ cHardwareBase::cHardwareBase(cWorld* world, cOrganism* in_organism, cInstSet* in
 , m_has_res_costs(m_inst_set->HasResCosts()), m_has_fem_res_costs(m_inst_set->HasFemResCosts())
 , m_has_female_costs(m_inst_set->HasFemaleCosts()), m_has_choosy_female_costs(m_inst_set->HasChoosyFemaleCosts())
 , m_has_post_costs(inst_set->HasPostCosts()), m_has_bonus_costs(inst_set->HasBonusCosts())
+, m_offspring_copy_true(false)
 {
 	m_task_switching_cost=0;
 	int switch_cost =  world->GetConfig().TASK_SWITCH_PENALTY.Get();
@@ -858,6 +859,41 @@ unsigned cHardwareBase::Divide_DoExactMutations(cAvidaContext& ctx, double mut_m
 }
 
 
+// Hand the offspring the parent's genome once the hardware's copy tracking vouches for an exact copy, skipping the
+// crop of the memory.  Divide mutations applied afterwards detach the offspring from the parent's storage.
+void cHardwareBase::Divide_SetOffspringCopyTrue()
+{
+  m_organism->OffspringGenome() = m_organism->GetGenome();
+  m_offspring_copy_true = true;
+}
+
+
+// Set the phenotype's copy true state for the offspring of this divide.  A true copy takes over the parent's genome,
+// whose storage is shared with its genotype (and any other relatives descended by true copies), letting the genotype
+// classify it without comparing sequences.
+void cHardwareBase::Divide_CheckCopyTrue()
+{
+  cPhenotype& phenotype = m_organism->GetPhenotype();
+  const Genome& offspring = m_organism->OffspringGenome();
+  const Genome& parent = m_organism->GetGenome();
+  
+  // A tracked copy that still shares the parent's storage was not touched by divide mutations
+  ConstInstructionSequencePtr offspring_seq, parent_seq;
+  if (m_offspring_copy_true) {
+    offspring_seq.DynamicCastFrom(offspring.Representation());
+    parent_seq.DynamicCastFrom(parent.Representation());
+  }
+  m_offspring_copy_true = false;
+  if (offspring_seq && parent_seq && offspring_seq->SharesStorage(*parent_seq)) {
+    phenotype.CopyTrue() = true;
+    return;
+  }
+  
+  phenotype.CopyTrue() = (offspring == parent);
+  if (phenotype.CopyTrue()) m_organism->OffspringGenome() = parent;
+}
+
+
 // test whether the offspring creature contains an advantageous mutation.
 /*
  Return true iff only a reversion is performed -- returns false is sterilized regardless of whether or 
@@ -866,7 +902,7 @@ unsigned cHardwareBase::Divide_DoExactMutations(cAvidaContext& ctx, double mut_m
 bool cHardwareBase::Divide_TestFitnessMeasures(cAvidaContext& ctx)
 {
   cPhenotype & phenotype = m_organism->GetPhenotype();
-  phenotype.CopyTrue() = ( m_organism->OffspringGenome() == m_organism->GetGenome() );
+  Divide_CheckCopyTrue();
   phenotype.ChildFertile() = true;
 	
   // Only continue if we're supposed to do a fitness test on divide...
@@ -885,12 +921,11 @@ bool cHardwareBase::Divide_TestFitnessMeasures(cAvidaContext& ctx)
   const double neut_min = parent_fitness * (1.0 - m_organism->GetNeutralMin());
   const double neut_max = parent_fitness * (1.0 + m_organism->GetNeutralMax());
   
-  cTestCPU* testcpu = m_world->GetHardwareManager().CreateTestCPU(ctx);
+  cTestCPULease testcpu(ctx, m_world->GetHardwareManager());
   cCPUTestInfo test_info;
   test_info.UseRandomInputs();
   testcpu->TestGenome(ctx, test_info, m_organism->OffspringGenome());
   const double child_fitness = test_info.GetGenotypeFitness();
-  delete testcpu;
   
   bool revert = false;
   bool sterilize = false;
@@ -978,7 +1013,7 @@ bool cHardwareBase::Divide_TestFitnessMeasures(cAvidaContext& ctx)
 bool cHardwareBase::Divide_TestFitnessMeasures1(cAvidaContext& ctx)
 {
   cPhenotype & phenotype = m_organism->GetPhenotype();
-  phenotype.CopyTrue() = (m_organism->OffspringGenome() == m_organism->GetGenome());
+  Divide_CheckCopyTrue();
   phenotype.ChildFertile() = true;
 	
   // Only continue if we're supposed to do a fitness test on divide...
@@ -997,12 +1032,11 @@ bool cHardwareBase::Divide_TestFitnessMeasures1(cAvidaContext& ctx)
   const double neut_min = parent_fitness * (1.0 - m_organism->GetNeutralMin());
   const double neut_max = parent_fitness * (1.0 + m_organism->GetNeutralMax());
   
-  cTestCPU* testcpu = m_world->GetHardwareManager().CreateTestCPU(ctx);
+  cTestCPULease testcpu(ctx, m_world->GetHardwareManager());
   cCPUTestInfo test_info;
   test_info.UseRandomInputs();
   testcpu->TestGenome(ctx, test_info, m_organism->OffspringGenome());
   const double child_fitness = test_info.GetGenotypeFitness();
-  delete testcpu;
   
   bool revert = false;
   bool sterilize = false;
@@ -99,6 +99,7 @@ protected:
   // --------  Base Hardware Feature Support  ---------
   Apto::Array<int, Apto::Smart> m_ext_mem;
   bool m_implicit_repro_active;
+  bool m_offspring_copy_true;             // Offspring was handed the parent's genome by Divide_SetOffspringCopyTrue
   
 	// --------  Bit masks  ---------
 	static const unsigned int MASK_SIGNBIT = 0x7FFFFFFF;	
@@ -288,6 +289,8 @@ protected:
   bool Divide_CheckViable(cAvidaContext& ctx, const int parent_size, const int child_size, bool using_repro = false);
   unsigned Divide_DoExactMutations(cAvidaContext& ctx, double mut_multiplier = 1.0, const int pointmut = INT_MAX);
   bool Divide_TestFitnessMeasures1(cAvidaContext& ctx);
+  void Divide_SetOffspringCopyTrue();
+  void Divide_CheckCopyTrue();
   
 
 private:
@@ -789,6 +789,7 @@ cHardwareCPU::cHardwareCPU(cAvidaContext& ctx, cWorld* world, cOrganism* in_orga
   ConstInstructionSequencePtr in_seq_p;
   in_seq_p.DynamicCastFrom(in_genome.Representation());
   m_memory = *in_seq_p;
+  m_memory.ArmCopyTrue();
   
   Reset(ctx);                            // Setup the rest of the hardware...
   internalReset();
@@ -1071,7 +1072,11 @@ bool cHardwareCPU::SingleProcess_ExecuteInst(cAvidaContext& ctx, const Instructi
   m_organism->GetPhenotype().IncCurInstCount(actual_inst.GetOp());
 	
   // And execute it.
-  const bool exec_success = (this->*(m_functions[inst_idx]))(ctx);
+  bool exec_success;
+  {
+    cInstProfiler::Sample profile(m_inst_set->GetProfiler(), ctx, inst_idx);
+    exec_success = (this->*(m_functions[inst_idx]))(ctx);
+  }
   
   // NOTE: Organism may be dead now if instruction executed killed it (such as some divides, "die", or "explode")
   
@@ -1782,25 +1787,31 @@ bool cHardwareCPU::Divide_Main(cAvidaContext& ctx, const int div_point,
   if (viable == false) return false;
 	
   // Since the divide will now succeed, set up the information to be sent
-  // to the new organism
-  InstructionSequencePtr offspring_seq(new InstructionSequence(m_memory.Crop(div_point, div_point + child_size)));
-  HashPropertyMap props;
-  cHardwareManager::SetupPropertyMap(props, (const char*)m_inst_set->GetInstSetName());
-  Genome offspring(GetType(), props, offspring_seq);
+  // to the new organism; a tracked true copy simply takes over the parent's genome
+  const bool copy_true = m_memory.IsCopyTrue(div_point, child_size);
+  if (copy_true) {
+    Divide_SetOffspringCopyTrue();
+  } else {
+    InstructionSequencePtr offspring_seq(new InstructionSequence(m_memory.Crop(div_point, div_point + child_size)));
+    HashPropertyMap props;
+    cHardwareManager::SetupPropertyMap(props, (const char*)m_inst_set->GetInstSetName());
+    Genome offspring(GetType(), props, offspring_seq);
+    
+    // Make sure it is an exact copy at this point (before divide mutations) if required
+    const Genome& base_genome = m_organism->GetGenome();
+    ConstInstructionSequencePtr seq_p;
+    seq_p.DynamicCastFrom(base_genome.Representation());
+    const InstructionSequence& seq = *seq_p;
+    if (m_world->GetConfig().REQUIRE_EXACT_COPY.Get() && (seq != *offspring_seq) ) {
+      return false;
+    }
     
-  // Make sure it is an exact copy at this point (before divide mutations) if required
-  const Genome& base_genome = m_organism->GetGenome();
-  ConstInstructionSequencePtr seq_p;
-  seq_p.DynamicCastFrom(base_genome.Representation());
-  const InstructionSequence& seq = *seq_p;
-  if (m_world->GetConfig().REQUIRE_EXACT_COPY.Get() && (seq != *offspring_seq) ) {
-    return false;
+    m_organism->OffspringGenome() = offspring;
   }
   
-  m_organism->OffspringGenome() = offspring;
-  
-  // Cut off everything in this memory past the divide point.
+  // Cut off everything in this memory past the divide point.  After a true copy it again holds exactly the genome.
   m_memory.Resize(div_point);
+  if (copy_true) m_memory.ArmCopyTrue();
   
   // Handle Divide Mutations...
   Divide_DoMutations(ctx, mut_multiplier);
@@ -3525,7 +3536,7 @@ bool cHardwareCPU::Inst_SenseQuorum(cAvidaContext& ctx) {
       cOrganism* org_temp = neighbor_cell.GetOrganism();
       /*
        if (distance == 0) {
-       int temp_id = org_temp->SystematicsGroup("genotype")->ID();
+       int temp_id = org_temp->SystematicsGroup(Systematics::ROLE_GENOTYPE)->ID();
        if (temp_id != bgid) kincounter++;
        } else {
        
@@ -3597,7 +3608,7 @@ bool cHardwareCPU::Inst_NoisyQuorum(cAvidaContext& ctx) {
       cOrganism* org_temp = neighbor_cell.GetOrganism();
       /*
        if (distance == 0) {
-       int temp_id = org_temp->SystematicsGroup("genotype")->ID();
+       int temp_id = org_temp->SystematicsGroup(Systematics::ROLE_GENOTYPE)->ID();
        if (temp_id != bgid) kincounter++;
        } else {
        
@@ -4303,16 +4314,9 @@ bool cHardwareCPU::DoSense(cAvidaContext& ctx, int conversion_method, double bas
   // There are no resources, return
   if (res_count.GetSize() == 0) return false;
   
-  // Only recalculate logs if these values have changed
-  static int last_num_resources = 0;
-  static int max_label_length = 0;
+  // Computed per call: the resource count and NOP count may differ between worlds sharing this code
   int num_nops = GetInstSet().GetNumNops();
-  
-  if ((last_num_resources != res_count.GetSize()))
-  {
-    max_label_length = (int) ceil(log((double)res_count.GetSize())/log((double)num_nops));
-    last_num_resources = res_count.GetSize();
-  }
+  const int max_label_length = (int) ceil(log((double)res_count.GetSize())/log((double)num_nops));
   
   // Convert modifying NOPs to the index of the resource.
   // If there are fewer than the number of NOPs required
@@ -5048,7 +5052,7 @@ bool cHardwareCPU::Inst_DonateKin(cAvidaContext& ctx)
   if (max_dist != -1) {
     int max_id = neighbor_id + num_neighbors;
     bool found = false;
-    Systematics::GroupPtr bg = m_organism->SystematicsGroup("genotype");
+    Systematics::GroupPtr bg = m_organism->SystematicsGroup(Systematics::ROLE_GENOTYPE);
     if (!bg) return false;
     Systematics::SexualAncestryPtr sa = bg->GetData<Systematics::SexualAncestry>();
     if (!sa) {
@@ -5059,7 +5063,7 @@ bool cHardwareCPU::Inst_DonateKin(cAvidaContext& ctx)
     while (neighbor_id < max_id) {
       neighbor = m_organism->GetNeighbor();
       if (neighbor != NULL) {
-        Systematics::GroupPtr nbg = neighbor->SystematicsGroup("genotype");
+        Systematics::GroupPtr nbg = neighbor->SystematicsGroup(Systematics::ROLE_GENOTYPE);
         assert(nbg);
         if (sa->GetPhyloDistance(nbg) <= max_dist) {
           found = true;
@@ -5123,41 +5127,6 @@ bool cHardwareCPU::Inst_DonateEditDist(cAvidaContext& ctx)
       }
       if (edit_dist <= max_dist) {
         found = true;
-				
-        // Code to track the edit distance between edt donors and recipients
-        const Genome& org_genome = m_organism->GetGenome();
-        ConstInstructionSequencePtr org_seq_p;
-        org_seq_p.DynamicCastFrom(org_genome.Representation());
-        const InstructionSequence& org_seq = *org_seq_p;
-        
-        const Genome& neighbor_genome = neighbor->GetGenome();
-        ConstInstructionSequencePtr neighbor_seq_p;
-        neighbor_seq_p.DynamicCastFrom(neighbor_genome.Representation());
-        const InstructionSequence& neighbor_seq = *neighbor_seq_p;
-        
-        const int edit_dist = InstructionSequence::FindEditDistance(org_seq, neighbor_seq);
-				
-        /*static ofstream edit_file("edit_dists.dat");*/
-        static int num_edit_donates = 0;
-        static int num_edit_donates_15_dist = 0;
-        static int tot_dist_edit_donate = 0;
-				
-        num_edit_donates++;
-        if (edit_dist > 15) num_edit_donates_15_dist++;
-        tot_dist_edit_donate += edit_dist;
-        
-        if (num_edit_donates == 1000) {
-          /*
-           edit_file << num_edit_donates << " "
-           << (double) num_edit_donates_15_dist / (double) num_edit_donates << " "
-           << (double) tot_dist_edit_donate / (double) num_edit_donates << endl;
-           */
-					
-          num_edit_donates = 0;
-          num_edit_donates_15_dist = 0;
-          tot_dist_edit_donate = 0;
-        }
-        
         break;
       }
       m_organism->Rotate(ctx, 1);
@@ -5343,40 +5312,6 @@ bool cHardwareCPU::Inst_DonateShadedGreenBeard(cAvidaContext& ctx)
       // shade (color/number of donations)
       //			if (neighbor_shade_of_gb >=  shade_of_gb) {
       if (neighbor_shade_of_gb ==  shade_of_gb) {	
-        // Code to track the edit distance between shaded donors and recipients
-        const Genome& org_genome = m_organism->GetGenome();
-        ConstInstructionSequencePtr org_seq_p;
-        org_seq_p.DynamicCastFrom(org_genome.Representation());
-        const InstructionSequence& org_seq = *org_seq_p;
-        
-        const Genome& neighbor_genome = neighbor->GetGenome();
-        ConstInstructionSequencePtr neighbor_seq_p;
-        neighbor_seq_p.DynamicCastFrom(neighbor_genome.Representation());
-        const InstructionSequence& neighbor_seq = *neighbor_seq_p;
-        
-        const int edit_dist = InstructionSequence::FindEditDistance(org_seq, neighbor_seq);
-				
-        /*static ofstream gb_file("shaded_gb_dists.dat");*/
-        static int num_gb_donates = 0;
-        static int num_gb_donates_15_dist = 0;
-        static int tot_dist_gb_donate = 0;
-				
-        num_gb_donates++;
-        if (edit_dist > 15) num_gb_donates_15_dist++;
-        tot_dist_gb_donate += edit_dist;
-				
-        if (num_gb_donates == 1000) {
-          /*
-           gb_file << num_gb_donates << " "
-           << (double) num_gb_donates_15_dist / (double) num_gb_donates << " "
-           << (double) tot_dist_gb_donate / (double) num_gb_donates << endl;
-           */
-					
-          num_gb_donates = 0;
-          num_gb_donates_15_dist = 0;
-          tot_dist_gb_donate = 0;
-        }
-				
         found = true;
       }
     }
@@ -5538,39 +5473,11 @@ bool cHardwareCPU::Inst_DonateThreshGreenBeard(cAvidaContext& ctx)
       }
 			
       if (neighbor_thresh_of_gb >= m_world->GetConfig().MIN_GB_DONATE_THRESHOLD.Get() ) {
-        const Genome& org_gen = m_organism->GetGenome();
-        ConstInstructionSequencePtr org_seq_p;
-        org_seq_p.DynamicCastFrom(org_gen.Representation());
-        const InstructionSequence& org_seq = *org_seq_p;
-
         const Genome& neighbor_gen = neighbor->GetGenome();
         ConstInstructionSequencePtr neighbor_seq_p;
         neighbor_seq_p.DynamicCastFrom(neighbor_gen.Representation());
         const InstructionSequence& neighbor_seq = *neighbor_seq_p;
         
-        // Code to track the edit distance between tgb donors and recipients
-        const int edit_dist = InstructionSequence::FindEditDistance(org_seq, neighbor_seq);
-				
-        /*static ofstream tgb_file("thresh_gb_dists.dat");*/
-        static int num_tgb_donates = 0;
-        static int num_tgb_donates_15_dist = 0;
-        static int tot_dist_tgb_donate = 0;
-        
-        num_tgb_donates++;
-        if (edit_dist > 15) num_tgb_donates_15_dist++;
-        tot_dist_tgb_donate += edit_dist;
-				
-        if (num_tgb_donates == 1000) {
-          /*
-           tgb_file << num_tgb_donates << " "
-           << (double) num_tgb_donates_15_dist / (double) num_tgb_donates << " "
-           << (double) tot_dist_tgb_donate / (double) num_tgb_donates << endl;
-           */
-          
-          num_tgb_donates = 0;
-          num_tgb_donates_15_dist = 0;
-          tot_dist_tgb_donate = 0;
-        }
         
         // for each instruction in the genome...
         for (int i=0;i<neighbor_seq.GetSize();i++){
@@ -7118,6 +7025,7 @@ bool cHardwareCPU::Inst_HeadWrite(cAvidaContext& ctx)
   if (m_organism->TestCopyDel(ctx)) active_head.RemoveInst();
   if (m_organism->TestCopyUniform(ctx)) doUniformCopyMutation(ctx, active_head);
   if (!m_slip_read_head && m_organism->TestCopySlip(ctx)) {
+    m_memory.ClearCopyTrue();
     doSlipMutation(ctx, m_memory, active_head.GetPosition());
   }
   
@@ -7138,16 +7046,18 @@ bool cHardwareCPU::Inst_HeadCopy(cAvidaContext& ctx)
   
   // Do mutations.
   Instruction read_inst = read_head.GetInst();
+  int copied_from = read_head.GetPosition();
   ReadInst(read_inst.GetOp());
   
   //checkNoMutList is for head to head kaboom experiments
   if (m_organism->TestCopyMut(ctx) && !(checkNoMutList(read_head))) {
     read_inst = m_inst_set->GetRandomInst(ctx);
+    copied_from = -1;
     write_head.SetFlagMutated();
     write_head.SetFlagCopyMut();
   }
   
-  write_head.SetInst(read_inst);
+  write_head.SetCopiedInst(read_inst, copied_from);
   write_head.SetFlagCopied();  // Set the copied flag...
   
   if (m_organism->TestCopyIns(ctx)) write_head.InsertInst(m_inst_set->GetRandomInst(ctx));
@@ -7157,6 +7067,7 @@ bool cHardwareCPU::Inst_HeadCopy(cAvidaContext& ctx)
     if (m_slip_read_head) {
       read_head.Set(ctx.GetRandom().GetInt(m_memory.GetSize()));
     } else {
+      m_memory.ClearCopyTrue();
       doSlipMutation(ctx, m_memory, write_head.GetPosition());
     }
   }
@@ -7223,6 +7134,7 @@ bool cHardwareCPU::HeadCopy_ErrorCorrect(cAvidaContext& ctx, double reduction)
     if (m_slip_read_head) {
       read_head.Set(ctx.GetRandom().GetInt(m_memory.GetSize()));
     } else {
+      m_memory.ClearCopyTrue();
       doSlipMutation(ctx, m_memory, write_head.GetPosition());
     }
   }
@@ -8411,15 +8323,9 @@ bool cHardwareCPU::DoSenseFacing(cAvidaContext& ctx, int conversion_method, doub
   // There are no resources, return
   if (res_count.GetSize() == 0) return false;
   
-  // Only recalculate logs if these values have changed
-  static int last_num_resources = 0;
-  static int max_label_length = 0;
+  // Computed per call: the resource count and NOP count may differ between worlds sharing this code
   int num_nops = GetInstSet().GetNumNops();
-  
-  if ((last_num_resources != res_count.GetSize())) {
-    max_label_length = (int) ceil(log((double)res_count.GetSize())/log((double)num_nops));
-    last_num_resources = res_count.GetSize();
-  }
+  const int max_label_length = (int) ceil(log((double)res_count.GetSize())/log((double)num_nops));
   
   // Convert modifying NOPs to the index of the resource.
   // If there are fewer than the number of NOPs required
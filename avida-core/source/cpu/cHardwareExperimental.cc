@@ -753,7 +753,11 @@ bool cHardwareExperimental::SingleProcess_ExecuteInst(cAvidaContext& ctx, const
   // And execute it.
   m_from_sensor = false;
   m_from_message = false;
-  const bool exec_success = (this->*(m_functions[inst_idx]))(ctx);
+  bool exec_success;
+  {
+    cInstProfiler::Sample profile(m_inst_set->GetProfiler(), ctx, inst_idx);
+    exec_success = (this->*(m_functions[inst_idx]))(ctx);
+  }
   
 	if (exec_success) {
     int code_len = m_world->GetConfig().INST_CODE_LENGTH.Get();
@@ -7181,7 +7185,7 @@ void cHardwareExperimental::TryPreyClone(cAvidaContext& ctx)
     // prey numbers can be crashing for other reasons and we wouldn't be using this switch if we didn't want an absolute min num prey
     // but can't dump a lot b/c could end up filling world with just clones (e.g. if attack happens when world is still being populated)
     int num_clones = abs(m_world->GetConfig().MIN_PREY.Get()) - m_world->GetStats().GetNumPreyCreatures();
-    for (int i = 0; i < min(2, num_clones); i++) m_organism->GetOrgInterface().InjectPreyClone(ctx, m_organism->SystematicsGroup("genotype")->ID());
+    for (int i = 0; i < min(2, num_clones); i++) m_organism->GetOrgInterface().InjectPreyClone(ctx, m_organism->SystematicsGroup(Systematics::ROLE_GENOTYPE)->ID());
   }
 }
 
@@ -623,7 +623,11 @@ bool cHardwareGP8::SingleProcess_ExecuteInst(cAvidaContext& ctx, const Instructi
   m_organism->GetPhenotype().IncCurInstCount(actual_inst.GetOp());
   
   // And execute it.
-  const bool exec_success = (this->*(m_functions[inst_idx]))(ctx);
+  bool exec_success;
+  {
+    cInstProfiler::Sample profile(m_inst_set->GetProfiler(), ctx, inst_idx);
+    exec_success = (this->*(m_functions[inst_idx]))(ctx);
+  }
   
   // decremenet if the instruction was not executed successfully
   if (exec_success == false) {
@@ -3236,7 +3240,7 @@ void cHardwareGP8::tryPreyClone(cAvidaContext& ctx)
     // prey numbers can be crashing for other reasons and we wouldn't be using this switch if we didn't want an absolute min num prey
     // but can't dump a lot b/c could end up filling world with just clones (e.g. if attack happens when world is still being populated)
     int num_clones = abs(m_world->GetConfig().MIN_PREY.Get()) - m_world->GetStats().GetNumPreyCreatures();
-    for (int i = 0; i < min(2, num_clones); i++) m_organism->GetOrgInterface().InjectPreyClone(ctx, m_organism->SystematicsGroup("genotype")->ID());
+    for (int i = 0; i < min(2, num_clones); i++) m_organism->GetOrgInterface().InjectPreyClone(ctx, m_organism->SystematicsGroup(Systematics::ROLE_GENOTYPE)->ID());
   }
 }
 
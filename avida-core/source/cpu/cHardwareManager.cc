@@ -44,6 +44,7 @@ static const Apto::BasicString<Apto::ThreadSafe> s_prop_id_instset("instset");
 
 cHardwareManager::cHardwareManager(cWorld* world)
 : m_world(world)
+, m_inst_profile_interval(0)
 {
   cString filename = world->GetConfig().INST_SET.Get();
   m_is_name_map.Set("(default)", 0);
@@ -53,6 +54,32 @@ cHardwareManager::cHardwareManager(cWorld* world)
 cHardwareManager::~cHardwareManager()
 {
   for (int i = 0; i < m_inst_sets.GetSize(); i++) delete m_inst_sets[i];
+  for (int i = 0; i < m_test_cpu_pool.GetSize(); i++) delete m_test_cpu_pool[i];
+}
+
+
+cTestCPU* cHardwareManager::AcquireTestCPU(cAvidaContext& ctx)
+{
+  cTestCPU* testcpu = NULL;
+  {
+    Apto::MutexAutoLock lock(m_test_cpu_mutex);
+    const int num_idle = m_test_cpu_pool.GetSize();
+    if (num_idle) {
+      testcpu = m_test_cpu_pool[num_idle - 1];
+      m_test_cpu_pool.Resize(num_idle - 1);
+    }
+  }
+  
+  if (!testcpu) return new cTestCPU(ctx, m_world);
+  
+  testcpu->Reset(ctx);
+  return testcpu;
+}
+
+void cHardwareManager::ReleaseTestCPU(cTestCPU* testcpu)
+{
+  Apto::MutexAutoLock lock(m_test_cpu_mutex);
+  m_test_cpu_pool.Push(testcpu);
 }
 
 
@@ -290,5 +317,14 @@ bool cHardwareManager::RegisterInstSet(const Apto::String& name, cInstSet* inst_
   m_inst_sets.Push(inst_set);
   m_is_name_map.Set(name, inst_set_id);  
   
+  if (m_inst_profile_interval > 0) inst_set->EnableProfiling(m_inst_profile_interval);
+  
   return true;
 }
+
+
+void cHardwareManager::EnableInstProfiling(int sample_interval)
+{
+  m_inst_profile_interval = (sample_interval < 1) ? 1 : sample_interval;
+  for (int i = 0; i < m_inst_sets.GetSize(); i++) m_inst_sets[i]->EnableProfiling(m_inst_profile_interval);
+}
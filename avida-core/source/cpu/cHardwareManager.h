@@ -22,6 +22,8 @@
 #ifndef cHardwareManager_h
 #define cHardwareManager_h
 
+#include "apto/core/Mutex.h"
+
 #include "cTestCPU.h"
 
 namespace Avida {
@@ -46,6 +48,10 @@ private:
   cWorld* m_world;
   Apto::Array<cInstSet*> m_inst_sets;
   Apto::Map<Apto::String, int> m_is_name_map;
+  int m_inst_profile_interval;
+  
+  Apto::Mutex m_test_cpu_mutex;
+  Apto::Array<cTestCPU*, Apto::Smart> m_test_cpu_pool;  // Idle test CPUs, ready for reuse
 
   
   cHardwareManager(); // @not_implemented
@@ -66,6 +72,10 @@ public:
   
   cHardwareBase* Create(cAvidaContext& ctx, cOrganism* org, const Genome& mg);
   inline cTestCPU* CreateTestCPU(cAvidaContext& ctx) { return new cTestCPU(ctx, m_world); }
+  
+  // Pooled test CPUs, reset before they are handed out; prefer cTestCPULease, which returns the CPU automatically
+  cTestCPU* AcquireTestCPU(cAvidaContext& ctx);
+  void ReleaseTestCPU(cTestCPU* testcpu);
 
   inline bool IsInstSet(const Apto::String& name) const { return m_is_name_map.Has(name); }
   
@@ -78,12 +88,38 @@ public:
   int GetNumInstSets() const { return m_inst_sets.GetSize(); }
   
   bool RegisterInstSet(const Apto::String& name, cInstSet* inst_set);
+  
+  // Enables sampled instruction execution profiling on all current and future instruction sets
+  void EnableInstProfiling(int sample_interval);
+  bool IsInstProfilingEnabled() const { return (m_inst_profile_interval > 0); }
     
 private:
   bool loadInstSet(int hw_type, const Apto::String& name, int stack_size, int uops_per_cycle, cStringList& sl, cUserFeedback* feedback);
 };
 
 
+// cTestCPULease - scoped use of a pooled test CPU, returned to its hardware manager when the lease goes out of scope
+
+class cTestCPULease
+{
+private:
+  cHardwareManager& m_mgr;
+  cTestCPU* m_testcpu;
+  
+  cTestCPULease(); // @not_implemented
+  cTestCPULease(const cTestCPULease&); // @not_implemented
+  cTestCPULease& operator=(const cTestCPULease&); // @not_implemented
+  
+public:
+  cTestCPULease(cAvidaContext& ctx, cHardwareManager& mgr) : m_mgr(mgr), m_testcpu(mgr.AcquireTestCPU(ctx)) { ; }
+  ~cTestCPULease() { m_mgr.ReleaseTestCPU(m_testcpu); }
+  
+  cTestCPU* operator->() const { return m_testcpu; }
+  cTestCPU& operator*() const { return *m_testcpu; }
+  cTestCPU* Get() const { return m_testcpu; }
+};
+
+
 inline const cInstSet& cHardwareManager::GetInstSet(const Apto::String& name) const
 {
   return (name == "(default)") ? *m_inst_sets[0] : *m_inst_sets[m_is_name_map.GetWithDefault(name, -1)];
@@ -38,8 +38,8 @@ void cHardwareStatusPrinter::TraceHardware(cAvidaContext& ctx, cHardwareBase& ha
   
   bool in_setup = false;
   if (m_minitracer && minitrace && !m_file->HeaderDone()) {
-    Apto::String genotype_name = organism->SystematicsGroup("genotype")->Properties().Get("genotype").StringValue();
-    hardware.SetupMiniTraceFileHeader(*m_file, organism->SystematicsGroup("genotype")->ID(), genotype_name);
+    Apto::String genotype_name = organism->SystematicsGroup(Systematics::ROLE_GENOTYPE)->Properties().Get("genotype").StringValue();
+    hardware.SetupMiniTraceFileHeader(*m_file, organism->SystematicsGroup(Systematics::ROLE_GENOTYPE)->ID(), genotype_name);
     in_setup = true;
   }
     
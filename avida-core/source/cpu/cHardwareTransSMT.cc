@@ -323,7 +323,11 @@ bool cHardwareTransSMT::SingleProcess_ExecuteInst(cAvidaContext& ctx, const Inst
   m_organism->GetPhenotype().IncCurInstCount(actual_inst.GetOp());
 	
   // And execute it.
-  const bool exec_success = (this->*(m_functions[inst_idx]))(ctx);
+  bool exec_success;
+  {
+    cInstProfiler::Sample profile(m_inst_set->GetProfiler(), ctx, inst_idx);
+    exec_success = (this->*(m_functions[inst_idx]))(ctx);
+  }
 	
   // decremenet if the instruction was not executed successfully
   if (exec_success == false) {
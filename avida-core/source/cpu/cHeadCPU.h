@@ -84,6 +84,7 @@ public:
   inline Instruction GetNextInst() const;
 
   inline void SetInst(const Instruction& value) { GetMemory()[m_position] = value; }
+  inline void SetCopiedInst(const Instruction& value, int from) { GetMemory().SetCopiedInst(m_position, value, from); }
   inline void InsertInst(const Instruction& inst) { GetMemory().Insert(m_position, inst); }
   inline void RemoveInst() { GetMemory().Remove(m_position); }
 
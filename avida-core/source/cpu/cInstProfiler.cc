@@ -0,0 +1,58 @@
+/*
+ *  cInstProfiler.cc
+ *  Avida
+ *
+ *  Copyright 2026 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "cInstProfiler.h"
+
+
+cInstProfiler::cInstProfiler(int lib_size, int sample_interval)
+  : m_entries(lib_size), m_sample_interval(1), m_countdown(1), m_rng_state(2463534242u)
+{
+  SetSampleInterval(sample_interval);
+}
+
+
+void cInstProfiler::SetSampleInterval(int sample_interval)
+{
+  m_sample_interval = (sample_interval < 1) ? 1 : sample_interval;
+  resetCountdown();
+}
+
+
+void cInstProfiler::Reset()
+{
+  for (int i = 0; i < m_entries.GetSize(); i++) m_entries[i] = Entry();
+}
+
+
+void cInstProfiler::resetCountdown()
+{
+  if (m_sample_interval == 1) {
+    m_countdown = 1;
+    return;
+  }
+
+  // Draw the distance to the next sample uniformly from [1, 2 * interval - 1] so that the mean rate is preserved.  A
+  // private xorshift generator is used so that profiling never perturbs the world random number stream.
+  m_rng_state ^= m_rng_state << 13;
+  m_rng_state ^= m_rng_state >> 17;
+  m_rng_state ^= m_rng_state << 5;
+  m_countdown = 1 + static_cast<int>(m_rng_state % static_cast<unsigned int>(2 * m_sample_interval - 1));
+}
@@ -0,0 +1,115 @@
+/*
+ *  cInstProfiler.h
+ *  Avida
+ *
+ *  Copyright 2026 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef cInstProfiler_h
+#define cInstProfiler_h
+
+#include "cAvidaContext.h"
+#include "cHighResTimer.h"
+
+
+// cInstProfiler - sampled execution cost of the instruction implementations in a single instruction set
+// --------------------------------------------------------------------------------------------------------------
+//
+//  Every execution is counted against its instruction library entry, while only about one in sample_interval
+//  executions is timed (with randomized spacing to avoid aliasing with loops in the genomes).  Costs are measured
+//  with cHighResTimer::Cycles().  Test CPU executions are ignored.
+
+class cInstProfiler
+{
+public:
+  struct Entry
+  {
+    long long executions;
+    long long samples;
+    unsigned long long sampled_cycles;
+    unsigned long long max_cycles;
+
+    inline Entry() : executions(0), samples(0), sampled_cycles(0), max_cycles(0) { ; }
+
+    // Mean cost per execution, extrapolated from the sampled executions
+    inline double MeanCycles() const { return (samples) ? static_cast<double>(sampled_cycles) / samples : 0.0; }
+    inline double EstimatedCycles() const { return MeanCycles() * executions; }
+  };
+
+  class Sample
+  {
+  private:
+    cInstProfiler* m_profiler;
+    int m_lib_idx;
+    unsigned long long m_start;
+
+    Sample(); // @not_implemented
+    Sample(const Sample&); // @not_implemented
+    Sample& operator=(const Sample&); // @not_implemented
+
+  public:
+    inline Sample(cInstProfiler* profiler, cAvidaContext& ctx, int lib_idx) : m_profiler(NULL)
+    {
+      if (profiler && !ctx.GetTestMode()) {
+        profiler->m_entries[lib_idx].executions++;
+        if (--profiler->m_countdown == 0) {
+          profiler->resetCountdown();
+          m_profiler = profiler;
+          m_lib_idx = lib_idx;
+          m_start = cHighResTimer::Cycles();
+        }
+      }
+    }
+    inline ~Sample()
+    {
+      if (m_profiler) {
+        const unsigned long long elapsed = cHighResTimer::Cycles() - m_start;
+        Entry& entry = m_profiler->m_entries[m_lib_idx];
+        entry.samples++;
+        entry.sampled_cycles += elapsed;
+        if (elapsed > entry.max_cycles) entry.max_cycles = elapsed;
+      }
+    }
+  };
+  friend class Sample;
+
+private:
+  Apto::Array<Entry> m_entries;
+  int m_sample_interval;
+  int m_countdown;
+  unsigned int m_rng_state;
+
+  cInstProfiler(); // @not_implemented
+  cInstProfiler(const cInstProfiler&); // @not_implemented
+  cInstProfiler& operator=(const cInstProfiler&); // @not_implemented
+
+public:
+  cInstProfiler(int lib_size, int sample_interval);
+
+  int GetSize() const { return m_entries.GetSize(); }
+  const Entry& Get(int lib_idx) const { return m_entries[lib_idx]; }
+
+  int GetSampleInterval() const { return m_sample_interval; }
+  void SetSampleInterval(int sample_interval);
+
+  void Reset();
+
+private:
+  void resetCountdown();
+};
+
+#endif
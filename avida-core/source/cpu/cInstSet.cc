@@ -44,6 +44,7 @@ cInstSet::cInstSet(const cInstSet& _in)
   , m_inst_lib(_in.m_inst_lib)
   , m_lib_name_map(_in.m_lib_name_map)
   , m_mutation_index(NULL)
+  , m_profiler(NULL)
   , m_has_costs(_in.m_has_costs)
   , m_has_ft_costs(_in.m_has_ft_costs)
   , m_has_energy_costs(_in.m_has_energy_costs)
@@ -80,6 +81,13 @@ cInstSet& cInstSet::operator=(const cInstSet& _in)
 }
 
 
+void cInstSet::EnableProfiling(int sample_interval)
+{
+  if (m_profiler) m_profiler->SetSampleInterval(sample_interval);
+  else m_profiler = new cInstProfiler(m_inst_lib->GetSize(), sample_interval);
+}
+
+
 Instruction cInstSet::GetRandomInst(cAvidaContext& ctx) const
 {
   double weight = ctx.GetRandom().GetDouble(m_mutation_index->GetTotalWeight());
@@ -29,6 +29,7 @@
 
 #include "cString.h"
 #include "cInstLib.h"
+#include "cInstProfiler.h"
 #include "cOrderedWeightedIndex.h"
 
 using namespace std;
@@ -78,6 +79,7 @@ public:
   Apto::Array<int> m_lib_nopmod_map;
   
   cOrderedWeightedIndex* m_mutation_index;     // Weighted index for instructions 
+  cInstProfiler* m_profiler;                   // Execution cost sampling, NULL unless enabled
   
   bool m_has_costs;
   bool m_has_ft_costs;
@@ -96,13 +98,13 @@ public:
 
 public:
   inline cInstSet(cWorld* world, const cString& name, int hw_type, cInstLib* inst_lib, int stack_size, int uops_per_cycle)
-    : m_world(world), m_name(name), m_hw_type(hw_type), m_inst_lib(inst_lib), m_mutation_index(NULL)
+    : m_world(world), m_name(name), m_hw_type(hw_type), m_inst_lib(inst_lib), m_mutation_index(NULL), m_profiler(NULL)
     , m_has_costs(false), m_has_ft_costs(false), m_has_energy_costs(false), m_has_res_costs(false), m_has_fem_res_costs(false)
     , m_has_female_costs(false), m_has_choosy_female_costs(false), m_has_post_costs(false), m_has_bonus_costs(false), m_stack_size(stack_size)
     , m_uops_per_cycle(uops_per_cycle) { ; }
   cInstSet(const cInstSet&); 
   cInstSet& operator=(const cInstSet&); 
-  inline ~cInstSet() { if (m_mutation_index != NULL) delete m_mutation_index; }
+  inline ~cInstSet() { if (m_mutation_index != NULL) delete m_mutation_index; delete m_profiler; }
   
   const cString& GetInstSetName() const { return m_name; }
   int GetHardwareType() const { return m_hw_type; }
@@ -174,6 +176,10 @@ public:
   // accessors for instruction library
   cInstLib* GetInstLib() { return m_inst_lib; }
   const cInstLib* GetInstLib() const { return m_inst_lib; }
+  
+  // Instruction execution profiling
+  void EnableProfiling(int sample_interval);
+  cInstProfiler* GetProfiler() const { return m_profiler; }
 
   inline Instruction GetInst(const cString& in_name) const;
   cString FindBestMatch(const cString& in_name) const;
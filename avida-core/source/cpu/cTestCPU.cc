@@ -51,17 +51,23 @@ using namespace AvidaTools;
 cTestCPU::cTestCPU(cAvidaContext& ctx, cWorld* world)
 {
   m_world = world;
+  Reset(ctx);
+}  
+
+
+void cTestCPU::Reset(cAvidaContext& ctx)
+{
 	m_use_manual_inputs = false;
   m_test_solo_res = -1;
   m_test_solo_res_lev = 0;
   InitResources(ctx);
-}  
+}
 
  
 void cTestCPU::InitResources(cAvidaContext& ctx, int res_method, cResourceHistory* res, int update, int cpu_cycle_offset)
 {  
   //FOR DEMES
-  m_deme_resource_count.SetSize(0);
+  if (m_deme_resource_count.GetSize()) m_deme_resource_count.SetSize(0);
 
   m_res_method = (eTestCPUResourceMethod)res_method;
   // Make sure it's valid
@@ -94,10 +100,13 @@ void cTestCPU::InitResources(cAvidaContext& ctx, int res_method, cResourceHistor
   const cResourceLib& resource_lib = m_world->GetEnvironment().GetResourceLib();
   assert(resource_lib.GetSize() >= 0);
   
-  // Set the resource count to zero by default
-  m_resource_count.SetSize(resource_lib.GetSize());
-  m_faced_cell_resource_count.SetSize(resource_lib.GetSize());
-  m_cell_resource_count.SetSize(resource_lib.GetSize());
+  // Set the resource count to zero by default.  The counts are only ever given levels here, so a reused CPU whose
+  // counts already match the environment keeps them allocated.
+  if (m_resource_count.GetSize() != resource_lib.GetSize()) {
+    m_resource_count.SetSize(resource_lib.GetSize());
+    m_faced_cell_resource_count.SetSize(resource_lib.GetSize());
+    m_cell_resource_count.SetSize(resource_lib.GetSize());
+  }
   for (int i = 0; i < resource_lib.GetSize(); i++) {
     m_resource_count.Set(ctx, i, 0.0);
     m_faced_cell_resource_count.Set(ctx, i, 0.0);
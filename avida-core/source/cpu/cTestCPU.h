@@ -87,6 +87,9 @@ public:
   cTestCPU(cAvidaContext& ctx, cWorld* world);
   ~cTestCPU() { }
   
+  // Returns the CPU to its freshly constructed state, keeping the resource counts allocated
+  void Reset(cAvidaContext& ctx);
+  
   bool TestGenome(cAvidaContext& ctx, cCPUTestInfo& test_info, const Genome& genome);
   bool TestGenome(cAvidaContext& ctx, cCPUTestInfo& test_info, const Genome& genome, std::ofstream& out_fp);
   
@@ -295,28 +295,56 @@ bool Avida::Data::Manager::AttachRecorder(RecorderPtr recorder, bool concurrent_
     }
   }
   
+  // Parse the requested data ids and locate their providers once, so that updates retrieve them directly
+  Apto::Array<ValueSource, Apto::Smart> sources(requested->GetSize());
+  int source_idx = 0;
+  for (ConstDataSetIterator it = requested->Begin(); it.Next(); source_idx++) resolveValue(*it.Get(), sources[source_idx]);
+  
   m_rwlock.WriteUnlock();
   
   
+  // Handles and the snapshot only change while holding the recorder mutex, as notification reads them without locking
+  m_recorder_mutex.Lock();
+  const bool reattach = m_recorders.Has(recorder);
+  for (int i = 0; i < sources.GetSize(); i++) {
+    DataHandle handle;
+    if (m_value_handles.Get(sources[i].data_id, handle)) {
+      if (!reattach) m_value_sources[handle].refs++;
+      continue;
+    }
+    
+    sources[i].refs = 1;
+    if (m_free_handles.GetSize()) {
+      handle = m_free_handles[m_free_handles.GetSize() - 1];
+      m_free_handles.Resize(m_free_handles.GetSize() - 1);
+      m_value_sources[handle] = sources[i];
+    } else {
+      handle = m_value_sources.GetSize();
+      m_value_sources.Push(sources[i]);
+    }
+    m_value_handles[sources[i].data_id] = handle;
+  }
+  m_snapshot.Resize(m_value_sources.GetSize());
+  
   if (concurrent_update) {
     for (Apto::Set<ProviderPtr>::Iterator it = provider_set.Begin(); it.Next();) {
       if ((*it.Get())->SupportsConcurrentUpdate()) {
         ProviderPtr provider = (*it.Get());
         provider->UpdateProvidedValues(UPDATE_CONCURRENT);
-        
-        // Invalidate cached entries for this provider
-        ConstDataSetPtr provided = provider->Provides();
-        m_current_value_mutex.Lock();
-        for (ConstDataSetIterator pit = provided->Begin(); pit.Next();) m_current_values.Remove(*pit.Get());
-        m_current_value_mutex.Unlock();
       }
     }
+    
+    // Refresh the values of this recorder, the rest of the snapshot still belongs to the last update
+    for (int i = 0; i < sources.GetSize(); i++) {
+      DataHandle handle = m_value_handles.Get(sources[i].data_id);
+      m_snapshot[handle] = retrieveValue(m_value_sources[handle]);
+    }
+    
     DataRetrievalFunctor drf(this, &Manager::GetCurrentValue);
     recorder->NotifyData(UPDATE_CONCURRENT, drf);
   }
   
   // Store the recorder
-  m_recorder_mutex.Lock();
   m_recorders.Insert(recorder);
   m_recorder_mutex.Unlock();
   return true;
@@ -324,15 +352,46 @@ bool Avida::Data::Manager::AttachRecorder(RecorderPtr recorder, bool concurrent_
 
 bool Avida::Data::Manager::DetachRecorder(RecorderPtr recorder)
 {
+  ConstDataSetPtr requested = recorder->RequestedData();
+  
   bool success = false;
   m_recorder_mutex.Lock();
   success = m_recorders.Remove(recorder);
+  
+  // Release the values no other recorder requested, dropping their providers and last snapshot.  Handles held by the
+  // remaining recorders stay valid, released slots are only reused by later attachments.
+  if (success) {
+    for (ConstDataSetIterator it = requested->Begin(); it.Next();) {
+      DataHandle handle;
+      if (!m_value_handles.Get(*it.Get(), handle) || --m_value_sources[handle].refs > 0) continue;
+      
+      m_value_handles.Remove(*it.Get());
+      m_value_sources[handle] = ValueSource();
+      m_snapshot[handle] = PackagePtr();
+      m_free_handles.Push(handle);
+    }
+  }
   // @TODO - this should probably deactivate data providers that are no longer needed, or at least adjust schedule
   m_recorder_mutex.Unlock();
   return success;
 }
 
 
+Avida::Data::DataHandle Avida::Data::Manager::ResolveHandle(const DataID& data_id) const
+{
+  DataHandle handle = -1;
+  m_recorder_mutex.Lock();
+  m_value_handles.Get(data_id, handle);
+  m_recorder_mutex.Unlock();
+  return handle;
+}
+
+Avida::Data::PackagePtr Avida::Data::Manager::GetSnapshotValue(DataHandle handle) const
+{
+  return m_snapshot[handle];
+}
+
+
 bool Avida::Data::Manager::Register(const DataID& data_id, ProviderActivateFunctor functor)
 {
   if (data_id.GetSize() == 0 || data_id[data_id.GetSize() - 1] == ']') return false;
@@ -420,10 +479,6 @@ Avida::WorldFacetID Avida::Data::Manager::UpdateAfter() const
 
 void Avida::Data::Manager::PerformUpdate(Context&, Update current_update)
 {
-  m_current_value_mutex.Lock();
-  m_current_values.Clear();
-  m_current_value_mutex.Unlock();
-  
   m_rwlock.ReadLock();
   
   // Update all of the active providers
@@ -435,6 +490,9 @@ void Avida::Data::Manager::PerformUpdate(Context&, Update current_update)
   // Lock recorder mutex before releasing RWLock, so that only recorders that have values will be notified
   m_recorder_mutex.Lock();
   
+  // Retrieve every requested value once, recorders read them from the snapshot without locking
+  for (int i = 0; i < m_value_sources.GetSize(); i++) m_snapshot[i] = retrieveValue(m_value_sources[i]);
+  
   // Release RWLock before notification to prevent double RWLocking deadlock during recorder attachment
   m_rwlock.ReadUnlock();
   
@@ -446,10 +504,53 @@ void Avida::Data::Manager::PerformUpdate(Context&, Update current_update)
 
 Avida::Data::PackagePtr Avida::Data::Manager::GetCurrentValue(const DataID& data_id) const
 {
-  PackagePtr rtn;
-  Apto::MutexAutoLock cvmutexlock(m_current_value_mutex);
+  // Called while recorders are notified, when the handles and the snapshot cannot change
+  DataHandle handle;
+  if (m_value_handles.Get(data_id, handle)) return m_snapshot[handle];
   
-  if (m_current_values.Get(data_id, rtn)) return rtn;
+  // The recorder asked for a value it did not request
+  m_rwlock.ReadLock();
+  PackagePtr rtn = lookupValue(data_id);
+  m_rwlock.ReadUnlock();
+  return rtn;
+}
+
+
+void Avida::Data::Manager::resolveValue(const DataID& data_id, ValueSource& source) const
+{
+  source.data_id = data_id;
+  if (data_id[data_id.GetSize() - 1] == ']') {
+    // Find start of argument, the requested data has already been checked to have one
+    int start_idx = -1;
+    for (int i = 0; i < data_id.GetSize(); i++) {
+      if (data_id[i] == '[') {
+        start_idx = i + 1;
+        break;
+      }
+    }
+    assert(start_idx != -1);
+    
+    // Separate argument from incoming requested data id
+    source.argument = data_id.Substring(start_idx, data_id.GetSize() - start_idx - 1);
+    source.raw_id = data_id.Substring(0, start_idx) + "]";
+    m_active_arg_provider_map.Get(source.raw_id, source.arg_provider);
+  } else {
+    m_active_provider_map.Get(data_id, source.provider);
+  }
+}
+
+
+Avida::Data::PackagePtr Avida::Data::Manager::retrieveValue(const ValueSource& source) const
+{
+  if (source.arg_provider) return source.arg_provider->GetProvidedValueForArgument(source.raw_id, source.argument);
+  if (source.provider) return source.provider->GetProvidedValue(source.data_id);
+  return PackagePtr();
+}
+
+
+Avida::Data::PackagePtr Avida::Data::Manager::lookupValue(const DataID& data_id) const
+{
+  PackagePtr rtn;
   
   if (data_id[data_id.GetSize() - 1] == ']') {
     // Find start of argument
@@ -466,23 +567,12 @@ Avida::Data::PackagePtr Avida::Data::Manager::GetCurrentValue(const DataID& data
     Apto::String argument = data_id.Substring(start_idx, data_id.GetSize() - start_idx - 1);
     DataID raw_id = data_id.Substring(0, start_idx) + "]";
     
-    m_rwlock.ReadLock();
     ArgumentedProviderPtr arg_provider;
-    if (m_active_arg_provider_map.Get(raw_id, arg_provider)) {
-      rtn = arg_provider->GetProvidedValueForArgument(raw_id, argument);
-      if (rtn) m_current_values[data_id] = rtn;
-    }
-    m_rwlock.ReadUnlock();
+    if (m_active_arg_provider_map.Get(raw_id, arg_provider)) rtn = arg_provider->GetProvidedValueForArgument(raw_id, argument);
   } else {
-    m_rwlock.ReadLock();
     ProviderPtr provider;
-    if (m_active_provider_map.Get(data_id, provider)) {
-      rtn = provider->GetProvidedValue(data_id);
-      if (rtn) m_current_values[data_id] = rtn;
-    }
-    m_rwlock.ReadUnlock();
+    if (m_active_provider_map.Get(data_id, provider)) rtn = provider->GetProvidedValue(data_id);
   }
   
   return rtn;
 }
-
@@ -0,0 +1,67 @@
+/*
+ *  data/SeriesRecorder.cc
+ *  avida-core
+ *
+ *  Copyright 2026 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "avida/data/SeriesRecorder.h"
+
+#include "avida/data/Package.h"
+
+
+Avida::Data::SeriesRecorder::SeriesRecorder(Output::SeriesFilePtr file, int interval)
+  : m_file(file), m_interval((interval > 0) ? interval : 1), m_requested(new DataSet)
+{
+}
+
+
+bool Avida::Data::SeriesRecorder::AddValue(const DataID& data_id, Output::SeriesColumnType type)
+{
+  if (m_requested->Has(data_id)) return false;
+  
+  const int column = m_file->AddColumn(data_id, type);
+  if (column < 0) return false;
+  
+  m_requested->Insert(data_id);
+  m_data_ids.Push(data_id);
+  m_columns.Push(column);
+  return true;
+}
+
+
+Avida::Data::ConstDataSetPtr Avida::Data::SeriesRecorder::RequestedData() const
+{
+  return m_requested;
+}
+
+
+void Avida::Data::SeriesRecorder::NotifyData(Update current_update, DataRetrievalFunctor retrieve_data)
+{
+  if (current_update == UPDATE_CONCURRENT || current_update % m_interval != 0) return;
+  
+  m_file->BeginRow(current_update);
+  for (int i = 0; i < m_data_ids.GetSize(); i++) {
+    // Missing values are left unset, which repeats the previous value of the column
+    PackagePtr value = retrieve_data(m_data_ids[i]);
+    if (!value) continue;
+    
+    if (m_file->ColumnType(m_columns[i]) == Output::SERIES_INT) m_file->SetValue(m_columns[i], value->IntValue());
+    else m_file->SetValue(m_columns[i], value->DoubleValue());
+  }
+  m_file->EndRow();
+}
@@ -0,0 +1,92 @@
+/*
+ *  cArchipelago.cc
+ *  Avida
+ *
+ *  Copyright 2026 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "cArchipelago.h"
+
+#include "avida/core/Genome.h"
+
+#include <cmath>
+
+
+cArchipelago::cArchipelago(int num_islands)
+  : m_num_islands(num_islands), m_dimension(0), m_mailboxes(num_islands * num_islands * 2), m_departed(num_islands)
+  , m_participants(num_islands), m_waiting(0), m_generation(0)
+{
+  m_departed.SetAll(false);
+  const int dim = static_cast<int>(sqrt(static_cast<double>(num_islands)) + 0.5);
+  if (dim * dim == num_islands) m_dimension = dim;
+}
+
+cArchipelago::~cArchipelago()
+{
+  // Discard migrants that were never delivered
+  for (int i = 0; i < m_mailboxes.GetSize(); i++) {
+    for (int j = 0; j < m_mailboxes[i].GetSize(); j++) delete m_mailboxes[i][j].genome;
+  }
+}
+
+
+void cArchipelago::Barrier()
+{
+  m_mutex.Lock();
+  const int generation = m_generation;
+  if (++m_waiting == m_participants) {
+    m_waiting = 0;
+    m_generation++;
+    m_cond.Broadcast();
+  } else {
+    while (generation == m_generation) m_cond.Wait(m_mutex);
+  }
+  m_mutex.Unlock();
+}
+
+
+void cArchipelago::Leave(int island)
+{
+  m_mutex.Lock();
+  m_departed[island] = true;
+  m_participants--;
+  if (m_waiting > 0 && m_waiting == m_participants) {
+    m_waiting = 0;
+    m_generation++;
+    m_cond.Broadcast();
+  }
+  m_mutex.Unlock();
+}
+
+
+bool cArchipelago::HasLeft(int island)
+{
+  m_mutex.Lock();
+  const bool departed = m_departed[island];
+  m_mutex.Unlock();
+  return departed;
+}
+
+
+void cArchipelago::DiscardMailboxes(int src, int dst)
+{
+  for (int exchange = 0; exchange < 2; exchange++) {
+    MigrantList& migrants = Mailbox(src, dst, exchange);
+    for (int i = 0; i < migrants.GetSize(); i++) delete migrants[i].genome;
+    migrants.Resize(0);
+  }
+}
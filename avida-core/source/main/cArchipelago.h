@@ -0,0 +1,104 @@
+/*
+ *  cArchipelago.h
+ *  Avida
+ *
+ *  Copyright 2026 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef cArchipelago_h
+#define cArchipelago_h
+
+#include "avida/core/Types.h"
+
+#include "apto/core.h"
+
+
+// cArchipelago - shared state of a set of worlds (islands) running on separate threads of one process
+// --------------------------------------------------------------------------------------------------------------
+//
+//  Each ordered pair of islands has a pair of mailboxes, alternating between consecutive exchanges.  During an
+//  exchange interval the source island is the only writer of the mailboxes for the current exchange, and after the
+//  exchange barrier the destination island is the only reader, so the mailboxes themselves need no locking.  The
+//  barrier is the only synchronization point between the islands.  Once an island has left, its sources discard the
+//  migrants addressed to it at their next exchange (see DiscardMailboxes()).
+//
+//  Process-wide state is shared by all islands: the configuration registration lists and the interned systematics
+//  roles are locked, and the instruction and action libraries are read-only once Avida::Initialize() has run.  The
+//  hardware keeps no mutable function-local statics; the few remaining statics (e.g. the catch, label and transposon
+//  instructions) are initialized once from the instruction set, which every island loads from the same arguments.
+//  Features that draw from the C library rand() would make the islands' runs depend on thread scheduling, so
+//  cArchipelagoWorld rejects configurations that use them.
+
+class cArchipelago
+{
+public:
+  struct sMigrant
+  {
+    Avida::Genome* genome;  // Owned by the mailbox until the destination island injects it
+    double merit;
+    int lineage;
+    int x;
+    int y;
+    int generation;
+
+    sMigrant() : genome(NULL), merit(0.0), lineage(0), x(0), y(0), generation(0) { ; }
+  };
+  typedef Apto::Array<sMigrant, Apto::Smart> MigrantList;
+
+private:
+  int m_num_islands;
+  int m_dimension;
+  Apto::Array<MigrantList> m_mailboxes;
+  Apto::Array<bool> m_departed;
+
+  Apto::Mutex m_mutex;
+  Apto::ConditionVariable m_cond;
+  int m_participants;
+  int m_waiting;
+  int m_generation;
+
+
+  cArchipelago(); // @not_implemented
+  cArchipelago(const cArchipelago&); // @not_implemented
+  cArchipelago& operator=(const cArchipelago&); // @not_implemented
+
+public:
+  explicit cArchipelago(int num_islands);
+  ~cArchipelago();
+
+  int GetNumIslands() const { return m_num_islands; }
+
+  // Number of islands along each side of the square grid used for spatial migration (0 if not square)
+  int GetDimension() const { return m_dimension; }
+
+  // Migrants sent from src to dst during the given exchange interval
+  MigrantList& Mailbox(int src, int dst, int exchange) { return m_mailboxes[((dst * m_num_islands) + src) * 2 + (exchange & 1)]; }
+
+  // Blocks until every island that has not left has reached the barrier
+  void Barrier();
+
+  // Removes the calling island from all future barriers (its run has finished)
+  void Leave(int island);
+
+  // True if the island has left, only reliable for islands that left before the caller's last barrier
+  bool HasLeft(int island);
+
+  // Frees the migrants that src has sent to a departed island, in both of the pair's mailboxes
+  void DiscardMailboxes(int src, int dst);
+};
+
+#endif
@@ -0,0 +1,273 @@
+/*
+ *  cArchipelagoWorld.cc
+ *  Avida
+ *
+ *  Copyright 2026 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "cArchipelagoWorld.h"
+
+#include "avida/core/Genome.h"
+#include "avida/core/WorldDriver.h"
+
+#include "cArchipelago.h"
+#include "cAvidaConfig.h"
+#include "cEnvironment.h"
+#include "cMerit.h"
+#include "cOrganism.h"
+#include "cPhenotype.h"
+#include "cPopulation.h"
+#include "cPopulationCell.h"
+#include "cReaction.h"
+#include "cReactionLib.h"
+#include "cReactionProcess.h"
+#include "cStats.h"
+#include "cTaskEntry.h"
+#include "cUserFeedback.h"
+#include "nGeometry.h"
+
+#include <cassert>
+
+
+cArchipelagoWorld::cArchipelagoWorld(cAvidaConfig* cfg, const cString& wd, cArchipelago* archipelago, int island)
+  : cWorld(cfg, wd), m_archipelago(archipelago), m_island(island), m_universe_x(0), m_universe_y(0)
+  , m_exchange(0), m_updates_since_exchange(0), m_injecting_migrants(false)
+{
+  if (archipelago->GetDimension() > 0) {
+    m_universe_x = island % archipelago->GetDimension();
+    m_universe_y = island / archipelago->GetDimension();
+  }
+}
+
+
+cArchipelagoWorld* cArchipelagoWorld::Initialize(cAvidaConfig* cfg, const cString& working_dir, World* new_world,
+                                                 cArchipelago* archipelago, int island, cUserFeedback* feedback,
+                                                 const Apto::Map<Apto::String, Apto::String>* mappings)
+{
+  cArchipelagoWorld* world = new cArchipelagoWorld(cfg, working_dir, archipelago, island);
+  if (!world->setup(new_world, feedback, mappings) || !world->checkIslandSafe(feedback)) {
+    delete world;
+    world = NULL;
+  }
+  return world;
+}
+
+
+/*! Returns false if the environment uses features that draw from the process-wide C rand().
+
+ All islands share one rand() sequence, so a run using these features would depend on the
+ interleaving of the island threads and could not be reproduced.
+ */
+bool cArchipelagoWorld::checkIslandSafe(cUserFeedback* feedback)
+{
+  const cEnvironment& env = GetEnvironment();
+  bool safe = true;
+
+  for (int i = 0; i < env.GetNumTasks(); i++) {
+    if (env.GetTask(i).GetName() == "consume-public-good") {
+      if (feedback) feedback->Error("task consume-public-good is not supported by archipelago runs");
+      safe = false;
+    }
+  }
+
+  const cReactionLib& reaction_lib = env.GetReactionLib();
+  for (int i = 0; i < reaction_lib.GetSize(); i++) {
+    tLWConstListIterator<cReactionProcess> process_it(reaction_lib.GetReaction(i)->GetProcesses());
+    while (process_it.Next() != NULL) {
+      if (process_it.Get()->GetIsRandomResource()) {
+        if (feedback) feedback->Error("reaction %s: random product placement is not supported by archipelago runs",
+                                      (const char*)reaction_lib.GetReaction(i)->GetName());
+        safe = false;
+        break;
+      }
+    }
+  }
+
+  return safe;
+}
+
+
+/*! Migrate this organism to a different world.
+
+ The destination is chosen exactly as in cMultiProcessWorld: the neighboring world
+ across the boundary for POSITION_OFFSPRING_RANDOM (the grid of worlds wraps, bounded
+ grids are handled by IsWorldBoundary), or a random other world for
+ POSITION_OFFSPRING_FULL_SOUP_RANDOM.
+ */
+void cArchipelagoWorld::MigrateOrganism(cOrganism* org, const cPopulationCell& cell, const cMerit& merit, int lineage)
+{
+  assert(org != NULL);
+  const int num_islands = m_archipelago->GetNumIslands();
+  int dst_world = -1;
+
+  switch (GetConfig().BIRTH_METHOD.Get()) {
+    case POSITION_OFFSPRING_RANDOM: {
+      const int dim = m_archipelago->GetDimension();
+      int x, y;
+      cell.GetPosition(x, y);
+      int ux = m_universe_x;
+      int uy = m_universe_y;
+      if (x == 0) ux--;
+      else if (x == GetConfig().WORLD_X.Get() - 1) ux++;
+      else if (y == 0) uy--;
+      else if (y == GetConfig().WORLD_Y.Get() - 1) uy++;
+      dst_world = ((uy + dim) % dim) * dim + ((ux + dim) % dim);
+      break;
+    }
+    case POSITION_OFFSPRING_FULL_SOUP_RANDOM: {
+      // prevent a migration back to this same world, unless this is the only world
+      if (num_islands == 1) {
+        dst_world = 0;
+      } else {
+        dst_world = GetRandom().GetInt(num_islands - 1);
+        if (dst_world >= m_island) dst_world++;
+      }
+      break;
+    }
+    default:
+      GetDriver().Feedback().Error("archipelago migration only supports BIRTH_METHOD 0 (POSITION_OFFSPRING_RANDOM) and 4 (POSITION_OFFSPRING_FULL_SOUP_RANDOM)");
+      GetDriver().Abort(Avida::INVALID_CONFIG);
+  }
+
+  assert(dst_world >= 0 && dst_world < num_islands);
+
+  cArchipelago::sMigrant migrant;
+  migrant.genome = new Genome(org->GetGenome());
+  migrant.merit = merit.GetDouble();
+  migrant.lineage = lineage;
+  cell.GetPosition(migrant.x, migrant.y);
+  migrant.generation = org->GetPhenotype().GetGeneration();
+  m_archipelago->Mailbox(m_island, dst_world, m_exchange).Push(migrant);
+
+  GetStats().OutgoingMigrant(org);
+}
+
+
+/*! Returns true if an organism should be migrated to a different world.
+
+ As in cMultiProcessWorld, under POSITION_OFFSPRING_FULL_SOUP_RANDOM the probability of
+ migrating is (number of worlds - 1) / (number of worlds), and a single world always
+ migrates (re-injecting the organism elsewhere in its own population).
+ */
+bool cArchipelagoWorld::TestForMigration()
+{
+  if (GetConfig().BIRTH_METHOD.Get() != POSITION_OFFSPRING_FULL_SOUP_RANDOM) return false;
+
+  const int num_islands = m_archipelago->GetNumIslands();
+  if (num_islands == 1) return true;
+  return GetRandom().P(static_cast<double>(num_islands - 1) / num_islands);
+}
+
+
+/*! Returns true if the given cell is on the boundary of the world, false otherwise.
+ */
+bool cArchipelagoWorld::IsWorldBoundary(const cPopulationCell& cell)
+{
+  if (m_injecting_migrants || GetConfig().BIRTH_METHOD.Get() != POSITION_OFFSPRING_RANDOM) return false;
+
+  const int world_x = GetConfig().WORLD_X.Get();
+  const int world_y = GetConfig().WORLD_Y.Get();
+  int x, y;
+  cell.GetPosition(x, y);
+
+  // if this cell isn't on the boundary of this world, then there's no way that
+  // it can cause a migration, regardless of world geometry.
+  if (!(x == 0 || x == world_x - 1 || y == 0 || y == world_y - 1)) return false;
+
+  switch (GetConfig().WORLD_GEOMETRY.Get()) {
+    case nGeometry::GRID: { // bounded grid: the boundary cells of the universe do not cause migrations.
+      const int dim = m_archipelago->GetDimension();
+      const int uni_x = x + world_x * m_universe_x;
+      const int uni_y = y + world_y * m_universe_y;
+      return !(uni_x == 0 || uni_x == world_x * dim - 1 || uni_y == 0 || uni_y == world_y * dim - 1);
+    }
+    case nGeometry::TORUS:
+      return true;
+    default:
+      GetDriver().Feedback().Error("only bounded grid and toroidal geometries are supported for cell migration");
+      GetDriver().Abort(Avida::INVALID_CONFIG);
+  }
+  return false;
+}
+
+
+/*! Process post-update events.
+
+ Every MP_MIGRATION_INTERVAL updates all islands meet at the archipelago barrier, after
+ which each island injects the migrants sent to it during the interval, in order by
+ source island and then by the order in which they were migrated.  Runs are therefore
+ reproducible regardless of thread scheduling.
+ */
+void cArchipelagoWorld::ProcessPostUpdate(cAvidaContext& ctx)
+{
+  if (++m_updates_since_exchange < GetConfig().MP_MIGRATION_INTERVAL.Get()) return;
+  m_updates_since_exchange = 0;
+
+  m_archipelago->Barrier();
+
+  // Islands that have finished their runs no longer collect their migrants
+  for (int dst = 0; dst < m_archipelago->GetNumIslands(); dst++) {
+    if (dst != m_island && m_archipelago->HasLeft(dst)) m_archipelago->DiscardMailboxes(m_island, dst);
+  }
+
+  // Migrations caused by the injections below belong to the next exchange
+  const int exchange = m_exchange++;
+  injectMigrants(ctx, exchange);
+}
+
+
+void cArchipelagoWorld::injectMigrants(cAvidaContext& ctx, int exchange)
+{
+  // Migrants placed on a boundary cell stay there, rather than being passed straight on to the next world
+  m_injecting_migrants = true;
+
+  for (int src = 0; src < m_archipelago->GetNumIslands(); src++) {
+    cArchipelago::MigrantList& migrants = m_archipelago->Mailbox(src, m_island, exchange);
+    for (int i = 0; i < migrants.GetSize(); i++) {
+      cArchipelago::sMigrant& migrant = migrants[i];
+      int target_cell = -1;
+
+      switch (GetConfig().BIRTH_METHOD.Get()) {
+        case POSITION_OFFSPRING_RANDOM: {
+          // invert the orginating cell
+          const int x = GetConfig().WORLD_X.Get() - migrant.x - 1;
+          const int y = GetConfig().WORLD_Y.Get() - migrant.y - 1;
+          target_cell = GetConfig().WORLD_X.Get() * y + x;
+          break;
+        }
+        default: // POSITION_OFFSPRING_FULL_SOUP_RANDOM
+          target_cell = GetRandom().GetInt(GetPopulation().GetSize());
+          break;
+      }
+
+      GetPopulation().InjectGenome(target_cell, Systematics::Source(Systematics::DUPLICATION, "migrant", true), *migrant.genome,
+                                   ctx, migrant.lineage);
+      delete migrant.genome;
+      migrant.genome = NULL;
+
+      cOrganism* org = GetPopulation().GetCell(target_cell).GetOrganism();
+      if (org) {
+        org->UpdateMerit(ctx, migrant.merit);
+        org->GetPhenotype().SetGeneration(migrant.generation);
+        GetStats().IncomingMigrant(org);
+      }
+    }
+    migrants.Resize(0);
+  }
+
+  m_injecting_migrants = false;
+}
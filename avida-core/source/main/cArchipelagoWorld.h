@@ -0,0 +1,78 @@
+/*
+ *  cArchipelagoWorld.h
+ *  Avida
+ *
+ *  Copyright 2026 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef cArchipelagoWorld_h
+#define cArchipelagoWorld_h
+
+#include "cWorld.h"
+
+class cArchipelago;
+
+
+/*! One island of a single-process archipelago.
+
+ Provides the cross-world migration of cMultiProcessWorld between worlds that run on
+ separate threads of the same process.  Migrants are passed in memory through the
+ mailboxes of a shared cArchipelago rather than serialized into MPI messages, and are
+ exchanged every MP_MIGRATION_INTERVAL updates.
+ */
+class cArchipelagoWorld : public cWorld
+{
+private:
+  cArchipelago* m_archipelago; //!< Shared mailboxes and barrier (not owned).
+  int m_island; //!< Index of this world in the archipelago.
+  int m_universe_x; //!< X coordinate of this world in the grid of worlds (spatial migration).
+  int m_universe_y; //!< Y coordinate of this world in the grid of worlds (spatial migration).
+  int m_exchange; //!< Number of migrant exchanges performed.
+  int m_updates_since_exchange; //!< Updates completed since the last exchange.
+  bool m_injecting_migrants; //!< Suppresses boundary migration of arriving migrants.
+
+  cArchipelagoWorld(cAvidaConfig* cfg, const cString& wd, cArchipelago* archipelago, int island);
+
+  cArchipelagoWorld(); // @not_implemented
+  cArchipelagoWorld(const cArchipelagoWorld&); // @not_implemented
+  cArchipelagoWorld& operator=(const cArchipelagoWorld&); // @not_implemented
+
+public:
+  static cArchipelagoWorld* Initialize(cAvidaConfig* cfg, const cString& working_dir, World* new_world,
+                                       cArchipelago* archipelago, int island, cUserFeedback* feedback = NULL,
+                                       const Apto::Map<Apto::String, Apto::String>* mappings = NULL);
+
+  int GetIsland() const { return m_island; }
+
+  //! Migrate this organism to a different world.
+  virtual void MigrateOrganism(cOrganism* org, const cPopulationCell& cell, const cMerit& merit, int lineage);
+
+  //! Returns true if an organism should be migrated to a different world, false otherwise.
+  virtual bool TestForMigration();
+
+  //! Returns true if the given cell is on the boundary of the world, false otherwise.
+  virtual bool IsWorldBoundary(const cPopulationCell& cell);
+
+  //! Process post-update events (exchanges migrants with the other worlds).
+  virtual void ProcessPostUpdate(cAvidaContext& ctx);
+
+private:
+  bool checkIslandSafe(cUserFeedback* feedback);
+  void injectMigrants(cAvidaContext& ctx, int exchange);
+};
+
+#endif
@@ -284,6 +284,8 @@ public:
   CONFIG_ADD_VAR(SPECULATIVE, bool, 1, "Enable speculative execution\n(pre-execute instructions that don't affect other organisms)");
   CONFIG_ADD_VAR(POPULATION_CAP, int, 0, "Carrying capacity in number of organisms (use 0 for no cap)");
   CONFIG_ADD_VAR(POP_CAP_ELDEST, int, 0, "Carrying capacity in number of organisms (use 0 for no cap). Will kill oldest organism in population, but still use birth method to place new offspring."); 
+  CONFIG_ADD_VAR(STATS_THREADS, int, 1, "Number of threads used to gather per-organism statistics each update\n1 = Single threaded\n<1 = All available CPUs\n(Floating point sums may differ in the last digits from a single threaded run)");
+  CONFIG_ADD_VAR(ASYNC_OUTPUT, bool, 0, "Format data file values and write the files from a background thread\n(file contents are unchanged; buffered output is flushed on population saves and at exit)");
   
   
   // -------- Topology config options --------
@@ -475,6 +477,8 @@ public:
   CONFIG_ADD_GROUP(MP_GROUP, "Config options for multiple, distributed populations");
   CONFIG_ADD_VAR(ENABLE_MP, int, 0, "Enable multi-process Avida; 0=disabled (default),\n1=enabled.");
   CONFIG_ADD_VAR(MP_SCHEDULING_STYLE, int, 0, "Style of scheduling:\n0=non-MP aware (default)\n1=MP aware, integrated across worlds.");
+  CONFIG_ADD_VAR(MP_MIGRATION_STYLE, int, 0, "Style of migrant exchange between worlds:\n0=synchronous, migrants arrive at the end of the exchange update (default)\n1=overlapped with computation, migrants arrive one exchange interval late.");
+  CONFIG_ADD_VAR(MP_MIGRATION_INTERVAL, int, 1, "Number of updates between migrant exchanges.");
 	
   
   // -------- Deme config options --------
@@ -546,7 +550,8 @@ public:
   // -------- Time Slicing config options --------
   CONFIG_ADD_GROUP(TIME_GROUP, "Time Slicing");
   CONFIG_ADD_VAR(AVE_TIME_SLICE, int, 30, "Average number of CPU-cycles per org per update");
-  CONFIG_ADD_VAR(SLICING_METHOD, int, 1, "0 = CONSTANT: all organisms receive equal number of CPU cycles\n1 = PROBABILISTIC: CPU cycles distributed randomly, proportional to merit.\n2 = INTEGRATED: CPU cycles given out deterministicly, proportional to merit\n3 = DEME_PROBABALISTIC: Demes receive fixed number of CPU cycles, awarded probabalistically to members\n4 = CROSS_DEME_PROBABALISTIC: Demes receive CPU cycles proportional to living population size, awarded probabalistically to members");
+  CONFIG_ADD_VAR(SLICING_METHOD, int, 1, "0 = CONSTANT: all organisms receive equal number of CPU cycles\n1 = PROBABILISTIC: CPU cycles distributed randomly, proportional to merit.\n2 = INTEGRATED: CPU cycles given out deterministicly, proportional to merit\n3 = DEME_PROBABALISTIC: Demes receive fixed number of CPU cycles, awarded probabalistically to members\n4 = CROSS_DEME_PROBABALISTIC: Demes receive CPU cycles proportional to living population size, awarded probabalistically to members\n6 = PROBABILISTIC_TREE: as PROBABILISTIC, drawn from an avida-core merit tree that supports batched updates and draws");
+  CONFIG_ADD_VAR(PRESAMPLE_SCHEDULE, int, 0, "Draw all CPU cycles of an update before executing them, redrawing the remainder after merit changes\n(requires SLICING_METHOD 6; 0 = off, 1 = on)");
   CONFIG_ADD_VAR(BASE_MERIT_METHOD, int, 4, "How should merit be initialized?\n0 = Constant (merit independent of size)\n1 = Merit proportional to copied size\n2 = Merit prop. to executed size\n3 = Merit prop. to full size\n4 = Merit prop. to min of executed or copied size\n5 = Merit prop. to sqrt of the minimum size\n6 = Merit prop. to num times MERIT_BONUS_INST is in genome.");
   CONFIG_ADD_VAR(BASE_CONST_MERIT, int, 100, "Base merit value for BASE_MERIT_METHOD 0");
   CONFIG_ADD_VAR(MERIT_BONUS_INST, int, 0, "Instruction ID to count for BASE_MERIT_METHOD 6"); 
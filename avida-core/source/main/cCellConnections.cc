@@ -0,0 +1,128 @@
+/*
+ *  cCellConnections.cc
+ *  Avida
+ *
+ *  Copyright 2026 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "cCellConnections.h"
+
+
+cCellConnections::cCellConnections(const cCellConnections& rhs)
+  : m_cells(NULL), m_size(0), m_capacity(0), m_facing(0)
+{
+  operator=(rhs);
+}
+
+
+cCellConnections& cCellConnections::operator=(const cCellConnections& rhs)
+{
+  if (this == &rhs) return *this;
+
+  // Copies always get private storage, the shared table belongs to the population the original cell is part of
+  Clear();
+  reserve(rhs.m_size);
+  for (int i = 0; i < rhs.m_size; i++) m_cells[i] = rhs.m_cells[i];
+  m_size = rhs.m_size;
+  m_facing = rhs.m_facing;
+  return *this;
+}
+
+
+int cCellConnections::Find(const cPopulationCell* cell) const
+{
+  for (int i = 0; i < m_size; i++) if (m_cells[i] == cell) return i;
+  return -1;
+}
+
+
+void cCellConnections::Push(cPopulationCell* cell)
+{
+  // Inserting at the facing index places the new cell in front of the faced cell
+  insertAt(m_facing, cell);
+}
+
+
+void cCellConnections::PushRear(cPopulationCell* cell)
+{
+  // Same position as Push, but the facing stays with the previously faced cell, leaving the new cell last
+  insertAt(m_facing, cell);
+  if (m_size > 1) m_facing++;
+}
+
+
+cPopulationCell* cCellConnections::Remove(cPopulationCell* cell)
+{
+  const int idx = Find(cell);
+  if (idx < 0) return NULL;
+
+  reserve(m_size);
+  for (int i = idx + 1; i < m_size; i++) m_cells[i - 1] = m_cells[i];
+  m_size--;
+
+  // Removing the faced cell leaves the next one faced
+  if (idx < m_facing) m_facing--;
+  else if (m_facing == m_size) m_facing = 0;
+
+  return cell;
+}
+
+
+void cCellConnections::Clear()
+{
+  if (m_capacity) delete [] m_cells;
+  m_cells = NULL;
+  m_size = 0;
+  m_capacity = 0;
+  m_facing = 0;
+}
+
+
+void cCellConnections::PackInto(cPopulationCell** table)
+{
+  for (int i = 0; i < m_size; i++) table[i] = m_cells[i];
+  if (m_capacity) delete [] m_cells;
+  m_cells = table;
+  m_capacity = 0;
+}
+
+
+void cCellConnections::reserve(int capacity)
+{
+  if (capacity <= m_capacity || capacity == 0) return;
+
+  // Grow geometrically while the topology is being built, one neighbor at a time
+  int new_capacity = (m_capacity) ? m_capacity * 2 : 8;
+  if (new_capacity < capacity) new_capacity = capacity;
+
+  cPopulationCell** cells = new cPopulationCell*[new_capacity];
+  for (int i = 0; i < m_size; i++) cells[i] = m_cells[i];
+  if (m_capacity) delete [] m_cells;
+  m_cells = cells;
+  m_capacity = new_capacity;
+}
+
+
+void cCellConnections::insertAt(int idx, cPopulationCell* cell)
+{
+  assert(idx >= 0 && idx <= m_size);
+
+  reserve(m_size + 1);
+  for (int i = m_size; i > idx; i--) m_cells[i] = m_cells[i - 1];
+  m_cells[idx] = cell;
+  m_size++;
+}
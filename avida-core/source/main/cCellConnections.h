@@ -0,0 +1,91 @@
+/*
+ *  cCellConnections.h
+ *  Avida
+ *
+ *  Copyright 2026 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef cCellConnections_h
+#define cCellConnections_h
+
+#include <cassert>
+#include <cstddef>
+
+class cPopulationCell;
+
+
+// cCellConnections - the neighbors of a population cell, stored as a flat array with the faced neighbor as an index
+// --------------------------------------------------------------------------------------------------------------
+//
+//  Neighbors are kept in a fixed circular order.  Positions are relative to the faced neighbor, so GetPos(0) is the
+//  faced cell, and turning only moves the facing index.  Push, PushRear, Remove, CircNext and CircPrev keep the same
+//  ordering semantics as the tList based connection lists they replace.
+//
+//  Once the topology is built, cPopulation packs the neighbors of all cells into one shared table (compressed sparse
+//  row layout), with each cell referencing its own span.  A cell whose connections are edited afterwards moves its
+//  span into private storage first.
+
+class cCellConnections
+{
+private:
+  cPopulationCell** m_cells;
+  int m_size;
+  int m_capacity;   // Capacity of private storage, 0 when the cells are held in a shared table
+  int m_facing;     // Index of the faced cell
+
+  void reserve(int capacity);
+  void insertAt(int idx, cPopulationCell* cell);
+
+public:
+  cCellConnections() : m_cells(NULL), m_size(0), m_capacity(0), m_facing(0) { ; }
+  cCellConnections(const cCellConnections& rhs);
+  ~cCellConnections() { if (m_capacity) delete [] m_cells; }
+
+  cCellConnections& operator=(const cCellConnections& rhs);
+
+  inline int GetSize() const { return m_size; }
+
+  inline cPopulationCell* GetFirst() const { return (m_size) ? m_cells[m_facing] : NULL; }
+  inline cPopulationCell* GetPos(int pos) const
+  {
+    assert(pos >= 0 && pos < m_size);
+    int idx = m_facing + pos;
+    if (idx >= m_size) idx -= m_size;
+    return m_cells[idx];
+  }
+
+  // Turning changes the faced neighbor without moving any of the cells
+  inline void CircNext() { if (m_size > 0 && ++m_facing == m_size) m_facing = 0; }
+  inline void CircPrev() { if (m_size > 0) m_facing = ((m_facing) ? m_facing : m_size) - 1; }
+
+  inline int GetFacing() const { return m_facing; }
+  inline void SetFacing(int facing) { assert(facing >= 0 && (facing < m_size || m_size == 0)); m_facing = facing; }
+
+  // Index (in storage order, as used by SetFacing) of the given neighbor, -1 if it is not connected
+  int Find(const cPopulationCell* cell) const;
+  cPopulationCell* FindPtr(cPopulationCell* cell) const { return (Find(cell) >= 0) ? cell : NULL; }
+
+  void Push(cPopulationCell* cell);        // Adds the cell as the faced neighbor
+  void PushRear(cPopulationCell* cell);    // Adds the cell as the last neighbor in facing order
+  cPopulationCell* Remove(cPopulationCell* cell);
+  void Clear();
+
+  // Moves the cells into the given table, which must hold GetSize() entries and outlive this object or its next edit
+  void PackInto(cPopulationCell** table);
+};
+
+#endif
@@ -0,0 +1,98 @@
+/*
+ *  cCellNeighborhoods.cc
+ *  Avida
+ *
+ *  Copyright 2026 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "cCellNeighborhoods.h"
+
+#include "cPopulationCell.h"
+
+#include <algorithm>
+
+
+const Apto::Array<int>& cCellNeighborhoods::Get(int cell_id, int depth)
+{
+  assert(cell_id >= 0 && cell_id < m_cells.GetSize());
+  if (depth < 1) depth = 1;
+
+  if (m_neighborhoods.GetSize() < depth) {
+    const int old_size = m_neighborhoods.GetSize();
+    m_neighborhoods.Resize(depth);
+    for (int i = old_size; i < depth; i++) {
+      m_neighborhoods[i].Resize(m_cells.GetSize());
+      m_neighborhoods[i].SetAll(NULL);
+    }
+  }
+
+  Apto::Array<int>*& neighborhood = m_neighborhoods[depth - 1][cell_id];
+  if (neighborhood == NULL) {
+    neighborhood = new Apto::Array<int>;
+    build(cell_id, depth, *neighborhood);
+  }
+  return *neighborhood;
+}
+
+
+void cCellNeighborhoods::Clear()
+{
+  for (int i = 0; i < m_neighborhoods.GetSize(); i++) {
+    for (int j = 0; j < m_neighborhoods[i].GetSize(); j++) delete m_neighborhoods[i][j];
+  }
+  m_neighborhoods.Resize(0);
+}
+
+
+void cCellNeighborhoods::build(int cell_id, int depth, Apto::Array<int>& neighborhood)
+{
+  if (m_marks.GetSize() != m_cells.GetSize()) {
+    m_marks.Resize(m_cells.GetSize());
+    m_marks.SetAll(0);
+    m_cur_mark = 0;
+  }
+  if (++m_cur_mark == 0) {
+    // The marks wrapped around, old marks could be mistaken for the current search
+    m_marks.SetAll(0);
+    m_cur_mark = 1;
+  }
+
+  m_found.Resize(0);
+  walk(cell_id, depth);
+
+  // The walk can come back to the cell itself, which is not part of its neighborhood.  Order by ID as the pointer
+  // ordered set of cells used to.
+  neighborhood.Resize(m_found.GetSize());
+  int count = 0;
+  for (int i = 0; i < m_found.GetSize(); i++) if (m_found[i] != cell_id) neighborhood[count++] = m_found[i];
+  neighborhood.Resize(count);
+  if (count > 1) std::sort(&neighborhood[0], &neighborhood[0] + count);
+}
+
+
+void cCellNeighborhoods::walk(int cell_id, int depth)
+{
+  // Mirrors cPopulationCell::GetNeighboringCells, visiting connections in the same order
+  const cCellConnections& connections = m_cells[cell_id].ConnectionList();
+  for (int i = 0; i < connections.GetSize(); i++) {
+    const int neighbor_id = connections.GetPos(i)->GetID();
+    if (m_marks[neighbor_id] == m_cur_mark) continue;
+    m_marks[neighbor_id] = m_cur_mark;
+    m_found.Push(neighbor_id);
+    if (depth > 1) walk(neighbor_id, depth - 1);
+  }
+}
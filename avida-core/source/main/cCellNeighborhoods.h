@@ -0,0 +1,71 @@
+/*
+ *  cCellNeighborhoods.h
+ *  Avida
+ *
+ *  Copyright 2026 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef cCellNeighborhoods_h
+#define cCellNeighborhoods_h
+
+#include "apto/core.h"
+
+class cPopulationCell;
+
+
+// cCellNeighborhoods - cached sets of the cells within a number of hops of each cell
+// --------------------------------------------------------------------------------------------------------------
+//
+//  The neighborhood of a cell at a given depth holds the IDs of the cells that cPopulationCell::GetNeighboringCells
+//  finds from it at that depth, other than the cell itself, in ascending ID order.  That walk is depth first and only
+//  expands a cell from the path that first reaches it, so a cell first found on its last hop is not expanded even if it
+//  is closer by another path.  Neighborhoods are found the first time they are requested and kept until the
+//  connections change, so repeated broadcasts from the same cell do not walk the topology again.
+
+class cCellNeighborhoods
+{
+private:
+  Apto::Array<cPopulationCell>& m_cells;
+
+  // Per depth, per cell neighborhoods; a neighborhood that has not been built yet is NULL
+  Apto::Array<Apto::Array<Apto::Array<int>*>, Apto::Smart> m_neighborhoods;
+
+  // Search scratch space: a cell has been found by the current search when its mark equals m_cur_mark
+  Apto::Array<unsigned int> m_marks;
+  unsigned int m_cur_mark;
+  Apto::Array<int, Apto::Smart> m_found;
+
+
+  void build(int cell_id, int depth, Apto::Array<int>& neighborhood);
+  void walk(int cell_id, int depth);
+
+  cCellNeighborhoods(); // @not_implemented
+  cCellNeighborhoods(const cCellNeighborhoods&); // @not_implemented
+  cCellNeighborhoods& operator=(const cCellNeighborhoods&); // @not_implemented
+
+public:
+  explicit cCellNeighborhoods(Apto::Array<cPopulationCell>& cells) : m_cells(cells), m_cur_mark(0) { ; }
+  ~cCellNeighborhoods() { Clear(); }
+
+  // IDs of the cells within depth hops of the given cell, excluding the cell itself
+  const Apto::Array<int>& Get(int cell_id, int depth);
+
+  // Drops every cached neighborhood, must be called whenever cell connections are edited
+  void Clear();
+};
+
+#endif
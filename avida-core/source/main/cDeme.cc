@@ -311,7 +311,7 @@ std::vector<int> cDeme::GetGenotypeIDs()
   std::vector<int> genotype_ids;
   for (int i = 0; i < GetSize(); i++) {
     cPopulationCell& cell = GetCell(i);
-    if (cell.IsOccupied()) genotype_ids.push_back(cell.GetOrganism()->SystematicsGroup("genotype")->ID());
+    if (cell.IsOccupied()) genotype_ids.push_back(cell.GetOrganism()->SystematicsGroup(Systematics::ROLE_GENOTYPE)->ID());
   }
 
   //assert(genotype_ids.size()>0); // How did we get to replication otherwise?
@@ -15,7 +15,10 @@
 #include "cString.h"
 #include "cStringUtil.h"
 
-cMigrationMatrix::cMigrationMatrix(){
+#include <cmath>
+#include <limits>
+
+cMigrationMatrix::cMigrationMatrix() : m_num_cols(0){
     
 };
 
@@ -24,25 +27,34 @@ cMigrationMatrix::~cMigrationMatrix(){
 }
 
 int cMigrationMatrix::GetOffspringCountAt(int from_deme_id, int to_deme_id){
-  assert(from_deme_id >= 0 && from_deme_id < m_offspring_migration_counts.GetSize());
-  assert(to_deme_id >= 0 && to_deme_id < m_offspring_migration_counts[from_deme_id].GetSize());
-  return m_offspring_migration_counts[from_deme_id][to_deme_id];
+  assert(from_deme_id >= 0 && from_deme_id < m_rows.GetSize());
+  assert(to_deme_id >= 0 && to_deme_id < m_num_cols);
+  const int idx = findConnection(m_rows[from_deme_id], to_deme_id);
+  return (idx < 0) ? 0 : m_rows[from_deme_id].offspring_counts[idx];
 };
 
 int cMigrationMatrix::GetParasiteCountAt(int from_deme_id, int to_deme_id){
-  assert(from_deme_id >= 0 && from_deme_id < m_parasite_migration_counts.GetSize());
-  assert(to_deme_id >= 0 && to_deme_id < m_parasite_migration_counts[from_deme_id].GetSize());  
-  return m_parasite_migration_counts[from_deme_id][to_deme_id];
+  assert(from_deme_id >= 0 && from_deme_id < m_rows.GetSize());
+  assert(to_deme_id >= 0 && to_deme_id < m_num_cols);
+  const int idx = findConnection(m_rows[from_deme_id], to_deme_id);
+  return (idx < 0) ? 0 : m_rows[from_deme_id].parasite_counts[idx];
 };
 
 bool cMigrationMatrix::AlterConnectionWeight(const int from_deme_id, const int to_deme_id, const double alter_amount){
-  m_migration_matrix[from_deme_id][to_deme_id] += alter_amount;
-  m_row_connectivity_sums[from_deme_id] += alter_amount;
+  assert(from_deme_id >= 0 && from_deme_id < m_rows.GetSize());
+  assert(to_deme_id >= 0 && to_deme_id < m_num_cols);
+  sRow& row = m_rows[from_deme_id];
+  int idx = findConnection(row, to_deme_id);
+  if (idx < 0) idx = addConnection(row, to_deme_id);
+  row.weights[idx] += alter_amount;
+  row.row_sum += alter_amount;
+  row.prefix_valid = false;
+  
   double row_sum = 0.0;
-  for(int col = 0; col < m_migration_matrix[from_deme_id].GetSize();col++){
-    row_sum += m_migration_matrix[from_deme_id][col];
+  for(int i = 0; i < row.weights.GetSize(); i++){
+    row_sum += row.weights[i];
   }
-  if(m_migration_matrix[from_deme_id][to_deme_id] < 0.0 || row_sum <= 0.0){
+  if(row.weights[idx] < 0.0 || row_sum <= 0.0){
     return false;
   }
   else
@@ -50,27 +62,50 @@ bool cMigrationMatrix::AlterConnectionWeight(const int from_deme_id, const int t
 };
 
 int cMigrationMatrix::GetProbabilisticDemeID(const int from_deme_id, Apto::Random& p_rng,bool p_is_parasite_migration){
-    assert(0 <= from_deme_id && from_deme_id < m_migration_matrix.GetSize());
-    double rand_dbl_value_in_range = p_rng.GetDouble(m_row_connectivity_sums[from_deme_id]);
-    for(int col = 0; col < m_migration_matrix[from_deme_id].GetSize(); col++){
-        rand_dbl_value_in_range -= m_migration_matrix[from_deme_id][col];
-        if(rand_dbl_value_in_range <= 0.0){
-            if(p_is_parasite_migration)
-              m_parasite_migration_counts[from_deme_id][col] += 1;
-            else
-              m_offspring_migration_counts[from_deme_id][col] += 1;
-          
-            return col;
-        }
-    }    
-    // Should never get to this point
-    assert(false);
-  return -1;
+  assert(0 <= from_deme_id && from_deme_id < m_rows.GetSize());
+  sRow& row = m_rows[from_deme_id];
+  if (!row.prefix_valid) buildPrefixSums(row);
+  
+  const double value = p_rng.GetDouble(row.row_sum);
+  int idx = -1;
+  if (value <= 0.0) {
+    // The dense scan stops at the first column, connected or not
+    idx = findConnection(row, 0);
+    if (idx < 0) idx = addConnection(row, 0);
+  } else if (row.has_negative) {
+    idx = scanRow(row, value);
+  } else {
+    // First connection whose running sum reaches the value
+    int lo = 0;
+    int hi = row.prefix_sums.GetSize();
+    while (lo < hi) {
+      const int mid = (lo + hi) / 2;
+      if (row.prefix_sums[mid] < value) lo = mid + 1;
+      else hi = mid;
+    }
+    const bool near_upper = (lo == row.prefix_sums.GetSize()) || (row.prefix_sums[lo] - value <= row.prefix_error);
+    const bool near_lower = (lo > 0) && (value - row.prefix_sums[lo - 1] <= row.prefix_error);
+    idx = (near_upper || near_lower) ? scanRow(row, value) : lo;
+  }
+  
+  // Should never get to this point
+  assert(idx >= 0);
+  if (idx < 0) return -1;
+  
+  if(p_is_parasite_migration)
+    row.parasite_counts[idx] += 1;
+  else
+    row.offspring_counts[idx] += 1;
+  
+  return row.cols[idx];
 };
 
 bool cMigrationMatrix::Load(const int num_demes, const cString& filename, const cString& working_dir,bool p_count_parasites, bool p_count_offspring, bool p_is_reload, Feedback& feedback){
-  m_migration_matrix.ResizeClear(0);
-  m_row_connectivity_sums.ResizeClear(0);
+  // Connection counts are stored alongside the sparse connections and are always maintained, so the count
+  // flags are no longer needed to size them.  A reload preserves the counts accumulated so far.
+  (void)p_count_parasites;
+  (void)p_count_offspring;
+  
   cInitFile infile(filename, working_dir);
   if (!infile.WasOpened()) {
     for (int i = 0; i < infile.GetFeedback().GetNumMessages(); i++) {
@@ -89,69 +124,74 @@ bool cMigrationMatrix::Load(const int num_demes, const cString& filename, const
     return false;
   }
   
-  Apto::Array<double, Apto::Smart> f_temp_row;
+  if(num_demes != infile.GetNumLines()){
+    feedback.Error("The number of demes in the migration matrix (%i) did not match the NUM_DEMES (%i) parameter in avida.cfg.",infile.GetNumLines(),num_demes);
+    return false;
+  }
+  
+  Apto::Array<sRow, Apto::Smart> rows(num_demes);
   for (int line_id = 0; line_id < infile.GetNumLines(); line_id++) {
-    // Load the next line from the file.
-    f_temp_row.ResizeClear(0);
+    // Load the next line from the file, keeping only the nonzero connections.
+    sRow& row = rows[line_id];
     cString f_curr_line = infile.GetLine(line_id);
     double f_row_sum = 0.0;
+    int f_num_cols = 0;
     while(!f_curr_line.IsEmpty()){
       double val = f_curr_line.Pop(',').AsDouble();
       if(val < 0.0){
         feedback.Error("Cannot have a negative connection in connection matrix");
         return false;
       }
+      if(val > 0.0){
+        row.cols.Push(f_num_cols);
+        row.weights.Push(val);
+        row.offspring_counts.Push(0);
+        row.parasite_counts.Push(0);
+      }
       f_row_sum += val;
-      f_temp_row.Push(val);
+      f_num_cols++;
     }
     if(f_row_sum == 0.0){
       feedback.Error("Cannot have a row sum of 0.0 in connection matrix");
       return false;
     }
-    else{
-      m_row_connectivity_sums.Push(f_row_sum);
-    }
-    m_migration_matrix.Push(f_temp_row);
-  }
-  
-  if(num_demes != m_migration_matrix.GetSize()){
-    feedback.Error("The number of demes in the migration matrix (%i) did not match the NUM_DEMES (%i) parameter in avida.cfg.",m_migration_matrix.GetSize(),num_demes);
-    return false;
-  }
-  for(int f_row = 0; f_row < m_migration_matrix.GetSize(); f_row++){
-    if(m_migration_matrix[f_row].GetSize() != m_migration_matrix.GetSize()){
-      feedback.Error("The number of columns in row %i did not match total number of demes",f_row);
-      return false;
-    }
-    if(m_migration_matrix[f_row].GetSize() != num_demes){
-      feedback.Error("The number of demes in the migration matrix (%i) did not match the NUM_DEMES (%i) parameter in avida.cfg.",m_migration_matrix.GetSize(),num_demes);
+    row.row_sum = f_row_sum;
+    if(f_num_cols != num_demes){
+      feedback.Error("The number of columns in row %i did not match total number of demes",line_id);
       return false;
     }
   }
   
-  if(p_count_parasites && !p_is_reload){
-    Apto::Array<int, Apto::Smart> blank(num_demes);
-    blank.SetAll(0);
-    
-    m_parasite_migration_counts.Resize(num_demes, blank);
-    ResetParasiteCounts();
+  if(p_is_reload && m_rows.GetSize() == num_demes){
+    // Carry over counts, keeping removed connections that have been used as zero weight connections.
+    for(int f_row = 0; f_row < num_demes; f_row++){
+      const sRow& old_row = m_rows[f_row];
+      for(int i = 0; i < old_row.cols.GetSize(); i++){
+        if(old_row.offspring_counts[i] == 0 && old_row.parasite_counts[i] == 0) continue;
+        int idx = findConnection(rows[f_row], old_row.cols[i]);
+        if (idx < 0) idx = addConnection(rows[f_row], old_row.cols[i]);
+        rows[f_row].offspring_counts[idx] = old_row.offspring_counts[i];
+        rows[f_row].parasite_counts[idx] = old_row.parasite_counts[i];
+      }
+    }
   }
   
-  if(p_count_offspring && !p_is_reload){
-    Apto::Array<int, Apto::Smart> blank(num_demes);
-    blank.SetAll(0);
-    m_offspring_migration_counts.Resize(num_demes, blank);
-    ResetOffspringCounts();
-  }
+  m_rows = rows;
+  m_num_cols = num_demes;
   
   return true;
 }
 
 void cMigrationMatrix::Print(std::ostream& os){
-    for(int row = 0; row < m_migration_matrix.GetSize(); row++){
-        for(int col = 0; col < m_migration_matrix[row].GetSize(); col++){
-            os << m_migration_matrix[row][col];
-            if(col + 1 < m_migration_matrix[row].GetSize())
+    for(int row = 0; row < m_rows.GetSize(); row++){
+        const sRow& cur_row = m_rows[row];
+        int idx = 0;
+        for(int col = 0; col < m_num_cols; col++){
+            if(idx < cur_row.cols.GetSize() && cur_row.cols[idx] == col)
+                os << cur_row.weights[idx++];
+            else
+                os << 0.0;
+            if(col + 1 < m_num_cols)
                 os << ",";
         }
         os << std::endl;
@@ -159,17 +199,79 @@ void cMigrationMatrix::Print(std::ostream& os){
 };
 
 void cMigrationMatrix::ResetParasiteCounts(){
-  for(int row = 0; row < m_parasite_migration_counts.GetSize(); row++){
-    for(int col = 0; col < m_parasite_migration_counts[row].GetSize(); col++){
-      m_parasite_migration_counts[row][col] = 0;
-    }
+  for(int row = 0; row < m_rows.GetSize(); row++){
+    m_rows[row].parasite_counts.SetAll(0);
   }
 };
 
 void cMigrationMatrix::ResetOffspringCounts(){
-  for(int row = 0; row < m_offspring_migration_counts.GetSize(); row++){
-    for(int col = 0; col < m_offspring_migration_counts[row].GetSize(); col++){
-      m_offspring_migration_counts[row][col] = 0;
-    }
+  for(int row = 0; row < m_rows.GetSize(); row++){
+    m_rows[row].offspring_counts.SetAll(0);
   }
 };
+
+int cMigrationMatrix::findConnection(const sRow& row, int to_deme_id) const{
+  int lo = 0;
+  int hi = row.cols.GetSize() - 1;
+  while(lo <= hi){
+    const int mid = (lo + hi) / 2;
+    if(row.cols[mid] == to_deme_id) return mid;
+    if(row.cols[mid] < to_deme_id) lo = mid + 1;
+    else hi = mid - 1;
+  }
+  return -1;
+}
+
+int cMigrationMatrix::addConnection(sRow& row, int to_deme_id){
+  row.cols.Push(to_deme_id);
+  row.weights.Push(0.0);
+  row.offspring_counts.Push(0);
+  row.parasite_counts.Push(0);
+  
+  // Shift the new connection down into its sorted position
+  int idx = row.cols.GetSize() - 1;
+  while(idx > 0 && row.cols[idx - 1] > to_deme_id){
+    row.cols[idx] = row.cols[idx - 1];
+    row.weights[idx] = row.weights[idx - 1];
+    row.offspring_counts[idx] = row.offspring_counts[idx - 1];
+    row.parasite_counts[idx] = row.parasite_counts[idx - 1];
+    idx--;
+  }
+  row.cols[idx] = to_deme_id;
+  row.weights[idx] = 0.0;
+  row.offspring_counts[idx] = 0;
+  row.parasite_counts[idx] = 0;
+  
+  row.prefix_valid = false;
+  return idx;
+}
+
+// The sequential scan subtracts one weight at a time and rounds at every step, while the prefix sums round as they
+// are accumulated, so the two can disagree only for values within a few units in the last place of a boundary.
+// prefix_error bounds that difference generously; lookups closer than this to a boundary fall back to the scan.
+void cMigrationMatrix::buildPrefixSums(sRow& row){
+  const int num_conns = row.weights.GetSize();
+  row.prefix_valid = true;
+  row.has_negative = false;
+  row.prefix_sums.ResizeClear(num_conns);
+  
+  double sum = 0.0;
+  double magnitude = fabs(row.row_sum);
+  for(int i = 0; i < num_conns; i++){
+    if(row.weights[i] < 0.0) row.has_negative = true;
+    sum += row.weights[i];
+    row.prefix_sums[i] = sum;
+    if(fabs(sum) > magnitude) magnitude = fabs(sum);
+  }
+  row.prefix_error = 4.0 * (num_conns + 2) * std::numeric_limits<double>::epsilon() * magnitude;
+}
+
+// Exact equivalent of scanning the dense row: columns without a connection subtract nothing and cannot end a scan
+// of a positive value.
+int cMigrationMatrix::scanRow(const sRow& row, double value) const{
+  for(int i = 0; i < row.weights.GetSize(); i++){
+    value -= row.weights[i];
+    if(value <= 0.0) return i;
+  }
+  return -1;
+}
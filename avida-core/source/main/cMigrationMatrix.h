@@ -33,6 +33,16 @@ namespace Avida {
 
 using namespace Avida;
 
+// cMigrationMatrix - weighted deme-to-deme migration topology
+// --------------------------------------------------------------------------------------------------------------
+//
+//  Each row stores only its nonzero connections, sorted by destination deme, along with the per-connection
+//  migration counts.  A destination is drawn with a single random number in [0, row sum) and is the first
+//  connection at which subtracting the weights in order brings it to zero or below, exactly as a scan of the dense
+//  row would, so runs reproduce those made with the dense matrix.  The connection is found by binary search of the
+//  row's prefix sums (rebuilt lazily after AlterConnectionWeight has changed the row); draws that fall within
+//  rounding distance of a boundary, and rows with negative weights, are resolved by the sequential scan.
+
 class cMigrationMatrix
 {
 public:
@@ -50,10 +60,30 @@ public:
   void ResetOffspringCounts();
   
 private:
-  Apto::Array< Apto::Array<double, Apto::Smart>, Apto::Smart > m_migration_matrix;
-  Apto::Array<double> m_row_connectivity_sums;
-  Apto::Array< Apto::Array<int, Apto::Smart>, Apto::Smart > m_parasite_migration_counts;
-  Apto::Array< Apto::Array<int, Apto::Smart>, Apto::Smart >  m_offspring_migration_counts;
+  struct sRow
+  {
+    Apto::Array<int, Apto::Smart> cols;            // Destination demes, ascending
+    Apto::Array<double, Apto::Smart> weights;
+    Apto::Array<int, Apto::Smart> offspring_counts;
+    Apto::Array<int, Apto::Smart> parasite_counts;
+    
+    double row_sum;                                 // Sum of the loaded weights plus all alterations since
+    
+    Apto::Array<double, Apto::Smart> prefix_sums;   // Running sums of the weights, indexed by connection
+    double prefix_error;                            // Bound on the rounding difference from the sequential scan
+    bool prefix_valid;
+    bool has_negative;
+    
+    sRow() : row_sum(0.0), prefix_error(0.0), prefix_valid(false), has_negative(false) { ; }
+  };
+  
+  Apto::Array<sRow, Apto::Smart> m_rows;
+  int m_num_cols;
+  
+  int findConnection(const sRow& row, int to_deme_id) const;
+  int addConnection(sRow& row, int to_deme_id);
+  void buildPrefixSums(sRow& row);
+  int scanRow(const sRow& row, double value) const;
 };
 
 #endif
@@ -38,12 +38,10 @@
 #include "cPopulationCell.h"
 #include "cMultiProcessWorld.h"
 #include "nGeometry.h"
-#include <map>
 #include <functional>
 #include <iostream>
 #include <sstream>
 #include <cmath>
-#include <boost/optional.hpp>
 
 using namespace Avida;
 
@@ -53,40 +51,22 @@ static const char* UPDATE="mean update time [ut]";
 static const char* POSTUPDATE="mean post-update time [post]";
 static const char* CALCUPDATE="mean calc-update time [calc]";
 
-/*! Message that is sent from one cMultiProcessWorld to another during organism
- migration.
+/*! Initializing constructor.
  */
-struct migration_message {
-	//! Default constructor.
-	migration_message() { }
-	
-	//! Initializing constructor.
-	migration_message(cOrganism* org, const cPopulationCell& cell, double merit, int lineage)
-	: _merit(merit), _lineage(lineage) {
-		_genome = org->GetGenome().AsString();
-		cell.GetPosition(_x, _y);
-		_generation = org->GetPhenotype().GetGeneration();
-	}
+migration_message::migration_message(cOrganism* org, const cPopulationCell& cell, double merit, int lineage)
+: _merit(merit), _lineage(lineage) {
+	_genome = org->GetGenome().AsString();
+	cell.GetPosition(_x, _y);
+	_generation = org->GetPhenotype().GetGeneration();
+}
 
-	//! Finish unpacking an organism from this message.
-	void unpack(cOrganism* org) {
-		org->UpdateMerit(cAvidaContext& ctx, _merit);
-		org->GetPhenotype().SetGeneration(_generation);
-	}	
-	
-	//! Serializer, used to (de)marshal organisms for migration.
-	template<class Archive>
-	void serialize(Archive & ar, const unsigned int version) {
-		ar & _genome & _merit & _lineage & _x & _y & _generation;
-	}
-	
-	std::string _genome; //!< Genome of the migrating organism.
-	double _merit; //!< Merit of this organism in its originating population.
-	int _lineage; //!< Lineage label of this organism in its orginating population.
-	int _x; //!< X-coordinate of the cell from which this migrant originated.
-	int _y; //!< Y-coordinate of the cell from which this migrant originated.
-	int _generation; //!< Generation of this organism.
-};
+
+/*! Finish unpacking an organism from this message.
+ */
+void migration_message::unpack(cAvidaContext& ctx, cOrganism* org) {
+	org->UpdateMerit(ctx, _merit);
+	org->GetPhenotype().SetGeneration(_generation);
+}
 
 
 /*! Create and initialize a cMultiProcessWorld.
@@ -114,7 +94,14 @@ cMultiProcessWorld::cMultiProcessWorld(cAvidaConfig* cfg, const cString& cwd, bo
 , m_universe_dim(0)
 , m_universe_x(0)
 , m_universe_y(0)
-, m_universe_popsize(-1) {
+, m_universe_popsize(-1)
+, m_outbox(worldcomm.size())
+, m_exchange_tag(0)
+, m_updates_since_exchange(0) {
+	if(GetConfig().MP_MIGRATION_INTERVAL.Get() < 1) {
+		GetDriver().RaiseFatalException(-1, "MP_MIGRATION_INTERVAL must be at least 1.");
+	}
+	
 	if(GetConfig().BIRTH_METHOD.Get() == POSITION_OFFSPRING_RANDOM) {
 		// there are a couple bugs in spatial that still need to be worked out:
 		// specifically, what to do about size(1) universes?
@@ -132,6 +119,22 @@ cMultiProcessWorld::cMultiProcessWorld(cAvidaConfig* cfg, const cString& cwd, bo
 }
 
 
+/*! Destructor.
+ 
+ Cancels an overlapped exchange that is still in flight; its migrants are discarded.
+ Other worlds may already have stopped exchanging, so requests that have not completed
+ are cancelled rather than waited for, and the wait only reaps the cancellations.
+ */
+cMultiProcessWorld::~cMultiProcessWorld() {
+	for(std::size_t i=0; i<m_reqs.size(); ++i) {
+		if(!m_reqs[i].test()) {
+			m_reqs[i].cancel();
+		}
+	}
+	boost::mpi::wait_all(m_reqs.begin(), m_reqs.end());
+}
+
+
 /*! Migrate this organism to a different world.
  
  If this method is called, it means that this organism is to be migrated to a
@@ -184,9 +187,9 @@ void cMultiProcessWorld::MigrateOrganism(cOrganism* org, const cPopulationCell&
 	assert(dst_world < m_mpi_world.size());
 	assert(dst_world >= 0);
 
-	// the tag is set to the number of messages previously sent; this is to allow
-	// the receiver to sort messages for consistency.
-	m_reqs.push_back(m_mpi_world.isend(dst_world, m_reqs.size(), migration_message(org, cell, merit.GetDouble(), lineage)));
+	// migrants are batched per destination until the next exchange; the order within
+	// each batch is the order of migration, which keeps injection deterministic.
+	m_outbox[dst_world].push_back(migration_message(org, cell, merit.GetDouble(), lineage));
 	
 	// stats tracking:
 	GetStats().OutgoingMigrant(org);
@@ -258,57 +261,109 @@ bool cMultiProcessWorld::IsWorldBoundary(const cPopulationCell& cell) {
 
 /*! Process post-update events.
  
- This method is called after each update of the local population completes.  Here
- we check to see if this world has received any migrants from other worlds, and if
- so, we inject them into the local population.  Note that this is an unconditional
- injection -- that is, migrants are "pushed" to this world.
+ This method is called after each update of the local population completes.  Every
+ MP_MIGRATION_INTERVAL updates, the migrants batched since the last exchange are
+ sent to their destination worlds, one message per destination, and the migrants
+ received from other worlds are injected into the local population.  Note that this
+ is an unconditional injection -- that is, migrants are "pushed" to this world.
  
- Migrants are injected according to BIRTH_METHOD.
+ With MP_MIGRATION_STYLE 0 the exchange is a single collective operation, and the
+ received migrants are injected immediately.  With MP_MIGRATION_STYLE 1 the exchange
+ is only started, and completes while the following updates are computed; its migrants
+ are injected at the next exchange.  Neither style needs a global barrier.  In both,
+ migrants are injected in order by source world and then by the order in which they
+ were migrated, so runs are reproducible.
  
  \todo What to do about cross-world lineage labels?
- 
- \todo At the moment, this method forces synchronization on update boundaries across
- *all* worlds.  This could slow things down quite a bit, so we may need to consider a
- second mode that relaxes consistency in favor of speed.
  */
 void cMultiProcessWorld::ProcessPostUpdate(cAvidaContext& ctx) {
-	namespace mpi = boost::mpi;
-	using namespace boost;
-	
 	// restart the timer for this method, and get the elapsed time for the past update:
 	m_pf[UPDATE] = m_update_timer.elapsed();
 	m_post_update_timer.restart();
 	
-	// wait until we're sure that this process has sent all its messages:
-	mpi::wait_all(m_reqs.begin(), m_reqs.end());
-	m_reqs.clear();
+	if(++m_updates_since_exchange >= GetConfig().MP_MIGRATION_INTERVAL.Get()) {
+		m_updates_since_exchange = 0;
+		switch(GetConfig().MP_MIGRATION_STYLE.Get()) {
+			case MP_MIGRATION_SYNCHRONOUS: {
+				ExchangeMigrants(ctx);
+				break;
+			}
+			case MP_MIGRATION_OVERLAPPED: {
+				OverlapExchangeMigrants(ctx);
+				break;
+			}
+			default: {
+				GetDriver().RaiseFatalException(-1, "Unrecognized MP_MIGRATION_STYLE.");
+			}
+		}
+	}
+	
+	// record profiling stats:
+	m_pf[POSTUPDATE] = m_post_update_timer.elapsed();
+	GetStats().ProfilingData(m_pf);
+	m_pf.clear();
+	
+	// restart the update timer!
+	m_update_timer.restart();
+}
+
+
+/*! Exchange the batched migrants with all worlds and inject the ones received.
+ 
+ all_to_all delivers exactly one (possibly empty) batch from every world, so no
+ probing or barrier is needed to know that everything has arrived.
+ */
+void cMultiProcessWorld::ExchangeMigrants(cAvidaContext& ctx) {
+	std::vector<migrant_list_t> recvd;
+	boost::mpi::all_to_all(m_mpi_world, m_outbox, recvd);
+	
+	for(std::size_t i=0; i<m_outbox.size(); ++i) {
+		m_outbox[i].clear();
+	}
+	
+	InjectMigrants(ctx, recvd);
+}
+
+
+/*! Complete the overlapped exchange in flight (if any) and post the next one.
+ 
+ Every world sends a batch to every world (including itself) at each exchange, so
+ each world knows exactly which messages to wait for.  The tag identifies the
+ exchange, which keeps consecutive exchanges from being confused.
+ */
+void cMultiProcessWorld::OverlapExchangeMigrants(cAvidaContext& ctx) {
+	if(!m_reqs.empty()) {
+		boost::mpi::wait_all(m_reqs.begin(), m_reqs.end());
+		m_reqs.clear();
+		InjectMigrants(ctx, m_inbox);
+	}
 	
-	// at this point, we know that *this* process has sent everything.  but, we don't
-	// know if it's *received* everything.  so, we're going to put in a synchronization
-	// barrier, which means that every process must reach the barrier before any are allowed
-	// to proceed.  since we just finished waiting for all communication to complete,
-	// this means that all messages must have been received, too.
-	m_mpi_world.barrier();	
+	// the batches must stay alive until their sends complete:
+	m_sending.swap(m_outbox);
+	m_outbox.assign(m_mpi_world.size(), migrant_list_t());
+	m_inbox.assign(m_mpi_world.size(), migrant_list_t());
 	
-	// now, receive all the messages, but store them in order by source and tag:
-	typedef std::map<int,migration_message> rx_tag_t;
-	typedef std::map<int,rx_tag_t> rx_src_t;
-	rx_src_t recvd;
-	optional<mpi::status> s = m_mpi_world.iprobe(mpi::any_source,mpi::any_tag);
-	while(s.is_initialized()) {
-		migration_message msg;
-		m_mpi_world.recv(s->source(), s->tag(), msg);
-		recvd[s->source()][s->tag()] = msg;		
-		// any others?
-		s = m_mpi_world.iprobe(mpi::any_source,mpi::any_tag);		
+	for(int i=0; i<m_mpi_world.size(); ++i) {
+		m_reqs.push_back(m_mpi_world.irecv(i, m_exchange_tag, m_inbox[i]));
+	}
+	for(int i=0; i<m_mpi_world.size(); ++i) {
+		m_reqs.push_back(m_mpi_world.isend(i, m_exchange_tag, m_sending[i]));
 	}
 	
-	// iterate over received messages in-order, injecting genomes into our population:
-	for(rx_src_t::iterator i=recvd.begin(); i!=recvd.end(); ++i) {
-		for(rx_tag_t::iterator j=i->second.begin(); j!=i->second.end(); ++j) {
-			//std::cerr << "**********  INJECTING *********** " << i->first << " " << j->first << std::endl;
+	// 32767 is the smallest upper bound on tags that MPI guarantees:
+	m_exchange_tag = (m_exchange_tag + 1) % 32768;
+}
+
+
+/*! Inject received migrants, in order by source world and then by the order in which they were sent.
+ 
+ Migrants are injected according to BIRTH_METHOD.
+ */
+void cMultiProcessWorld::InjectMigrants(cAvidaContext& ctx, std::vector<migrant_list_t>& migrants) {
+	for(std::size_t i=0; i<migrants.size(); ++i) {
+		for(std::size_t j=0; j<migrants[i].size(); ++j) {
 			// ok, add this migrant to the current population
-			migration_message& migrant = j->second;
+			migration_message& migrant = migrants[i][j];
 			int target_cell=-1;
 			
 			switch(GetConfig().BIRTH_METHOD.Get()) {
@@ -333,26 +388,11 @@ void cMultiProcessWorld::ProcessPostUpdate(cAvidaContext& ctx) {
 																	 Genome(cString(migrant._genome.c_str())), // genome unpacked from message
 																	 ctx, migrant._lineage); // lineage label
 			// unpack the rest from the message:
-			migrant.unpack(GetPopulation().GetCell(target_cell).GetOrganism());
+			migrant.unpack(ctx, GetPopulation().GetCell(target_cell).GetOrganism());
 			GetStats().IncomingMigrant(GetPopulation().GetCell(target_cell).GetOrganism());
 		}
+		migrants[i].clear();
 	}
-	
-	// oh, sweet sanity; make sure that we actually processed all messages.
-	assert(!m_mpi_world.iprobe(mpi::any_source,mpi::any_tag).is_initialized());
-	
-	// finally, we need another barrier down here, in the off chance that one of the
-	// processes is really speedy and manages to migrate another org to this world
-	// before we finished the probe-loop.
-	m_mpi_world.barrier();
-
-	// record profiling stats:
-	m_pf[POSTUPDATE] = m_post_update_timer.elapsed();
-	GetStats().ProfilingData(m_pf);
-	m_pf.clear();
-	
-	// restart the update timer!
-	m_update_timer.restart();
 }
 
 
@@ -26,12 +26,49 @@
 #include <boost/mpi/environment.hpp>
 #include <boost/mpi/communicator.hpp>
 #include <boost/timer.hpp>
+#include <boost/serialization/string.hpp>
+#include <boost/serialization/vector.hpp>
+#include <string>
 #include <vector>
 
 #include "cWorld.h"
 #include "cAvidaConfig.h"
 #include "cStats.h"
 
+class cAvidaContext;
+class cMerit;
+class cOrganism;
+class cPopulationCell;
+
+
+/*! Message that is sent from one cMultiProcessWorld to another during organism
+ migration.
+ */
+struct migration_message {
+	//! Default constructor.
+	migration_message() { }
+	
+	//! Initializing constructor.
+	migration_message(cOrganism* org, const cPopulationCell& cell, double merit, int lineage);
+	
+	//! Finish unpacking an organism from this message.
+	void unpack(cAvidaContext& ctx, cOrganism* org);
+	
+	//! Serializer, used to (de)marshal organisms for migration.
+	template<class Archive>
+	void serialize(Archive & ar, const unsigned int version) {
+		ar & _genome & _merit & _lineage & _x & _y & _generation;
+	}
+	
+	std::string _genome; //!< Genome of the migrating organism.
+	double _merit; //!< Merit of this organism in its originating population.
+	int _lineage; //!< Lineage label of this organism in its orginating population.
+	int _x; //!< X-coordinate of the cell from which this migrant originated.
+	int _y; //!< Y-coordinate of the cell from which this migrant originated.
+	int _generation; //!< Generation of this organism.
+};
+
+
 /*! Multi-process Avida world.
  
  This class enables multi-process Avida, which provides a mechanism for much larger
@@ -39,6 +76,10 @@
  a single new technique, that of "cross-world migration," where an individual organism
  is transferred to a different Avida world and injected into a random location in that
  world's population.
+ 
+ Migrants are batched per destination world and exchanged every MP_MIGRATION_INTERVAL
+ updates (see ProcessPostUpdate).  Any number of worlds can be run on a single machine,
+ e.g., "mpirun -np 4 avida-mp", which is the easiest way to test the exchange styles.
  */
 class cMultiProcessWorld : public cWorld
 	{
@@ -50,7 +91,13 @@ class cMultiProcessWorld : public cWorld
 	protected:
 		boost::mpi::environment& m_mpi_env; //!< MPI environment.
 		boost::mpi::communicator& m_mpi_world; //!< World-wide MPI communicator.
-		std::vector<boost::mpi::request> m_reqs; //!< Requests outstanding since the last ProcessPostUpdate.
+		typedef std::vector<migration_message> migrant_list_t; //!< Migrants, in the order they were migrated.
+		std::vector<migrant_list_t> m_outbox; //!< Migrants waiting for the next exchange, indexed by destination world.
+		std::vector<migrant_list_t> m_sending; //!< Migrants of the exchange in flight (overlapped), indexed by destination.
+		std::vector<migrant_list_t> m_inbox; //!< Migrants of the exchange in flight (overlapped), indexed by source.
+		std::vector<boost::mpi::request> m_reqs; //!< Requests of the exchange in flight (overlapped).
+		int m_exchange_tag; //!< Tag of the next overlapped exchange.
+		int m_updates_since_exchange; //!< Updates completed since the last exchange.
 		int m_universe_dim; //!< Dimension (x & y) of the universe (number of worlds along the side of a grid of worlds).
 		int m_universe_x; //!< X coordinate of this world.
 		int m_universe_y; //!< Y coordinate of this world.
@@ -69,7 +116,7 @@ class cMultiProcessWorld : public cWorld
 		static cMultiProcessWorld* Initialize(cAvidaConfig* cfg, const cString& cwd, boost::mpi::environment& env, boost::mpi::communicator& worldcomm);
 		
 		//! Destructor.
-		virtual ~cMultiProcessWorld() { }
+		virtual ~cMultiProcessWorld();
 		
 		//! Migrate this organism to a different world.
 		virtual void MigrateOrganism(cOrganism* org, const cPopulationCell& cell,
@@ -89,6 +136,16 @@ class cMultiProcessWorld : public cWorld
 		
 		//! Calculate the size (in virtual CPU cycles) of the current update.
 		virtual int CalculateUpdateSize();
+		
+	protected:
+		//! Exchange the batched migrants with all worlds and inject the ones received.
+		void ExchangeMigrants(cAvidaContext& ctx);
+		
+		//! Complete the overlapped exchange in flight (if any) and post the next one.
+		void OverlapExchangeMigrants(cAvidaContext& ctx);
+		
+		//! Inject received migrants, in order by source world and then by the order in which they were sent.
+		void InjectMigrants(cAvidaContext& ctx, std::vector<migrant_list_t>& migrants);
 	};
 
 #endif
@@ -0,0 +1,89 @@
+/*
+ *  cOrgMessageBox.h
+ *  Avida
+ *
+ *  Copyright 2026 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef cOrgMessageBox_h
+#define cOrgMessageBox_h
+
+#include "apto/core.h"
+
+#include "cOrgMessage.h"
+
+#include <cassert>
+
+
+/*! A first-in first-out store of organism messages with a fixed capacity.  The storage
+ is allocated once and used as a ring, so keeping the most recent messages of a busy
+ organism does not allocate per message.  Adding a message to a full box drops the oldest
+ one.  A capacity of -1 leaves the box unbounded, growing its storage as needed; any other
+ negative capacity is treated as 0, so the box keeps nothing.
+ */
+class cOrgMessageBox
+{
+private:
+  Apto::Array<cOrgMessage> m_msgs;
+  int m_capacity;
+  int m_head;     //!< Storage index of the oldest message.
+  int m_count;
+
+  inline int index(int pos) const { int idx = m_head + pos; return (idx < m_msgs.GetSize()) ? idx : idx - m_msgs.GetSize(); }
+
+  void grow()
+  {
+    Apto::Array<cOrgMessage> msgs((m_msgs.GetSize()) ? m_msgs.GetSize() * 2 : 8);
+    for (int i = 0; i < m_count; i++) msgs[i] = m_msgs[index(i)];
+    m_msgs = msgs;
+    m_head = 0;
+  }
+
+public:
+  explicit cOrgMessageBox(int capacity) : m_capacity((capacity < -1) ? 0 : capacity), m_head(0), m_count(0)
+  {
+    if (m_capacity > 0) m_msgs.Resize(m_capacity);
+  }
+
+  int GetSize() const { return m_count; }
+  int GetCapacity() const { return m_capacity; }
+  bool IsFull() const { return m_capacity != -1 && m_count >= m_capacity; }
+
+  //! Messages in arrival order, 0 is the oldest.
+  const cOrgMessage& operator[](int pos) const { assert(pos >= 0 && pos < m_count); return m_msgs[index(pos)]; }
+  cOrgMessage& Front() { assert(m_count > 0); return m_msgs[m_head]; }
+  cOrgMessage& Back() { assert(m_count > 0); return m_msgs[index(m_count - 1)]; }
+
+  //! Adds a message as the newest one, dropping the oldest if the box is full.
+  void PushBack(const cOrgMessage& msg)
+  {
+    if (m_capacity == 0) return;
+    if (IsFull()) {
+      m_msgs[m_head] = msg;
+      m_head = index(1);
+      return;
+    }
+    if (m_count == m_msgs.GetSize()) grow();
+    m_msgs[index(m_count)] = msg;
+    m_count++;
+  }
+
+  void PopFront() { assert(m_count > 0); m_head = index(1); m_count--; }
+  void Clear() { m_head = 0; m_count = 0; }
+};
+
+#endif
@@ -33,6 +33,7 @@
 #include "cHardwareManager.h"
 #include "cInstSet.h"
 #include "cOrgSensor.h"
+#include "cPopulation.h"
 #include "cPopulationCell.h"
 #include "cStateGrid.h"
 #include "cStringUtil.h"
@@ -270,6 +271,12 @@ void cOrganism::SetOrgInterface(cAvidaContext& ctx, cOrgInterface* org_interface
   HardwareReset(ctx);
 }
 
+void cOrganism::SetLineageLabel(int in_label)
+{
+  m_lineage_label = in_label;
+  m_world->GetPopulation().InvalidateSnapshot();
+}
+
 const cStateGrid& cOrganism::GetStateGrid() const { return m_world->GetEnvironment().GetStateGrid(m_cur_sg); }
 
 double cOrganism::GetVitality() const {
@@ -967,22 +974,23 @@ void cOrganism::NewTrial()
 }
 
 
+void cOrganism::CreateMessaging()
+{
+  m_msg = new cMessagingSupport(m_world->GetConfig().MESSAGE_SEND_BUFFER_SIZE.Get(),
+                                m_world->GetConfig().MESSAGE_RECV_BUFFER_SIZE.Get());
+}
+
+
 /*! Called as the bottom-half of a successfully sent message.
  */
 void cOrganism::MessageSent(cAvidaContext&, cOrgMessage& msg) {
 	// check to see if we should store it:
-	const int bsize = m_world->GetConfig().MESSAGE_SEND_BUFFER_SIZE.Get();
-  
-	if((bsize > 0) || (bsize == -1)) {
-		// yep; store it:
-		m_msg->sent.push_back(msg);
+	if(m_msg->sent.GetCapacity() != 0) {
+		// yep; store it, chopping off the oldest message if our buffer is full:
+		m_msg->sent.PushBack(msg);
 		// and set the receiver-pointer of this message to NULL.  We don't want to
 		// walk this list later thinking that the receivers are still around.
-		m_msg->sent.back().SetReceiver(0);
-		// if our buffer is too large, chop off old messages:
-		while((bsize != -1) && (static_cast<int>(m_msg->sent.size()) > bsize)) {
-			m_msg->sent.pop_front();
-		}
+		m_msg->sent.Back().SetReceiver(0);
 	}	
 }
 
@@ -1034,11 +1042,9 @@ void cOrganism::ReceiveMessage(cOrgMessage& msg)
 {
   InitMessaging();
 	// don't store more messages than we're configured to.
-	const int bsize = m_world->GetConfig().MESSAGE_RECV_BUFFER_SIZE.Get();
-	if((bsize != -1) && (bsize <= static_cast<int>(m_msg->received.size()))) {
+	if(m_msg->received.IsFull()) {
 		switch (m_world->GetConfig().MESSAGE_RECV_BUFFER_BEHAVIOR.Get()) {
-			case 0: // drop oldest message
-				m_msg->received.pop_front();
+			case 0: // drop oldest message, which adding this one does
 				break;
 			case 1: // drop this message
 				return;
@@ -1050,7 +1056,7 @@ void cOrganism::ReceiveMessage(cOrgMessage& msg)
 	}
   
 	msg.SetReceiver(this);
-	m_msg->received.push_back(msg);
+	m_msg->received.PushBack(msg);
   
   if (m_world->GetConfig().ACTIVE_MESSAGES_ENABLED.Get() > 0) {
     // then create new thread and load its registers
@@ -1069,10 +1075,10 @@ std::pair<bool, cOrgMessage> cOrganism::RetrieveMessage() {
   InitMessaging();
 	std::pair<bool, cOrgMessage> ret = std::make_pair(false, cOrgMessage());	
 	
-	if(m_msg->received.size() > 0) {
-		ret.second = m_msg->received.front();
+	if(m_msg->received.GetSize() > 0) {
+		ret.second = m_msg->received.Front();
 		ret.first = true;
-		m_msg->received.pop_front();
+		m_msg->received.PopFront();
 	}
 	
 	return ret;
@@ -1219,6 +1225,14 @@ void cOrganism::SetOpinion(const Opinion& opinion) {
     }
   }
   // if using avatars, make sure you swap avatar lists if the org's catorization changes!
+  m_world->GetPopulation().InvalidateSnapshot();
+}
+
+void cOrganism::ClearOpinion()
+{
+  InitOpinions();
+  m_opinion->opinion_list.clear();
+  m_world->GetPopulation().InvalidateSnapshot();
 }
 
 // Checks if the organism has an opinion.
@@ -1264,6 +1278,7 @@ void cOrganism::SetForageTarget(cAvidaContext& ctx, int forage_target, bool inje
   }
   m_forage_target = forage_target;
   if (m_show_ft == -1) m_show_ft = m_forage_target;
+  m_world->GetPopulation().InvalidateSnapshot();
 }
 
 void cOrganism::CopyParentFT(cAvidaContext& ctx) {
@@ -33,6 +33,7 @@
 #include "cPhenotype.h"
 #include "cOrgInterface.h"
 #include "cOrgMessage.h"
+#include "cOrgMessageBox.h"
 #include "tBuffer.h"
 #include "tList.h"
 
@@ -157,7 +158,7 @@ public:
   cOrgInterface& GetOrgInterface() { assert(m_interface); return *m_interface; }
   void SetOrgInterface(cAvidaContext& ctx, cOrgInterface* org_interface);
 
-  void SetLineageLabel(int in_label) { m_lineage_label = in_label; }
+  void SetLineageLabel(int in_label);
   int GetLineageLabel() const { return m_lineage_label; }  
   void SetLineage(cLineage* in_lineage) { m_lineage = in_lineage; }
   cLineage* GetLineage() const { return m_lineage; }
@@ -382,7 +383,7 @@ public:
 
   // -------- Messaging support --------
 public:
-  typedef std::deque<cOrgMessage> message_list_type; //!< Container-type for cOrgMessages.
+  typedef cOrgMessageBox message_list_type; //!< Container-type for cOrgMessages.
 
   //! Called when this organism attempts to send a message.
   bool SendMessage(cAvidaContext& ctx, cOrgMessage& msg);
@@ -392,25 +393,25 @@ public:
   void ReceiveMessage(cOrgMessage& msg);
   //! Called when this organism attempts to move a received message into its CPU.
   std::pair<bool, cOrgMessage> RetrieveMessage();
-  //! Returns the list of all messsages received by this organism.
+  //! Returns the messsages received by this organism that have not been retrieved (at most MESSAGE_RECV_BUFFER_SIZE).
   const message_list_type& GetReceivedMessages() { InitMessaging(); return m_msg->received; }
-  //! Returns the list of all messages sent by this organism.
+  //! Returns the most recent messages sent by this organism (at most MESSAGE_SEND_BUFFER_SIZE).
   const message_list_type& GetSentMessages() { InitMessaging(); return m_msg->sent; }
   //! Use at your own rish; clear all the message buffers.
-  void FlushMessageBuffers() { InitMessaging(); m_msg->sent.clear(); m_msg->received.clear(); }
-  int PeekAtNextMessageType() { InitMessaging(); return m_msg->received.front().GetMessageType(); }
+  void FlushMessageBuffers() { InitMessaging(); m_msg->sent.Clear(); m_msg->received.Clear(); }
+  int PeekAtNextMessageType() { InitMessaging(); return m_msg->received.Front().GetMessageType(); }
 
 private:
   /*! Contains all the different data structures needed to support messaging within
   cOrganism.  Inspired by cNetSupport (above), the idea is to minimize impact on
-  organisms that DON'T use messaging. */
+  organisms that DON'T use messaging.  Both buffers are sized once from the configuration,
+  so the sent history is only retained when MESSAGE_SEND_BUFFER_SIZE asks for it. */
   struct cMessagingSupport
   {
-    cMessagingSupport() : retrieve_index(0) { }
+    cMessagingSupport(int send_size, int recv_size) : sent(send_size), received(recv_size) { }
 
-    message_list_type sent; //!< List of all messages sent by this organism.
-    message_list_type received; //!< List of all messages received by this organism.
-    message_list_type::size_type retrieve_index; //!< Index of next message that can be retrieved.
+    message_list_type sent; //!< Most recent messages sent by this organism.
+    message_list_type received; //!< Messages received by this organism, waiting to be retrieved.
   };
 
   /*! This member variable is lazily initialized whenever any of the messaging
@@ -418,7 +419,8 @@ private:
   cMessagingSupport* m_msg;
 
   //! Called to check for (and initialize) messaging support within this organism.
-  inline void InitMessaging() { if(!m_msg) m_msg = new cMessagingSupport(); }	
+  inline void InitMessaging() { if(!m_msg) CreateMessaging(); }
+  void CreateMessaging();
   //! Called as the bottom-half of a successfully sent message.
   void MessageSent(cAvidaContext& ctx, cOrgMessage& msg);
   // -------- End of messaging support --------
@@ -475,7 +477,7 @@ public:
   //! Return whether this organism has an opinion.
   bool HasOpinion();
   //! remove all opinions
-  void ClearOpinion() { InitOpinions(); m_opinion->opinion_list.clear(); }
+  void ClearOpinion();
 
 private:
   //! Initialize opinion support.
@@ -837,15 +839,15 @@ private:
 
 
 inline double cOrganism::GetTestFitness(cAvidaContext& ctx) const {
-  return Systematics::GenomeTestMetrics::GetMetrics(m_world, ctx, SystematicsGroup("genotype"))->GetFitness();
+  return Systematics::GenomeTestMetrics::GetMetrics(m_world, ctx, SystematicsGroup(Systematics::ROLE_GENOTYPE))->GetFitness();
 }
 
 inline double cOrganism::GetTestMerit(cAvidaContext& ctx) const {
-  return Systematics::GenomeTestMetrics::GetMetrics(m_world, ctx, SystematicsGroup("genotype"))->GetMerit();
+  return Systematics::GenomeTestMetrics::GetMetrics(m_world, ctx, SystematicsGroup(Systematics::ROLE_GENOTYPE))->GetMerit();
 }
 
 inline double cOrganism::GetTestColonyFitness(cAvidaContext& ctx) const {
-  return Systematics::GenomeTestMetrics::GetMetrics(m_world, ctx, SystematicsGroup("genotype"))->GetColonyFitness();
+  return Systematics::GenomeTestMetrics::GetMetrics(m_world, ctx, SystematicsGroup(Systematics::ROLE_GENOTYPE))->GetColonyFitness();
 }
 
 
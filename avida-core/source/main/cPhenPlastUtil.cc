@@ -32,7 +32,7 @@ int cPhenPlastUtil::GetNumPhenotypes(cAvidaContext& ctx, cWorld* world, Systemat
   Apto::SmartPtr<cPhenPlastSummary> ps = bg->GetData<cPhenPlastSummary>();
   if (!ps) {
     
-    ps = Apto::SmartPtr<cPhenPlastSummary>(TestPlasticity(ctx, world, Genome(bg->Properties().Get("genome"))));
+    ps = Apto::SmartPtr<cPhenPlastSummary>(TestPlasticity(ctx, world, Genome(*bg->RepresentativeGenome())));
     bg->AttachData(ps);
   }
   
@@ -44,7 +44,7 @@ double cPhenPlastUtil::GetPhenotypicEntropy(cAvidaContext& ctx, cWorld* world, S
   Apto::SmartPtr<cPhenPlastSummary> ps = bg->GetData<cPhenPlastSummary>();
   if (!ps) {
     
-    ps = Apto::SmartPtr<cPhenPlastSummary>(TestPlasticity(ctx, world, Genome(bg->Properties().Get("genome"))));
+    ps = Apto::SmartPtr<cPhenPlastSummary>(TestPlasticity(ctx, world, Genome(*bg->RepresentativeGenome())));
     bg->AttachData(ps);
   }
   
@@ -56,7 +56,7 @@ double cPhenPlastUtil::GetTaskProbability(cAvidaContext& ctx, cWorld* world, Sys
   Apto::SmartPtr<cPhenPlastSummary> ps = bg->GetData<cPhenPlastSummary>();
   if (!ps) {
     
-    ps = Apto::SmartPtr<cPhenPlastSummary>(TestPlasticity(ctx, world, Genome(bg->Properties().Get("genome"))));
+    ps = Apto::SmartPtr<cPhenPlastSummary>(TestPlasticity(ctx, world, Genome(*bg->RepresentativeGenome())));
     bg->AttachData(ps);
   }
   
@@ -68,7 +68,7 @@ const Apto::Array<double>& cPhenPlastUtil::GetTaskProbabilities(cAvidaContext& c
   Apto::SmartPtr<cPhenPlastSummary> ps = bg->GetData<cPhenPlastSummary>();
   if (!ps) {
     
-    ps = Apto::SmartPtr<cPhenPlastSummary>(TestPlasticity(ctx, world, Genome(bg->Properties().Get("genome"))));
+    ps = Apto::SmartPtr<cPhenPlastSummary>(TestPlasticity(ctx, world, Genome(*bg->RepresentativeGenome())));
     bg->AttachData(ps);
   }
   
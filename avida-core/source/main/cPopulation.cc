@@ -29,6 +29,7 @@
 #include "avida/data/Package.h"
 #include "avida/data/Util.h"
 #include "avida/output/File.h"
+#include "avida/output/Manager.h"
 #include "avida/systematics/Arbiter.h"
 #include "avida/systematics/Group.h"
 #include "avida/systematics/Manager.h"
@@ -52,16 +53,21 @@
 #include "cHardwareManager.h"
 #include "cInitFile.h"
 #include "cInstSet.h"
+#include "cMeritSchedule.h"
 #include "cMigrationMatrix.h"   
 #include "cOrganism.h"
 #include "cParasite.h"
 #include "cPhenotype.h"
 #include "cPopulationCell.h"
+#include "cPopulationSnapshot.h"
 #include "cResource.h"
 #include "cResourceCount.h"
 #include "cStats.h"
 #include "cTestCPU.h"
 #include "cTopology.h"
+#include "cUpdateProfiler.h"
+#include "cUpdateSchedule.h"
+#include "cWorkerPool.h"
 #include "cWorld.h"
 
 #include "cHardwareCPU.h"
@@ -157,12 +163,19 @@ public:
     }
   }
   
-  void HandleOrganism(cOrganism* organism)
+  void HandleSnapshot(const cPopulationSnapshot& snapshot)
   {
-    Apto::String inst_set = organism->GetGenome().Properties().Get(s_prop_id_instset).StringValue();
-    Apto::Array<Apto::Stat::Accumulator<int> >& inst_exe_counts = m_is_exe_inst_map[inst_set];
-    for (int j = 0; j < organism->GetPhenotype().GetLastInstCount().GetSize(); j++) {
-      inst_exe_counts[j].Add(organism->GetPhenotype().GetLastInstCount()[j]);
+    const cInstSet* inst_set = NULL;
+    Apto::Array<Apto::Stat::Accumulator<int> >* inst_exe_counts = NULL;
+    for (int row = 0; row < snapshot.GetNumOrgs(); row++) {
+      // Rows almost always share one instruction set, so the map is only searched when it changes
+      if (&snapshot.GetInstSet(row) != inst_set) {
+        inst_set = &snapshot.GetInstSet(row);
+        inst_exe_counts = &m_is_exe_inst_map[Apto::String((const char*)inst_set->GetInstSetName())];
+      }
+      for (int j = 0; j < snapshot.GetNumLastInstCounts(row); j++) {
+        (*inst_exe_counts)[j].Add(snapshot.GetLastInstCount(row, j));
+      }
     }
   }
   
@@ -245,12 +258,18 @@ public:
     }
   }
   
-  void HandleOrganism(cOrganism* organism)
+  void HandleSnapshot(const cPopulationSnapshot& snapshot)
   {
-    Apto::String inst_set = organism->GetGenome().Properties().Get(s_prop_id_instset).StringValue();
-    Apto::Array<Apto::Stat::Accumulator<int> >& inst_exe_counts = m_is_exe_inst_map[inst_set];
-    for (int j = 0; j < organism->GetPhenotype().GetLastFromMessageInstCount().GetSize(); j++) {
-      inst_exe_counts[j].Add(organism->GetPhenotype().GetLastFromMessageInstCount()[j]);
+    const cInstSet* inst_set = NULL;
+    Apto::Array<Apto::Stat::Accumulator<int> >* inst_exe_counts = NULL;
+    for (int row = 0; row < snapshot.GetNumOrgs(); row++) {
+      if (&snapshot.GetInstSet(row) != inst_set) {
+        inst_set = &snapshot.GetInstSet(row);
+        inst_exe_counts = &m_is_exe_inst_map[Apto::String((const char*)inst_set->GetInstSetName())];
+      }
+      for (int j = 0; j < snapshot.GetNumLastFromMessageCounts(row); j++) {
+        (*inst_exe_counts)[j].Add(snapshot.GetLastFromMessageCount(row, j));
+      }
     }
   }
   
@@ -268,6 +287,9 @@ public:
 cPopulation::cPopulation(cWorld* world)  
 : m_world(world)
 , m_scheduler(NULL)
+, m_merit_schedule(NULL)
+, m_update_schedule(NULL)
+, m_cell_neighborhoods(cell_array)
 , birth_chamber(world)
 , print_mini_trace_genomes(false)
 , use_micro_traces(false)
@@ -280,10 +302,17 @@ cPopulation::cPopulation(cWorld* world)
 , num_top_pred_organisms(0)
 , sync_events(false)
 , m_hgt_resid(-1)
+, m_stats_workers(NULL)
+, m_snapshot(NULL)
+, m_snapshot_update(-1)
+, m_pop_version(0)
+, m_snapshot_version(0)
 {
   world_x = world->GetConfig().WORLD_X.Get();
   world_y = world->GetConfig().WORLD_Y.Get();
   
+  if (world->GetConfig().STATS_THREADS.Get() != 1) m_stats_workers = new cWorkerPool(world->GetConfig().STATS_THREADS.Get());
+  
   
   // Validate settings
   if (m_world->GetConfig().ENERGY_CAP.Get() == -1) m_world->GetConfig().ENERGY_CAP.Set(std::numeric_limits<double>::max());
@@ -319,7 +348,9 @@ void cPopulation::ClearCellGrid()
 {
   delete sleep_log; sleep_log = NULL;
   reaper_queue.Clear();
+  delete m_update_schedule; m_update_schedule = NULL;
   delete m_scheduler; m_scheduler = NULL;
+  m_merit_schedule = NULL;
 }
 
 
@@ -404,6 +435,18 @@ void cPopulation::SetupCellGrid()
     }
   }
   
+  // Pack the neighbors of every cell into a single table, in cell order
+  int num_connections = 0;
+  for (int i = 0; i < num_cells; i++) num_connections += cell_array[i].ConnectionList().GetSize();
+  m_connection_table.ResizeClear(num_connections);
+  for (int i = 0, offset = 0; i < num_cells; i++) {
+    cCellConnections& connections = cell_array[i].ConnectionList();
+    if (connections.GetSize() == 0) continue;
+    connections.PackInto(&m_connection_table[offset]);
+    offset += connections.GetSize();
+  }
+  m_cell_neighborhoods.Clear();
+  
   BuildTimeSlicer();
   
   
@@ -418,10 +461,12 @@ void cPopulation::SetupCellGrid()
   cResourceCount tmp_res_count(resource_lib.GetSize() - num_deme_res);
   resource_count = tmp_res_count;
   resource_count.ResizeSpatialGrids(world_x, world_y);
+  resource_count.SetProfiler(&m_world->GetUpdateProfiler());
   
   for(int i = 0; i < GetNumDemes(); i++) {
     cResourceCount tmp_deme_res_count(num_deme_res);
     GetDeme(i).SetDemeResourceCount(tmp_deme_res_count);
+    GetDeme(i).GetDemeResources().SetProfiler(&m_world->GetUpdateProfiler());
     GetDeme(i).ResizeSpatialGrids(deme_size_x, deme_size_y);
   }
   
@@ -606,7 +651,10 @@ bool cPopulation::IsValidArgument(const Data::DataID& data_id, Data::Argument ar
 cPopulation::~cPopulation()
 {
   for (int i = 0; i < cell_array.GetSize(); i++) delete cell_array[i].GetOrganism(); 
+  delete m_update_schedule;
   delete m_scheduler;
+  delete m_stats_workers;
+  delete m_snapshot;
 }
 
 
@@ -614,7 +662,10 @@ inline void cPopulation::AdjustSchedule(const cPopulationCell& cell, const cMeri
 {
   const int deme_id = cell.GetDemeID();
   const cDeme& deme = deme_array[deme_id];
-  m_scheduler->AdjustPriority(cell.GetID(), deme.HasDemeMerit() ? (merit.GetDouble() * deme.GetDemeMerit().GetDouble()) : merit.GetDouble());
+  const double priority = deme.HasDemeMerit() ? (merit.GetDouble() * deme.GetDemeMerit().GetDouble()) : merit.GetDouble();
+  if (m_update_schedule && m_merit_schedule->GetPriority(cell.GetID()) != priority) m_update_schedule->Invalidate();
+  m_scheduler->AdjustPriority(cell.GetID(), priority);
+  m_pop_version++;
 }
 
 
@@ -623,6 +674,7 @@ inline void cPopulation::AdjustSchedule(const cPopulationCell& cell, const cMeri
 // Return true if parent lives through this process.
 bool cPopulation::ActivateOffspring(cAvidaContext& ctx, const Genome& offspring_genome, cOrganism* parent_organism)
 {
+  cUpdateProfiler::Scope profile(m_world->GetUpdateProfiler(), cUpdateProfiler::PHASE_BIRTHS);
   assert(parent_organism != NULL);
   bool is_doomed = false;
   int doomed_cell = (world_x * world_y) - 1; //Also at the end of cPopulation::ActivateOrganism
@@ -995,7 +1047,7 @@ void cPopulation::UpdateQs(cOrganism* org, bool reproduced)
   bool split = (m_world->GetConfig().DIVIDE_METHOD.Get() == DIVIDE_METHOD_SPLIT && m_world->GetConfig().RESET_INPUTS_ON_DIVIDE.Get());
   
   if (!reproduced || (reproduced && split)) {
-    org->GetHardware().PrintMicroTrace(org->SystematicsGroup("genotype")->ID());
+    org->GetHardware().PrintMicroTrace(org->SystematicsGroup(Systematics::ROLE_GENOTYPE)->ID());
     org->GetHardware().DeleteMiniTrace(print_mini_trace_reacs, (reproduced && split));
   }
   
@@ -1476,7 +1528,7 @@ bool cPopulation::ActivateOrganism(cAvidaContext& ctx, cOrganism* in_organism, c
     in_organism->GetPhenotype().SetBirthGroupID(op);
     in_organism->GetPhenotype().SetBirthForagerType(in_organism->GetForageTarget());
     Systematics::GenotypePtr genotype;
-    genotype.DynamicCastFrom(in_organism->SystematicsGroup("genotype"));
+    genotype.DynamicCastFrom(in_organism->SystematicsGroup(Systematics::ROLE_GENOTYPE));
     assert(genotype);    
     
     genotype->SetLastBirthCell(target_cell.GetID());
@@ -1525,7 +1577,7 @@ bool cPopulation::ActivateOrganism(cAvidaContext& ctx, cOrganism* in_organism, c
 void cPopulation::TestForMiniTrace(cOrganism* in_organism) 
 {
   // if the org's genotype is on our to do list, setup the trace and remove the instance of the genotype from the list
-  int org_bg_id = in_organism->SystematicsGroup("genotype")->ID();
+  int org_bg_id = in_organism->SystematicsGroup(Systematics::ROLE_GENOTYPE)->ID();
   for (int i = 0; i < minitrace_queue.GetSize(); i++) {
     if (org_bg_id == minitrace_queue[i]) {
       unsigned int last = minitrace_queue.GetSize() - 1;
@@ -1546,13 +1598,13 @@ void cPopulation::SetupMiniTrace(cOrganism* in_organism)
   if (in_organism->HasOpinion()) group_id = in_organism->GetOpinion().first;
   else group_id = in_organism->GetParentGroup();
   
-  cString filename = cStringUtil::Stringf("minitraces/org%d-ud%d-grp%d_ft%d-gt%d.trc", id, m_world->GetStats().GetUpdate(), group_id, target, in_organism->SystematicsGroup("genotype")->ID());
+  cString filename = cStringUtil::Stringf("minitraces/org%d-ud%d-grp%d_ft%d-gt%d.trc", id, m_world->GetStats().GetUpdate(), group_id, target, in_organism->SystematicsGroup(Systematics::ROLE_GENOTYPE)->ID());
   
   if (!use_micro_traces) in_organism->GetHardware().SetMiniTrace(filename);
   else in_organism->GetHardware().SetMicroTrace();
   
   if (print_mini_trace_genomes) {
-    cString gen_file =  cStringUtil::Stringf("minitraces/trace_genomes/org%d-ud%d-grp%d_ft%d-gt%d.trcgeno", id, m_world->GetStats().GetUpdate(), group_id, target, in_organism->SystematicsGroup("genotype")->ID());
+    cString gen_file =  cStringUtil::Stringf("minitraces/trace_genomes/org%d-ud%d-grp%d_ft%d-gt%d.trcgeno", id, m_world->GetStats().GetUpdate(), group_id, target, in_organism->SystematicsGroup(Systematics::ROLE_GENOTYPE)->ID());
     PrintMiniTraceGenome(in_organism, gen_file);
   }
 }
@@ -1564,7 +1616,7 @@ void cPopulation::PrintMiniTraceGenome(cOrganism* in_organism, cString& filename
   cAvidaContext ctx2(&m_world->GetDriver(), rng);
   
   cTestCPU* testcpu = m_world->GetHardwareManager().CreateTestCPU(ctx2);
-  testcpu->PrintGenome(ctx2, Genome(in_organism->SystematicsGroup("genotype")->Properties().Get("genome")), filename, m_world->GetStats().GetUpdate());
+  testcpu->PrintGenome(ctx2, Genome(*in_organism->SystematicsGroup(Systematics::ROLE_GENOTYPE)->RepresentativeGenome()), filename, m_world->GetStats().GetUpdate());
   delete testcpu;
 }
 
@@ -1650,7 +1702,7 @@ Apto::Array<int, Apto::Smart> cPopulation::SetRandomTraceQ(int max_samples)
 
     if (!used_orgs[this_rand_sample]) {
       cOrganism* rand_org = live_orgs[this_rand_sample];
-      bg_id_list.Push(rand_org->SystematicsGroup("genotype")->ID());
+      bg_id_list.Push(rand_org->SystematicsGroup(Systematics::ROLE_GENOTYPE)->ID());
       used_orgs[this_rand_sample] = true;
     }
   } 
@@ -1679,7 +1731,7 @@ Apto::Array<int, Apto::Smart> cPopulation::SetRandomPreyTraceQ(int max_samples)
     if (!used_orgs[this_rand_sample]) {
       cOrganism* rand_org = live_orgs[this_rand_sample];
       if (rand_org->IsPreyFT()) {
-        bg_id_list.Push(rand_org->SystematicsGroup("genotype")->ID());
+        bg_id_list.Push(rand_org->SystematicsGroup(Systematics::ROLE_GENOTYPE)->ID());
         used_orgs[this_rand_sample] = true;
       }
     }
@@ -1709,7 +1761,7 @@ Apto::Array<int, Apto::Smart> cPopulation::SetRandomPredTraceQ(int max_samples)
     if (!used_orgs[this_rand_sample]) {
       cOrganism* rand_org = live_orgs[this_rand_sample];
       if (!rand_org->IsPreyFT()) {
-        bg_id_list.Push(rand_org->SystematicsGroup("genotype")->ID());
+        bg_id_list.Push(rand_org->SystematicsGroup(Systematics::ROLE_GENOTYPE)->ID());
         used_orgs[this_rand_sample] = true;
       }
     }
@@ -2254,6 +2306,8 @@ void cPopulation::KillOrganism(cPopulationCell& in_cell, cAvidaContext& ctx)
   // do we actually have something to kill?
   if (in_cell.IsOccupied() == false) return;
   
+  cUpdateProfiler::Scope profile(m_world->GetUpdateProfiler(), cUpdateProfiler::PHASE_DEATHS);
+  
   // Statistics...
   cOrganism* organism = in_cell.GetOrganism();
   m_world->GetStats().RecordDeath();
@@ -2354,7 +2408,7 @@ void cPopulation::Kaboom(cPopulationCell& in_cell, cAvidaContext& ctx, int dista
   m_world->GetStats().AddHamDistance(distance);
   cOrganism* organism = in_cell.GetOrganism();
   Apto::String ref_genome = organism->GetGenome().Representation()->AsString();
-  int bgid = organism->SystematicsGroup("genotype")->ID();
+  int bgid = organism->SystematicsGroup(Systematics::ROLE_GENOTYPE)->ID();
 
   
   int radius = m_world->GetConfig().KABOOM_RADIUS.Get();
@@ -2369,7 +2423,7 @@ void cPopulation::Kaboom(cPopulationCell& in_cell, cAvidaContext& ctx, int dista
       cOrganism* org_temp = death_cell.GetOrganism();
       
       if (distance == 0) {
-        int temp_id = org_temp->SystematicsGroup("genotype")->ID();
+        int temp_id = org_temp->SystematicsGroup(Systematics::ROLE_GENOTYPE)->ID();
         if (temp_id != bgid){
           KillOrganism(death_cell, ctx);
           m_world->GetStats().IncKaboomKills();
@@ -3323,7 +3377,7 @@ void cPopulation::ReplaceDeme(cDeme& source_deme, cDeme& target_deme, cAvidaCont
     assert(germline_genotype);
     
     // create a new genome by mutation
-    Genome mg(germline_genotype->Properties().Get("genome"));
+    Genome mg(*germline_genotype->RepresentativeGenome());
     InstructionSequencePtr seq;
     seq.DynamicCastFrom(mg.Representation());
     cCPUMemory new_genome(*seq);
@@ -3506,8 +3560,8 @@ void cPopulation::ReplaceDemeFlaggedGermline(cDeme& source_deme, cDeme& target_d
     
     // this is the genotype of the organism, which does not reflect any point mutations that have occurred. 
     // we need to use it to get the right length for the genome
-    Systematics::GroupPtr parent_bg = target_founders[i]->SystematicsGroup("genotype");
-    Genome mg(parent_bg->Properties().Get("genome"));
+    Systematics::GroupPtr parent_bg = target_founders[i]->SystematicsGroup(Systematics::ROLE_GENOTYPE);
+    Genome mg(*parent_bg->RepresentativeGenome());
     InstructionSequencePtr seq;
     seq.DynamicCastFrom(mg.Representation());
     cCPUMemory new_genome(*seq);
@@ -3549,9 +3603,9 @@ void cPopulation::ReplaceDemeFlaggedGermline(cDeme& source_deme, cDeme& target_d
     // For now, just copy the generation...
     organism->GetPhenotype().SetGeneration(target_founders[i]->GetPhenotype().GetGeneration() );
     
-    target_deme.AddFounder(organism->SystematicsGroup("genotype"), &organism->GetPhenotype());
+    target_deme.AddFounder(organism->SystematicsGroup(Systematics::ROLE_GENOTYPE), &organism->GetPhenotype());
     
-    //track_founders.push_back(make_pair<int, Apto::String>(organism->SystematicsGroup("genotype")->ID(), Apto::String(new_genome.AsString()))); 
+    //track_founders.push_back(make_pair<int, Apto::String>(organism->SystematicsGroup(Systematics::ROLE_GENOTYPE)->ID(), Apto::String(new_genome.AsString()))); 
     
     ctx2.Driver().Feedback().Error("Temporarily disabled due to bizarre incompatibility on Windows with Visual Studio 2012");
     ctx2.Driver().Abort(Avida::INVALID_CONFIG);
@@ -3620,7 +3674,7 @@ void cPopulation::SeedDeme(cDeme& _deme, Systematics::GroupPtr bg, Systematics::
   // Create the specified number of organisms in the deme.
   for(int i=0; i< m_world->GetConfig().DEMES_REPLICATE_SIZE.Get(); ++i) {
     int cellid = DemeSelectInjectionCell(_deme, i);
-    InjectGenome(cellid, src, Genome(bg->Properties().Get("genome")), ctx); 
+    InjectGenome(cellid, src, Genome(*bg->RepresentativeGenome()), ctx); 
     DemePostInjection(_deme, cell_array[cellid]);
     _deme.AddFounder(bg);
   }
@@ -4007,15 +4061,15 @@ bool cPopulation::SeedDeme(cDeme& source_deme, cDeme& target_deme, cAvidaContext
       // we wanted to re-seed from the original founders.
       for(int i=0; i<target_founders.GetSize(); i++) {
         int cellid = DemeSelectInjectionCell(target_deme, i);
-        SeedDeme_InjectDemeFounder(cellid, target_founders[i]->SystematicsGroup("genotype"), ctx, &target_founders[i]->GetPhenotype(), target_founders[i]->GetLineageLabel(), false); 
-        //target_deme.AddFounder(target_founders[i]->SystematicsGroup("genotype"), &target_founders[i]->GetPhenotype());
+        SeedDeme_InjectDemeFounder(cellid, target_founders[i]->SystematicsGroup(Systematics::ROLE_GENOTYPE), ctx, &target_founders[i]->GetPhenotype(), target_founders[i]->GetLineageLabel(), false); 
+        //target_deme.AddFounder(target_founders[i]->SystematicsGroup(Systematics::ROLE_GENOTYPE), &target_founders[i]->GetPhenotype());
         DemePostInjection(target_deme, cell_array[cellid]);
       }
       
       for(int i=0; i<target_deme.GetSize(); ++i) {
         cPopulationCell& cell = target_deme.GetCell(i);
         if(cell.IsOccupied()) {
-          target_deme.AddFounder(cell.GetOrganism()->SystematicsGroup("genotype"), &cell.GetOrganism()->GetPhenotype());
+          target_deme.AddFounder(cell.GetOrganism()->SystematicsGroup(Systematics::ROLE_GENOTYPE), &cell.GetOrganism()->GetPhenotype());
         }
       }
       
@@ -4032,8 +4086,8 @@ bool cPopulation::SeedDeme(cDeme& source_deme, cDeme& target_deme, cAvidaContext
         
         for(int i=0; i<source_founders.GetSize(); i++) {
           int cellid = DemeSelectInjectionCell(source_deme, i);
-          SeedDeme_InjectDemeFounder(cellid, source_founders[i]->SystematicsGroup("genotype"), ctx, &source_founders[i]->GetPhenotype(), source_founders[i]->GetLineageLabel(), false); 
-          source_deme.AddFounder(source_founders[i]->SystematicsGroup("genotype"), &source_founders[i]->GetPhenotype());
+          SeedDeme_InjectDemeFounder(cellid, source_founders[i]->SystematicsGroup(Systematics::ROLE_GENOTYPE), ctx, &source_founders[i]->GetPhenotype(), source_founders[i]->GetLineageLabel(), false); 
+          source_deme.AddFounder(source_founders[i]->SystematicsGroup(Systematics::ROLE_GENOTYPE), &source_founders[i]->GetPhenotype());
           DemePostInjection(source_deme, cell_array[cellid]);
         }
       }
@@ -4139,7 +4193,7 @@ void cPopulation::SeedDeme_InjectDemeFounder(int _cell_id, Systematics::GroupPtr
     // MUTATE!
     
     // create a new genome by mutation
-    Genome mg(bg->Properties().Get("genome"));
+    Genome mg(*bg->RepresentativeGenome());
     InstructionSequencePtr seq;
     seq.DynamicCastFrom(mg.Representation());
     cCPUMemory new_genome(*seq);
@@ -4170,7 +4224,7 @@ void cPopulation::SeedDeme_InjectDemeFounder(int _cell_id, Systematics::GroupPtr
     
   } else {    
     // phenotype can be NULL
-    InjectGenome(_cell_id, Systematics::Source(Systematics::DUPLICATION, ""), Genome(bg->Properties().Get("genome")), ctx, lineage_label);
+    InjectGenome(_cell_id, Systematics::Source(Systematics::DUPLICATION, ""), Genome(*bg->RepresentativeGenome()), ctx, lineage_label);
   }
   
   // At this point, the cell had better be occupied...
@@ -5424,12 +5478,12 @@ cPopulationCell& cPopulation::PositionOffspring(cPopulationCell& parent_cell, cA
   tList<cPopulationCell> found_list;
   
   // First, check if there is an empty organism to work with (always preferred)
-  tList<cPopulationCell>& conn_list = parent_cell.ConnectionList();
+  cCellConnections& conn_list = parent_cell.ConnectionList();
   
   const bool prefer_empty = m_world->GetConfig().PREFER_EMPTY.Get();
   
   if (birth_method == POSITION_OFFSPRING_DISPERSAL && conn_list.GetSize() > 0) {
-    tList<cPopulationCell>* disp_list = &conn_list;
+    cCellConnections* disp_list = &conn_list;
     
     // hop through connection lists based on the dispersal rate
     int hops = ctx.GetRandom().GetRandPoisson(m_world->GetConfig().DISPERSAL_RATE.Get());
@@ -5443,7 +5497,7 @@ cPopulationCell& cPopulation::PositionOffspring(cPopulationCell& parent_cell, cA
     
     // if prefer empty is off, or there are no empty cells, use the whole connection list as possiblities
     if (found_list.GetSize() == 0) {
-      found_list = *disp_list;
+      for (int i = 0; i < disp_list->GetSize(); i++) found_list.PushRear(disp_list->GetPos(i));
       // if no hops were taken and ALLOW_PARENT is set, throw the parent cell into the hat for possible selection
       if (hops == 0 && parent_ok) found_list.Push(&parent_cell);
     }
@@ -5462,7 +5516,7 @@ cPopulationCell& cPopulation::PositionOffspring(cPopulationCell& parent_cell, cA
         PositionMerit(parent_cell, found_list, parent_ok);
         break;
       case POSITION_OFFSPRING_RANDOM:
-        found_list.Append(conn_list);
+        for (int i = 0; i < conn_list.GetSize(); i++) found_list.PushRear(conn_list.GetPos(i));
         if (parent_ok == true) found_list.Push(&parent_cell);
         break;
       case POSITION_OFFSPRING_NEIGHBORHOOD_ENERGY_USED:
@@ -5493,10 +5547,9 @@ void cPopulation::PositionAge(cPopulationCell & parent_cell,
   if (parent_ok == false) max_age = -1;
   
   // Now look at all of the neighbors.
-  tListIterator<cPopulationCell> conn_it( parent_cell.ConnectionList() );
-  
-  cPopulationCell * test_cell;
-  while ( (test_cell = conn_it.Next()) != NULL) {
+  const cCellConnections& conn_list = parent_cell.ConnectionList();
+  for (int i = 0; i < conn_list.GetSize(); i++) {
+    cPopulationCell* test_cell = conn_list.GetPos(i);
     const int cur_age = test_cell->GetOrganism()->GetPhenotype().GetAge();
     if (cur_age > max_age) {
       max_age = cur_age;
@@ -5521,10 +5574,9 @@ void cPopulation::PositionMerit(cPopulationCell & parent_cell,
   if (parent_ok == false) max_ratio = -1;
   
   // Now look at all of the neighbors.
-  tListIterator<cPopulationCell> conn_it( parent_cell.ConnectionList() );
-  
-  cPopulationCell * test_cell;
-  while ( (test_cell = conn_it.Next()) != NULL) {
+  const cCellConnections& conn_list = parent_cell.ConnectionList();
+  for (int i = 0; i < conn_list.GetSize(); i++) {
+    cPopulationCell* test_cell = conn_list.GetPos(i);
     const double cur_ratio = test_cell->GetOrganism()->CalcMeritRatio();
     if (cur_ratio > max_ratio) {
       max_ratio = cur_ratio;
@@ -5549,10 +5601,9 @@ void cPopulation::PositionEnergyUsed(cPopulationCell & parent_cell,
   if (parent_ok == false) max_energy_used = -1;
   
   // Now look at all of the neighbors.
-  tListIterator<cPopulationCell> conn_it( parent_cell.ConnectionList() );
-  
-  cPopulationCell * test_cell;
-  while ( (test_cell = conn_it.Next()) != NULL) {
+  const cCellConnections& conn_list = parent_cell.ConnectionList();
+  for (int i = 0; i < conn_list.GetSize(); i++) {
+    cPopulationCell* test_cell = conn_list.GetPos(i);
     const int cur_energy_used = test_cell->GetOrganism()->GetPhenotype().GetTimeUsed();
     if (cur_energy_used > max_energy_used) {
       max_energy_used = cur_energy_used;
@@ -5765,9 +5816,17 @@ int cPopulation::UpdateEmptyCellIDArray(int deme_id)
 
 int cPopulation::ScheduleOrganism()
 {
+  int cell_id;
+  if (m_update_schedule && m_update_schedule->Next(cell_id)) return cell_id;
   return m_scheduler->Next();
 }
 
+void cPopulation::BeginUpdateSchedule(int num_slices)
+{
+  if (m_merit_schedule) m_merit_schedule->EndBatch();
+  if (m_update_schedule) m_update_schedule->Begin(num_slices);
+}
+
 void cPopulation::ProcessStep(cAvidaContext& ctx, double step_size, int cell_id)
 {
   assert(step_size > 0.0);
@@ -5912,6 +5971,37 @@ void cPopulation::UpdateDemeStats(cAvidaContext& ctx) {
 }
 
 
+namespace {
+  // Gathers the per-organism statistics for one contiguous slice of the live organism list
+  class cOrgStatsJob : public cWorkerPool::Job
+  {
+  private:
+    const Apto::Array<cOrganism*, Apto::Smart>& m_orgs;
+    Apto::Array<cStats::sOrgStats>& m_parts;
+    
+  public:
+    cOrgStatsJob(const Apto::Array<cOrganism*, Apto::Smart>& orgs, Apto::Array<cStats::sOrgStats>& parts)
+      : m_orgs(orgs), m_parts(parts) { ; }
+    
+    void Run(int part)
+    {
+      const int num_orgs = m_orgs.GetSize();
+      const int num_parts = m_parts.GetSize();
+      const int begin = static_cast<int>(static_cast<long long>(num_orgs) * part / num_parts);
+      const int end = static_cast<int>(static_cast<long long>(num_orgs) * (part + 1) / num_parts);
+      
+      cStats::sOrgStats& org_stats = m_parts[part];
+      for (int i = begin; i < end; i++) {
+        org_stats.AddOrganism(m_orgs[i]);
+        
+        // Increment the age of this organism.
+        m_orgs[i]->GetPhenotype().IncAge();
+      }
+    }
+  };
+}
+
+
 void cPopulation::UpdateOrganismStats(cAvidaContext& ctx) 
 {
   // Loop through all the cells getting stats and doing calculations
@@ -5936,134 +6026,29 @@ void cPopulation::UpdateOrganismStats(cAvidaContext& ctx)
   stats.ZeroTasks();
   stats.ZeroReactions();
   
-  for (int osp_idx = 0; osp_idx < m_org_stat_providers.GetSize(); osp_idx++) m_org_stat_providers[osp_idx]->UpdateReset();
-
-  // Counts...
-  int num_breed_true = 0;
-  int num_parasites = 0;
-  int num_no_birth = 0;
-  int num_multi_thread = 0;
-  int num_single_thread = 0;
-  int num_threads = 0;
-  int num_modified = 0;
-  
-  // Maximums...
-  cMerit max_merit(0);
-  double max_fitness = 0;
-  int max_gestation_time = 0;
-  int max_genome_length = 0;
-  
-  // Minimums...
-  cMerit min_merit(FLT_MAX);
-  double min_fitness = FLT_MAX;
-  int min_gestation_time = INT_MAX;
-  int min_genome_length = INT_MAX;
-  
+  // Statistics that are shared between organisms, or that depend on the order in which organisms are visited, are
+  // gathered sequentially...
   for (int i = 0; i < live_org_list.GetSize(); i++) {  
     cOrganism* organism = live_org_list[i];
     
-    for (int osp_idx = 0; osp_idx < m_org_stat_providers.GetSize(); osp_idx++) {
-      m_org_stat_providers[osp_idx]->HandleOrganism(organism);
-    }
-    
     const cPhenotype& phenotype = organism->GetPhenotype();
-    const cMerit cur_merit = phenotype.GetMerit();
-    const double cur_fitness = phenotype.GetFitness();
-    const int cur_gestation_time = phenotype.GetGestationTime();
-    const int cur_genome_length = phenotype.GetGenomeLength();
     
     Apto::Array<Apto::Stat::Accumulator<int> >& from_message_exec_counts = stats.InstFromMessageExeCountsForInstSet((const char*)organism->GetGenome().Properties().Get(s_prop_id_instset).StringValue());
     for (int j = 0; j < phenotype.GetLastFromMessageInstCount().GetSize(); j++) {
       from_message_exec_counts[j].Add(organism->GetPhenotype().GetLastFromMessageInstCount()[j]);
     }
 
-    stats.SumFitness().Add(cur_fitness);
-    stats.SumMerit().Add(cur_merit.GetDouble());
-    stats.SumGestation().Add(phenotype.GetGestationTime());
-    stats.SumCreatureAge().Add(phenotype.GetAge());
-    stats.SumGeneration().Add(phenotype.GetGeneration());
-    stats.SumNeutralMetric().Add(phenotype.GetNeutralMetric());
-    stats.SumLineageLabel().Add(organism->GetLineageLabel());
-    stats.SumCopyMutRate().Push(organism->MutationRates().GetCopyMutProb());
     stats.SumLogCopyMutRate().Push(log(organism->MutationRates().GetCopyMutProb()));
-    stats.SumDivMutRate().Push(organism->MutationRates().GetDivMutProb() / organism->GetPhenotype().GetDivType());
     stats.SumLogDivMutRate().Push(log(organism->MutationRates().GetDivMutProb() / organism->GetPhenotype().GetDivType()));
-    stats.SumCopySize().Add(phenotype.GetCopiedSize());
-    stats.SumExeSize().Add(phenotype.GetExecutedSize());
     
-    if (cur_merit > max_merit) max_merit = cur_merit;
-    if (cur_fitness > max_fitness) max_fitness = cur_fitness;
-    if (cur_gestation_time > max_gestation_time) max_gestation_time = cur_gestation_time;
-    if (cur_genome_length > max_genome_length) max_genome_length = cur_genome_length;
-    
-    if (cur_merit < min_merit) min_merit = cur_merit;
-    if (cur_fitness < min_fitness) min_fitness = cur_fitness;
-    if (cur_gestation_time < min_gestation_time) min_gestation_time = cur_gestation_time;
-    if (cur_genome_length < min_genome_length) min_genome_length = cur_genome_length;
-    
-    // Test what tasks this creatures has completed.
-    for (int j = 0; j < m_world->GetEnvironment().GetNumTasks(); j++) {
-      if (phenotype.GetCurTaskCount()[j] > 0) {
-        stats.AddCurTask(j);
-        stats.AddCurTaskQuality(j, phenotype.GetCurTaskQuality()[j]);
-      }
-      
-      if (phenotype.GetLastTaskCount()[j] > 0) {
-        stats.AddLastTask(j);
-        stats.AddLastTaskQuality(j, phenotype.GetLastTaskQuality()[j]);
-        stats.IncTaskExeCount(j, phenotype.GetLastTaskCount()[j]);
-      }
-      
-      if (phenotype.GetCurHostTaskCount()[j] > 0) {
-        stats.AddCurHostTask(j);
-      }
-      
-      if (phenotype.GetLastHostTaskCount()[j] > 0) {
-        stats.AddLastHostTask(j);
-      }
-      
-      if (phenotype.GetCurParasiteTaskCount()[j] > 0) {
-        stats.AddCurParasiteTask(j);
-      }
-      
-      if (phenotype.GetLastParasiteTaskCount()[j] > 0) {
-        stats.AddLastParasiteTask(j);
-      }
-      
-      if (phenotype.GetCurInternalTaskCount()[j] > 0) {
-        stats.AddCurInternalTask(j);
-        stats.AddCurInternalTaskQuality(j, phenotype.GetCurInternalTaskQuality()[j]);
-      }
-      
-      if (phenotype.GetLastInternalTaskCount()[j] > 0) {
-        stats.AddLastInternalTask(j);
-        stats.AddLastInternalTaskQuality(j, phenotype.GetLastInternalTaskQuality()[j]);
-      }
-    }
-
     if (stats.ShouldCollectEnvTestStats()) {
-      Systematics::GroupPtr genotype = organism->SystematicsGroup("genotype");
+      Systematics::GroupPtr genotype = organism->SystematicsGroup(Systematics::ROLE_GENOTYPE);
       Systematics::GenomeTestMetricsPtr metrics(Systematics::GenomeTestMetrics::GetMetrics(m_world, ctx, genotype));
       const Apto::Array<int>& test_task_counts = metrics->GetTaskCounts();
       
       for (int j = 0; j < m_world->GetEnvironment().GetNumTasks(); j++) if (test_task_counts[j] > 0) stats.AddTestTask(j);
     }
     
-    
-    // Record what add bonuses this organism garnered for different reactions
-    for (int j = 0; j < m_world->GetEnvironment().GetNumReactions(); j++) {
-      if (phenotype.GetCurReactionCount()[j] > 0) {
-        stats.AddCurReaction(j);
-        stats.AddCurReactionAddReward(j, phenotype.GetCurReactionAddReward()[j]);
-      }
-      
-      if (phenotype.GetLastReactionCount()[j] > 0) {
-        stats.AddLastReaction(j);
-        stats.IncReactionExeCount(j, phenotype.GetLastReactionCount()[j]);
-        stats.AddLastReactionAddReward(j, phenotype.GetLastReactionAddReward()[j]);
-      }
-    }
-    
     // Test what resource combinations this creature has sensed
     for (int j = 0; j < stats.GetSenseSize(); j++) {
       if (phenotype.GetLastSenseCount()[j] > 0) {
@@ -6071,45 +6056,52 @@ void cPopulation::UpdateOrganismStats(cAvidaContext& ctx)
         stats.IncLastSenseExeCount(j, phenotype.GetLastSenseCount()[j]);
       }
     }
-    
-    // Increment the counts for all qualities the organism has...
-    num_parasites += organism->GetNumParasites();
-    if (phenotype.ParentTrue()) num_breed_true++;
-    if (phenotype.GetNumDivides() == 0) num_no_birth++;
-    if (phenotype.IsMultiThread()) num_multi_thread++;
-    else num_single_thread++;
-    
-    if (phenotype.IsModified()) num_modified++;
-    
-    cHardwareBase& hardware = organism->GetHardware();
-    stats.SumMemSize().Add(hardware.GetMemory().GetSize());
-    num_threads += hardware.GetNumThreads();
-    
-    // Increment the age of this organism.
-    organism->GetPhenotype().IncAge();
   }
   
-  stats.SetBreedTrueCreatures(num_breed_true);
-  stats.SetNumNoBirthCreatures(num_no_birth);
-  stats.SetNumParasites(num_parasites);
-  stats.SetNumSingleThreadCreatures(num_single_thread);
-  stats.SetNumMultiThreadCreatures(num_multi_thread);
-  stats.SetNumThreads(num_threads);
-  stats.SetNumModified(num_modified);
+  // ...while the remaining statistics only read the organism itself, so they are gathered over contiguous slices of
+  // the organism list (one per thread) and merged in slice order.
+  const int num_parts = (m_stats_workers && live_org_list.GetSize() > 1) ?
+    std::min(m_stats_workers->GetNumThreads(), live_org_list.GetSize()) : 1;
+  Apto::Array<cStats::sOrgStats> org_stats(num_parts);
+  for (int i = 0; i < num_parts; i++) {
+    org_stats[i].Reset(m_world->GetEnvironment().GetNumTasks(), m_world->GetEnvironment().GetNumReactions());
+  }
   
-  stats.SetMaxMerit(max_merit.GetDouble());
-  stats.SetMaxFitness(max_fitness);
-  stats.SetMaxGestationTime(max_gestation_time);
-  stats.SetMaxGenomeLength(max_genome_length);
+  cOrgStatsJob job(live_org_list, org_stats);
+  if (num_parts > 1) m_stats_workers->Run(job, num_parts);
+  else job.Run(0);
+  m_pop_version++;  // every organism aged
   
-  stats.SetMinMerit(min_merit.GetDouble());
-  stats.SetMinFitness(min_fitness);
-  stats.SetMinGestationTime(min_gestation_time);
-  stats.SetMinGenomeLength(min_genome_length);
+  for (int i = 1; i < num_parts; i++) org_stats[0].Merge(org_stats[i]);
+  stats.MergeOrgStats(org_stats[0]);
+  
+  // The providers read the snapshot taken after aging; the events at the start of the next update run with the same
+  // update number, so their print actions share it
+  if (m_org_stat_providers.GetSize()) {
+    const cPopulationSnapshot& snapshot = GetSnapshot(true);
+    for (int osp_idx = 0; osp_idx < m_org_stat_providers.GetSize(); osp_idx++) {
+      m_org_stat_providers[osp_idx]->UpdateReset();
+      m_org_stat_providers[osp_idx]->HandleSnapshot(snapshot);
+    }
+  }
   
   resource_count.UpdateGlobalResources(ctx);   
 }
 
+const cPopulationSnapshot& cPopulation::GetSnapshot(bool inst_counts)
+{
+  const int update = m_world->GetStats().GetUpdate();
+  if (m_snapshot == NULL) m_snapshot = new cPopulationSnapshot;
+  else if (m_snapshot_update == update && m_snapshot_version == m_pop_version &&
+           (m_snapshot->HasInstCounts() || !inst_counts)) return *m_snapshot;
+
+  m_snapshot->Build(live_org_list, cell_array.GetSize(), m_world->GetEnvironment().GetNumTasks(), inst_counts,
+                    m_stats_workers);
+  m_snapshot_update = update;
+  m_snapshot_version = m_pop_version;
+  return *m_snapshot;
+}
+
 void cPopulation::UpdateFTOrgStats(cAvidaContext&) 
 {
   // Get per-org stats seperately for pred and prey
@@ -6303,6 +6295,10 @@ void cPopulation::ProcessPreUpdate()
 
 void cPopulation::ProcessPostUpdate(cAvidaContext& ctx)
 {
+  // Merit changes made between updates (deaths here, deme processing, events) only set the tree leaves; the changed
+  // paths are summed once, when the next update begins or the next organism is scheduled
+  if (m_merit_schedule) m_merit_schedule->BeginBatch();
+
   ProcessUpdateCellActions(ctx);
   
   cStats& stats = m_world->GetStats();
@@ -6319,6 +6315,8 @@ void cPopulation::ProcessPostUpdate(cAvidaContext& ctx)
   }
   
   for (int i = 0; i < deme_array.GetSize(); i++) deme_array[i].ProcessUpdate(ctx);   
+  
+  if (m_update_schedule) m_update_schedule->End();
 }
 
 void cPopulation::ProcessUpdateCellActions(cAvidaContext& ctx)
@@ -6377,7 +6375,7 @@ bool cPopulation::SavePopulation(const cString& filename, bool save_historic, bo
       // Handle any parasites
       const Apto::Array<Systematics::UnitPtr>& parasites = org->GetParasites();
       for (int p = 0; p < parasites.GetSize(); p++) {
-        Systematics::GroupPtr pg = parasites[p]->SystematicsGroup("genotype");
+        Systematics::GroupPtr pg = parasites[p]->SystematicsGroup(Systematics::ROLE_GENOTYPE);
         if (pg == NULL) continue;
         
         sGroupInfo* map_entry = NULL;
@@ -6392,7 +6390,7 @@ bool cPopulation::SavePopulation(const cString& filename, bool save_historic, bo
       
       
       // Handle the organism itself
-      Systematics::GroupPtr genotype = org->SystematicsGroup("genotype");
+      Systematics::GroupPtr genotype = org->SystematicsGroup(Systematics::ROLE_GENOTYPE);
       if (genotype == NULL) continue;
       
       int offset = org->GetPhenotype().GetCPUCyclesUsed();
@@ -6559,6 +6557,9 @@ bool cPopulation::SavePopulation(const cString& filename, bool save_historic, bo
     Systematics::Manager::Of(m_world->GetNewWorld())->ArbiterForRole("genotype")->LegacySave(Apto::GetInternalPtr(df));
   }
   
+  // Bring all other data files up to date with this save point
+  Avida::Output::Manager::Of(m_world->GetNewWorld())->FlushAll();
+  
   return true;
 }
 
@@ -6681,7 +6682,7 @@ bool cPopulation::SaveFlameData(const cString& filename)
       // Handle any parasites
       const Apto::Array<Systematics::UnitPtr>& parasites = org->GetParasites();
       for (int p = 0; p < parasites.GetSize(); p++) {
-        Systematics::GroupPtr pg = parasites[p]->SystematicsGroup("genotype");
+        Systematics::GroupPtr pg = parasites[p]->SystematicsGroup(Systematics::ROLE_GENOTYPE);
         if (pg == NULL) continue;
         
         sGroupInfo* map_entry = NULL;
@@ -6696,7 +6697,7 @@ bool cPopulation::SaveFlameData(const cString& filename)
       
       
       // Handle the organism itself
-      Systematics::GroupPtr genotype = org->SystematicsGroup("genotype");
+      Systematics::GroupPtr genotype = org->SystematicsGroup(Systematics::ROLE_GENOTYPE);
       if (genotype == NULL) continue;
       
       int offset = org->GetPhenotype().GetCPUCyclesUsed();
@@ -7013,8 +7014,8 @@ bool cPopulation::LoadPopulation(const cString& filename, cAvidaContext& ctx, in
         lineage_label = tmp.lineage_labels[cell_i] + lineage_offset;
       }
       
-      assert(tmp.bg->Properties().Has("genome"));
-      Genome mg(tmp.bg->Properties().Get("genome"));
+      assert(tmp.bg->RepresentativeGenome());
+      Genome mg(*tmp.bg->RepresentativeGenome());
       cOrganism* new_organism = new cOrganism(m_world, ctx, mg, -1, tmp.source);
       
       // Setup the phenotype...
@@ -7225,10 +7226,10 @@ void cPopulation::Inject(const Genome& genome, Systematics::Source src, cAvidaCo
     } else if (m_world->GetConfig().DEMES_SEED_METHOD.Get() == 1) {
       if (m_world->GetConfig().DEMES_USE_GERMLINE.Get() == 2) {
         //find the genotype we just created from the genome, and save it
-        deme.ReplaceGermline(GetCell(cell_id).GetOrganism()->SystematicsGroup("genotype"));
+        deme.ReplaceGermline(GetCell(cell_id).GetOrganism()->SystematicsGroup(Systematics::ROLE_GENOTYPE));
       }
       else { // not germlines, save org as founder
-        deme.AddFounder(GetCell(cell_id).GetOrganism()->SystematicsGroup("genotype"), &phenotype);
+        deme.AddFounder(GetCell(cell_id).GetOrganism()->SystematicsGroup(Systematics::ROLE_GENOTYPE), &phenotype);
       }
 
       GetCell(cell_id).GetOrganism()->GetPhenotype().SetPermanentGermlinePropensity
@@ -7474,21 +7475,34 @@ void cPopulation::BuildTimeSlicer()
       m_scheduler = new Apto::Scheduler::ProbabilisticIntegrated(cell_array.GetSize(), rng);
     }
       break;
+    case SLICE_PROB_MERIT_TREE:
+    {
+      Apto::SmartPtr<Apto::Random> rng(new Apto::RNG::AvidaRNG(m_world->GetRandom().GetInt(0x7FFFFFFF)));
+      m_merit_schedule = new cMeritSchedule(cell_array.GetSize(), rng);
+      m_scheduler = m_merit_schedule;
+    }
+      break;
     default:
       cout << "error: requested time slicer not found." << endl;
       m_world->GetDriver().Abort(Avida::INVALID_CONFIG);
       break;
   }
+  
+  if (m_world->GetConfig().PRESAMPLE_SCHEDULE.Get()) {
+    if (m_merit_schedule) {
+      m_update_schedule = new cUpdateSchedule(*m_merit_schedule);
+    } else {
+      m_world->GetDriver().Feedback().Warning("PRESAMPLE_SCHEDULE requires SLICING_METHOD 6 (PROBABILISTIC_TREE), slices will be drawn one at a time.");
+    }
+  }
 }
 
 
-void cPopulation::FindEmptyCell(tList<cPopulationCell> & cell_list,
+void cPopulation::FindEmptyCell(const cCellConnections& cell_list,
                                 tList<cPopulationCell> & found_list)
 {
-  tListIterator<cPopulationCell> cell_it(cell_list);
-  cPopulationCell * test_cell;
-  
-  while ( (test_cell = cell_it.Next()) != NULL) {
+  for (int i = 0; i < cell_list.GetSize(); i++) {
+    cPopulationCell* test_cell = cell_list.GetPos(i);
     // If this cell is empty, add it to the list...
     if (test_cell->IsOccupied() == false) found_list.Push(test_cell);
   }
@@ -7628,7 +7642,7 @@ void cPopulation::InjectGenome(int cell_id, Systematics::Source src, const Genom
   //Coalescense Clade Setup
   new_organism->SetCCladeLabel(-1);
   
-  Systematics::GenomeTestMetricsPtr metrics = Systematics::GenomeTestMetrics::GetMetrics(m_world, ctx, new_organism->SystematicsGroup("genotype"));
+  Systematics::GenomeTestMetricsPtr metrics = Systematics::GenomeTestMetrics::GetMetrics(m_world, ctx, new_organism->SystematicsGroup(Systematics::ROLE_GENOTYPE));
   
   if (m_world->GetConfig().ENERGY_ENABLED.Get() == 1) {
     phenotype.SetMerit(cMerit(phenotype.ConvertEnergyToMerit(phenotype.GetStoredEnergy())));
@@ -8702,6 +8716,7 @@ void cPopulation::UpdateResourceCount(const int Verbosity, cWorld* world) {
   for(int i = 0; i < GetNumDemes(); i++) {
     cResourceCount tmp_deme_res_count(num_deme_res);
     GetDeme(i).SetDemeResourceCount(tmp_deme_res_count);
+    GetDeme(i).GetDemeResources().SetProfiler(&m_world->GetUpdateProfiler());
   }
   
   for (int i = 0; i < resource_lib.GetSize(); i++) {
@@ -8758,6 +8773,7 @@ void  cPopulation::AddLiveOrg(cOrganism* org)
 {
   live_org_list.Push(org);
   org->SetOrgIndex(live_org_list.GetSize()-1);
+  m_pop_version++;
 }
 
 // Remove an organism from live org list  
@@ -8768,6 +8784,7 @@ void  cPopulation::RemoveLiveOrg(cOrganism* org)
   exist_org->SetOrgIndex(org->GetOrgIndex());
   live_org_list.Swap(org->GetOrgIndex(), last);
   live_org_list.Pop();
+  m_pop_version++;
 }
 
 // Adds an organism to a group
@@ -9415,7 +9432,9 @@ void cPopulation::MixPopulation(cAvidaContext& ctx)
   // Shuffle them:
   std::random_shuffle(population.begin(), population.end(), ctx.GetRandom());
   
-  // Reset the organism pointers of all cells:
+  // Reset the organism pointers of all cells (within the update boundary batch when mixed by an event):
+  const bool batch = (m_merit_schedule && !m_merit_schedule->InBatch());
+  if (batch) m_merit_schedule->BeginBatch();
   for(int i=0; i<cell_array.GetSize(); ++i) {
     cell_array[i].RemoveOrganism(ctx);
     if (population[i] == 0) {
@@ -9425,6 +9444,7 @@ void cPopulation::MixPopulation(cAvidaContext& ctx)
       AdjustSchedule(cell_array[i], cell_array[i].GetOrganism()->GetPhenotype().GetMerit());
     }
   }
+  if (batch) m_merit_schedule->EndBatch();
 }
 
 int cPopulation::PlaceAvatar(cAvidaContext& ctx, cOrganism* parent)
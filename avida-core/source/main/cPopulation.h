@@ -26,6 +26,7 @@
 #include "avida/data/Provider.h"
 
 #include "cBirthChamber.h"
+#include "cCellNeighborhoods.h"
 #include "cDeme.h"
 #include "cOrgInterface.h"
 #include "cPopulationInterface.h"
@@ -39,11 +40,16 @@
 
 
 class cAvidaContext;
+class cCellConnections;
 class cCodeLabel;
 class cEnvironment;
 class cLineage;
+class cMeritSchedule;
+class cUpdateSchedule;
 class cOrganism;
 class cPopulationCell;
+class cPopulationSnapshot;
+class cWorkerPool;
 
 using namespace Avida;
 
@@ -54,7 +60,7 @@ public:
   ~cPopulationOrgStatProvider();
 
   virtual void UpdateReset() = 0;
-  virtual void HandleOrganism(cOrganism* org) = 0;
+  virtual void HandleSnapshot(const cPopulationSnapshot& snapshot) = 0;  // Snapshot includes instruction counts
 };
 
 typedef Apto::SmartPtr<cPopulationOrgStatProvider, Apto::InternalRCObject> cPopulationOrgStatProviderPtr;
@@ -66,7 +72,11 @@ private:
   // Components...
   cWorld* m_world;
   Apto::PriorityScheduler* m_scheduler;                // Handles allocation of CPU cycles
+  cMeritSchedule* m_merit_schedule;                    // m_scheduler when SLICING_METHOD selects it, otherwise NULL
+  cUpdateSchedule* m_update_schedule;                  // Pre-sampled slices of the current update, if PRESAMPLE_SCHEDULE
   Apto::Array<cPopulationCell> cell_array;  // Local cells composing the population
+  Apto::Array<cPopulationCell*> m_connection_table;  // Neighbors of all cells, each cell referencing its own span
+  cCellNeighborhoods m_cell_neighborhoods;  // Cells within a number of hops of each cell, used for broadcasts
   Apto::Array<int> empty_cell_id_array;     // Used for PREFER_EMPTY birth methods
   cResourceCount resource_count;       // Global resources available
   cBirthChamber birth_chamber;         // Global birth chamber.
@@ -122,6 +132,13 @@ private:
   std::map<int, int> m_group_males; //<! Maps the group id to the number of males in the group
 
   int m_hgt_resid; //!< HGT resource ID.
+  
+  cWorkerPool* m_stats_workers; //!< Threads for UpdateOrganismStats (NULL when single threaded)
+
+  cPopulationSnapshot* m_snapshot; //!< Columnar organism values shared by the print actions and org stat providers
+  int m_snapshot_update;           //!< Update m_snapshot was built in, -1 if never built
+  long long m_pop_version;         //!< Incremented whenever the live organisms or a value held by m_snapshot change
+  long long m_snapshot_version;    //!< m_pop_version m_snapshot was built at
 
   cPopulation(); // @not_implemented
   cPopulation(const cPopulation&); // @not_implemented
@@ -257,6 +274,9 @@ public:
 
   // Process a single organism one instruction...
   int ScheduleOrganism();          // Determine next organism to be processed.
+  const cMeritSchedule* GetMeritSchedule() const { return m_merit_schedule; }
+  void BeginUpdateSchedule(int num_slices);  // Pre-sample the update's slices, if enabled
+  const cUpdateSchedule* GetUpdateSchedule() const { return m_update_schedule; }
   void ProcessStep(cAvidaContext& ctx, double step_size, int cell_id);
   void ProcessStepSpeculative(cAvidaContext& ctx, double step_size, int cell_id);
 
@@ -302,6 +322,8 @@ public:
   cDeme& GetDeme(int i) { return deme_array[i]; }
 
   cPopulationCell& GetCell(int in_num) { assert(in_num >=0); assert(in_num < cell_array.GetSize()); return cell_array[in_num]; }
+  const Apto::Array<int>& GetCellNeighborhood(int cell_id, int depth) { return m_cell_neighborhoods.Get(cell_id, depth); }
+  void ConnectionsChanged() { m_cell_neighborhoods.Clear(); }
   const Apto::Array<double>& GetResources(cAvidaContext& ctx) const { return resource_count.GetResources(ctx); }
   const Apto::Array<double>& GetCellResources(int cell_id, cAvidaContext& ctx) const { return resource_count.GetCellResources(cell_id, ctx); } 
   const Apto::Array<double>& GetFrozenResources(cAvidaContext& ctx, int cell_id) const { return resource_count.GetFrozenResources(ctx, cell_id); }
@@ -401,6 +423,9 @@ public:
   // Remove an org from live org list
   void RemoveLiveOrg(cOrganism* org); 
   const Apto::Array<cOrganism*, Apto::Smart>& GetLiveOrgList() const { return live_org_list; }
+  // Rebuilt only when the update or the population changed since the last call, or inst_counts are newly requested
+  const cPopulationSnapshot& GetSnapshot(bool inst_counts = false);
+  void InvalidateSnapshot() { m_pop_version++; }  // For organism values the snapshot holds that change between births
 	
   // Adds an organism to a group  
   void JoinGroup(cOrganism* org, int group_id);
@@ -462,7 +487,7 @@ private:
   cPopulationCell& PositionDemeRandom(int deme_id, cPopulationCell& parent_cell, bool parent_ok = true);
   int UpdateEmptyCellIDArray(int deme_id = -1);
   Apto::Array<int>& GetEmptyCellIDArray() { return empty_cell_id_array; }
-  void FindEmptyCell(tList<cPopulationCell>& cell_list, tList<cPopulationCell>& found_list);
+  void FindEmptyCell(const cCellConnections& cell_list, tList<cPopulationCell>& found_list);
   int FindRandEmptyCell(cAvidaContext& ctx);
   
   // Update statistics collecting...
@@ -54,9 +54,7 @@ cPopulationCell::cPopulationCell(const cPopulationCell& in_cell)
   m_mut_rates = new cMutationRates(*in_cell.m_mut_rates);
 	
   // Copy the connection list
-  tConstListIterator<cPopulationCell> conn_it(in_cell.m_connections);
-  cPopulationCell* test_cell;
-  while ((test_cell = const_cast<cPopulationCell*>(conn_it.Next()))) m_connections.PushRear(test_cell);
+  m_connections = in_cell.m_connections;
 	
 	// copy the hgt information, if needed.
 	if(in_cell.m_hgt) {
@@ -86,9 +84,7 @@ void cPopulationCell::operator=(const cPopulationCell& in_cell)
 			m_mut_rates->Copy(*in_cell.m_mut_rates);
 		
 		// Copy the connection list
-		tConstListIterator<cPopulationCell> conn_it(in_cell.m_connections);
-		cPopulationCell* test_cell;
-		while ((test_cell = const_cast<cPopulationCell*>(conn_it.Next()))) m_connections.PushRear(test_cell);
+		m_connections = in_cell.m_connections;
 		
 		// copy hgt information, if needed.
 		delete m_hgt;
@@ -129,15 +125,9 @@ void cPopulationCell::Rotate(cPopulationCell& new_facing)
     return;
   }
 	
-#ifdef DEBUG
-  int scan_count = 0;
-#endif
-  while (m_connections.GetFirst() != &new_facing) {
-    m_connections.CircNext();
-#ifdef DEBUG
-    assert(++scan_count < m_connections.GetSize());
-#endif
-  }
+  const int facing = m_connections.Find(&new_facing);
+  assert(facing >= 0);
+  m_connections.SetFacing(facing);
 }
 
 /*! This method recursively builds a set of cells that neighbor this cell, out to 
@@ -148,10 +138,9 @@ void cPopulationCell::GetNeighboringCells(std::set<cPopulationCell*>& cell_set,
 	typedef std::set<cPopulationCell*> cell_set_t;
   
   // For each cell in our connection list...
-  tConstListIterator<cPopulationCell> i(m_connections);
-  while(!i.AtEnd()) {
+  for (int i = 0; i < m_connections.GetSize(); i++) {
 		// store the cell pointer, and check to see if we've already visited that cell...
-    cPopulationCell* cell = i.Next();
+    cPopulationCell* cell = m_connections.GetPos(i);
 		assert(cell != 0); // cells should never be null.
 		std::pair<cell_set_t::iterator, bool> ins = cell_set.insert(cell);
 		// and if so, recurse to it...
@@ -179,9 +168,8 @@ void cPopulationCell::GetOccupiedNeighboringCells(Apto::Array<cPopulationCell*>&
   occupied_cells.Resize(m_connections.GetSize());
   int occupied_count = 0;
 
-  tLWConstListIterator<cPopulationCell> i(m_connections);
-  while(!i.AtEnd()) {
-    cPopulationCell* cell = i.Next();
+  for (int i = 0; i < m_connections.GetSize(); i++) {
+    cPopulationCell* cell = m_connections.GetPos(i);
 		assert(cell); // cells should never be null.
     if (cell->IsOccupied()) occupied_cells[occupied_count++] = cell;
   }
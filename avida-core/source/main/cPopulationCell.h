@@ -29,6 +29,7 @@
 #include <set>
 #include <deque>
 
+#include "cCellConnections.h"
 #include "cMutationRates.h"
 #include "tList.h"
 #include "cGenomeUtil.h"
@@ -52,7 +53,7 @@ private:
   cOrganism* m_organism;                    // The occupant of this cell.
   cHardwareBase* m_hardware;
 
-  tList<cPopulationCell> m_connections;  // A list of neighboring cells.
+  cCellConnections m_connections;       // Neighboring cells, in facing order.
   cMutationRates* m_mut_rates;           // Mutation rates at this cell.
   Apto::Array<int> m_inputs;                 // Environmental Inputs...
 
@@ -103,7 +104,7 @@ public:
 
   inline cOrganism* GetOrganism() const { return m_organism; }
   inline cHardwareBase* GetHardware() const { return m_hardware; }
-  inline tList<cPopulationCell>& ConnectionList() { return m_connections; }
+  inline cCellConnections& ConnectionList() { return m_connections; }
   //! Recursively build a set of cells that neighbor this one, out to the given depth.
   void GetNeighboringCells(std::set<cPopulationCell*>& cell_set, int depth) const;
   //! Recursively build a set of occupied cells that neighbor this one, out to the given depth.
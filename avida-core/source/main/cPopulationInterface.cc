@@ -269,10 +269,9 @@ void cPopulationInterface::GetNeighborhoodCellIDs(Apto::Array<int>& list)
   cPopulationCell& cell = m_world->GetPopulation().GetCell(m_cell_id);
   assert(cell.IsOccupied());
   
-  list.Resize(cell.ConnectionList().GetSize());
-  tConstListIterator<cPopulationCell> it(cell.ConnectionList());
-  int i = 0;
-  while (it.Next() != NULL) list[i++] = it.Get()->GetID();
+  const cCellConnections& connections = cell.ConnectionList();
+  list.Resize(connections.GetSize());
+  for (int i = 0; i < connections.GetSize(); i++) list[i] = connections.GetPos(i)->GetID();
 }
 
 void cPopulationInterface::GetAVNeighborhoodCellIDs(Apto::Array<int>& list, int av_num)
@@ -280,10 +279,9 @@ void cPopulationInterface::GetAVNeighborhoodCellIDs(Apto::Array<int>& list, int
   cPopulationCell& cell = m_world->GetPopulation().GetCell(m_avatars[av_num].av_cell_id);
   assert(cell.HasAV());
   
-  list.Resize(cell.ConnectionList().GetSize());
-  tConstListIterator<cPopulationCell> it(cell.ConnectionList());
-  int i = 0;
-  while (it.Next() != NULL) list[i++] = it.Get()->GetID();
+  const cCellConnections& connections = cell.ConnectionList();
+  list.Resize(connections.GetSize());
+  for (int i = 0; i < connections.GetSize(); i++) list[i] = connections.GetPos(i)->GetID();
 }
 
 int cPopulationInterface::GetFacing()
@@ -615,19 +613,15 @@ bool cPopulationInterface::SendMessage(cOrgMessage& msg) {
 /*! Send a message to the faced organism, failing if this cell does not have 
  neighbors or if the cell currently faced is not occupied. */
 bool cPopulationInterface::BroadcastMessage(cOrgMessage& msg, int depth) {
-  cPopulationCell& cell = m_world->GetPopulation().GetCell(m_cell_id);
-  assert(cell.IsOccupied()); // This organism; sanity.
-	
-	// Get the set of cells that are within range.
-	std::set<cPopulationCell*> cell_set;
-	cell.GetNeighboringCells(cell_set, depth);
+  cPopulation& pop = m_world->GetPopulation();
+  assert(pop.GetCell(m_cell_id).IsOccupied()); // This organism; sanity.
 	
-	// Remove this cell from the set!
-	cell_set.erase(&cell);
+	// Get the cells that are within range, which never include this cell.
+	const Apto::Array<int>& neighborhood = pop.GetCellNeighborhood(m_cell_id, depth);
 	
 	// Now, send a message towards each cell:
-	for(std::set<cPopulationCell*>::iterator i=cell_set.begin(); i!=cell_set.end(); ++i) {
-		SendMessage(msg, **i);
+	for (int i = 0; i < neighborhood.GetSize(); i++) {
+		SendMessage(msg, pop.GetCell(neighborhood[i]));
 	}
 	return true;
 }
@@ -1625,7 +1619,7 @@ void cPopulationInterface::InjectPreyClone(cAvidaContext& ctx, int gen_id)
   while (org_to_clone == NULL) {
     cOrganism* org_at = TriedIdx[idx];
     // exclude pred and juvs & the genotype of the org that was being killed and triggered this cloning
-    if (org_at->GetForageTarget() > -1 && org_at->SystematicsGroup("genotype")->ID() != gen_id &&
+    if (org_at->GetForageTarget() > -1 && org_at->SystematicsGroup(Systematics::ROLE_GENOTYPE)->ID() != gen_id &&
       !org_at->GetPhenotype().IsClone()) org_to_clone = org_at;   // only clone orgs that can reproduce on their own
     else TriedIdx.Swap(idx, --list_size);
     if (list_size == 1) break;
@@ -0,0 +1,157 @@
+/*
+ *  cPopulationSnapshot.cc
+ *  Avida
+ *
+ *  Copyright 2026 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "cPopulationSnapshot.h"
+
+#include "avida/systematics/Group.h"
+#include "avida/systematics/Types.h"
+
+#include "cHardwareBase.h"
+#include "cOrganism.h"
+#include "cPhenotype.h"
+#include "cWorkerPool.h"
+
+#include <algorithm>
+
+
+// Fills one contiguous slice of rows; every row is written by exactly one part
+class cPopulationSnapshot::cFillJob : public cWorkerPool::Job
+{
+private:
+  cPopulationSnapshot& m_snap;
+  const Apto::Array<cOrganism*, Apto::Smart>& m_orgs;
+  int m_num_parts;
+
+public:
+  cFillJob(cPopulationSnapshot& snap, const Apto::Array<cOrganism*, Apto::Smart>& orgs, int num_parts)
+    : m_snap(snap), m_orgs(orgs), m_num_parts(num_parts) { ; }
+
+  void Run(int part)
+  {
+    const int num_orgs = m_orgs.GetSize();
+    const int begin = static_cast<int>(static_cast<long long>(num_orgs) * part / m_num_parts);
+    const int end = static_cast<int>(static_cast<long long>(num_orgs) * (part + 1) / m_num_parts);
+    const int words = m_snap.m_task_words;
+
+    for (int row = begin; row < end; row++) {
+      cOrganism* org = m_orgs[row];
+      const cPhenotype& phenotype = org->GetPhenotype();
+
+      m_snap.m_cell_id[row] = org->GetCellID();
+      m_snap.m_org_id[row] = org->GetID();
+      m_snap.m_merit[row] = phenotype.GetMerit().GetDouble();
+      m_snap.m_fitness[row] = phenotype.GetFitness();
+      m_snap.m_gestation[row] = phenotype.GetGestationTime();
+      m_snap.m_lineage[row] = org->GetLineageLabel();
+      m_snap.m_group[row] = org->HasOpinion() ? org->GetOpinion().first : -1;
+      m_snap.m_forage_target[row] = org->GetForageTarget();
+      m_snap.m_age[row] = phenotype.GetAge();
+      m_snap.m_generation[row] = phenotype.GetGeneration();
+      m_snap.m_cclade[row] = org->GetCCladeLabel();
+      m_snap.m_num_divides[row] = phenotype.GetNumDivides();
+      m_snap.m_mating_type[row] = phenotype.GetMatingType();
+      m_snap.m_inst_set[row] = &org->GetHardware().GetInstSet();
+
+      unsigned int* task_words = &m_snap.m_last_tasks[row * words];
+      for (int w = 0; w < words; w++) task_words[w] = 0;
+      const Apto::Array<int>& last_tasks = phenotype.GetLastTaskCount();
+      int num_tasks = 0;
+      for (int j = 0; j < last_tasks.GetSize(); j++) {
+        if (last_tasks[j] > 0) {
+          task_words[j >> 5] |= 1u << (j & 31);
+          num_tasks++;
+        }
+      }
+      m_snap.m_num_last_tasks[row] = num_tasks;
+
+      if (m_snap.m_has_inst_counts) {
+        const Apto::Array<int>& last_insts = phenotype.GetLastInstCount();
+        const int inst_offset = m_snap.m_inst_offset[row];
+        for (int j = 0; j < last_insts.GetSize(); j++) m_snap.m_last_inst_count[inst_offset + j] = last_insts[j];
+
+        const Apto::Array<int>& last_msgs = phenotype.GetLastFromMessageInstCount();
+        const int msg_offset = m_snap.m_msg_offset[row];
+        for (int j = 0; j < last_msgs.GetSize(); j++) m_snap.m_last_from_message_count[msg_offset + j] = last_msgs[j];
+      }
+    }
+  }
+};
+
+
+void cPopulationSnapshot::Build(const Apto::Array<cOrganism*, Apto::Smart>& orgs, int num_cells, int num_tasks,
+                                bool inst_counts, cWorkerPool* workers)
+{
+  m_num_orgs = orgs.GetSize();
+  m_task_words = (num_tasks + 31) / 32;
+  m_has_inst_counts = inst_counts;
+
+  m_cell_id.Resize(m_num_orgs);
+  m_org_id.Resize(m_num_orgs);
+  m_genotype_id.Resize(m_num_orgs);
+  m_merit.Resize(m_num_orgs);
+  m_fitness.Resize(m_num_orgs);
+  m_gestation.Resize(m_num_orgs);
+  m_last_tasks.Resize(m_num_orgs * m_task_words);
+  m_num_last_tasks.Resize(m_num_orgs);
+  m_lineage.Resize(m_num_orgs);
+  m_group.Resize(m_num_orgs);
+  m_forage_target.Resize(m_num_orgs);
+  m_age.Resize(m_num_orgs);
+  m_generation.Resize(m_num_orgs);
+  m_cclade.Resize(m_num_orgs);
+  m_num_divides.Resize(m_num_orgs);
+  m_mating_type.Resize(m_num_orgs);
+  m_inst_set.Resize(m_num_orgs);
+
+  // The instruction count rows are variable length, so their offsets are laid out before the rows are filled
+  if (m_has_inst_counts) {
+    m_inst_offset.Resize(m_num_orgs + 1);
+    m_msg_offset.Resize(m_num_orgs + 1);
+    m_inst_offset[0] = 0;
+    m_msg_offset[0] = 0;
+    for (int row = 0; row < m_num_orgs; row++) {
+      const cPhenotype& phenotype = orgs[row]->GetPhenotype();
+      m_inst_offset[row + 1] = m_inst_offset[row] + phenotype.GetLastInstCount().GetSize();
+      m_msg_offset[row + 1] = m_msg_offset[row] + phenotype.GetLastFromMessageInstCount().GetSize();
+    }
+    m_last_inst_count.Resize(m_inst_offset[m_num_orgs]);
+    m_last_from_message_count.Resize(m_msg_offset[m_num_orgs]);
+  } else {
+    m_inst_offset.Resize(0);
+    m_msg_offset.Resize(0);
+    m_last_inst_count.Resize(0);
+    m_last_from_message_count.Resize(0);
+  }
+
+  const int num_parts = (workers && m_num_orgs > 1) ? std::min(workers->GetNumThreads(), m_num_orgs) : 1;
+  cFillJob job(*this, orgs, num_parts);
+  if (num_parts > 1) workers->Run(job, num_parts);
+  else job.Run(0);
+
+  // Systematics group references are shared between organisms, so their ids are copied on this thread only
+  m_row.Resize(num_cells);
+  m_row.SetAll(-1);
+  for (int row = 0; row < m_num_orgs; row++) {
+    Avida::Systematics::GroupPtr genotype = orgs[row]->SystematicsGroup(Avida::Systematics::ROLE_GENOTYPE);
+    m_genotype_id[row] = (genotype) ? genotype->ID() : -1;
+    if (m_cell_id[row] >= 0) m_row[m_cell_id[row]] = row;
+  }
+}
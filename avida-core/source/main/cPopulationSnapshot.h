@@ -0,0 +1,120 @@
+/*
+ *  cPopulationSnapshot.h
+ *  Avida
+ *
+ *  Copyright 2026 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef cPopulationSnapshot_h
+#define cPopulationSnapshot_h
+
+#include "apto/core.h"
+
+class cInstSet;
+class cOrganism;
+class cWorkerPool;
+
+
+// cPopulationSnapshot - columnar copy of the commonly reported organism values
+// --------------------------------------------------------------------------------------------------------------
+//
+//  One row per living organism, in the order of the population's live organism list, with one array per column so
+//  that reductions over a single value read contiguous memory instead of chasing organism and phenotype pointers.
+//  GetRow() maps a cell to its row for grid output.  The last and from-message instruction counts are variable length
+//  (one entry per instruction of the row's instruction set) and are only copied when the snapshot is requested with
+//  them, since they dominate its size.
+//
+//  The snapshot is built by cPopulation::GetSnapshot() the first time it is requested after the population changed
+//  (any birth, death, merit change or organism value changed by an event, see cPopulation::InvalidateSnapshot()) or
+//  the update advanced, so all print actions and organism stat providers run in the same update share one copy.  Rows are filled in contiguous slices on the STATS_THREADS worker pool when there is one; genotype ids are
+//  read in a sequential pass since they go through the shared systematics group references.
+
+class cPopulationSnapshot
+{
+private:
+  int m_num_orgs;
+  int m_task_words;                               // 32 bit words of task flags per row
+  bool m_has_inst_counts;
+
+  Apto::Array<int> m_row;                         // Row of each cell, -1 for empty cells
+
+  Apto::Array<int> m_cell_id;
+  Apto::Array<int> m_org_id;
+  Apto::Array<int> m_genotype_id;
+  Apto::Array<double> m_merit;
+  Apto::Array<double> m_fitness;
+  Apto::Array<int> m_gestation;
+  Apto::Array<unsigned int> m_last_tasks;         // Tasks performed during the last gestation, m_task_words per row
+  Apto::Array<int> m_num_last_tasks;              // Distinct tasks performed during the last gestation
+  Apto::Array<int> m_lineage;
+  Apto::Array<int> m_group;                       // Current opinion (group id), -1 if none
+  Apto::Array<int> m_forage_target;
+  Apto::Array<int> m_age;
+  Apto::Array<int> m_generation;
+  Apto::Array<int> m_cclade;
+  Apto::Array<int> m_num_divides;
+  Apto::Array<int> m_mating_type;
+  Apto::Array<const cInstSet*> m_inst_set;
+
+  Apto::Array<int> m_inst_offset;                 // Start of each row's last instruction counts, m_num_orgs + 1 entries
+  Apto::Array<int> m_last_inst_count;
+  Apto::Array<int> m_msg_offset;                  // Start of each row's from-message counts, m_num_orgs + 1 entries
+  Apto::Array<int> m_last_from_message_count;
+
+
+  class cFillJob;
+  friend class cFillJob;
+
+  cPopulationSnapshot(const cPopulationSnapshot&); // @not_implemented
+  cPopulationSnapshot& operator=(const cPopulationSnapshot&); // @not_implemented
+
+public:
+  cPopulationSnapshot() : m_num_orgs(0), m_task_words(0), m_has_inst_counts(false) { ; }
+
+  void Build(const Apto::Array<cOrganism*, Apto::Smart>& orgs, int num_cells, int num_tasks, bool inst_counts,
+             cWorkerPool* workers);
+
+  int GetNumOrgs() const { return m_num_orgs; }
+  bool HasInstCounts() const { return m_has_inst_counts; }
+  int GetRow(int cell_id) const { return m_row[cell_id]; }
+
+  int GetCellID(int row) const { return m_cell_id[row]; }
+  int GetOrgID(int row) const { return m_org_id[row]; }
+  int GetGenotypeID(int row) const { return m_genotype_id[row]; }
+  double GetMerit(int row) const { return m_merit[row]; }
+  double GetFitness(int row) const { return m_fitness[row]; }
+  int GetGestationTime(int row) const { return m_gestation[row]; }
+  bool HasLastTask(int row, int task) const { return (m_last_tasks[row * m_task_words + (task >> 5)] >> (task & 31)) & 1u; }
+  int GetNumLastTasks(int row) const { return m_num_last_tasks[row]; }
+  int GetLineageLabel(int row) const { return m_lineage[row]; }
+  int GetGroup(int row) const { return m_group[row]; }
+  int GetForageTarget(int row) const { return m_forage_target[row]; }
+  int GetAge(int row) const { return m_age[row]; }
+  int GetGeneration(int row) const { return m_generation[row]; }
+  int GetCCladeLabel(int row) const { return m_cclade[row]; }
+  int GetNumDivides(int row) const { return m_num_divides[row]; }
+  int GetMatingType(int row) const { return m_mating_type[row]; }
+  const cInstSet& GetInstSet(int row) const { return *m_inst_set[row]; }
+
+  // Only available when HasInstCounts()
+  int GetNumLastInstCounts(int row) const { return m_inst_offset[row + 1] - m_inst_offset[row]; }
+  int GetLastInstCount(int row, int inst) const { return m_last_inst_count[m_inst_offset[row] + inst]; }
+  int GetNumLastFromMessageCounts(int row) const { return m_msg_offset[row + 1] - m_msg_offset[row]; }
+  int GetLastFromMessageCount(int row, int inst) const { return m_last_from_message_count[m_msg_offset[row] + inst]; }
+};
+
+#endif
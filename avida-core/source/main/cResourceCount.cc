@@ -25,6 +25,7 @@
 #include "cGradientCount.h"
 #include "cWorld.h"
 #include "cStats.h"
+#include "cUpdateProfiler.h"
 
 #include "nGeometry.h"
 
@@ -37,6 +38,13 @@ const double cResourceCount::EPSILON (1.0e-15);
 const int cResourceCount::PRECALC_DISTANCE(100);
 
 
+// 1 - e^x, without losing precision to cancellation when x is near 0
+static inline double OneMinusExp(double x)
+{
+  if (fabs(x) < 1.0e-3) return -x * (1.0 + x / 2.0 * (1.0 + x / 3.0 * (1.0 + x / 4.0 * (1.0 + x / 5.0))));
+  return 1.0 - exp(x);
+}
+
 void FlowMatter(cSpatialCountElem &elem1, cSpatialCountElem &elem2, 
                 double inxdiffuse, 
                 double inydiffuse, double inxgravity, double inygravity,
@@ -102,6 +110,8 @@ cResourceCount::cResourceCount(int num_resources)
   , spatial_update_time(0.0)
   , m_last_updated(0)
   , m_spatial_update(0)
+  , m_global_step(0)
+  , m_profiler(NULL)
 {
   if(num_resources > 0) {
     SetSize(num_resources);
@@ -110,7 +120,7 @@ cResourceCount::cResourceCount(int num_resources)
   return;
 }
 
-cResourceCount::cResourceCount(const cResourceCount &rc) {
+cResourceCount::cResourceCount(const cResourceCount &rc) : m_profiler(NULL) {
   *this = rc;
 
   return;
@@ -135,6 +145,8 @@ const cResourceCount &cResourceCount::operator=(const cResourceCount &rc) {
   curr_spatial_res_cnt = rc.curr_spatial_res_cnt;
   update_time = rc.update_time;
   spatial_update_time = rc.spatial_update_time;
+  m_global_step = rc.m_global_step;
+  m_res_step = rc.m_res_step;
   cell_lists = rc.cell_lists;
 
   return *this;
@@ -152,6 +164,7 @@ void cResourceCount::SetSize(int num_resources)
     inflow_precalc.ResizeClear(num_resources, PRECALC_DISTANCE+1);
   }
   geometry.ResizeClear(num_resources);
+  m_res_step.ResizeClear(num_resources);
   
   for (int i = 0; i < spatial_resource_count.GetSize(); i++) {
     delete spatial_resource_count[i]; 
@@ -174,6 +187,7 @@ void cResourceCount::SetSize(int num_resources)
   decay_precalc.SetAll(1.0); // This is 1-inflow, so there should be no inflow by default, JEB
   inflow_precalc.SetAll(0.0);
   geometry.SetAll(nGeometry::GLOBAL);
+  m_res_step.SetAll(m_global_step);
   curr_grid_res_cnt.SetAll(0.0);
   //DO spacial resources need to be set to zero?
 }
@@ -291,6 +305,7 @@ void cResourceCount::Setup(cWorld* world, const int& res_index, const cString& n
 
   resource_name[res_index] = name;
   resource_initial[res_index] = initial;
+  m_res_step[res_index] = m_global_step;
   if (in_geometry == nGeometry::GLOBAL) {
     resource_count[res_index] = initial;
     spatial_resource_count[res_index]->RateAll(0);
@@ -502,6 +517,7 @@ void cResourceCount::SetInflow(const cString& name, const double _inflow)
   int id = GetResourceCountID(name);
   if (id == -1) return;
 
+  if (!IsSpatialResource(id)) DoNonSpatialUpdates(id);
   inflow_rate[id] = _inflow;
   double step_inflow = _inflow * UPDATE_STEP;
   double step_decay = pow(decay_rate[id], UPDATE_STEP);
@@ -525,6 +541,7 @@ void cResourceCount::SetDecay(const cString& name, const double _decay)
   int id = GetResourceCountID(name);
   if (id == -1) return;
 
+  if (!IsSpatialResource(id)) DoNonSpatialUpdates(id);
   decay_rate[id] = _decay;
   double step_decay = pow(_decay, UPDATE_STEP);
   decay_precalc(id, 0) = 1.0;
@@ -543,6 +560,7 @@ void cResourceCount::Update(double in_time)
 const Apto::Array<double> & cResourceCount::GetResources(cAvidaContext& ctx) const
 {
   DoUpdates(ctx); 
+  DoNonSpatialUpdates();
   return resource_count;
 }
  
@@ -556,6 +574,7 @@ const Apto::Array<double> & cResourceCount::GetCellResources(int cell_id, cAvida
               
   for (int i = 0; i < num_resources; i++) {
      if (!IsSpatialResource(i)) {
+         DoNonSpatialUpdates(i);
          curr_grid_res_cnt[i] = resource_count[i];
     } else {
       curr_grid_res_cnt[i] = spatial_resource_count[i]->GetAmount(cell_id);
@@ -575,6 +594,7 @@ const Apto::Array<double> & cResourceCount::GetFrozenResources(cAvidaContext&, i
   
   for (int i = 0; i < num_resources; i++) {
     if (!IsSpatialResource(i)) {
+      DoNonSpatialUpdates(i);
       curr_grid_res_cnt[i] = resource_count[i];
     } else {
       curr_grid_res_cnt[i] = spatial_resource_count[i]->GetAmount(cell_id);
@@ -586,8 +606,10 @@ const Apto::Array<double> & cResourceCount::GetFrozenResources(cAvidaContext&, i
 double cResourceCount::GetFrozenCellResVal(cAvidaContext& ctx, int cell_id, int res_id) const
 // This differs from GetFrozenCellResources by only pulling for res of interest.
 {
-  if (!IsSpatialResource(res_id)) 
+  if (!IsSpatialResource(res_id)) {
+    DoNonSpatialUpdates(res_id);
     return resource_count[res_id];
+  }
   else 
     return spatial_resource_count[res_id]->GetAmount(cell_id);
 }
@@ -599,6 +621,7 @@ double cResourceCount::GetCellResVal(cAvidaContext& ctx, int cell_id, int res_id
 
   double res_val = 0;
   if (!IsSpatialResource(res_id)) {
+    DoNonSpatialUpdates(res_id);
     res_val = resource_count[res_id];
   } else {
     res_val = spatial_resource_count[res_id]->GetAmount(cell_id);
@@ -631,6 +654,7 @@ void cResourceCount::Modify(cAvidaContext& ctx, const Apto::Array<double> & res_
   assert(resource_count.GetSize() == res_change.GetSize());
 
   DoUpdates(ctx);
+  DoNonSpatialUpdates();
   for (int i = 0; i < resource_count.GetSize(); i++) {
     resource_count[i] += res_change[i];
     assert(resource_count[i] >= 0.0);
@@ -643,6 +667,7 @@ void cResourceCount::Modify(cAvidaContext& ctx, int res_index, double change)
   assert(res_index < resource_count.GetSize());
 
   DoUpdates(ctx);
+  if (!IsSpatialResource(res_index)) DoNonSpatialUpdates(res_index);
   resource_count[res_index] += change;
   assert(resource_count[res_index] >= 0.0);
 }
@@ -654,6 +679,7 @@ void cResourceCount::ModifyCell(cAvidaContext& ctx, const Apto::Array<double> &
   DoUpdates(ctx);
   for (int i = 0; i < resource_count.GetSize(); i++) {
   if (!IsSpatialResource(i)) {
+        DoNonSpatialUpdates(i);
         resource_count[i] += res_change[i];
       assert(resource_count[i] >= 0.0);
     } else {
@@ -679,6 +705,7 @@ double cResourceCount::Get(cAvidaContext& ctx, int res_id) const
   assert(res_id < resource_count.GetSize());
   DoUpdates(ctx);
   if (!IsSpatialResource(res_id)) {
+      DoNonSpatialUpdates(res_id);
       return resource_count[res_id];
   } //else return spacial resource sum
   return spatial_resource_count[res_id]->SumAll();
@@ -690,6 +717,7 @@ void cResourceCount::Set(cAvidaContext& ctx, int res_id, double new_level)
   DoUpdates(ctx);
   if (!IsSpatialResource(res_id)) {
      resource_count[res_id] = new_level;
+     m_res_step[res_id] = m_global_step;
   } else {
     for(int i = 0; i < spatial_resource_count[res_id]->GetSize(); i++) {
       spatial_resource_count[res_id]->SetCellAmount(i, new_level/spatial_resource_count[res_id]->GetSize());
@@ -756,6 +784,7 @@ int cResourceCount::GetMaxUsedY(int res_id)
 
 void cResourceCount::DoUpdates(cAvidaContext& ctx, bool global_only) const
 { 
+  cUpdateProfiler::Scope profile(m_profiler, cUpdateProfiler::PHASE_RESOURCES);
 
   
   // GLOBAL AND PARTIAL CALCULATION VALUES ======================================
@@ -798,31 +827,52 @@ void cResourceCount::DoUpdates(cAvidaContext& ctx, bool global_only) const
   
   
   // DO UPDATE FOR EACH RESOURCE ================================================
-  for (int res_id = 0; res_id < resource_count.GetSize(); res_id++) {
-    if (!IsSpatialResource(res_id)) {
-      DoNonSpatialUpdates(ctx, res_id, num_steps);
-    } else if (!global_only){
-      DoSpatialUpdates(ctx, res_id, num_spatial_updates);
-    }
-  }
+  // Non-spatial resources only note the elapsed steps here, see DoNonSpatialUpdates
+  m_global_step += num_steps;
   
-  if (!global_only){
+  if (!global_only) {
+    for (int res_id = 0; res_id < resource_count.GetSize(); res_id++) {
+      if (IsSpatialResource(res_id)) DoSpatialUpdates(ctx, res_id, num_spatial_updates);
+    }
     m_last_updated = m_spatial_update;
   }
 }
 
-void cResourceCount::DoNonSpatialUpdates(cAvidaContext& ctx, const int res_id, int num_steps) const
+void cResourceCount::DoNonSpatialUpdates(const int res_id) const
 {
-  // Calculate our entire PRECALC_DISTANCE intervals
-  while (num_steps > PRECALC_DISTANCE) {
-    resource_count[res_id] *= decay_precalc(res_id, PRECALC_DISTANCE);
-    resource_count[res_id] += inflow_precalc(res_id, PRECALC_DISTANCE);
-    num_steps -= PRECALC_DISTANCE;
+  const long long num_steps = m_global_step - m_res_step[res_id];
+  if (num_steps == 0) return;
+  m_res_step[res_id] = m_global_step;
+  
+  if (num_steps <= PRECALC_DISTANCE) {
+    resource_count[res_id] *= decay_precalc(res_id, (int)num_steps);
+    resource_count[res_id] += inflow_precalc(res_id, (int)num_steps);
+    return;
   }
   
-  // Calculate our remaining number of steps
-  resource_count[res_id] *= decay_precalc(res_id, num_steps);
-  resource_count[res_id] += inflow_precalc(res_id, num_steps);
+  // Longer gaps are solved in closed form rather than stepped through the tables PRECALC_DISTANCE steps at a time
+  resource_count[res_id] = IntegrateSteps(resource_count[res_id], decay_rate[res_id], inflow_precalc(res_id, 1), num_steps);
+}
+
+void cResourceCount::DoNonSpatialUpdates() const
+{
+  for (int res_id = 0; res_id < resource_count.GetSize(); res_id++) {
+    if (!IsSpatialResource(res_id)) DoNonSpatialUpdates(res_id);
+  }
+}
+
+double cResourceCount::IntegrateSteps(double amount, double decay, double step_inflow, long long num_steps)
+{
+  // Each step computes x' = d * x + i, so after n steps x_n = d^n * x + i * (1 - d^n) / (1 - d), or x + i * n when
+  // there is no decay.  d = decay^UPDATE_STEP is close to 1 (1 - 1e-6 for a decay of 0.99 per update), so
+  // (1 - d^n) / (1 - d) is evaluated from the log of the decay to avoid the cancellation.
+  if (num_steps <= 0) return amount;
+  if (decay == 1.0) return amount + step_inflow * num_steps;
+  if (decay <= 0.0) return step_inflow;
+
+  const double log_step_decay = log(decay) * UPDATE_STEP;
+  const double log_decay_n = log_step_decay * num_steps;
+  return amount * exp(log_decay_n) + step_inflow * OneMinusExp(log_decay_n) / OneMinusExp(log_step_decay);
 }
 
 
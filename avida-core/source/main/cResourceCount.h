@@ -31,6 +31,7 @@
 #include "tMatrix.h"
 #include "nGeometry.h"
 
+class cUpdateProfiler;
 class cWorld;
 
 
@@ -81,9 +82,19 @@ private:
   mutable int m_last_updated;
   mutable int m_spatial_update;
 
+  // Global and partial resources are integrated on demand: the steps taken by DoUpdates only advance m_global_step,
+  // and each resource_count entry catches up to it when it is next read or modified, from the precalculated tables
+  // for gaps of up to PRECALC_DISTANCE steps and with IntegrateSteps beyond.  Steps from several DoUpdates calls are
+  // integrated as a single gap, so counts can differ in the last digits from integrating each call separately.
+  mutable long long m_global_step;            // Resource steps elapsed
+  mutable Apto::Array<long long> m_res_step;  // Step each non-spatial resource_count entry is current to
+
+  cUpdateProfiler* m_profiler;    // Optional, not copied with the resource state
+
   void DoUpdates(cAvidaContext& ctx, bool global_only = false) const;         // Update resource count based on update time
   
-  void DoNonSpatialUpdates(cAvidaContext& ctx, const int res_id, int num_steps) const;
+  void DoNonSpatialUpdates(const int res_id) const;
+  void DoNonSpatialUpdates() const;
   void DoSpatialUpdates(cAvidaContext& ctx, const int res_id, int num_updates) const;
 
   // A few constants to describe update process...
@@ -99,6 +110,7 @@ public:
   const cResourceCount& operator=(const cResourceCount&);
 
   void SetSize(int num_resources);
+  void SetProfiler(cUpdateProfiler* profiler) { m_profiler = profiler; }
   void SetCellResources(int cell_id, const Apto::Array<double> & res);
 
   void Setup(cWorld* world, const int& id, const cString& name, const double& initial, const double& inflow, const double& decay,                      
@@ -156,7 +168,7 @@ public:
   void Update(double in_time);
 
   int GetSize(void) const { return resource_count.GetSize(); }
-  const Apto::Array<double>& ReadResources(void) const { return resource_count; }
+  const Apto::Array<double>& ReadResources(void) const { DoNonSpatialUpdates(); return resource_count; }
   const Apto::Array<double>& GetResources(cAvidaContext& ctx) const; 
   const Apto::Array<double>& GetCellResources(int cell_id, cAvidaContext& ctx) const;
   const Apto::Array<double>& GetFrozenResources(cAvidaContext& ctx, int cell_id) const;
@@ -194,9 +206,12 @@ public:
   int GetMaxUsedY(int res_id);
   
   void SetSpatialUpdate(int update) { m_spatial_update = update; }
-  void UpdateGlobalResources(cAvidaContext& ctx) { DoUpdates(ctx, true); }
+  void UpdateGlobalResources(cAvidaContext& ctx) { DoUpdates(ctx, true); DoNonSpatialUpdates(); }
   void UpdateRandomResources(cAvidaContext& ctx) { DoUpdates(ctx, false); }
   void UpdateResources(cAvidaContext& ctx) { DoUpdates(ctx, false); }
+
+  // Amount after num_steps steps of x' = d * x + i, with d = decay^UPDATE_STEP and i = step_inflow, in closed form
+  static double IntegrateSteps(double amount, double decay, double step_inflow, long long num_steps);
 };
 
 #endif
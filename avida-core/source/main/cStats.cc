@@ -49,6 +49,7 @@
 #include <algorithm>
 #include <cassert>
 #include <cfloat>
+#include <climits>
 #include <numeric>
 #include <cmath>
 #include <sstream>
@@ -500,6 +501,314 @@ void cStats::ZeroReactions()
   m_reaction_last_add_reward.SetAll(0);
 }
 
+
+void cStats::sOrgStats::Reset(int num_tasks, int num_reactions)
+{
+  fitness.Clear();
+  gestation.Clear();
+  merit.Clear();
+  creature_age.Clear();
+  generation.Clear();
+  neutral_metric.Clear();
+  lineage_label.Clear();
+  copy_mut_rate.Clear();
+  div_mut_rate.Clear();
+  copy_size.Clear();
+  exe_size.Clear();
+  mem_size.Clear();
+
+  num_breed_true = 0;
+  num_parasites = 0;
+  num_no_birth = 0;
+  num_multi_thread = 0;
+  num_single_thread = 0;
+  num_threads = 0;
+  num_modified = 0;
+
+  max_merit = 0.0;
+  max_fitness = 0;
+  max_gestation_time = 0;
+  max_genome_length = 0;
+  min_merit = FLT_MAX;
+  min_fitness = FLT_MAX;
+  min_gestation_time = INT_MAX;
+  min_genome_length = INT_MAX;
+
+  task_cur_count.ResizeClear(num_tasks);
+  task_last_count.ResizeClear(num_tasks);
+  task_exe_count.ResizeClear(num_tasks);
+  task_cur_quality.ResizeClear(num_tasks);
+  task_last_quality.ResizeClear(num_tasks);
+  task_cur_max_quality.ResizeClear(num_tasks);
+  task_last_max_quality.ResizeClear(num_tasks);
+  tasks_host_current.ResizeClear(num_tasks);
+  tasks_host_last.ResizeClear(num_tasks);
+  tasks_parasite_current.ResizeClear(num_tasks);
+  tasks_parasite_last.ResizeClear(num_tasks);
+  task_internal_cur_count.ResizeClear(num_tasks);
+  task_internal_last_count.ResizeClear(num_tasks);
+  task_internal_cur_quality.ResizeClear(num_tasks);
+  task_internal_last_quality.ResizeClear(num_tasks);
+  task_internal_cur_max_quality.ResizeClear(num_tasks);
+  task_internal_last_max_quality.ResizeClear(num_tasks);
+  task_cur_count.SetAll(0);
+  task_last_count.SetAll(0);
+  task_exe_count.SetAll(0);
+  task_cur_quality.SetAll(0);
+  task_last_quality.SetAll(0);
+  task_cur_max_quality.SetAll(0);
+  task_last_max_quality.SetAll(0);
+  tasks_host_current.SetAll(0);
+  tasks_host_last.SetAll(0);
+  tasks_parasite_current.SetAll(0);
+  tasks_parasite_last.SetAll(0);
+  task_internal_cur_count.SetAll(0);
+  task_internal_last_count.SetAll(0);
+  task_internal_cur_quality.SetAll(0);
+  task_internal_last_quality.SetAll(0);
+  task_internal_cur_max_quality.SetAll(0);
+  task_internal_last_max_quality.SetAll(0);
+
+  reaction_cur_count.ResizeClear(num_reactions);
+  reaction_last_count.ResizeClear(num_reactions);
+  reaction_exe_count.ResizeClear(num_reactions);
+  reaction_cur_add_reward.ResizeClear(num_reactions);
+  reaction_last_add_reward.ResizeClear(num_reactions);
+  reaction_cur_count.SetAll(0);
+  reaction_last_count.SetAll(0);
+  reaction_exe_count.SetAll(0);
+  reaction_cur_add_reward.SetAll(0);
+  reaction_last_add_reward.SetAll(0);
+}
+
+
+// Only reads state owned by the organism itself, so that separate organisms may be added from separate threads
+void cStats::sOrgStats::AddOrganism(cOrganism* org)
+{
+  const cPhenotype& phenotype = org->GetPhenotype();
+  const cMerit cur_merit = phenotype.GetMerit();
+  const double cur_fitness = phenotype.GetFitness();
+  const int cur_gestation_time = phenotype.GetGestationTime();
+  const int cur_genome_length = phenotype.GetGenomeLength();
+
+  fitness.Add(cur_fitness);
+  merit.Add(cur_merit.GetDouble());
+  gestation.Add(phenotype.GetGestationTime());
+  creature_age.Add(phenotype.GetAge());
+  generation.Add(phenotype.GetGeneration());
+  neutral_metric.Add(phenotype.GetNeutralMetric());
+  lineage_label.Add(org->GetLineageLabel());
+  copy_mut_rate.Push(org->MutationRates().GetCopyMutProb());
+  div_mut_rate.Push(org->MutationRates().GetDivMutProb() / phenotype.GetDivType());
+  copy_size.Add(phenotype.GetCopiedSize());
+  exe_size.Add(phenotype.GetExecutedSize());
+
+  if (cur_merit > max_merit) max_merit = cur_merit;
+  if (cur_fitness > max_fitness) max_fitness = cur_fitness;
+  if (cur_gestation_time > max_gestation_time) max_gestation_time = cur_gestation_time;
+  if (cur_genome_length > max_genome_length) max_genome_length = cur_genome_length;
+
+  if (cur_merit < min_merit) min_merit = cur_merit;
+  if (cur_fitness < min_fitness) min_fitness = cur_fitness;
+  if (cur_gestation_time < min_gestation_time) min_gestation_time = cur_gestation_time;
+  if (cur_genome_length < min_genome_length) min_genome_length = cur_genome_length;
+
+  // Test what tasks this creatures has completed.
+  for (int j = 0; j < task_cur_count.GetSize(); j++) {
+    if (phenotype.GetCurTaskCount()[j] > 0) {
+      task_cur_count[j]++;
+      const double quality = phenotype.GetCurTaskQuality()[j];
+      task_cur_quality[j] += quality;
+      if (quality > task_cur_max_quality[j]) task_cur_max_quality[j] = quality;
+    }
+
+    if (phenotype.GetLastTaskCount()[j] > 0) {
+      task_last_count[j]++;
+      const double quality = phenotype.GetLastTaskQuality()[j];
+      task_last_quality[j] += quality;
+      if (quality > task_last_max_quality[j]) task_last_max_quality[j] = quality;
+      task_exe_count[j] += phenotype.GetLastTaskCount()[j];
+    }
+
+    if (phenotype.GetCurHostTaskCount()[j] > 0) tasks_host_current[j]++;
+    if (phenotype.GetLastHostTaskCount()[j] > 0) tasks_host_last[j]++;
+    if (phenotype.GetCurParasiteTaskCount()[j] > 0) tasks_parasite_current[j]++;
+    if (phenotype.GetLastParasiteTaskCount()[j] > 0) tasks_parasite_last[j]++;
+
+    if (phenotype.GetCurInternalTaskCount()[j] > 0) {
+      task_internal_cur_count[j]++;
+      const double quality = phenotype.GetCurInternalTaskQuality()[j];
+      task_internal_cur_quality[j] += quality;
+      if (quality > task_internal_cur_max_quality[j]) task_internal_cur_max_quality[j] = quality;
+    }
+
+    if (phenotype.GetLastInternalTaskCount()[j] > 0) {
+      task_internal_last_count[j]++;
+      const double quality = phenotype.GetLastInternalTaskQuality()[j];
+      task_internal_last_quality[j] += quality;
+      if (quality > task_internal_last_max_quality[j]) task_internal_last_max_quality[j] = quality;
+    }
+  }
+
+  // Record what add bonuses this organism garnered for different reactions
+  for (int j = 0; j < reaction_cur_count.GetSize(); j++) {
+    if (phenotype.GetCurReactionCount()[j] > 0) {
+      reaction_cur_count[j]++;
+      reaction_cur_add_reward[j] += phenotype.GetCurReactionAddReward()[j];
+    }
+
+    if (phenotype.GetLastReactionCount()[j] > 0) {
+      reaction_last_count[j]++;
+      reaction_exe_count[j] += phenotype.GetLastReactionCount()[j];
+      reaction_last_add_reward[j] += phenotype.GetLastReactionAddReward()[j];
+    }
+  }
+
+  // Increment the counts for all qualities the organism has...
+  num_parasites += org->GetNumParasites();
+  if (phenotype.ParentTrue()) num_breed_true++;
+  if (phenotype.GetNumDivides() == 0) num_no_birth++;
+  if (phenotype.IsMultiThread()) num_multi_thread++;
+  else num_single_thread++;
+
+  if (phenotype.IsModified()) num_modified++;
+
+  cHardwareBase& hardware = org->GetHardware();
+  mem_size.Add(hardware.GetMemory().GetSize());
+  num_threads += hardware.GetNumThreads();
+}
+
+
+void cStats::sOrgStats::Merge(const sOrgStats& other)
+{
+  fitness.Merge(other.fitness);
+  gestation.Merge(other.gestation);
+  merit.Merge(other.merit);
+  creature_age.Merge(other.creature_age);
+  generation.Merge(other.generation);
+  neutral_metric.Merge(other.neutral_metric);
+  lineage_label.Merge(other.lineage_label);
+  copy_mut_rate.Merge(other.copy_mut_rate);
+  div_mut_rate.Merge(other.div_mut_rate);
+  copy_size.Merge(other.copy_size);
+  exe_size.Merge(other.exe_size);
+  mem_size.Merge(other.mem_size);
+
+  num_breed_true += other.num_breed_true;
+  num_parasites += other.num_parasites;
+  num_no_birth += other.num_no_birth;
+  num_multi_thread += other.num_multi_thread;
+  num_single_thread += other.num_single_thread;
+  num_threads += other.num_threads;
+  num_modified += other.num_modified;
+
+  if (other.max_merit > max_merit) max_merit = other.max_merit;
+  if (other.max_fitness > max_fitness) max_fitness = other.max_fitness;
+  if (other.max_gestation_time > max_gestation_time) max_gestation_time = other.max_gestation_time;
+  if (other.max_genome_length > max_genome_length) max_genome_length = other.max_genome_length;
+  if (other.min_merit < min_merit) min_merit = other.min_merit;
+  if (other.min_fitness < min_fitness) min_fitness = other.min_fitness;
+  if (other.min_gestation_time < min_gestation_time) min_gestation_time = other.min_gestation_time;
+  if (other.min_genome_length < min_genome_length) min_genome_length = other.min_genome_length;
+
+  for (int j = 0; j < task_cur_count.GetSize(); j++) {
+    task_cur_count[j] += other.task_cur_count[j];
+    task_last_count[j] += other.task_last_count[j];
+    task_exe_count[j] += other.task_exe_count[j];
+    task_cur_quality[j] += other.task_cur_quality[j];
+    task_last_quality[j] += other.task_last_quality[j];
+    task_cur_max_quality[j] = std::max(task_cur_max_quality[j], other.task_cur_max_quality[j]);
+    task_last_max_quality[j] = std::max(task_last_max_quality[j], other.task_last_max_quality[j]);
+    tasks_host_current[j] += other.tasks_host_current[j];
+    tasks_host_last[j] += other.tasks_host_last[j];
+    tasks_parasite_current[j] += other.tasks_parasite_current[j];
+    tasks_parasite_last[j] += other.tasks_parasite_last[j];
+    task_internal_cur_count[j] += other.task_internal_cur_count[j];
+    task_internal_last_count[j] += other.task_internal_last_count[j];
+    task_internal_cur_quality[j] += other.task_internal_cur_quality[j];
+    task_internal_last_quality[j] += other.task_internal_last_quality[j];
+    task_internal_cur_max_quality[j] = std::max(task_internal_cur_max_quality[j], other.task_internal_cur_max_quality[j]);
+    task_internal_last_max_quality[j] = std::max(task_internal_last_max_quality[j], other.task_internal_last_max_quality[j]);
+  }
+
+  for (int j = 0; j < reaction_cur_count.GetSize(); j++) {
+    reaction_cur_count[j] += other.reaction_cur_count[j];
+    reaction_last_count[j] += other.reaction_last_count[j];
+    reaction_exe_count[j] += other.reaction_exe_count[j];
+    reaction_cur_add_reward[j] += other.reaction_cur_add_reward[j];
+    reaction_last_add_reward[j] += other.reaction_last_add_reward[j];
+  }
+}
+
+
+// Applies a complete set of organism statistics.  The organism sums are expected to have been cleared and the task
+// and reaction counts zeroed beforehand; task and reaction execution counts accumulate as with IncTaskExeCount().
+void cStats::MergeOrgStats(const sOrgStats& org_stats)
+{
+  sum_fitness.Merge(org_stats.fitness);
+  sum_gestation.Merge(org_stats.gestation);
+  sum_merit.Merge(org_stats.merit);
+  sum_creature_age.Merge(org_stats.creature_age);
+  sum_generation.Merge(org_stats.generation);
+  sum_neutral_metric.Merge(org_stats.neutral_metric);
+  sum_lineage_label.Merge(org_stats.lineage_label);
+  sum_copy_mut_rate.Merge(org_stats.copy_mut_rate);
+  sum_div_mut_rate.Merge(org_stats.div_mut_rate);
+  sum_copy_size.Merge(org_stats.copy_size);
+  sum_exe_size.Merge(org_stats.exe_size);
+  sum_mem_size.Merge(org_stats.mem_size);
+
+  SetBreedTrueCreatures(org_stats.num_breed_true);
+  SetNumNoBirthCreatures(org_stats.num_no_birth);
+  SetNumParasites(org_stats.num_parasites);
+  SetNumSingleThreadCreatures(org_stats.num_single_thread);
+  SetNumMultiThreadCreatures(org_stats.num_multi_thread);
+  SetNumThreads(org_stats.num_threads);
+  SetNumModified(org_stats.num_modified);
+
+  SetMaxMerit(org_stats.max_merit.GetDouble());
+  SetMaxFitness(org_stats.max_fitness);
+  SetMaxGestationTime(org_stats.max_gestation_time);
+  SetMaxGenomeLength(org_stats.max_genome_length);
+
+  SetMinMerit(org_stats.min_merit.GetDouble());
+  SetMinFitness(org_stats.min_fitness);
+  SetMinGestationTime(org_stats.min_gestation_time);
+  SetMinGenomeLength(org_stats.min_genome_length);
+
+  for (int j = 0; j < org_stats.task_cur_count.GetSize(); j++) {
+    task_cur_count[j] += org_stats.task_cur_count[j];
+    task_last_count[j] += org_stats.task_last_count[j];
+    task_exe_count[j] += org_stats.task_exe_count[j];
+    task_cur_quality[j] += org_stats.task_cur_quality[j];
+    task_last_quality[j] += org_stats.task_last_quality[j];
+    if (org_stats.task_cur_max_quality[j] > task_cur_max_quality[j]) task_cur_max_quality[j] = org_stats.task_cur_max_quality[j];
+    if (org_stats.task_last_max_quality[j] > task_last_max_quality[j]) task_last_max_quality[j] = org_stats.task_last_max_quality[j];
+    tasks_host_current[j] += org_stats.tasks_host_current[j];
+    tasks_host_last[j] += org_stats.tasks_host_last[j];
+    tasks_parasite_current[j] += org_stats.tasks_parasite_current[j];
+    tasks_parasite_last[j] += org_stats.tasks_parasite_last[j];
+    task_internal_cur_count[j] += org_stats.task_internal_cur_count[j];
+    task_internal_last_count[j] += org_stats.task_internal_last_count[j];
+    task_internal_cur_quality[j] += org_stats.task_internal_cur_quality[j];
+    task_internal_last_quality[j] += org_stats.task_internal_last_quality[j];
+    if (org_stats.task_internal_cur_max_quality[j] > task_internal_cur_max_quality[j]) {
+      task_internal_cur_max_quality[j] = org_stats.task_internal_cur_max_quality[j];
+    }
+    if (org_stats.task_internal_last_max_quality[j] > task_internal_last_max_quality[j]) {
+      task_internal_last_max_quality[j] = org_stats.task_internal_last_max_quality[j];
+    }
+  }
+
+  for (int j = 0; j < org_stats.reaction_cur_count.GetSize(); j++) {
+    m_reaction_cur_count[j] += org_stats.reaction_cur_count[j];
+    m_reaction_last_count[j] += org_stats.reaction_last_count[j];
+    m_reaction_exe_count[j] += org_stats.reaction_exe_count[j];
+    m_reaction_cur_add_reward[j] += org_stats.reaction_cur_add_reward[j];
+    m_reaction_last_add_reward[j] += org_stats.reaction_last_add_reward[j];
+  }
+}
+
 void cStats::ZeroMessageInst()
 {
 
@@ -4747,8 +5056,8 @@ void cStats::PrintWinningDeme(const cString& filename)
 	for(int i=0; i<deme.GetSize(); ++i) {
 		cOrganism* org=deme.GetOrganism(i);
 		if(org != 0) {
-			genotypes.push_back(org->SystematicsGroup("genotype")->ID());
-			uniq.insert(org->SystematicsGroup("genotype")->ID());
+			genotypes.push_back(org->SystematicsGroup(Systematics::ROLE_GENOTYPE)->ID());
+			uniq.insert(org->SystematicsGroup(Systematics::ROLE_GENOTYPE)->ID());
 		}
 	}
 	
@@ -5010,7 +5319,7 @@ void cStats::PrintMiniTraceReactions(cOrganism* org)
   int group_id = m_world->GetConfig().DEFAULT_GROUP.Get();
   if (org->HasOpinion()) group_id = org->GetOpinion().first;
   cString filename("");
-  filename.Set("minitraces/trace_reactions/org%d-ud%d-grp%d_ft%d-gt%d.trcreac", org->GetID(), org->GetPhenotype().GetUpdateBorn(), group_id, org->GetForageTarget(), org->SystematicsGroup("genotype")->ID());
+  filename.Set("minitraces/trace_reactions/org%d-ud%d-grp%d_ft%d-gt%d.trcreac", org->GetID(), org->GetPhenotype().GetUpdateBorn(), group_id, org->GetForageTarget(), org->SystematicsGroup(Systematics::ROLE_GENOTYPE)->ID());
   
   // Open the file...
   Avida::Output::FilePtr df = Avida::Output::File::CreateWithPath(m_world->GetNewWorld(), (const char*)filename);
@@ -5099,11 +5408,11 @@ void cStats::UpdateTopNavTrace(cOrganism* org, bool force_update)
   if (new_winner || force_update) {
     topreac = best_reac;
     topcycle = cycle;
-    topgenid = org->SystematicsGroup("genotype")->ID();
+    topgenid = org->SystematicsGroup(Systematics::ROLE_GENOTYPE)->ID();
     topid = org->GetID();
     topbirthud = org->GetPhenotype().GetUpdateBorn();
     toprepro = org->GetPhenotype().GetNumExecs();
-    topgenome = Genome(org->SystematicsGroup("genotype")->Properties().Get("genome"));
+    topgenome = Genome(*org->SystematicsGroup(Systematics::ROLE_GENOTYPE)->RepresentativeGenome());
     
     Apto::Array<char, Apto::Smart> trace = org->GetHardware().GetMicroTrace();
     Apto::Array<int, Apto::Smart> traceloc = org->GetHardware().GetNavTraceLoc();
@@ -5262,7 +5571,7 @@ void cStats::PrintReproData(cOrganism* org)
   }
   
   std::ofstream& fp = df->OFStream();
-  fp << update << " " << org->SystematicsGroup("genotype")->ID()<< " " << org->GetID() << " " << org->GetPhenotype().GetAge() << " " << org->GetPhenotype().GetTimeUsed()
+  fp << update << " " << org->SystematicsGroup(Systematics::ROLE_GENOTYPE)->ID()<< " " << org->GetID() << " " << org->GetPhenotype().GetAge() << " " << org->GetPhenotype().GetTimeUsed()
   << " " << org->GetPhenotype().GetNumExecs() << " ";
   Apto::Array<int> reaction_count = org->GetPhenotype().GetCurReactionCount();
   for (int i = 0; i < reaction_count.GetSize() - 1; i++) {
@@ -415,6 +415,69 @@ private:
   Genome topgenome;
     
 public:
+  // Per-organism statistics gathered by cPopulation::UpdateOrganismStats.  Each worker thread fills its own instance
+  // over a contiguous slice of the live organisms; the slices are merged in order and applied with MergeOrgStats().
+  struct sOrgStats
+  {
+    cDoubleSum fitness;
+    cDoubleSum gestation;
+    cDoubleSum merit;
+    cDoubleSum creature_age;
+    cDoubleSum generation;
+    cDoubleSum neutral_metric;
+    cDoubleSum lineage_label;
+    cRunningStats copy_mut_rate;
+    cRunningStats div_mut_rate;
+    cDoubleSum copy_size;
+    cDoubleSum exe_size;
+    cDoubleSum mem_size;
+
+    int num_breed_true;
+    int num_parasites;
+    int num_no_birth;
+    int num_multi_thread;
+    int num_single_thread;
+    int num_threads;
+    int num_modified;
+
+    cMerit max_merit;
+    double max_fitness;
+    int max_gestation_time;
+    int max_genome_length;
+    cMerit min_merit;
+    double min_fitness;
+    int min_gestation_time;
+    int min_genome_length;
+
+    Apto::Array<int> task_cur_count;
+    Apto::Array<int> task_last_count;
+    Apto::Array<int> task_exe_count;
+    Apto::Array<double> task_cur_quality;
+    Apto::Array<double> task_last_quality;
+    Apto::Array<double> task_cur_max_quality;
+    Apto::Array<double> task_last_max_quality;
+    Apto::Array<int> tasks_host_current;
+    Apto::Array<int> tasks_host_last;
+    Apto::Array<int> tasks_parasite_current;
+    Apto::Array<int> tasks_parasite_last;
+    Apto::Array<int> task_internal_cur_count;
+    Apto::Array<int> task_internal_last_count;
+    Apto::Array<double> task_internal_cur_quality;
+    Apto::Array<double> task_internal_last_quality;
+    Apto::Array<double> task_internal_cur_max_quality;
+    Apto::Array<double> task_internal_last_max_quality;
+
+    Apto::Array<int> reaction_cur_count;
+    Apto::Array<int> reaction_last_count;
+    Apto::Array<int> reaction_exe_count;
+    Apto::Array<double> reaction_cur_add_reward;
+    Apto::Array<double> reaction_last_add_reward;
+
+    void Reset(int num_tasks, int num_reactions);
+    void AddOrganism(cOrganism* org);
+    void Merge(const sOrgStats& other);
+  };
+
   cStats(cWorld* world);
   ~cStats() { ; }
 
@@ -709,6 +772,7 @@ public:
   void AddLastReactionAddReward(int reaction, double reward) { m_reaction_last_add_reward[reaction] += reward; }
   void IncReactionExeCount(int reaction, int count) { m_reaction_exe_count[reaction] += count; }
   void ZeroReactions();
+  void MergeOrgStats(const sOrgStats& org_stats);
 
   void SetResources(const Apto::Array<double> &_in) { resource_count = _in; }
   void SetResourcesGeometry(const Apto::Array<int> &_in) { resource_geometry = _in;}
@@ -0,0 +1,157 @@
+/*
+ *  cUpdateProfiler.cc
+ *  Avida
+ *
+ *  Copyright 2026 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "cUpdateProfiler.h"
+
+#include "avida/data/Manager.h"
+#include "avida/data/Package.h"
+
+#include "cWorld.h"
+
+#include <cassert>
+
+
+static const struct {
+  const char* name;
+  const char* description;
+  int parent;
+} s_phase_info[cUpdateProfiler::NUM_PHASES] = {
+  { "update",          "Update",                 -1 },
+  { "events",          "Events",                 cUpdateProfiler::PHASE_UPDATE },
+  { "pre_update",      "Pre-Update Processing",  cUpdateProfiler::PHASE_UPDATE },
+  { "stats",           "Statistics Update",      cUpdateProfiler::PHASE_UPDATE },
+  { "cpu_cycles",      "CPU Cycles",             cUpdateProfiler::PHASE_UPDATE },
+  { "births",          "Births",                 cUpdateProfiler::PHASE_CPU_CYCLES },
+  { "deaths",          "Deaths",                 cUpdateProfiler::PHASE_CPU_CYCLES },
+  { "resources",       "Resource Updates",       cUpdateProfiler::PHASE_UPDATE },
+  { "post_update",     "Post-Update Processing", cUpdateProfiler::PHASE_UPDATE },
+  { "output",          "Status Output",          cUpdateProfiler::PHASE_UPDATE },
+  { "point_mutations", "Point Mutations",        cUpdateProfiler::PHASE_UPDATE },
+  { "world_update",    "World Facet Updates",    cUpdateProfiler::PHASE_UPDATE }
+};
+
+
+cUpdateProfiler::cUpdateProfiler(cWorld* world)
+  : m_world(world), m_enabled(false), m_pending(false), m_depth(0), m_overflow(0), m_num_updates(0)
+{
+  for (int i = 0; i < NUM_PHASES; i++) m_active[i] = 0;
+
+  setupProvidedData();
+}
+
+
+const char* cUpdateProfiler::PhaseName(int phase)
+{
+  assert(phase >= 0 && phase < NUM_PHASES);
+  return s_phase_info[phase].name;
+}
+
+const char* cUpdateProfiler::PhaseDescription(int phase)
+{
+  assert(phase >= 0 && phase < NUM_PHASES);
+  return s_phase_info[phase].description;
+}
+
+int cUpdateProfiler::PhaseParent(int phase)
+{
+  assert(phase >= 0 && phase < NUM_PHASES);
+  return s_phase_info[phase].parent;
+}
+
+
+void cUpdateProfiler::completeUpdate()
+{
+  for (int i = 0; i < NUM_PHASES; i++) {
+    m_last[i] = m_current[i];
+    m_total[i].Add(m_current[i]);
+    m_current[i].Clear();
+  }
+  m_num_updates++;
+}
+
+
+Data::ConstDataSetPtr cUpdateProfiler::Provides() const
+{
+  if (!m_provides) {
+    Data::DataSetPtr provides(new Apto::Set<Apto::String>);
+    for (Apto::Map<Data::DataID, ProvidedData>::KeyIterator it = m_provided_data.Keys(); it.Next();) {
+      provides->Insert(*it.Get());
+    }
+    m_provides = provides;
+  }
+  return m_provides;
+}
+
+void cUpdateProfiler::UpdateProvidedValues(Update)
+{
+  // Nothing to do, values are rolled over as each update completes
+}
+
+Data::PackagePtr cUpdateProfiler::GetProvidedValue(const Data::DataID& data_id) const
+{
+  Data::PackagePtr rtn;
+  ProvidedData data_entry;
+  if (m_provided_data.Get(data_id, data_entry)) {
+    const PhaseStats& stats = m_last[data_entry.phase];
+    switch (data_entry.type) {
+      case STAT_MS:       rtn = Data::PackagePtr(new Data::Wrap<double>(stats.inclusive_ns * 1.0e-6)); break;
+      case STAT_SELF_MS:  rtn = Data::PackagePtr(new Data::Wrap<double>(stats.self_ns * 1.0e-6)); break;
+      case STAT_CALLS:    rtn = Data::PackagePtr(new Data::Wrap<int>(static_cast<int>(stats.calls))); break;
+    }
+  }
+  assert(rtn);
+
+  return rtn;
+}
+
+Apto::String cUpdateProfiler::DescribeProvidedValue(const Data::DataID& data_id) const
+{
+  ProvidedData data_entry;
+  Apto::String rtn;
+  if (m_provided_data.Get(data_id, data_entry)) {
+    rtn = data_entry.description;
+  }
+  assert(rtn != "");
+  return rtn;
+}
+
+
+void cUpdateProfiler::setupProvidedData()
+{
+  // Setup functors and references for use in the PROVIDE macro
+  Data::ProviderActivateFunctor activate(m_world, &cWorld::GetUpdateProfilerProvider);
+  Data::ManagerPtr mgr = m_world->GetDataManager();
+
+  // Define PROVIDE macro to simplify instantiating new provided data
+#define PROVIDE(phase, suffix, desc, type) { Apto::String pvn = Apto::String("core.profile.") + s_phase_info[phase].name + suffix; \
+  m_provided_data[pvn] = ProvidedData(Apto::String(s_phase_info[phase].description) + desc, phase, type); \
+  mgr->Register(pvn, activate); \
+}
+
+  for (int i = 0; i < NUM_PHASES; i++) {
+    ePhase phase = static_cast<ePhase>(i);
+    PROVIDE(phase, ".ms", " Time (ms, last update)", STAT_MS);
+    PROVIDE(phase, ".self_ms", " Self Time (ms, last update)", STAT_SELF_MS);
+    PROVIDE(phase, ".calls", " Call Count (last update)", STAT_CALLS);
+  }
+
+#undef PROVIDE
+}
@@ -0,0 +1,220 @@
+/*
+ *  cUpdateProfiler.h
+ *  Avida
+ *
+ *  Copyright 2026 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef cUpdateProfiler_h
+#define cUpdateProfiler_h
+
+#include "avida/data/Provider.h"
+
+#include "cHighResTimer.h"
+
+class cWorld;
+
+using namespace Avida;
+
+
+// cUpdateProfiler - wall clock accounting of the phases of each update
+// --------------------------------------------------------------------------------------------------------------
+//
+//  Phases are timed with cUpdateProfiler::Scope objects placed around the relevant code.  Scopes may nest; each
+//  phase records its inclusive time, its self time (inclusive time less that of any nested phases) and the number
+//  of times it was entered.  The outermost PHASE_UPDATE scope delimits an update; when it closes, the accumulated
+//  timings become the 'last update' values and are added to the running totals.
+//
+//  Profiling is disabled until Enable() is called (by the PrintUpdateProfile action or by activation of any of the
+//  core.profile.* provided data); until then a scope costs two tests.  Recording starts when the next PHASE_UPDATE
+//  scope opens, so an update is either profiled from its start or not at all.  The profiler is not thread safe,
+//  scopes must only be used from the thread running the world update loop.
+
+class cUpdateProfiler : public Data::Provider
+{
+public:
+  enum ePhase {
+    PHASE_UPDATE = 0,       // Entire update, from event processing through world facet updates
+    PHASE_EVENTS,           // Event list processing (including all Print actions)
+    PHASE_PRE_UPDATE,       // cPopulation::ProcessPreUpdate
+    PHASE_STATS,            // cStats::ProcessUpdate
+    PHASE_CPU_CYCLES,       // Organism execution loop
+    PHASE_BIRTHS,           // Offspring placement and activation
+    PHASE_DEATHS,           // Organism removal
+    PHASE_RESOURCES,        // Lazy resource flow/diffusion updates, wherever they are triggered
+    PHASE_POST_UPDATE,      // cPopulation::ProcessPostUpdate and cWorld::ProcessPostUpdate
+    PHASE_OUTPUT,           // Standard output status line
+    PHASE_POINT_MUTATIONS,  // Per-update point mutations
+    PHASE_WORLD_UPDATE,     // World facet updates (Data::Manager providers and recorders, systematics)
+    NUM_PHASES
+  };
+
+  struct PhaseStats
+  {
+    long long inclusive_ns;
+    long long self_ns;
+    long long calls;
+
+    inline PhaseStats() : inclusive_ns(0), self_ns(0), calls(0) { ; }
+    inline void Clear() { inclusive_ns = 0; self_ns = 0; calls = 0; }
+    inline void Add(const PhaseStats& s) { inclusive_ns += s.inclusive_ns; self_ns += s.self_ns; calls += s.calls; }
+  };
+
+  class Scope
+  {
+  private:
+    cUpdateProfiler* m_profiler;
+
+    Scope(); // @not_implemented
+    Scope(const Scope&); // @not_implemented
+    Scope& operator=(const Scope&); // @not_implemented
+
+  public:
+    inline Scope(cUpdateProfiler* profiler, ePhase phase)
+      : m_profiler((profiler && profiler->recording(phase)) ? profiler : NULL) { if (m_profiler) m_profiler->enterPhase(phase); }
+    inline Scope(cUpdateProfiler& profiler, ePhase phase)
+      : m_profiler(profiler.recording(phase) ? &profiler : NULL) { if (m_profiler) m_profiler->enterPhase(phase); }
+    inline ~Scope() { if (m_profiler) m_profiler->exitPhase(); }
+  };
+  friend class Scope;
+
+private:
+  static const int MAX_DEPTH = 32;
+
+  struct Frame
+  {
+    ePhase phase;
+    long long start;
+    long long child_ns;
+  };
+
+  cWorld* m_world;
+  bool m_enabled;
+  bool m_pending;           // Enable() was called, recording starts with the next update
+
+  Frame m_stack[MAX_DEPTH];
+  int m_depth;
+  int m_overflow;
+  int m_active[NUM_PHASES];
+
+  PhaseStats m_current[NUM_PHASES];
+  PhaseStats m_last[NUM_PHASES];
+  PhaseStats m_total[NUM_PHASES];
+  int m_num_updates;
+
+
+  // --------  Data Provider Support  ---------
+  enum eStatType { STAT_MS = 0, STAT_SELF_MS, STAT_CALLS };
+  struct ProvidedData
+  {
+    Apto::String description;
+    ePhase phase;
+    eStatType type;
+
+    ProvidedData() : phase(PHASE_UPDATE), type(STAT_MS) { ; }
+    ProvidedData(const Apto::String& desc, ePhase in_phase, eStatType in_type)
+      : description(desc), phase(in_phase), type(in_type) { ; }
+  };
+  Apto::Map<Data::DataID, ProvidedData> m_provided_data;
+  mutable Data::ConstDataSetPtr m_provides;
+
+
+  cUpdateProfiler(); // @not_implemented
+  cUpdateProfiler(const cUpdateProfiler&); // @not_implemented
+  cUpdateProfiler& operator=(const cUpdateProfiler&); // @not_implemented
+
+public:
+  cUpdateProfiler(cWorld* world);
+  ~cUpdateProfiler() { ; }
+
+  void Enable() { if (!m_enabled) m_pending = true; }
+  bool IsEnabled() const { return m_enabled || m_pending; }
+
+  static const char* PhaseName(int phase);
+  static const char* PhaseDescription(int phase);
+  static int PhaseParent(int phase);
+
+  // Timings of the most recently completed update
+  const PhaseStats& GetLastUpdate(int phase) const { return m_last[phase]; }
+
+  // Cumulative timings across all completed updates since profiling was enabled
+  const PhaseStats& GetTotal(int phase) const { return m_total[phase]; }
+  int GetNumUpdates() const { return m_num_updates; }
+
+
+  // Data::Provider
+  Data::ConstDataSetPtr Provides() const;
+  void UpdateProvidedValues(Update current_update);
+  Data::PackagePtr GetProvidedValue(const Data::DataID& data_id) const;
+  Apto::String DescribeProvidedValue(const Data::DataID& data_id) const;
+
+private:
+  void setupProvidedData();
+  inline bool recording(ePhase phase);
+  inline void enterPhase(ePhase phase);
+  inline void exitPhase();
+  void completeUpdate();
+};
+
+
+inline bool cUpdateProfiler::recording(ePhase phase)
+{
+  if (m_enabled) return true;
+  if (!m_pending || phase != PHASE_UPDATE || m_depth != 0) return false;
+  m_pending = false;
+  m_enabled = true;
+  return true;
+}
+
+inline void cUpdateProfiler::enterPhase(ePhase phase)
+{
+  if (m_depth == MAX_DEPTH) {
+    m_overflow++;
+    return;
+  }
+
+  Frame& frame = m_stack[m_depth++];
+  frame.phase = phase;
+  frame.child_ns = 0;
+  m_active[phase]++;
+  frame.start = cHighResTimer::Now();
+}
+
+inline void cUpdateProfiler::exitPhase()
+{
+  const long long now = cHighResTimer::Now();
+
+  if (m_overflow) {
+    m_overflow--;
+    return;
+  }
+
+  const Frame& frame = m_stack[--m_depth];
+  const long long elapsed = now - frame.start;
+
+  // Recursive entries into a phase that is already open only contribute self time, inclusive time is owned by the
+  // outermost entry
+  PhaseStats& stats = m_current[frame.phase];
+  if (--m_active[frame.phase] == 0) stats.inclusive_ns += elapsed;
+  stats.self_ns += elapsed - frame.child_ns;
+  stats.calls++;
+
+  if (m_depth) m_stack[m_depth - 1].child_ns += elapsed;
+  else if (frame.phase == PHASE_UPDATE) completeUpdate();
+}
+
+#endif
@@ -0,0 +1,159 @@
+/*
+ *  cUpdateSchedule.cc
+ *  Avida
+ *
+ *  Copyright 2026 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "cUpdateSchedule.h"
+
+#include "cMeritSchedule.h"
+
+
+cUpdateSchedule::cUpdateSchedule(cMeritSchedule& merits)
+  : m_merits(merits), m_active(false), m_run(0), m_used(0), m_undrawn(0), m_redraw(MIN_REDRAW)
+  , m_cell_slices(merits.GetSize())
+{
+  m_cell_slices.SetAll(0);
+}
+
+cUpdateSchedule::~cUpdateSchedule()
+{
+}
+
+
+void cUpdateSchedule::Begin(int num_slices)
+{
+  if (m_active) End();
+
+  m_active = true;
+  m_runs.Resize(0);
+  m_run = 0;
+  m_used = 0;
+  m_undrawn = (num_slices > 0) ? num_slices : 0;
+  m_redraw = MIN_REDRAW;
+
+  m_cur = sUpdateStats();
+  m_cur.slices = m_undrawn;
+
+  draw(m_undrawn);
+}
+
+
+void cUpdateSchedule::Invalidate()
+{
+  if (!m_active) return;
+  m_redraw = MIN_REDRAW;
+
+  // Keep the handed out part of the current run, drop everything after it
+  int keep = m_run;
+  int dropped = 0;
+  if (m_run < m_runs.GetSize() && m_used > 0) {
+    dropped += m_runs[m_run].count - m_used;
+    m_runs[m_run].count = m_used;
+    keep++;
+  }
+  for (int i = keep; i < m_runs.GetSize(); i++) dropped += m_runs[i].count;
+  m_runs.Resize(keep);
+
+  if (dropped == 0) return;
+  m_undrawn += dropped;
+  m_cur.discarded += dropped;
+  m_cur.invalidations++;
+}
+
+
+void cUpdateSchedule::End()
+{
+  if (!m_active) return;
+  m_active = false;
+
+  // Tally only the executed part of the schedule
+  for (int i = 0; i <= m_run && i < m_runs.GetSize(); i++) {
+    const int cell = m_runs[i].cell;
+    const int count = (i == m_run) ? m_used : m_runs[i].count;
+    if (cell < 0 || count == 0) continue;
+    if (m_cell_slices[cell] == 0) m_cells.Push(cell);
+    m_cell_slices[cell] += count;
+    m_cur.runs++;
+  }
+
+  m_cur.cells = m_cells.GetSize();
+  if (m_cur.cells > 0) {
+    double sum = 0.0;
+    double sum_sq = 0.0;
+    double rate_sum = 0.0;
+    double rate_sum_sq = 0.0;
+    int num_rates = 0;
+    for (int i = 0; i < m_cells.GetSize(); i++) {
+      const int slices = m_cell_slices[m_cells[i]];
+      sum += slices;
+      sum_sq += (double)slices * slices;
+      if (slices > m_cur.max_slices) m_cur.max_slices = slices;
+
+      // Merits are those at the end of the update, cells that have since emptied are left out
+      const double merit = m_merits.GetPriority(m_cells[i]);
+      if (merit > 0.0) {
+        const double rate = slices / merit;
+        rate_sum += rate;
+        rate_sum_sq += rate * rate;
+        num_rates++;
+      }
+      m_cell_slices[m_cells[i]] = 0;
+    }
+    m_cur.mean_slices = sum / m_cur.cells;
+    m_cur.var_slices = sum_sq / m_cur.cells - m_cur.mean_slices * m_cur.mean_slices;
+    if (rate_sum_sq > 0.0) m_cur.fairness = (rate_sum * rate_sum) / (num_rates * rate_sum_sq);
+  }
+  m_cells.Resize(0);
+
+  m_last = m_cur;
+  m_runs.Resize(0);
+  m_run = 0;
+  m_used = 0;
+  m_undrawn = 0;
+}
+
+
+void cUpdateSchedule::draw(int count)
+{
+  if (count <= 0) return;
+
+  // With no merit anywhere nothing can be drawn; the rest of the update is left to per-slice draws
+  if (m_merits.GetTotalPriority() <= 0.0) {
+    m_undrawn = 0;
+    return;
+  }
+
+  m_merits.Next(count, m_ids);
+  m_undrawn -= count;
+  m_cur.drawn += count;
+
+  // Consecutive draws of the same cell extend the last run, unless it has already been handed out
+  for (int i = 0; i < count; i++) {
+    const int cell = m_ids[i];
+    const int last = m_runs.GetSize() - 1;
+    if (last >= m_run && m_runs[last].cell == cell) {
+      m_runs[last].count++;
+    } else {
+      sRun run;
+      run.cell = cell;
+      run.count = 1;
+      m_runs.Push(run);
+    }
+  }
+}
@@ -0,0 +1,142 @@
+/*
+ *  cUpdateSchedule.h
+ *  Avida
+ *
+ *  Copyright 2026 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef cUpdateSchedule_h
+#define cUpdateSchedule_h
+
+#include "apto/core.h"
+
+class cMeritSchedule;
+
+
+// cUpdateSchedule - the order in which cells execute during one update, drawn ahead of time
+// --------------------------------------------------------------------------------------------------------------
+//
+//  Begin() draws every time slice of the update from the merit schedule in a single block and stores the result as
+//  (cell, count) runs of consecutive slices given to the same cell, in execution order.  Next() then walks the runs.
+//
+//  A merit change makes the slices that have not been handed out yet stale.  Invalidate() drops only that remainder;
+//  it is redrawn lazily with the merits in effect at that point, in blocks that start small and double while the
+//  merits stay unchanged, so a burst of births does not redraw the whole update each time.  Since the probabilistic
+//  draws are independent given the merits, the executed schedule has the same distribution as drawing one slice at a
+//  time, although the random number sequence differs once a remainder has been discarded.
+//
+//  When the total merit is zero, presampling stops for the rest of the update and Next() returns false, leaving the
+//  caller to draw single slices from the merit schedule.
+//
+//  End() closes the update and summarizes the slices that were actually executed.
+
+class cUpdateSchedule
+{
+public:
+  struct sRun
+  {
+    int cell;
+    int count;
+  };
+
+  struct sUpdateStats
+  {
+    int slices;               // Slices requested by Begin()
+    int executed;             // Slices handed out by Next()
+    int drawn;                // Slices drawn from the merit schedule, including discarded ones
+    int discarded;            // Drawn slices dropped by Invalidate()
+    int invalidations;        // Invalidate() calls that dropped slices
+    int runs;                 // Executed runs
+    int cells;                // Distinct cells executed
+    double mean_slices;       // Mean slices per executed cell
+    double var_slices;        // Variance of slices per executed cell
+    int max_slices;           // Most slices given to a single cell
+    double fairness;          // Jain's index of slices per unit merit over executed cells, 1 is perfectly fair
+
+    sUpdateStats() : slices(0), executed(0), drawn(0), discarded(0), invalidations(0), runs(0), cells(0)
+      , mean_slices(0.0), var_slices(0.0), max_slices(0), fairness(0.0) { ; }
+  };
+
+private:
+  static const int MIN_REDRAW = 64;
+
+  cMeritSchedule& m_merits;
+
+  bool m_active;
+  Apto::Array<sRun, Apto::Smart> m_runs;
+  int m_run;                    // Current run
+  int m_used;                   // Slices of the current run already handed out
+  int m_undrawn;                // Slices of the update not drawn yet
+  int m_redraw;                 // Size of the next lazy block
+
+  Apto::Array<int> m_ids;                       // Scratch for block draws
+  Apto::Array<int> m_cell_slices;               // Scratch for End(), indexed by cell
+  Apto::Array<int, Apto::Smart> m_cells;        // Cells touched in m_cell_slices
+
+  sUpdateStats m_cur;
+  sUpdateStats m_last;
+
+
+  cUpdateSchedule(); // @not_implemented
+  cUpdateSchedule(const cUpdateSchedule&); // @not_implemented
+  cUpdateSchedule& operator=(const cUpdateSchedule&); // @not_implemented
+
+public:
+  cUpdateSchedule(cMeritSchedule& merits);
+  ~cUpdateSchedule();
+
+  void Begin(int num_slices);
+  inline bool Next(int& cell);
+  void Invalidate();
+  void End();
+
+  bool IsActive() const { return m_active; }
+
+  // Runs of the current update, executed ones included; only the runs past the current position may still change
+  const Apto::Array<sRun, Apto::Smart>& GetRuns() const { return m_runs; }
+  int GetCurrentRun() const { return m_run; }
+
+  // Statistics of the last update closed by End()
+  const sUpdateStats& GetLastUpdateStats() const { return m_last; }
+
+private:
+  void draw(int count);
+};
+
+
+inline bool cUpdateSchedule::Next(int& cell)
+{
+  if (!m_active) return false;
+
+  while (m_run < m_runs.GetSize() && m_used == m_runs[m_run].count) {
+    m_run++;
+    m_used = 0;
+  }
+  if (m_run == m_runs.GetSize()) {
+    if (m_undrawn == 0) return false;
+    draw((m_redraw < m_undrawn) ? m_redraw : m_undrawn);
+    m_redraw *= 2;
+    if (m_run == m_runs.GetSize()) return false;
+  }
+
+  m_used++;
+  m_cur.executed++;
+  cell = m_runs[m_run].cell;
+  return true;
+}
+
+#endif
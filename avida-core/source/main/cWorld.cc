@@ -42,6 +42,7 @@
 #include "cPopulation.h"
 #include "cStats.h"
 #include "cTestCPU.h"
+#include "cUpdateProfiler.h"
 #include "cUserFeedback.h"
 
 #include <cassert>
@@ -51,7 +52,7 @@ using namespace AvidaTools;
 
 cWorld::cWorld(cAvidaConfig* cfg, const cString& wd)
   : m_working_dir(wd), m_analyze(NULL), m_conf(cfg), m_ctx(NULL)
-  , m_env(NULL), m_event_list(NULL), m_hw_mgr(NULL), m_pop(NULL), m_stats(NULL), m_mig_mat(NULL), m_driver(NULL), m_data_mgr(NULL)
+  , m_env(NULL), m_event_list(NULL), m_hw_mgr(NULL), m_pop(NULL), m_stats(NULL), m_profiler(NULL), m_mig_mat(NULL), m_driver(NULL), m_data_mgr(NULL)
   , m_own_driver(false)
 {
 }
@@ -114,7 +115,9 @@ bool cWorld::setup(World* new_world, cUserFeedback* feedback, const Apto::Map<Ap
     
     // Output Manager
     Apto::String opath = Apto::FileSystem::GetAbsolutePath(Apto::String(m_conf->DATA_DIR.Get()), Apto::String(m_working_dir));
-    Output::ManagerPtr(new Output::Manager(opath))->AttachTo(new_world);
+    Output::ManagerPtr output_mgr(new Output::Manager(opath));
+    output_mgr->SetAsyncFiles(m_conf->ASYNC_OUTPUT.Get());
+    output_mgr->AttachTo(new_world);
   }
   
 
@@ -151,6 +154,9 @@ bool cWorld::setup(World* new_world, cUserFeedback* feedback, const Apto::Map<Ap
   // Setup Stats Object
   m_stats = Apto::SmartPtr<cStats, Apto::InternalRCObject>(new cStats(this));
   Data::Manager::Of(m_new_world)->AttachRecorder(m_stats);
+  
+  // Setup Update Profiler (disabled until requested)
+  m_profiler = Apto::SmartPtr<cUpdateProfiler, Apto::InternalRCObject>(new cUpdateProfiler(this));
 
   
   // Initialize the hardware manager, loading all of the instruction sets
@@ -208,6 +214,13 @@ bool cWorld::setup(World* new_world, cUserFeedback* feedback, const Apto::Map<Ap
 Data::ProviderPtr cWorld::GetStatsProvider(World*) { return m_stats; }
 Data::ArgumentedProviderPtr cWorld::GetPopulationProvider(World*) { return m_pop; }
 
+Data::ProviderPtr cWorld::GetUpdateProfilerProvider(World*)
+{
+  // Activation of any of the profiling data turns on collection
+  m_profiler->Enable();
+  return m_profiler;
+}
+
 
 cAnalyze& cWorld::GetAnalyze()
 {
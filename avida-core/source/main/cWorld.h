@@ -44,6 +44,7 @@ class cMerit;
 class cPopulationCell;
 class cStats;
 class cTestCPU;
+class cUpdateProfiler;
 class cUserFeedback;
 template<class T> class tDataEntry;
 
@@ -64,6 +65,7 @@ protected:
   cHardwareManager* m_hw_mgr;
   Apto::SmartPtr<cPopulation, Apto::InternalRCObject> m_pop;
   Apto::SmartPtr<cStats, Apto::InternalRCObject> m_stats;
+  Apto::SmartPtr<cUpdateProfiler, Apto::InternalRCObject> m_profiler;
   cMigrationMatrix* m_mig_mat;  
   WorldDriver* m_driver;
   
@@ -97,6 +99,7 @@ public:
   cPopulation& GetPopulation() { return *m_pop; }
   Apto::Random& GetRandom() { return m_rng; }
   cStats& GetStats() { return *m_stats; }
+  cUpdateProfiler& GetUpdateProfiler() { return *m_profiler; }
   WorldDriver& GetDriver() { return *m_driver; }
   World* GetNewWorld() { return m_new_world; }
   
@@ -104,6 +107,7 @@ public:
   
   Data::ProviderPtr GetStatsProvider(World*);
   Data::ArgumentedProviderPtr GetPopulationProvider(World*);
+  Data::ProviderPtr GetUpdateProfilerProvider(World*);
   
   // Config Dependent Modes
   bool GetTestOnDivide() const { return m_test_on_div; }
@@ -27,6 +27,8 @@
 #include "avida/core/Feedback.h"
 #include "avida/output/Manager.h"
 
+#include "avida/private/output/FileBuffer.h"
+
 #include <ctime>
 
 
@@ -89,13 +91,26 @@ Avida::Output::FilePtr Avida::Output::File::StaticWithPath(World* world, Apto::S
 
 
 Avida::Output::File::File(World* world, const OutputID& name, bool append)
-  : Socket(world, name), m_descr_written(false), m_num_cols(0)
+  : Socket(world, name), m_descr_written(false), m_num_cols(0), m_async(NULL)
 {
   m_fp.open(name, (append) ? (std::ios::out | std::ios::app) : std::ios::out);
   assert(m_fp.good());
+  
+  // Redirect the stream through the asynchronous buffer; Write() values are formatted by its writer thread, while
+  // callers of OFStream() still format on this thread into the same ordered block
+  if (m_fp.good() && Manager::Of(world)->AsyncFiles()) {
+    m_async = new FileBuffer(m_fp.rdbuf());
+    m_fp.std::ios::rdbuf(m_async);
+  }
 }
 
-Avida::Output::File::~File() { ; }
+Avida::Output::File::~File()
+{
+  if (m_async) {
+    m_fp.std::ios::rdbuf(m_fp.rdbuf());
+    delete m_async;
+  }
+}
 
 
 
@@ -104,6 +119,8 @@ void Avida::Output::File::Write(double x, const char* descr, const char* format)
   if (!m_descr_written) {
     m_data << x << " ";
     WriteColumnDesc(descr, format);
+  } else if (m_async && FileBuffer::CanPut(m_fp)) {
+    m_async->Put(x);
   } else {
     m_fp << x << " ";
   }
@@ -115,6 +132,8 @@ void Avida::Output::File::Write(int i, const char* descr, const char* format)
   if (!m_descr_written) {
     m_data << i << " ";
     WriteColumnDesc(descr, format);
+  } else if (m_async && FileBuffer::CanPut(m_fp)) {
+    m_async->Put(i);
   } else {
     m_fp << i << " ";
   }
@@ -126,6 +145,8 @@ void Avida::Output::File::Write(long i, const char* descr, const char* format)
   if (!m_descr_written) {
     m_data << i << " ";
     WriteColumnDesc(descr, format);
+  } else if (m_async && FileBuffer::CanPut(m_fp)) {
+    m_async->Put(i);
   } else {
     m_fp << i << " ";
   }
@@ -136,6 +157,8 @@ void Avida::Output::File::Write(unsigned int i, const char* descr, const char*)
   if (!m_descr_written) {
     m_data << i << " ";
     WriteColumnDesc(descr);
+  } else if (m_async && FileBuffer::CanPut(m_fp)) {
+    m_async->Put(i);
   } else {
     m_fp << i << " ";
   }
@@ -152,7 +175,7 @@ void Avida::Output::File::Write(const char* data_str, const char* descr, const c
   }
 }
 
-void Avida::Output::File::Write(Apto::Array<int> list, const char* descr, const char* format)
+void Avida::Output::File::Write(const Apto::Array<int>& list, const char* descr, const char* format)
 {
   //Anya is trying to make a commant to write vectors for Kaboom data
   if (!m_descr_written) {
@@ -161,22 +184,39 @@ void Avida::Output::File::Write(Apto::Array<int> list, const char* descr, const
     }
     WriteColumnDesc(descr, format);
   } else {
-    for (int i =0; i < (int)list.GetSize(); i++) {
-      m_fp << list[i] << " ";
-    }
+    for (int i =0; i < (int)list.GetSize(); i++) WriteAnonymous(list[i]);
   }
 }
 
 
+void Avida::Output::File::WriteAnonymous(double x)
+{
+  if (m_async && FileBuffer::CanPut(m_fp)) m_async->Put(x);
+  else m_fp << x << " ";
+}
+
+void Avida::Output::File::WriteAnonymous(int i)
+{
+  if (m_async && FileBuffer::CanPut(m_fp)) m_async->Put(i);
+  else m_fp << i << " ";
+}
+
+void Avida::Output::File::WriteAnonymous(long i)
+{
+  if (m_async && FileBuffer::CanPut(m_fp)) m_async->Put(i);
+  else m_fp << i << " ";
+}
+
+
 void Avida::Output::File::WriteBlockElement(double x, int element, int x_size)
 {
-  m_fp << x << " ";
+  WriteAnonymous(x);
   if (((element + 1) % x_size) == 0) m_fp << "\n";
 }
 
 void Avida::Output::File::WriteBlockElement(int i, int element, int x_size)
 {
-  m_fp << i << " ";
+  WriteAnonymous(i);
   if (((element + 1) % x_size) == 0) m_fp << "\n";
 }
 
@@ -255,4 +295,5 @@ void Avida::Output::File::Endl()
 void Avida::Output::File::Flush()
 {
   m_fp.flush();
+  if (m_async) m_async->Flush();
 }
@@ -0,0 +1,315 @@
+/*
+ *  output/FileBuffer.cc
+ *  avida-core
+ *
+ *  Copyright 2026 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "avida/private/output/FileBuffer.h"
+
+#include "apto/core.h"
+#include "apto/core/Thread.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <fstream>
+#include <ostream>
+#include <set>
+
+
+namespace {
+  const int BLOCK_SIZE = 64 * 1024;
+  const int MAX_QUEUED_BLOCKS = 256;
+
+  // Block records: a type byte, followed by either a text run (int length, then the text) or the raw bytes of a value
+  enum RecordType { RECORD_TEXT = 0, RECORD_INT, RECORD_LONG, RECORD_UINT, RECORD_DOUBLE };
+  const int RUN_HEADER_SIZE = 1 + sizeof(int);
+
+
+  template<typename T> inline T readValue(const char* data, int& pos)
+  {
+    T value;
+    memcpy(&value, data + pos, sizeof(T));
+    pos += sizeof(T);
+    return value;
+  }
+
+
+  // Formats the typed records of a block with a default formatted stream, so they match what File would have written
+  void writeBlock(std::filebuf* sink, const std::vector<char>& block)
+  {
+    std::ostream out(sink);
+    const char* data = &block[0];
+    const int size = static_cast<int>(block.size());
+    int pos = 0;
+    while (pos < size) {
+      switch (data[pos++]) {
+        case RECORD_TEXT:
+        {
+          const int length = readValue<int>(data, pos);
+          sink->sputn(data + pos, length);
+          pos += length;
+          break;
+        }
+        case RECORD_INT:    out << readValue<int>(data, pos) << " "; break;
+        case RECORD_LONG:   out << readValue<long>(data, pos) << " "; break;
+        case RECORD_UINT:   out << readValue<unsigned int>(data, pos) << " "; break;
+        case RECORD_DOUBLE: out << readValue<double>(data, pos) << " "; break;
+      }
+    }
+  }
+
+
+  // Writer - the background thread shared by all file buffers, copies queued blocks into their files in order
+  class Writer : public Apto::Thread
+  {
+  private:
+    struct Entry
+    {
+      std::filebuf* sink;
+      std::vector<char>* block;
+      bool flush;
+
+      Entry(std::filebuf* in_sink, std::vector<char>* in_block, bool in_flush)
+        : sink(in_sink), block(in_block), flush(in_flush) { ; }
+    };
+
+    Apto::Mutex m_mutex;
+    Apto::ConditionVariable m_work_cond;
+    Apto::ConditionVariable m_done_cond;
+
+    std::deque<Entry> m_queue;
+    std::filebuf* m_active;
+    bool m_shutdown;
+
+  public:
+    Writer() : m_active(NULL), m_shutdown(false) { ; }
+
+    void Submit(std::filebuf* sink, std::vector<char>* block, bool flush)
+    {
+      m_mutex.Lock();
+      while (static_cast<int>(m_queue.size()) >= MAX_QUEUED_BLOCKS) m_done_cond.Wait(m_mutex);
+      m_queue.push_back(Entry(sink, block, flush));
+      m_mutex.Unlock();
+      m_work_cond.Signal();
+    }
+
+    // Blocks until every entry queued for sink has been written
+    void Wait(std::filebuf* sink)
+    {
+      m_mutex.Lock();
+      while (isPending(sink)) m_done_cond.Wait(m_mutex);
+      m_mutex.Unlock();
+    }
+
+    void Stop()
+    {
+      m_mutex.Lock();
+      m_shutdown = true;
+      m_mutex.Unlock();
+      m_work_cond.Signal();
+      Join();
+    }
+
+  protected:
+    void Run()
+    {
+      m_mutex.Lock();
+      while (true) {
+        while (m_queue.empty() && !m_shutdown) m_work_cond.Wait(m_mutex);
+        if (m_queue.empty()) break;
+
+        Entry entry = m_queue.front();
+        m_queue.pop_front();
+        m_active = entry.sink;
+        m_mutex.Unlock();
+
+        if (entry.block) {
+          writeBlock(entry.sink, *entry.block);
+          delete entry.block;
+        }
+        if (entry.flush) entry.sink->pubsync();
+
+        m_mutex.Lock();
+        m_active = NULL;
+        m_done_cond.Broadcast();
+      }
+      m_mutex.Unlock();
+    }
+
+  private:
+    bool isPending(std::filebuf* sink) const
+    {
+      if (m_active == sink) return true;
+      for (std::deque<Entry>::const_iterator it = m_queue.begin(); it != m_queue.end(); it++) {
+        if (it->sink == sink) return true;
+      }
+      return false;
+    }
+  };
+
+
+  Apto::Mutex s_writer_mutex;
+  Writer* s_writer = NULL;
+  bool s_atexit_registered = false;
+  std::set<Avida::Output::FileBuffer*> s_buffers;
+
+
+  // Files still open when exit() is called would otherwise lose their buffered output
+  void flushAtExit()
+  {
+    Apto::MutexAutoLock lock(s_writer_mutex);
+    for (std::set<Avida::Output::FileBuffer*>::iterator it = s_buffers.begin(); it != s_buffers.end(); it++) {
+      (*it)->Flush();
+    }
+  }
+}
+
+
+Avida::Output::FileBuffer::FileBuffer(std::filebuf* sink)
+  : m_sink(sink), m_block(new std::vector<char>(BLOCK_SIZE)), m_used(0), m_run(0)
+{
+  openRun();
+
+  Apto::MutexAutoLock lock(s_writer_mutex);
+  if (!s_writer) {
+    s_writer = new Writer;
+    s_writer->Start();
+  }
+  if (!s_atexit_registered) {
+    atexit(flushAtExit);
+    s_atexit_registered = true;
+  }
+  s_buffers.insert(this);
+}
+
+
+Avida::Output::FileBuffer::~FileBuffer()
+{
+  Flush();
+  delete m_block;
+
+  Apto::MutexAutoLock lock(s_writer_mutex);
+  s_buffers.erase(this);
+  if (s_buffers.empty()) {
+    s_writer->Stop();
+    delete s_writer;
+    s_writer = NULL;
+  }
+}
+
+
+void Avida::Output::FileBuffer::Flush()
+{
+  submitBlock(true);
+  s_writer->Wait(m_sink);
+}
+
+
+bool Avida::Output::FileBuffer::CanPut(const std::ios& stream)
+{
+  return stream.good() && stream.flags() == (std::ios::skipws | std::ios::dec) && stream.precision() == 6 &&
+    stream.width() == 0;
+}
+
+
+void Avida::Output::FileBuffer::Put(int i) { putRecord(RECORD_INT, &i, sizeof(i)); }
+void Avida::Output::FileBuffer::Put(long i) { putRecord(RECORD_LONG, &i, sizeof(i)); }
+void Avida::Output::FileBuffer::Put(unsigned int i) { putRecord(RECORD_UINT, &i, sizeof(i)); }
+void Avida::Output::FileBuffer::Put(double x) { putRecord(RECORD_DOUBLE, &x, sizeof(x)); }
+
+
+Avida::Output::FileBuffer::int_type Avida::Output::FileBuffer::overflow(int_type c)
+{
+  submitBlock(false);
+
+  if (traits_type::eq_int_type(c, traits_type::eof())) return traits_type::not_eof(c);
+
+  *pptr() = traits_type::to_char_type(c);
+  pbump(1);
+  return c;
+}
+
+
+int Avida::Output::FileBuffer::sync()
+{
+  // Stream flushes are deferred until Flush()
+  return 0;
+}
+
+
+void Avida::Output::FileBuffer::submitBlock(bool flush)
+{
+  closeRun();
+  if (m_used == 0 && !flush) {
+    openRun();
+    return;
+  }
+
+  if (m_used > 0) {
+    m_block->resize(m_used);
+    s_writer->Submit(m_sink, m_block, flush);
+    m_block = new std::vector<char>(BLOCK_SIZE);
+    m_used = 0;
+  } else {
+    s_writer->Submit(m_sink, NULL, flush);
+  }
+  openRun();
+}
+
+
+void Avida::Output::FileBuffer::putRecord(char type, const void* value, int size)
+{
+  closeRun();
+  // Leave room for the record and at least one byte of the text run that follows it
+  if (m_used + 1 + size + RUN_HEADER_SIZE + 1 > BLOCK_SIZE) {
+    submitBlock(false);
+    closeRun();
+  }
+
+  char* data = &(*m_block)[0];
+  data[m_used] = type;
+  memcpy(data + m_used + 1, value, size);
+  m_used += 1 + size;
+  openRun();
+}
+
+
+// Starts a new text run after the completed records, the put area is the rest of the block
+void Avida::Output::FileBuffer::openRun()
+{
+  m_run = m_used;
+  char* data = &(*m_block)[0];
+  setp(data + m_run + RUN_HEADER_SIZE, data + BLOCK_SIZE);
+}
+
+
+// Completes the current text run, dropping its header if nothing was written to it
+void Avida::Output::FileBuffer::closeRun()
+{
+  char* data = &(*m_block)[0];
+  const int length = static_cast<int>(pptr() - (data + m_run + RUN_HEADER_SIZE));
+  if (length > 0) {
+    data[m_run] = RECORD_TEXT;
+    memcpy(data + m_run + 1, &length, sizeof(length));
+    m_used = m_run + RUN_HEADER_SIZE + length;
+  } else {
+    m_used = m_run;
+  }
+  setp(data + m_used, data + m_used);
+}
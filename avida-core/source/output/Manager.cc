@@ -26,7 +26,7 @@
 
 #include "avida/output/Socket.h"
 
-Avida::Output::Manager::Manager(const Apto::String& output_path) : m_world(NULL)
+Avida::Output::Manager::Manager(const Apto::String& output_path) : m_world(NULL), m_async_files(false)
 {
   m_output_path = output_path;
   m_output_path.Trim();
@@ -0,0 +1,240 @@
+/*
+ *  output/SeriesFile.cc
+ *  avida-core
+ *
+ *  Copyright 2026 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "avida/output/SeriesFile.h"
+
+#include "avida/core/Feedback.h"
+#include "avida/output/Manager.h"
+
+#include "avida/private/output/SeriesFormat.h"
+
+#include <cassert>
+
+using namespace Avida::Output::SeriesFormat;
+
+
+Avida::Output::SeriesFilePtr Avida::Output::SeriesFile::CreateWithPath(World* world, Apto::String path, Feedback* feedback,
+                                                                     int chunk_rows)
+{
+  Output::ManagerPtr mgr = Output::Manager::Of(world);
+  OutputID oid = mgr->OutputIDFromPath(path);
+  
+  if (oid.GetSize() == 0) {
+    if (feedback) feedback->Error("unable to translate path '%s' to output id", (const char*)path);
+    return SeriesFilePtr(NULL);
+  }
+  
+  if (mgr->IsOpen(oid)) {
+    if (feedback) feedback->Error("file '%s' already open", (const char*)oid);
+    return SeriesFilePtr(NULL);
+  }
+  
+  SeriesFilePtr rtn(new SeriesFile(world, oid, (chunk_rows > 0) ? chunk_rows : DEFAULT_CHUNK_ROWS));
+  
+  if (!rtn->Good()) {
+    if (feedback) feedback->Error("unable to open file '%s' for writing", (const char*)oid);
+    return SeriesFilePtr(NULL);
+  }
+  
+  return rtn;
+}
+
+
+Avida::Output::SeriesFile::SeriesFile(World* world, const OutputID& output_id, int chunk_rows)
+  : Socket(world, output_id), m_chunk_rows(chunk_rows), m_header_written(false), m_first_update(0), m_last_update(0)
+  , m_num_rows(0), m_row_open(false)
+{
+  m_fp.open(output_id, std::ios::out | std::ios::binary);
+}
+
+Avida::Output::SeriesFile::~SeriesFile()
+{
+  if (m_row_open) EndRow();
+  if (m_fp.good()) {
+    if (!m_header_written) writeHeader();
+    writeChunk();
+    writeIndex();
+  }
+  m_fp.close();
+}
+
+
+int Avida::Output::SeriesFile::AddColumn(const Apto::String& name, SeriesColumnType type)
+{
+  assert(!m_header_written);
+  if (m_header_written) return -1;
+  
+  Column column;
+  column.name = name;
+  column.type = type;
+  column.last_int = 0;
+  column.last_bits = 0;
+  column.is_set = false;
+  m_columns.Push(column);
+  return m_columns.GetSize() - 1;
+}
+
+
+void Avida::Output::SeriesFile::BeginRow(Update update)
+{
+  if (m_row_open) EndRow();
+  if (!m_header_written) writeHeader();
+  
+  assert(m_num_rows == 0 || update >= m_last_update);
+  if (m_num_rows == 0) m_first_update = m_last_update = update;
+  PutVarint(m_updates, ZigZag(static_cast<long long>(update) - m_last_update));
+  m_last_update = update;
+  m_row_open = true;
+}
+
+
+void Avida::Output::SeriesFile::SetValue(int column, int value)
+{
+  assert(m_row_open && column >= 0 && column < m_columns.GetSize());
+  Column& col = m_columns[column];
+  if (col.is_set) return;
+  
+  if (col.type == SERIES_INT) putInt(col, value);
+  else putBits(col, DoubleBits(value));
+  col.is_set = true;
+}
+
+
+void Avida::Output::SeriesFile::SetValue(int column, double value)
+{
+  assert(m_row_open && column >= 0 && column < m_columns.GetSize());
+  Column& col = m_columns[column];
+  if (col.is_set) return;
+  
+  if (col.type == SERIES_DOUBLE) putBits(col, DoubleBits(value));
+  else putInt(col, static_cast<long long>(value));
+  col.is_set = true;
+}
+
+
+void Avida::Output::SeriesFile::EndRow()
+{
+  if (!m_row_open) return;
+  
+  // Unset columns repeat their previous value, also across the start of a chunk
+  for (int i = 0; i < m_columns.GetSize(); i++) {
+    Column& col = m_columns[i];
+    if (!col.is_set) {
+      if (col.type == SERIES_INT) putInt(col, col.last_int);
+      else putBits(col, col.last_bits);
+    }
+    col.is_set = false;
+  }
+  m_row_open = false;
+  
+  if (++m_num_rows >= m_chunk_rows) writeChunk();
+}
+
+
+void Avida::Output::SeriesFile::Flush()
+{
+  if (m_row_open || !m_fp.good()) return;
+  
+  if (!m_header_written) writeHeader();
+  writeChunk();
+  m_fp.flush();
+}
+
+
+// Values are encoded against the previous row, or against zero in the first row of a chunk
+void Avida::Output::SeriesFile::putInt(Column& col, long long value)
+{
+  PutVarint(col.data, ZigZag(value - ((m_num_rows) ? col.last_int : 0)));
+  col.last_int = value;
+}
+
+
+void Avida::Output::SeriesFile::putBits(Column& col, unsigned long long bits)
+{
+  PutVarint(col.data, bits ^ ((m_num_rows) ? col.last_bits : 0));
+  col.last_bits = bits;
+}
+
+
+void Avida::Output::SeriesFile::writeHeader()
+{
+  Bytes header(HEADER_MAGIC, HEADER_MAGIC + 4);
+  PutU32(header, VERSION);
+  PutU32(header, m_columns.GetSize());
+  for (int i = 0; i < m_columns.GetSize(); i++) {
+    header.push_back(static_cast<unsigned char>(m_columns[i].type));
+    PutU32(header, m_columns[i].name.GetSize());
+    header.insert(header.end(), (const char*)m_columns[i].name, (const char*)m_columns[i].name + m_columns[i].name.GetSize());
+  }
+  m_fp.write(reinterpret_cast<const char*>(&header[0]), header.size());
+  m_header_written = true;
+}
+
+
+void Avida::Output::SeriesFile::writeChunk()
+{
+  if (m_num_rows == 0) return;
+  
+  ChunkEntry entry;
+  entry.offset = static_cast<unsigned long long>(m_fp.tellp());
+  entry.num_rows = m_num_rows;
+  entry.first_update = m_first_update;
+  entry.last_update = m_last_update;
+  m_index.Push(entry);
+  
+  Bytes payload;
+  payload.swap(m_updates);
+  for (int i = 0; i < m_columns.GetSize(); i++) {
+    PutU32(payload, static_cast<unsigned int>(m_columns[i].data.size()));
+    payload.insert(payload.end(), m_columns[i].data.begin(), m_columns[i].data.end());
+    m_columns[i].data.clear();
+  }
+  
+  Bytes header(CHUNK_MAGIC, CHUNK_MAGIC + 4);
+  PutU32(header, m_num_rows);
+  PutU32(header, static_cast<unsigned int>(m_first_update));
+  PutU32(header, static_cast<unsigned int>(m_last_update));
+  PutU32(header, static_cast<unsigned int>(payload.size()));
+  m_fp.write(reinterpret_cast<const char*>(&header[0]), header.size());
+  m_fp.write(reinterpret_cast<const char*>(&payload[0]), payload.size());
+  
+  // Each chunk decodes on its own, starting from zero
+  m_updates.clear();
+  m_num_rows = 0;
+}
+
+
+void Avida::Output::SeriesFile::writeIndex()
+{
+  const unsigned long long index_offset = static_cast<unsigned long long>(m_fp.tellp());
+  
+  Bytes index(INDEX_MAGIC, INDEX_MAGIC + 4);
+  PutU32(index, m_index.GetSize());
+  for (int i = 0; i < m_index.GetSize(); i++) {
+    PutU64(index, m_index[i].offset);
+    PutU32(index, m_index[i].num_rows);
+    PutU32(index, static_cast<unsigned int>(m_index[i].first_update));
+    PutU32(index, static_cast<unsigned int>(m_index[i].last_update));
+  }
+  PutU64(index, index_offset);
+  index.insert(index.end(), TRAILER_MAGIC, TRAILER_MAGIC + 4);
+  m_fp.write(reinterpret_cast<const char*>(&index[0]), index.size());
+}
@@ -0,0 +1,291 @@
+/*
+ *  output/SeriesReader.cc
+ *  avida-core
+ *
+ *  Copyright 2026 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "avida/output/SeriesReader.h"
+
+#include "apto/platform.h"
+
+#include "avida/private/output/SeriesFormat.h"
+
+#include <cstdio>
+#include <fstream>
+
+#if !APTO_PLATFORM(WINDOWS)
+# include <fcntl.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <unistd.h>
+#endif
+
+using namespace Avida::Output::SeriesFormat;
+
+
+Avida::Output::SeriesReader::SeriesReader() : m_data(NULL), m_size(0), m_mapping(NULL), m_buffer(NULL), m_num_rows(0)
+{
+}
+
+Avida::Output::SeriesReader::~SeriesReader()
+{
+  Close();
+}
+
+
+bool Avida::Output::SeriesReader::Open(const Apto::String& path)
+{
+  Close();
+  if (!mapFile(path)) return false;
+  
+  Cursor cur(m_data, m_data + m_size);
+  cur.Magic(HEADER_MAGIC);
+  if (cur.U32() != VERSION) {
+    Close();
+    return false;
+  }
+  
+  const unsigned int num_columns = cur.U32();
+  for (unsigned int i = 0; cur.Ok() && i < num_columns; i++) {
+    Column column;
+    column.type = static_cast<SeriesColumnType>(cur.Fixed(1));
+    const unsigned int name_size = cur.U32();
+    const char* name = reinterpret_cast<const char*>(cur.Position());
+    if (cur.Skip(name_size)) column.name = Apto::String(name, name_size);
+    m_columns.Push(column);
+  }
+  
+  // An interrupted run leaves no index, the chunks themselves still describe the series
+  if (!cur.Ok() || (!readIndex() && !scanChunks(cur.Position() - m_data))) {
+    Close();
+    return false;
+  }
+  
+  for (int i = 0; i < m_chunks.GetSize(); i++) m_num_rows += m_chunks[i].num_rows;
+  return true;
+}
+
+
+void Avida::Output::SeriesReader::Close()
+{
+#if !APTO_PLATFORM(WINDOWS)
+  if (m_mapping != NULL) munmap(m_mapping, m_size);
+#endif
+  m_mapping = NULL;
+  delete [] m_buffer;
+  m_buffer = NULL;
+  m_data = NULL;
+  m_size = 0;
+  
+  m_columns.Resize(0);
+  m_chunks.Resize(0);
+  m_num_rows = 0;
+}
+
+
+int Avida::Output::SeriesReader::FindChunk(Update update) const
+{
+  int lo = 0;
+  int hi = m_chunks.GetSize();
+  while (lo < hi) {
+    const int mid = (lo + hi) / 2;
+    if (m_chunks[mid].last_update < update) lo = mid + 1;
+    else hi = mid;
+  }
+  return (lo < m_chunks.GetSize()) ? lo : -1;
+}
+
+
+bool Avida::Output::SeriesReader::ReadUpdates(int chunk, Apto::Array<Update>& updates) const
+{
+  const Chunk& info = m_chunks[chunk];
+  Cursor cur(m_data + info.offset + CHUNK_HEADER_SIZE, m_data + m_size);
+  
+  updates.Resize(info.num_rows);
+  long long update = info.first_update;
+  for (int i = 0; i < info.num_rows; i++) {
+    update += UnZigZag(cur.Varint());
+    updates[i] = static_cast<Update>(update);
+  }
+  return cur.Ok();
+}
+
+
+bool Avida::Output::SeriesReader::ReadColumn(int chunk, int column, Apto::Array<double>& values) const
+{
+  size_t size = 0;
+  const unsigned char* data = columnData(chunk, column, size);
+  if (data == NULL) return false;
+  
+  Cursor cur(data, data + size);
+  const int num_rows = m_chunks[chunk].num_rows;
+  values.Resize(num_rows);
+  if (m_columns[column].type == SERIES_INT) {
+    long long value = 0;
+    for (int i = 0; i < num_rows; i++) {
+      value += UnZigZag(cur.Varint());
+      values[i] = static_cast<double>(value);
+    }
+  } else {
+    unsigned long long bits = 0;
+    for (int i = 0; i < num_rows; i++) {
+      bits ^= cur.Varint();
+      values[i] = BitsDouble(bits);
+    }
+  }
+  return cur.Ok();
+}
+
+
+bool Avida::Output::SeriesReader::ExportDat(const Apto::String& path) const
+{
+  std::ofstream fp(path, std::ios::out);
+  if (!fp.good()) return false;
+  
+  fp << "# Avida data series" << std::endl;
+  fp << (const char*)Apto::FormatStr("# %2d: %s", 1, "Update") << std::endl;
+  for (int i = 0; i < m_columns.GetSize(); i++) {
+    fp << (const char*)Apto::FormatStr("# %2d: %s", i + 2, (const char*)m_columns[i].name) << std::endl;
+  }
+  fp << std::endl;
+  
+  Apto::Array<Update> updates;
+  Apto::Array<Apto::Array<double>, Apto::Smart> columns(m_columns.GetSize());
+  for (int chunk = 0; chunk < m_chunks.GetSize(); chunk++) {
+    if (!ReadUpdates(chunk, updates)) return false;
+    for (int i = 0; i < m_columns.GetSize(); i++) if (!ReadColumn(chunk, i, columns[i])) return false;
+    
+    for (int row = 0; row < updates.GetSize(); row++) {
+      fp << updates[row] << " ";
+      for (int i = 0; i < m_columns.GetSize(); i++) {
+        if (m_columns[i].type == SERIES_INT) fp << static_cast<long long>(columns[i][row]) << " ";
+        else fp << columns[i][row] << " ";
+      }
+      fp << std::endl;
+    }
+  }
+  
+  return fp.good();
+}
+
+
+bool Avida::Output::SeriesReader::mapFile(const Apto::String& path)
+{
+#if !APTO_PLATFORM(WINDOWS)
+  int fd = open(path, O_RDONLY);
+  if (fd < 0) return false;
+  
+  struct stat file_stat;
+  if (fstat(fd, &file_stat) != 0 || file_stat.st_size == 0) {
+    close(fd);
+    return false;
+  }
+  
+  m_size = static_cast<size_t>(file_stat.st_size);
+  void* mapping = mmap(NULL, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (mapping != MAP_FAILED) {
+    m_mapping = mapping;
+    m_data = static_cast<const unsigned char*>(mapping);
+    return true;
+  }
+#endif
+  
+  // Mapping is unavailable, read the whole file instead
+  FILE* fp = fopen(path, "rb");
+  if (fp == NULL) return false;
+  
+  fseek(fp, 0, SEEK_END);
+  long file_size = ftell(fp);
+  fseek(fp, 0, SEEK_SET);
+  if (file_size <= 0) {
+    fclose(fp);
+    return false;
+  }
+  
+  m_size = static_cast<size_t>(file_size);
+  m_buffer = new unsigned char[m_size];
+  const bool success = (fread(m_buffer, 1, m_size, fp) == m_size);
+  fclose(fp);
+  m_data = m_buffer;
+  return success;
+}
+
+
+bool Avida::Output::SeriesReader::readIndex()
+{
+  if (m_size < static_cast<size_t>(TRAILER_SIZE)) return false;
+  
+  Cursor trailer(m_data + m_size - TRAILER_SIZE, m_data + m_size);
+  const unsigned long long index_offset = trailer.U64();
+  if (!trailer.Magic(TRAILER_MAGIC) || index_offset >= m_size) return false;
+  
+  Cursor cur(m_data + index_offset, m_data + m_size - TRAILER_SIZE);
+  cur.Magic(INDEX_MAGIC);
+  const unsigned int num_chunks = cur.U32();
+  if (!cur.Ok() || cur.Remaining() != static_cast<size_t>(num_chunks) * INDEX_ENTRY_SIZE) return false;
+  
+  m_chunks.Resize(num_chunks);
+  for (unsigned int i = 0; i < num_chunks; i++) {
+    m_chunks[i].offset = static_cast<size_t>(cur.U64());
+    m_chunks[i].num_rows = static_cast<int>(cur.U32());
+    m_chunks[i].first_update = cur.I32();
+    m_chunks[i].last_update = cur.I32();
+    if (m_chunks[i].offset + CHUNK_HEADER_SIZE > index_offset) {
+      m_chunks.Resize(0);
+      return false;
+    }
+  }
+  return true;
+}
+
+
+bool Avida::Output::SeriesReader::scanChunks(size_t offset)
+{
+  m_chunks.Resize(0);
+  
+  // Stop at the first incomplete chunk, the run was interrupted while writing it
+  Cursor cur(m_data + offset, m_data + m_size);
+  while (cur.Remaining() >= static_cast<size_t>(CHUNK_HEADER_SIZE)) {
+    Chunk chunk;
+    chunk.offset = cur.Position() - m_data;
+    if (!cur.Magic(CHUNK_MAGIC)) break;
+    chunk.num_rows = static_cast<int>(cur.U32());
+    chunk.first_update = cur.I32();
+    chunk.last_update = cur.I32();
+    if (!cur.Skip(cur.U32())) break;
+    m_chunks.Push(chunk);
+  }
+  return true;
+}
+
+
+const unsigned char* Avida::Output::SeriesReader::columnData(int chunk, int column, size_t& size) const
+{
+  const Chunk& info = m_chunks[chunk];
+  Cursor cur(m_data + info.offset + CHUNK_HEADER_SIZE, m_data + m_size);
+  
+  // The update column has no size prefix, so its values are stepped over
+  for (int i = 0; i < info.num_rows; i++) cur.Varint();
+  for (int i = 0; i < column; i++) cur.Skip(cur.U32());
+  
+  size = cur.U32();
+  const unsigned char* data = cur.Position();
+  if (!cur.Skip(size)) return NULL;
+  return data;
+}
@@ -0,0 +1,179 @@
+/*
+ *  cASBytecode.h
+ *  Avida
+ *
+ *  Copyright 2026 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef cASBytecode_h
+#define cASBytecode_h
+
+#include "AvidaScript.h"
+
+#include "cString.h"
+
+class cASFilePosition;
+class cASFunction;
+class cSymbolTable;
+
+
+// cASBytecode - register bytecode for AvidaScript, produced by cBytecodeCompileASTVisitor
+// --------------------------------------------------------------------------------------------------------------
+//
+//  Every function runs in its own register frame.  The first registers of a frame hold the variables of the function
+//  symbol table (indexed by variable id), the remaining ones are temporaries.  Function 0 is the top level script, so
+//  its variables are the globals, which other functions reach through LOAD_GLOBAL and STORE_GLOBAL.
+//
+//  Registers are typed statically by the compiler: the typed opcodes (ADD_INT, LT_FLOAT, ...) read and write the
+//  values without checking their tags, and only the CAST and *_ANY opcodes look at the runtime type.  Bool and char
+//  values are kept in the int slot of a register, normalized as (bool) and (char) would.
+
+enum eASOpcode {
+  AS_OP_NOP = 0,
+
+  // Loads and moves                      a           b             c           aux
+  AS_OP_LOAD_BOOL,                     // dst         value
+  AS_OP_LOAD_CHAR,                     // dst         value
+  AS_OP_LOAD_INT,                      // dst         value
+  AS_OP_LOAD_FLOAT,                    // dst         float const
+  AS_OP_LOAD_STRING,                   // dst         string const
+  AS_OP_MOVE,                          // dst         src                                   bool, char, int and float
+  AS_OP_MOVE_STRING,                   // dst         src                                   copies the string
+  AS_OP_MOVE_OBJECT,                   // dst         src                                   adds a reference
+  AS_OP_MOVE_ANY,                      // dst         src                                   dispatches on the tag
+  AS_OP_LOAD_GLOBAL,                   // dst         global var
+  AS_OP_STORE_GLOBAL,                  // global var  src
+  AS_OP_CLEAR,                         // reg                                               releases a temporary
+
+  // Conversions
+  AS_OP_INT_TO_FLOAT,                  // dst         src
+  AS_OP_CAST,                          // dst         src           type info   target type
+
+  // Integer arithmetic (also used for chars, followed by a CAST to char)
+  AS_OP_ADD_INT,                       // dst         lhs           rhs
+  AS_OP_SUB_INT,
+  AS_OP_MUL_INT,
+  AS_OP_DIV_INT,
+  AS_OP_MOD_INT,
+  AS_OP_ADDI_INT,                      // dst         src           value
+  AS_OP_NEG_INT,                       // dst         src
+  AS_OP_BIT_NOT_INT,                   // dst         src
+  AS_OP_BIT_AND_INT,                   // dst         lhs           rhs
+  AS_OP_BIT_OR_INT,
+  AS_OP_EQ_INT,                        // dst         lhs           rhs                     result is a bool
+  AS_OP_NE_INT,
+  AS_OP_LT_INT,
+  AS_OP_LE_INT,
+  AS_OP_GT_INT,
+  AS_OP_GE_INT,
+
+  // Float arithmetic
+  AS_OP_ADD_FLOAT,                     // dst         lhs           rhs
+  AS_OP_SUB_FLOAT,
+  AS_OP_MUL_FLOAT,
+  AS_OP_DIV_FLOAT,
+  AS_OP_MOD_FLOAT,
+  AS_OP_NEG_FLOAT,                     // dst         src
+  AS_OP_EQ_FLOAT,                      // dst         lhs           rhs                     result is a bool
+  AS_OP_NE_FLOAT,
+  AS_OP_LT_FLOAT,
+  AS_OP_LE_FLOAT,
+  AS_OP_GT_FLOAT,
+  AS_OP_GE_FLOAT,
+
+  // Bool and string operations
+  AS_OP_NOT_BOOL,                      // dst         src
+  AS_OP_AND_BOOL,                      // dst         lhs           rhs
+  AS_OP_OR_BOOL,
+  AS_OP_EQ_BOOL,
+  AS_OP_NE_BOOL,
+  AS_OP_ADD_STRING,                    // dst         lhs           rhs
+  AS_OP_EQ_STRING,
+  AS_OP_NE_STRING,
+
+  // Operations on values whose type is only known at runtime
+  AS_OP_BINARY_ANY,                    // dst         lhs           rhs         token
+  AS_OP_NEG_ANY,                       // dst         src
+  AS_OP_BIT_NOT_ANY,                   // dst         src
+
+  // Control flow
+  AS_OP_JUMP,                          //             target
+  AS_OP_JUMP_FALSE,                    // cond        target
+  AS_OP_JUMP_TRUE,                     // cond        target
+  AS_OP_CHECK_SIZE,                    // src                                               errors if negative
+  AS_OP_CALL,                          // dst         first arg     function
+  AS_OP_CALL_LIBRARY,                  // dst         first arg     library function
+  AS_OP_CALL_METHOD,                   // dst         object        call site
+  AS_OP_RETURN,                        // src
+  AS_OP_RETURN_NONE
+};
+
+
+class cASBytecode
+{
+public:
+  struct sInstruction
+  {
+    short op;
+    short aux;
+    int a;
+    int b;
+    int c;
+  };
+
+  struct sFunction
+  {
+    cString name;
+    Apto::Array<sInstruction, Apto::Smart> code;
+    Apto::Array<const cASFilePosition*, Apto::Smart> positions;   // Source position of each instruction, for errors
+
+    cSymbolTable* symtbl;
+    Apto::Array<const sASTypeInfo*> var_types;                    // Type of each variable register
+    Apto::Array<int> params;                                      // Variable ids of the parameters, in order
+    sASTypeInfo rtype;
+    int num_regs;
+
+    sFunction() : symtbl(NULL), rtype(AS_TYPE_INVALID), num_regs(0) { ; }
+  };
+
+  // Object method calls bind to the method of the last object type seen at the call site
+  struct sMethodSite
+  {
+    cString name;
+    int first_arg;
+    int num_args;
+    const char* type_key;
+    int mid;
+  };
+
+  Apto::Array<sFunction*> functions;
+  Apto::Array<double> floats;
+  Apto::Array<cString> strings;
+  Apto::Array<const cASFunction*> library;
+  Apto::Array<sMethodSite, Apto::Smart> sites;
+  Apto::Array<sASTypeInfo, Apto::ManagedPointer> types;           // Targets of object casts, entries never move
+
+
+  cASBytecode() { ; }
+  ~cASBytecode() { for (int i = 0; i < functions.GetSize(); i++) delete functions[i]; }
+
+private:
+  cASBytecode(const cASBytecode&); // @not_implemented
+  cASBytecode& operator=(const cASBytecode&); // @not_implemented
+};
+
+#endif
@@ -0,0 +1,949 @@
+/*
+ *  cBytecodeCompileASTVisitor.cc
+ *  Avida
+ *
+ *  Copyright 2026 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "cBytecodeCompileASTVisitor.h"
+
+#include "AvidaScript.h"
+
+#include "cASFunction.h"
+#include "cStringUtil.h"
+#include "cSymbolTable.h"
+
+using namespace AvidaScript;
+
+
+#define TOKEN(x) AS_TOKEN_ ## x
+#define TYPE(x) AS_TYPE_ ## x
+
+
+cBytecodeCompileASTVisitor::cBytecodeCompileASTVisitor(cSymbolTable* global_symtbl)
+  : m_global_symtbl(global_symtbl), m_program(NULL), m_success(true), m_func(NULL), m_cur_symtbl(global_symtbl)
+  , m_next_reg(0), m_dst(-1), m_result(-1)
+{
+}
+
+cBytecodeCompileASTVisitor::~cBytecodeCompileASTVisitor()
+{
+  delete m_program;
+}
+
+
+cASBytecode* cBytecodeCompileASTVisitor::Compile(cASTNode* node)
+{
+  delete m_program;
+  m_program = new cASBytecode;
+  m_functions.Resize(0);
+  m_success = true;
+  m_unsupported = "";
+
+  // Function 0 is the script itself, its variables are the globals
+  cASBytecode::sFunction* script = new cASBytecode::sFunction;
+  script->name = "<script>";
+  script->symtbl = m_global_symtbl;
+  script->rtype = TYPE(INT);
+  m_program->functions.Push(script);
+  sFunctionRef ref = { NULL, -1 };
+  m_functions.Push(ref);
+
+  compileFunction(0, node);
+
+  // Script functions are queued as calls to them are compiled
+  for (int i = 1; m_success && i < m_program->functions.GetSize(); i++) {
+    compileFunction(i, m_functions[i].src_symtbl->GetFunctionDefinition(m_functions[i].fun_id));
+  }
+
+  cASBytecode* program = NULL;
+  if (m_success) program = m_program;
+  else delete m_program;
+  m_program = NULL;
+
+  return program;
+}
+
+
+void cBytecodeCompileASTVisitor::VisitAssignment(cASTAssignment& node)
+{
+  int var_id = node.GetVarID();
+  cSymbolTable* symtbl = node.IsVarGlobal() ? m_global_symtbl : m_cur_symtbl;
+  const sASTypeInfo& type = symtbl->GetVariableType(var_id);
+  if (!isSupportedType(type.type)) {
+    unsupported(cString("assignment to '") + mapType(type) + "' variable", node);
+    return;
+  }
+
+  if (node.IsVarGlobal() && m_cur_symtbl != m_global_symtbl) {
+    int mark = m_next_reg;
+    int src = exprAs(node.GetExpression(), type, -1);
+    emit(AS_OP_STORE_GLOBAL, var_id, src, 0, node);
+    releaseTemps(mark, node);
+  } else {
+    exprAs(node.GetExpression(), type, var_id);
+  }
+  m_result = -1;
+}
+
+
+void cBytecodeCompileASTVisitor::VisitObjectAssignment(cASTObjectAssignment& node)
+{
+  unsupported("object assignment", node);
+}
+
+
+void cBytecodeCompileASTVisitor::VisitArgumentList(cASTArgumentList& node)
+{
+  unsupported("argument list", node);
+}
+
+
+void cBytecodeCompileASTVisitor::VisitReturnStatement(cASTReturnStatement& node)
+{
+  int mark = m_next_reg;
+  if (m_func->rtype.type == TYPE(VOID)) {
+    expr(node.GetExpression(), -1);
+    releaseTemps(mark, node);
+    emit(AS_OP_RETURN_NONE, 0, 0, 0, node);
+  } else {
+    int src = exprAs(node.GetExpression(), m_func->rtype, -1);
+    emit(AS_OP_RETURN, src, 0, 0, node);
+    m_next_reg = mark;
+  }
+  m_result = -1;
+}
+
+
+void cBytecodeCompileASTVisitor::VisitStatementList(cASTStatementList& node)
+{
+  tListIterator<cASTNode> it = node.Iterator();
+  cASTNode* stmt = NULL;
+  while (m_success && (stmt = it.Next())) statement(stmt);
+  m_result = -1;
+}
+
+
+void cBytecodeCompileASTVisitor::VisitForeachBlock(cASTForeachBlock& node)
+{
+  int var_id = node.GetVariable()->GetVarID();
+  const sASTypeInfo& var_type = node.GetVariable()->GetType();
+  if (!isSupportedType(var_type.type)) {
+    unsupported(cString("foreach with '") + mapType(var_type) + "' variable", node);
+    return;
+  }
+
+  // Ranges and expansions are iterated in place, any other value would have to be an array
+  cASTExpressionBinary* values = dynamic_cast<cASTExpressionBinary*>(node.GetValues());
+  if (!values || (values->GetOperator() != TOKEN(ARR_RANGE) && values->GetOperator() != TOKEN(ARR_EXPAN))) {
+    unsupported("foreach over an array", node);
+    return;
+  }
+
+  const sASTypeInfo int_type(TYPE(INT));
+  int mark = m_next_reg;
+
+  if (values->GetOperator() == TOKEN(ARR_RANGE)) {
+    int cur = allocTemp(TYPE(INT));
+    int last = allocTemp(TYPE(INT));
+    int step = allocTemp(TYPE(INT));
+    int cond = allocTemp(TYPE(BOOL));
+    exprAs(values->GetLeft(), int_type, cur);
+    exprAs(values->GetRight(), int_type, last);
+
+    // Ranges count down when the last value is not above the first, a single value range counts either way
+    emit(AS_OP_LOAD_INT, step, 1, 0, node);
+    emit(AS_OP_GT_INT, cond, last, cur, node);
+    int up = emit(AS_OP_JUMP_TRUE, cond, -1, 0, node);
+    emit(AS_OP_LOAD_INT, step, -1, 0, node);
+    patchJump(up, nextInstruction());
+
+    int top = nextInstruction();
+    convert(cur, int_type, var_type, var_id, node);
+    statement(node.GetCode());
+    emit(AS_OP_EQ_INT, cond, cur, last, node);
+    int done = emit(AS_OP_JUMP_TRUE, cond, -1, 0, node);
+    emit(AS_OP_ADD_INT, cur, cur, step, node);
+    emit(AS_OP_JUMP, 0, top, 0, node);
+    patchJump(done, nextInstruction());
+  } else {
+    sASTypeInfo value_type = staticType(values->GetLeft());
+    if (!isSupportedType(value_type.type) && value_type.type != TYPE(RUNTIME)) {
+      unsupported(cString("expansion of '") + mapType(value_type) + "' values", node);
+      return;
+    }
+
+    int value = allocTemp(value_type.type);
+    int count = allocTemp(TYPE(INT));
+    int idx = allocTemp(TYPE(INT));
+    int cond = allocTemp(TYPE(BOOL));
+    exprAs(values->GetLeft(), value_type, value);
+    exprAs(values->GetRight(), int_type, count);
+    emit(AS_OP_CHECK_SIZE, count, 0, 0, *values);
+    emit(AS_OP_LOAD_INT, idx, 0, 0, node);
+
+    int top = nextInstruction();
+    emit(AS_OP_LT_INT, cond, idx, count, node);
+    int done = emit(AS_OP_JUMP_FALSE, cond, -1, 0, node);
+    convert(value, value_type, var_type, var_id, node);
+    statement(node.GetCode());
+    emit(AS_OP_ADDI_INT, idx, idx, 1, node);
+    emit(AS_OP_JUMP, 0, top, 0, node);
+    patchJump(done, nextInstruction());
+  }
+
+  releaseTemps(mark, node);
+  m_result = -1;
+}
+
+
+void cBytecodeCompileASTVisitor::VisitIfBlock(cASTIfBlock& node)
+{
+  Apto::Array<int> end_jumps;
+  bool has_more = (node.HasElseIfs() || node.HasElse());
+
+  int next = -1;
+  emitCondition(node.GetCondition(), false, next);
+  statement(node.GetCode());
+  if (has_more) end_jumps.Push(emit(AS_OP_JUMP, 0, -1, 0, node));
+  patchJump(next, nextInstruction());
+
+  tListIterator<cASTIfBlock::cElseIf> it = node.ElseIfIterator();
+  cASTIfBlock::cElseIf* elif = NULL;
+  while (m_success && (elif = it.Next())) {
+    emitCondition(elif->GetCondition(), false, next);
+    statement(elif->GetCode());
+    end_jumps.Push(emit(AS_OP_JUMP, 0, -1, 0, node));
+    patchJump(next, nextInstruction());
+  }
+
+  if (node.HasElse()) statement(node.GetElseCode());
+
+  for (int i = 0; i < end_jumps.GetSize(); i++) patchJump(end_jumps[i], nextInstruction());
+  m_result = -1;
+}
+
+
+void cBytecodeCompileASTVisitor::VisitWhileBlock(cASTWhileBlock& node)
+{
+  int top = nextInstruction();
+  int done = -1;
+  emitCondition(node.GetCondition(), false, done);
+  statement(node.GetCode());
+  emit(AS_OP_JUMP, 0, top, 0, node);
+  patchJump(done, nextInstruction());
+  m_result = -1;
+}
+
+
+void cBytecodeCompileASTVisitor::VisitFunctionDefinition(cASTFunctionDefinition& node)
+{
+  // Functions are compiled when the first call to them is compiled
+  m_result = -1;
+}
+
+
+void cBytecodeCompileASTVisitor::VisitVariableDefinition(cASTVariableDefinition& node)
+{
+  const sASTypeInfo& type = node.GetType();
+  if (!isSupportedType(type.type) || node.GetDimensions()) {
+    unsupported(cString("'") + mapType(type) + "' variable", node);
+    return;
+  }
+
+  if (node.GetAssignmentExpression()) exprAs(node.GetAssignmentExpression(), type, node.GetVarID());
+  m_result = -1;
+}
+
+
+void cBytecodeCompileASTVisitor::VisitVariableDefinitionList(cASTVariableDefinitionList& node)
+{
+  unsupported("variable definition list", node);
+}
+
+
+void cBytecodeCompileASTVisitor::VisitExpressionBinary(cASTExpressionBinary& node)
+{
+  const ASToken_t op = node.GetOperator();
+  const ASType_t type = node.GetType().type;
+
+  switch (op) {
+    case TOKEN(OP_LOGIC_AND):
+    case TOKEN(OP_LOGIC_OR):
+      binary(node, (op == TOKEN(OP_LOGIC_AND)) ? AS_OP_AND_BOOL : AS_OP_OR_BOOL, TYPE(BOOL), TYPE(BOOL));
+      return;
+
+    case TOKEN(OP_EQ):
+    case TOKEN(OP_NEQ):
+      {
+        const bool eq = (op == TOKEN(OP_EQ));
+        switch (node.GetCompareType().type) {
+          case TYPE(BOOL):    binary(node, eq ? AS_OP_EQ_BOOL : AS_OP_NE_BOOL, TYPE(BOOL), TYPE(BOOL)); return;
+          case TYPE(CHAR):
+          case TYPE(INT):     binary(node, eq ? AS_OP_EQ_INT : AS_OP_NE_INT, TYPE(INT), TYPE(BOOL)); return;
+          case TYPE(FLOAT):   binary(node, eq ? AS_OP_EQ_FLOAT : AS_OP_NE_FLOAT, TYPE(FLOAT), TYPE(BOOL)); return;
+          case TYPE(STRING):  binary(node, eq ? AS_OP_EQ_STRING : AS_OP_NE_STRING, TYPE(STRING), TYPE(BOOL)); return;
+          case TYPE(RUNTIME): binaryAny(node, TYPE(BOOL)); return;
+          default: break;
+        }
+      }
+      break;
+
+    case TOKEN(OP_LE):
+    case TOKEN(OP_GE):
+    case TOKEN(OP_LT):
+    case TOKEN(OP_GT):
+      {
+        eASOpcode int_op = AS_OP_LT_INT;
+        eASOpcode float_op = AS_OP_LT_FLOAT;
+        switch (op) {
+          case TOKEN(OP_LE): int_op = AS_OP_LE_INT; float_op = AS_OP_LE_FLOAT; break;
+          case TOKEN(OP_GE): int_op = AS_OP_GE_INT; float_op = AS_OP_GE_FLOAT; break;
+          case TOKEN(OP_GT): int_op = AS_OP_GT_INT; float_op = AS_OP_GT_FLOAT; break;
+          default: break;
+        }
+        switch (node.GetCompareType().type) {
+          case TYPE(CHAR):
+          case TYPE(INT):     binary(node, int_op, TYPE(INT), TYPE(BOOL)); return;
+          case TYPE(FLOAT):   binary(node, float_op, TYPE(FLOAT), TYPE(BOOL)); return;
+          case TYPE(RUNTIME): binaryAny(node, TYPE(BOOL)); return;
+          default: break;
+        }
+      }
+      break;
+
+    case TOKEN(OP_BIT_AND):
+    case TOKEN(OP_BIT_OR):
+    case TOKEN(OP_ADD):
+    case TOKEN(OP_SUB):
+    case TOKEN(OP_MUL):
+    case TOKEN(OP_DIV):
+    case TOKEN(OP_MOD):
+      {
+        eASOpcode int_op = AS_OP_NOP;
+        eASOpcode float_op = AS_OP_NOP;
+        switch (op) {
+          case TOKEN(OP_BIT_AND): int_op = AS_OP_BIT_AND_INT; break;
+          case TOKEN(OP_BIT_OR):  int_op = AS_OP_BIT_OR_INT; break;
+          case TOKEN(OP_ADD):     int_op = AS_OP_ADD_INT; float_op = AS_OP_ADD_FLOAT; break;
+          case TOKEN(OP_SUB):     int_op = AS_OP_SUB_INT; float_op = AS_OP_SUB_FLOAT; break;
+          case TOKEN(OP_MUL):     int_op = AS_OP_MUL_INT; float_op = AS_OP_MUL_FLOAT; break;
+          case TOKEN(OP_DIV):     int_op = AS_OP_DIV_INT; float_op = AS_OP_DIV_FLOAT; break;
+          case TOKEN(OP_MOD):     int_op = AS_OP_MOD_INT; float_op = AS_OP_MOD_FLOAT; break;
+          default: break;
+        }
+        switch (type) {
+          case TYPE(CHAR):    binary(node, int_op, TYPE(CHAR), TYPE(CHAR)); return;
+          case TYPE(INT):     binary(node, int_op, TYPE(INT), TYPE(INT)); return;
+          case TYPE(FLOAT):
+            if (float_op == AS_OP_NOP) break;
+            binary(node, float_op, TYPE(FLOAT), TYPE(FLOAT));
+            return;
+          case TYPE(STRING):
+            if (op != TOKEN(OP_ADD)) break;
+            binary(node, AS_OP_ADD_STRING, TYPE(STRING), TYPE(STRING));
+            return;
+          case TYPE(RUNTIME): binaryAny(node, TYPE(RUNTIME)); return;
+          default: break;
+        }
+      }
+      break;
+
+    default:
+      break;
+  }
+
+  unsupported(cString("'") + mapToken(op) + "' producing '" + mapType(node.GetType()) + "'", node);
+}
+
+
+void cBytecodeCompileASTVisitor::VisitExpressionUnary(cASTExpressionUnary& node)
+{
+  const ASType_t type = node.GetType().type;
+
+  switch (node.GetOperator()) {
+    case TOKEN(OP_BIT_NOT):
+      switch (type) {
+        case TYPE(CHAR):    unary(node, AS_OP_BIT_NOT_INT, TYPE(CHAR)); return;
+        case TYPE(INT):     unary(node, AS_OP_BIT_NOT_INT, TYPE(INT)); return;
+        case TYPE(RUNTIME): unary(node, AS_OP_BIT_NOT_ANY, TYPE(RUNTIME)); return;
+        default: break;
+      }
+      break;
+
+    case TOKEN(OP_LOGIC_NOT):
+      unary(node, AS_OP_NOT_BOOL, TYPE(BOOL));
+      return;
+
+    case TOKEN(OP_SUB):
+      switch (type) {
+        case TYPE(CHAR):    unary(node, AS_OP_NEG_INT, TYPE(CHAR)); return;
+        case TYPE(INT):     unary(node, AS_OP_NEG_INT, TYPE(INT)); return;
+        case TYPE(FLOAT):   unary(node, AS_OP_NEG_FLOAT, TYPE(FLOAT)); return;
+        case TYPE(RUNTIME): unary(node, AS_OP_NEG_ANY, TYPE(RUNTIME)); return;
+        default: break;
+      }
+      break;
+
+    default:
+      break;
+  }
+
+  unsupported(cString("'") + mapToken(node.GetOperator()) + "' on '" + mapType(node.GetType()) + "'", node);
+}
+
+
+void cBytecodeCompileASTVisitor::VisitBuiltInCall(cASTBuiltInCall& node)
+{
+  ASType_t type = TYPE(INVALID);
+  switch (node.GetBuiltIn()) {
+    case AS_BUILTIN_CAST_BOOL:    type = TYPE(BOOL); break;
+    case AS_BUILTIN_CAST_CHAR:    type = TYPE(CHAR); break;
+    case AS_BUILTIN_CAST_INT:     type = TYPE(INT); break;
+    case AS_BUILTIN_CAST_FLOAT:   type = TYPE(FLOAT); break;
+    case AS_BUILTIN_CAST_STRING:  type = TYPE(STRING); break;
+
+    default:
+      unsupported("builtin function", node);
+      return;
+  }
+
+  m_result = exprAs(node.GetArguments()->Iterator().Next(), sASTypeInfo(type), target(type));
+  m_result_type = type;
+}
+
+
+void cBytecodeCompileASTVisitor::VisitFunctionCall(cASTFunctionCall& node)
+{
+  if (node.IsASFunction()) {
+    const cASFunction* func = node.GetASFunction();
+    const sASTypeInfo& rtype = func->GetReturnType();
+    if (!isSupportedType(rtype.type) && rtype.type != TYPE(VOID)) {
+      unsupported(cString("library function returning '") + mapType(rtype) + "'", node);
+      return;
+    }
+
+    int lib_idx = 0;
+    while (lib_idx < m_program->library.GetSize() && m_program->library[lib_idx] != func) lib_idx++;
+    if (lib_idx == m_program->library.GetSize()) m_program->library.Push(func);
+
+    int dst = (rtype.type == TYPE(VOID)) ? allocTemp(TYPE(VOID)) : target(rtype.type);
+    int mark = m_next_reg;
+
+    // Arguments are converted into consecutive registers, which the library function borrows for the call
+    int first_arg = m_next_reg;
+    for (int i = 0; i < func->GetArity(); i++) {
+      if (!isSupportedType(func->GetArgumentType(i).type)) {
+        unsupported(cString("library function taking '") + mapType(func->GetArgumentType(i)) + "'", node);
+        return;
+      }
+      allocTemp(func->GetArgumentType(i).type);
+    }
+    if (func->GetArity()) {
+      tListIterator<cASTNode> it = node.GetArguments()->Iterator();
+      for (int i = 0; i < func->GetArity(); i++) exprAs(it.Next(), func->GetArgumentType(i), first_arg + i);
+    }
+
+    emit(AS_OP_CALL_LIBRARY, dst, first_arg, lib_idx, node);
+    releaseTemps(mark, node);
+
+    m_result = (rtype.type == TYPE(VOID)) ? -1 : dst;
+    m_result_type = rtype;
+  } else {
+    cSymbolTable* src_symtbl = node.IsFuncGlobal() ? m_global_symtbl : m_cur_symtbl;
+    int fun_id = node.GetFuncID();
+    int func_idx = lookupFunction(src_symtbl, fun_id);
+    if (func_idx < 0) return;
+
+    const cASBytecode::sFunction* func = m_program->functions[func_idx];
+    const sASTypeInfo rtype = func->rtype;
+
+    int dst = (rtype.type == TYPE(VOID)) ? allocTemp(TYPE(VOID)) : target(rtype.type);
+    int mark = m_next_reg;
+
+    // Arguments are evaluated in the caller, defaults included, and moved into the parameters of the new frame
+    int first_arg = m_next_reg;
+    for (int i = 0; i < func->params.GetSize(); i++) allocTemp(func->symtbl->GetVariableType(func->params[i]).type);
+
+    Apto::Array<cASTNode*> args;
+    if (node.HasArguments()) {
+      tListIterator<cASTNode> cit = node.GetArguments()->Iterator();
+      cASTNode* arg = NULL;
+      while ((arg = cit.Next())) args.Push(arg);
+    }
+    cASTVariableDefinitionList* signature = src_symtbl->GetFunctionSignature(fun_id);
+    if (signature) {
+      tListIterator<cASTVariableDefinition> sit = signature->Iterator();
+      cASTVariableDefinition* arg_def = NULL;
+      for (int i = 0; (arg_def = sit.Next()); i++) {
+        cASTNode* arg = (i < args.GetSize()) ? args[i] : arg_def->GetAssignmentExpression();
+        exprAs(arg, func->symtbl->GetVariableType(arg_def->GetVarID()), first_arg + i);
+      }
+    }
+
+    emit(AS_OP_CALL, dst, first_arg, func_idx, node);
+    releaseTemps(mark, node);
+
+    m_result = (rtype.type == TYPE(VOID)) ? -1 : dst;
+    m_result_type = rtype;
+  }
+}
+
+
+void cBytecodeCompileASTVisitor::VisitLiteral(cASTLiteral& node)
+{
+  const ASType_t type = node.GetType().type;
+  int dst = target(type);
+
+  switch (type) {
+    case TYPE(BOOL):    emit(AS_OP_LOAD_BOOL, dst, (node.GetValue() == "true") ? 1 : 0, 0, node); break;
+    case TYPE(CHAR):    emit(AS_OP_LOAD_CHAR, dst, node.GetValue()[0], 0, node); break;
+    case TYPE(INT):     emit(AS_OP_LOAD_INT, dst, node.GetValue().AsInt(), 0, node); break;
+    case TYPE(FLOAT):
+      emit(AS_OP_LOAD_FLOAT, dst, m_program->floats.GetSize(), 0, node);
+      m_program->floats.Push(node.GetValue().AsDouble());
+      break;
+    case TYPE(STRING):
+      emit(AS_OP_LOAD_STRING, dst, m_program->strings.GetSize(), 0, node);
+      m_program->strings.Push(node.GetValue());
+      break;
+
+    default:
+      unsupported(cString("'") + mapType(node.GetType()) + "' literal", node);
+      return;
+  }
+
+  m_result = dst;
+  m_result_type = type;
+}
+
+
+void cBytecodeCompileASTVisitor::VisitLiteralArray(cASTLiteralArray& node)
+{
+  unsupported("array literal", node);
+}
+
+
+void cBytecodeCompileASTVisitor::VisitLiteralDict(cASTLiteralDict& node)
+{
+  unsupported("dict literal", node);
+}
+
+
+void cBytecodeCompileASTVisitor::VisitObjectCall(cASTObjectCall& node)
+{
+  int dst = target(TYPE(RUNTIME));
+  int mark = m_next_reg;
+
+  int obj = expr(node.GetObject(), -1);
+  if (node.HasArguments()) obj = stable(obj, NULL, node);
+
+  // The method, and with it the argument types, is only known at runtime, so the arguments keep their own types
+  int num_args = node.HasArguments() ? node.GetArguments()->GetSize() : 0;
+  int first_arg = m_next_reg;
+  Apto::Array<sASTypeInfo> arg_types(num_args);
+  if (num_args) {
+    tListIterator<cASTNode> it = node.GetArguments()->Iterator();
+    for (int i = 0; i < num_args; i++) {
+      arg_types[i] = staticType(it.Next());
+      if (!isSupportedType(arg_types[i].type) && arg_types[i].type != TYPE(RUNTIME)) {
+        unsupported(cString("method argument of type '") + mapType(arg_types[i]) + "'", node);
+        return;
+      }
+      allocTemp(arg_types[i].type);
+    }
+    tListIterator<cASTNode> ait = node.GetArguments()->Iterator();
+    for (int i = 0; i < num_args; i++) exprAs(ait.Next(), arg_types[i], first_arg + i);
+  }
+
+  cASBytecode::sMethodSite site;
+  site.name = node.GetName();
+  site.first_arg = first_arg;
+  site.num_args = num_args;
+  site.type_key = NULL;
+  site.mid = -1;
+  emit(AS_OP_CALL_METHOD, dst, obj, m_program->sites.GetSize(), node);
+  m_program->sites.Push(site);
+  releaseTemps(mark, node);
+
+  m_result = dst;
+  m_result_type = TYPE(RUNTIME);
+}
+
+
+void cBytecodeCompileASTVisitor::VisitObjectReference(cASTObjectReference& node)
+{
+  unsupported("object reference", node);
+}
+
+
+void cBytecodeCompileASTVisitor::VisitVariableReference(cASTVariableReference& node)
+{
+  int var_id = node.GetVarID();
+  cSymbolTable* symtbl = node.IsVarGlobal() ? m_global_symtbl : m_cur_symtbl;
+  const sASTypeInfo& type = symtbl->GetVariableType(var_id);
+  if (!isSupportedType(type.type)) {
+    unsupported(cString("'") + mapType(type) + "' variable", node);
+    return;
+  }
+
+  if (node.IsVarGlobal() && m_cur_symtbl != m_global_symtbl) {
+    m_result = target(type.type);
+    emit(AS_OP_LOAD_GLOBAL, m_result, var_id, 0, node);
+  } else if (m_dst >= 0 && m_dst != var_id) {
+    emitMove(m_dst, var_id, type.type, node);
+    m_result = m_dst;
+  } else {
+    // Operands are read straight from the variable register
+    m_result = var_id;
+  }
+  m_result_type = type;
+}
+
+
+void cBytecodeCompileASTVisitor::VisitUnpackTarget(cASTUnpackTarget& node)
+{
+  unsupported("unpack assignment", node);
+}
+
+
+
+void cBytecodeCompileASTVisitor::unsupported(const cString& construct, cASTNode& node)
+{
+  if (m_success) {
+    m_success = false;
+    m_unsupported = cStringUtil::Stringf("%s:%d: %s", (const char*)node.GetFilePosition().GetFilename(),
+                                         node.GetFilePosition().GetLineNumber(), (const char*)construct);
+  }
+  m_result = -1;
+}
+
+
+bool cBytecodeCompileASTVisitor::isSupportedType(ASType_t type) const
+{
+  switch (type) {
+    case TYPE(BOOL):
+    case TYPE(CHAR):
+    case TYPE(INT):
+    case TYPE(FLOAT):
+    case TYPE(STRING):
+    case TYPE(OBJECT_REF):
+      return true;
+
+    default:
+      return false;
+  }
+}
+
+
+int cBytecodeCompileASTVisitor::lookupFunction(cSymbolTable* src_symtbl, int fun_id)
+{
+  for (int i = 1; i < m_functions.GetSize(); i++) {
+    if (m_functions[i].src_symtbl == src_symtbl && m_functions[i].fun_id == fun_id) return i;
+  }
+
+  const sASTypeInfo& rtype = src_symtbl->GetFunctionRType(fun_id);
+  if (!isSupportedType(rtype.type) && rtype.type != TYPE(VOID)) {
+    m_success = false;
+    m_unsupported = cString("function '") + src_symtbl->GetFunctionName(fun_id) + "' returning '" + mapType(rtype) + "'";
+    return -1;
+  }
+
+  cASBytecode::sFunction* func = new cASBytecode::sFunction;
+  func->name = src_symtbl->GetFunctionName(fun_id);
+  func->symtbl = src_symtbl->GetFunctionSymbolTable(fun_id);
+  func->rtype = rtype;
+
+  cASTVariableDefinitionList* signature = src_symtbl->GetFunctionSignature(fun_id);
+  if (signature) {
+    tListIterator<cASTVariableDefinition> it = signature->Iterator();
+    cASTVariableDefinition* arg_def = NULL;
+    while ((arg_def = it.Next())) func->params.Push(arg_def->GetVarID());
+  }
+
+  m_program->functions.Push(func);
+  sFunctionRef ref = { src_symtbl, fun_id };
+  m_functions.Push(ref);
+
+  return m_program->functions.GetSize() - 1;
+}
+
+
+void cBytecodeCompileASTVisitor::compileFunction(int idx, cASTNode* code)
+{
+  m_func = m_program->functions[idx];
+  m_cur_symtbl = m_func->symtbl;
+
+  if (!code) {
+    m_success = false;
+    m_unsupported = cString("function '") + m_func->name + "' without a definition";
+    return;
+  }
+
+  const int num_vars = m_cur_symtbl->GetNumVariables();
+  m_func->var_types.Resize(num_vars);
+  m_reg_types.Resize(num_vars);
+  for (int i = 0; i < num_vars; i++) {
+    const sASTypeInfo& type = m_cur_symtbl->GetVariableType(i);
+    if (!isSupportedType(type.type)) {
+      unsupported(cString("'") + mapType(type) + "' variable", *code);
+      return;
+    }
+    m_func->var_types[i] = &type;
+    m_reg_types[i] = type.type;
+  }
+  m_next_reg = num_vars;
+  m_func->num_regs = num_vars;
+
+  statement(code);
+  emit(AS_OP_RETURN_NONE, 0, 0, 0, *code);
+}
+
+
+int cBytecodeCompileASTVisitor::emit(eASOpcode op, int a, int b, int c, cASTNode& node, int aux)
+{
+  cASBytecode::sInstruction inst;
+  inst.op = op;
+  inst.aux = aux;
+  inst.a = a;
+  inst.b = b;
+  inst.c = c;
+  m_func->code.Push(inst);
+  m_func->positions.Push(&node.GetFilePosition());
+  return m_func->code.GetSize() - 1;
+}
+
+
+inline void cBytecodeCompileASTVisitor::patchJump(int inst, int target)
+{
+  if (inst < 0) return;
+  m_func->code[inst].b = target;
+}
+
+
+int cBytecodeCompileASTVisitor::allocTemp(ASType_t type)
+{
+  int reg = m_next_reg++;
+  if (m_reg_types.GetSize() <= reg) m_reg_types.Resize(reg + 1);
+  m_reg_types[reg] = type;
+  if (m_next_reg > m_func->num_regs) m_func->num_regs = m_next_reg;
+  return reg;
+}
+
+
+void cBytecodeCompileASTVisitor::releaseTemps(int mark, cASTNode& node)
+{
+  // Temporaries that may own a string or an object reference are released as soon as they go out of use
+  for (int reg = m_next_reg - 1; reg >= mark; reg--) {
+    switch (m_reg_types[reg]) {
+      case TYPE(STRING):
+      case TYPE(OBJECT_REF):
+      case TYPE(RUNTIME):
+        emit(AS_OP_CLEAR, reg, 0, 0, node);
+        break;
+
+      default:
+        break;
+    }
+  }
+  if (mark < m_next_reg) m_next_reg = mark;
+}
+
+
+sASTypeInfo cBytecodeCompileASTVisitor::staticType(cASTNode* node) const
+{
+  // Variable references are typed from the symbol table that holds them, the same way they are compiled
+  cASTVariableReference* var = dynamic_cast<cASTVariableReference*>(node);
+  if (var) return (var->IsVarGlobal() ? m_global_symtbl : m_cur_symtbl)->GetVariableType(var->GetVarID());
+
+  if (dynamic_cast<cASTObjectCall*>(node)) return sASTypeInfo(TYPE(RUNTIME));
+
+  return node->GetType();
+}
+
+
+void cBytecodeCompileASTVisitor::statement(cASTNode* node)
+{
+  if (!m_success || !node) return;
+
+  int mark = m_next_reg;
+  int prev_dst = m_dst;
+  m_dst = -1;
+  node->Accept(*this);
+  m_dst = prev_dst;
+  releaseTemps(mark, *node);
+}
+
+
+int cBytecodeCompileASTVisitor::expr(cASTNode* node, int dst)
+{
+  if (!m_success) return 0;
+  if (!node) {
+    m_success = false;
+    m_unsupported = "missing expression";
+    return 0;
+  }
+
+  int prev_dst = m_dst;
+  m_dst = dst;
+  m_result = -1;
+  node->Accept(*this);
+  m_dst = prev_dst;
+
+  if (m_result < 0) {
+    if (m_success) unsupported("value of a void expression", *node);
+    return 0;
+  }
+  return m_result;
+}
+
+
+int cBytecodeCompileASTVisitor::exprAs(cASTNode* node, const sASTypeInfo& type, int dst)
+{
+  if (!m_success) return 0;
+
+  sASTypeInfo src_type = staticType(node);
+  if (src_type.type == type.type && (type.type != TYPE(OBJECT_REF) || src_type.info == type.info)) return expr(node, dst);
+
+  if (dst < 0) dst = allocTemp(type.type);
+  int mark = m_next_reg;
+  int src = expr(node, -1);
+  src_type = m_result_type;
+  convert(src, src_type, type, dst, *node);
+  releaseTemps(mark, *node);
+
+  m_result = dst;
+  m_result_type = type;
+  return dst;
+}
+
+
+int cBytecodeCompileASTVisitor::convert(int src, const sASTypeInfo& from, const sASTypeInfo& to, int dst,
+                                        cASTNode& node)
+{
+  if (!isSupportedType(to.type)) {
+    unsupported(cString("conversion to '") + mapType(to) + "'", node);
+    return dst;
+  }
+
+  if (from.type == to.type && (to.type != TYPE(OBJECT_REF) || from.info == to.info)) {
+    emitMove(dst, src, to.type, node);
+  } else if (from.type == TYPE(INT) && to.type == TYPE(FLOAT)) {
+    emit(AS_OP_INT_TO_FLOAT, dst, src, 0, node);
+  } else {
+    int info = -1;
+    if (to.type == TYPE(OBJECT_REF)) {
+      info = m_program->types.GetSize();
+      m_program->types.Push(to);
+    }
+    emit(AS_OP_CAST, dst, src, info, node, to.type);
+  }
+  return dst;
+}
+
+
+void cBytecodeCompileASTVisitor::emitMove(int dst, int src, ASType_t type, cASTNode& node)
+{
+  if (dst == src) return;
+
+  switch (type) {
+    case TYPE(STRING):      emit(AS_OP_MOVE_STRING, dst, src, 0, node); break;
+    case TYPE(OBJECT_REF):  emit(AS_OP_MOVE_OBJECT, dst, src, 0, node); break;
+    case TYPE(RUNTIME):     emit(AS_OP_MOVE_ANY, dst, src, 0, node); break;
+    default:                emit(AS_OP_MOVE, dst, src, 0, node); break;
+  }
+}
+
+
+void cBytecodeCompileASTVisitor::emitCondition(cASTNode* cond, bool jump_if, int& jump_inst)
+{
+  jump_inst = -1;
+  if (!m_success) return;
+
+  int mark = m_next_reg;
+  int reg = exprAs(cond, sASTypeInfo(TYPE(BOOL)), -1);
+  releaseTemps(mark, *cond);   // The condition is a bool, so its register is never cleared
+  jump_inst = emit(jump_if ? AS_OP_JUMP_TRUE : AS_OP_JUMP_FALSE, reg, -1, 0, *cond);
+}
+
+
+int cBytecodeCompileASTVisitor::stable(int reg, cASTNode* later, cASTNode& parent)
+{
+  // At the top level operands may be read straight from global registers, which script functions called while
+  // evaluating a later operand can assign.  Such operands are copied first, so they keep their evaluation order.
+  if (m_func != m_program->functions[0] || reg >= m_func->var_types.GetSize()) return reg;
+  if (later && (dynamic_cast<cASTLiteral*>(later) || dynamic_cast<cASTVariableReference*>(later))) return reg;
+
+  int copy = allocTemp(m_reg_types[reg]);
+  emitMove(copy, reg, m_reg_types[reg], parent);
+  return copy;
+}
+
+
+void cBytecodeCompileASTVisitor::binary(cASTExpressionBinary& node, eASOpcode op, ASType_t operand_type,
+                                        ASType_t result_type)
+{
+  int dst = target(result_type);
+  int mark = m_next_reg;
+
+  int lhs = exprAs(node.GetLeft(), sASTypeInfo(operand_type), -1);
+  lhs = stable(lhs, node.GetRight(), node);
+  int rhs = exprAs(node.GetRight(), sASTypeInfo(operand_type), -1);
+  emit(op, dst, lhs, rhs, node);
+
+  // Char arithmetic is done on ints, then truncated back
+  if (result_type == TYPE(CHAR)) emit(AS_OP_CAST, dst, dst, -1, node, TYPE(CHAR));
+
+  releaseTemps(mark, node);
+  m_result = dst;
+  m_result_type = result_type;
+}
+
+
+void cBytecodeCompileASTVisitor::binaryAny(cASTExpressionBinary& node, ASType_t result_type)
+{
+  int dst = target(result_type);
+  int mark = m_next_reg;
+
+  int lhs = expr(node.GetLeft(), -1);
+  lhs = stable(lhs, node.GetRight(), node);
+  int rhs = expr(node.GetRight(), -1);
+  emit(AS_OP_BINARY_ANY, dst, lhs, rhs, node, node.GetOperator());
+
+  releaseTemps(mark, node);
+  m_result = dst;
+  m_result_type = node.GetType();
+}
+
+
+void cBytecodeCompileASTVisitor::unary(cASTExpressionUnary& node, eASOpcode op, ASType_t type)
+{
+  int dst = target(type);
+  int mark = m_next_reg;
+
+  int src = (type == TYPE(RUNTIME)) ? expr(node.GetExpression(), -1) : exprAs(node.GetExpression(), sASTypeInfo(type), -1);
+  emit(op, dst, src, 0, node);
+  if (type == TYPE(CHAR)) emit(AS_OP_CAST, dst, dst, -1, node, TYPE(CHAR));
+
+  releaseTemps(mark, node);
+  m_result = dst;
+  m_result_type = type;
+}
+
+
+#undef TOKEN()
+#undef TYPE()
@@ -0,0 +1,140 @@
+/*
+ *  cBytecodeCompileASTVisitor.h
+ *  Avida
+ *
+ *  Copyright 2026 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef cBytecodeCompileASTVisitor_h
+#define cBytecodeCompileASTVisitor_h
+
+#include "cASBytecode.h"
+#include "cASTVisitor.h"
+
+class cSymbolTable;
+
+
+// cBytecodeCompileASTVisitor - compiles a semantically checked tree into cASBytecode
+// --------------------------------------------------------------------------------------------------------------
+//
+//  The bytecode covers scripts built from scalar, string and native object values, script functions, library
+//  functions and native object methods.  Aggregates (arrays, dicts, matrices), 'var' typed values, unpacking and the
+//  remaining builtins are not compiled: Compile returns NULL for trees that use them and GetUnsupportedConstruct()
+//  names the first one found, so callers can report it rather than run the script on another interpreter unnoticed.
+//  Foreach loops are supported over ranges and expansions, which are compiled into counting loops without building
+//  the array.
+
+class cBytecodeCompileASTVisitor : public cASTVisitor
+{
+private:
+  struct sFunctionRef
+  {
+    cSymbolTable* src_symtbl;
+    int fun_id;
+  };
+
+  cSymbolTable* m_global_symtbl;
+  cASBytecode* m_program;
+  Apto::Array<sFunctionRef, Apto::Smart> m_functions;   // Index matches cASBytecode::functions, compiled in order
+
+  bool m_success;
+  cString m_unsupported;
+
+  // Current function
+  cASBytecode::sFunction* m_func;
+  cSymbolTable* m_cur_symtbl;
+  Apto::Array<ASType_t, Apto::Smart> m_reg_types;       // Type of each allocated register, variables included
+  int m_next_reg;
+
+  // Expression results
+  int m_dst;                // Register requested for the result of the current expression, -1 for any
+  int m_result;             // Register holding the result of the last expression, -1 if void
+  sASTypeInfo m_result_type;
+
+
+  // --------  Private Constructors  --------
+  cBytecodeCompileASTVisitor(const cBytecodeCompileASTVisitor&); // @not_implemented
+  cBytecodeCompileASTVisitor& operator=(const cBytecodeCompileASTVisitor&); // @not_implemented
+
+
+public:
+  cBytecodeCompileASTVisitor(cSymbolTable* global_symtbl);
+  ~cBytecodeCompileASTVisitor();
+
+  // Returns the compiled program (owned by the caller), or NULL if the tree uses an unsupported construct
+  cASBytecode* Compile(cASTNode* node);
+  const cString& GetUnsupportedConstruct() const { return m_unsupported; }
+
+  void VisitAssignment(cASTAssignment&);
+  void VisitObjectAssignment(cASTObjectAssignment&);
+  void VisitArgumentList(cASTArgumentList&);
+
+  void VisitReturnStatement(cASTReturnStatement&);
+  void VisitStatementList(cASTStatementList&);
+
+  void VisitForeachBlock(cASTForeachBlock&);
+  void VisitIfBlock(cASTIfBlock&);
+  void VisitWhileBlock(cASTWhileBlock&);
+
+  void VisitFunctionDefinition(cASTFunctionDefinition&);
+  void VisitVariableDefinition(cASTVariableDefinition&);
+  void VisitVariableDefinitionList(cASTVariableDefinitionList&);
+
+  void VisitExpressionBinary(cASTExpressionBinary&);
+  void VisitExpressionUnary(cASTExpressionUnary&);
+
+  void VisitBuiltInCall(cASTBuiltInCall&);
+  void VisitFunctionCall(cASTFunctionCall&);
+  void VisitLiteral(cASTLiteral&);
+  void VisitLiteralArray(cASTLiteralArray&);
+  void VisitLiteralDict(cASTLiteralDict&);
+  void VisitObjectCall(cASTObjectCall&);
+  void VisitObjectReference(cASTObjectReference&);
+  void VisitVariableReference(cASTVariableReference&);
+  void VisitUnpackTarget(cASTUnpackTarget&);
+
+
+private:
+  // --------  Internal Utility Methods  --------
+  void unsupported(const cString& construct, cASTNode& node);
+  bool isSupportedType(ASType_t type) const;
+  int lookupFunction(cSymbolTable* src_symtbl, int fun_id);
+  void compileFunction(int idx, cASTNode* code);
+
+  int emit(eASOpcode op, int a, int b, int c, cASTNode& node, int aux = 0);
+  inline int nextInstruction() const { return m_func->code.GetSize(); }
+  inline void patchJump(int inst, int target);
+
+  int allocTemp(ASType_t type);
+  void releaseTemps(int mark, cASTNode& node);
+  int target(ASType_t type) { return (m_dst >= 0) ? m_dst : allocTemp(type); }
+
+  sASTypeInfo staticType(cASTNode* node) const;
+  void statement(cASTNode* node);
+  int expr(cASTNode* node, int dst);
+  int exprAs(cASTNode* node, const sASTypeInfo& type, int dst);
+  int convert(int src, const sASTypeInfo& from, const sASTypeInfo& to, int dst, cASTNode& node);
+  void emitMove(int dst, int src, ASType_t type, cASTNode& node);
+  void emitCondition(cASTNode* cond, bool jump_if, int& jump_inst);
+  int stable(int reg, cASTNode* later, cASTNode& parent);
+
+  void binary(cASTExpressionBinary& node, eASOpcode op, ASType_t operand_type, ASType_t result_type);
+  void binaryAny(cASTExpressionBinary& node, ASType_t result_type);
+  void unary(cASTExpressionUnary& node, eASOpcode op, ASType_t type);
+};
+
+#endif
@@ -0,0 +1,834 @@
+/*
+ *  cBytecodeInterpreter.cc
+ *  Avida
+ *
+ *  Copyright 2026 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "cBytecodeInterpreter.h"
+
+#include <cmath>
+#include <cstdarg>
+#include <cstdlib>
+#include <iostream>
+
+#include "ASTree.h"
+#include "AvidaScript.h"
+
+#include "cASCPPParameter.h"
+#include "cASFunction.h"
+#include "cASNativeObject.h"
+#include "cStringUtil.h"
+
+using namespace AvidaScript;
+
+
+#ifndef DEBUG_AS_BYTECODE_INTERPRET
+#define DEBUG_AS_BYTECODE_INTERPRET 0
+#endif
+
+#define INTERPRET_ERROR(code, ...) reportError(AS_DIRECT_INTERPRET_ERR_ ## code, fp,  __LINE__, ##__VA_ARGS__)
+
+#define TOKEN(x) AS_TOKEN_ ## x
+#define TYPE(x) AS_TYPE_ ## x
+
+// Native functions and methods take at most three arguments
+#define MAX_NATIVE_ARGS 3
+
+
+namespace {
+  const cString s_empty_string;
+
+  ASType_t getRuntimeType(ASType_t ltype, ASType_t rtype, bool allow_str = false)
+  {
+    // Same promotion rules as cDirectInterpretASTVisitor, restricted to the types held by bytecode registers
+    switch (ltype) {
+      case TYPE(BOOL):
+        switch (rtype) {
+          case TYPE(BOOL):
+          case TYPE(CHAR):
+          case TYPE(FLOAT):
+          case TYPE(INT):
+          case TYPE(OBJECT_REF):
+          case TYPE(STRING):
+            return TYPE(BOOL);
+
+          default: break;
+        }
+        break;
+      case TYPE(CHAR):
+        switch (rtype) {
+          case TYPE(BOOL):      return TYPE(CHAR);
+          case TYPE(CHAR):      return TYPE(CHAR);
+          case TYPE(FLOAT):     return TYPE(FLOAT);
+          case TYPE(INT):       return TYPE(INT);
+          case TYPE(STRING):    if (allow_str) return TYPE(STRING); break;
+          default: break;
+        }
+        break;
+      case TYPE(FLOAT):
+        switch (rtype) {
+          case TYPE(BOOL):      return TYPE(FLOAT);
+          case TYPE(CHAR):      return TYPE(FLOAT);
+          case TYPE(FLOAT):     return TYPE(FLOAT);
+          case TYPE(INT):       return TYPE(FLOAT);
+          case TYPE(STRING):    if (allow_str) return TYPE(FLOAT); break;
+          default: break;
+        }
+        break;
+      case TYPE(INT):
+        switch (rtype) {
+          case TYPE(BOOL):      return TYPE(INT);
+          case TYPE(CHAR):      return TYPE(INT);
+          case TYPE(FLOAT):     return TYPE(FLOAT);
+          case TYPE(INT):       return TYPE(INT);
+          case TYPE(STRING):    if (allow_str) return TYPE(INT); break;
+          default: break;
+        }
+        break;
+      case TYPE(STRING):
+        if (allow_str) return TYPE(STRING); break;
+
+      default: break;
+    }
+
+    return TYPE(INVALID);
+  }
+}
+
+
+cBytecodeInterpreter::cBytecodeInterpreter(cASBytecode* program) : m_program(program), m_stack(0, 2048)
+{
+}
+
+cBytecodeInterpreter::~cBytecodeInterpreter()
+{
+  if (m_stack.GetSize()) releaseFrame(*m_program->functions[0], 0);
+}
+
+
+int cBytecodeInterpreter::Run()
+{
+  const cASBytecode::sFunction& script = *m_program->functions[0];
+  m_stack.Resize(script.num_regs);
+  initFrame(script, 0);
+
+  sValue rvalue = execute(script, 0);
+  int rval = (rvalue.type == TYPE(INT)) ? rvalue.as_int : 0;
+  release(rvalue);
+
+  return rval;
+}
+
+
+cBytecodeInterpreter::sValue cBytecodeInterpreter::execute(const cASBytecode::sFunction& func, int base)
+{
+  const cASBytecode::sInstruction* code = &func.code[0];
+  sValue* regs = &m_stack[base];
+  int pc = 0;
+
+  for (;;) {
+    const cASBytecode::sInstruction& inst = code[pc++];
+    sValue& dst = regs[inst.a];
+
+    switch (inst.op) {
+      case AS_OP_NOP:
+        break;
+
+      // Loads and moves
+      case AS_OP_LOAD_BOOL:
+      case AS_OP_LOAD_CHAR:
+      case AS_OP_LOAD_INT:
+        dst.as_int = inst.b;
+        dst.type = (inst.op == AS_OP_LOAD_INT) ? TYPE(INT) : ((inst.op == AS_OP_LOAD_BOOL) ? TYPE(BOOL) : TYPE(CHAR));
+        break;
+      case AS_OP_LOAD_FLOAT:
+        dst.as_float = m_program->floats[inst.b];
+        dst.type = TYPE(FLOAT);
+        break;
+      case AS_OP_LOAD_STRING:
+        {
+          cString* str = new cString(m_program->strings[inst.b]);
+          release(dst);
+          dst.as_string = str;
+          dst.type = TYPE(STRING);
+        }
+        break;
+      case AS_OP_MOVE:
+        dst = regs[inst.b];
+        break;
+      case AS_OP_MOVE_STRING:
+        {
+          cString* str = new cString(stringOf(regs[inst.b]));
+          release(dst);
+          dst.as_string = str;
+          dst.type = TYPE(STRING);
+        }
+        break;
+      case AS_OP_MOVE_OBJECT:
+        {
+          cASNativeObject* nobj = regs[inst.b].as_nobj;
+          const sASTypeInfo* info = regs[inst.b].info;
+          if (nobj) nobj->GetReference();
+          release(dst);
+          dst.as_nobj = nobj;
+          dst.type = TYPE(OBJECT_REF);
+          dst.info = info;
+        }
+        break;
+      case AS_OP_MOVE_ANY:
+        copyValue(dst, regs[inst.b]);
+        break;
+      case AS_OP_LOAD_GLOBAL:
+        copyValue(dst, m_stack[inst.b]);
+        break;
+      case AS_OP_STORE_GLOBAL:
+        copyValue(m_stack[inst.a], regs[inst.b]);
+        break;
+      case AS_OP_CLEAR:
+        release(dst);
+        dst.type = TYPE(INVALID);
+        break;
+
+      // Conversions
+      case AS_OP_INT_TO_FLOAT:
+        dst.as_float = (double)regs[inst.b].as_int;
+        dst.type = TYPE(FLOAT);
+        break;
+      case AS_OP_CAST:
+        {
+          sValue value;
+          cast(regs[inst.b], (ASType_t)inst.aux, (inst.c >= 0) ? &m_program->types[inst.c] : NULL, value,
+               *func.positions[pc - 1]);
+          release(dst);
+          dst = value;
+        }
+        break;
+
+      // Integer arithmetic
+      case AS_OP_ADD_INT:     dst.as_int = regs[inst.b].as_int + regs[inst.c].as_int; dst.type = TYPE(INT); break;
+      case AS_OP_SUB_INT:     dst.as_int = regs[inst.b].as_int - regs[inst.c].as_int; dst.type = TYPE(INT); break;
+      case AS_OP_MUL_INT:     dst.as_int = regs[inst.b].as_int * regs[inst.c].as_int; dst.type = TYPE(INT); break;
+      case AS_OP_DIV_INT:
+      case AS_OP_MOD_INT:
+        {
+          int r = regs[inst.c].as_int;
+          if (r == 0) reportError(AS_DIRECT_INTERPRET_ERR_DIVISION_BY_ZERO, *func.positions[pc - 1], __LINE__);
+          dst.as_int = (inst.op == AS_OP_DIV_INT) ? (regs[inst.b].as_int / r) : (regs[inst.b].as_int % r);
+          dst.type = TYPE(INT);
+        }
+        break;
+      case AS_OP_ADDI_INT:    dst.as_int = regs[inst.b].as_int + inst.c; dst.type = TYPE(INT); break;
+      case AS_OP_NEG_INT:     dst.as_int = -regs[inst.b].as_int; dst.type = TYPE(INT); break;
+      case AS_OP_BIT_NOT_INT: dst.as_int = ~regs[inst.b].as_int; dst.type = TYPE(INT); break;
+      case AS_OP_BIT_AND_INT: dst.as_int = regs[inst.b].as_int & regs[inst.c].as_int; dst.type = TYPE(INT); break;
+      case AS_OP_BIT_OR_INT:  dst.as_int = regs[inst.b].as_int | regs[inst.c].as_int; dst.type = TYPE(INT); break;
+      case AS_OP_EQ_INT:      dst.as_int = (regs[inst.b].as_int == regs[inst.c].as_int); dst.type = TYPE(BOOL); break;
+      case AS_OP_NE_INT:      dst.as_int = (regs[inst.b].as_int != regs[inst.c].as_int); dst.type = TYPE(BOOL); break;
+      case AS_OP_LT_INT:      dst.as_int = (regs[inst.b].as_int < regs[inst.c].as_int); dst.type = TYPE(BOOL); break;
+      case AS_OP_LE_INT:      dst.as_int = (regs[inst.b].as_int <= regs[inst.c].as_int); dst.type = TYPE(BOOL); break;
+      case AS_OP_GT_INT:      dst.as_int = (regs[inst.b].as_int > regs[inst.c].as_int); dst.type = TYPE(BOOL); break;
+      case AS_OP_GE_INT:      dst.as_int = (regs[inst.b].as_int >= regs[inst.c].as_int); dst.type = TYPE(BOOL); break;
+
+      // Float arithmetic
+      case AS_OP_ADD_FLOAT:   dst.as_float = regs[inst.b].as_float + regs[inst.c].as_float; dst.type = TYPE(FLOAT); break;
+      case AS_OP_SUB_FLOAT:   dst.as_float = regs[inst.b].as_float - regs[inst.c].as_float; dst.type = TYPE(FLOAT); break;
+      case AS_OP_MUL_FLOAT:   dst.as_float = regs[inst.b].as_float * regs[inst.c].as_float; dst.type = TYPE(FLOAT); break;
+      case AS_OP_DIV_FLOAT:
+      case AS_OP_MOD_FLOAT:
+        {
+          double r = regs[inst.c].as_float;
+          if (r == 0.0) reportError(AS_DIRECT_INTERPRET_ERR_DIVISION_BY_ZERO, *func.positions[pc - 1], __LINE__);
+          dst.as_float = (inst.op == AS_OP_DIV_FLOAT) ? (regs[inst.b].as_float / r) : fmod(regs[inst.b].as_float, r);
+          dst.type = TYPE(FLOAT);
+        }
+        break;
+      case AS_OP_NEG_FLOAT:   dst.as_float = -regs[inst.b].as_float; dst.type = TYPE(FLOAT); break;
+      case AS_OP_EQ_FLOAT:    dst.as_int = (regs[inst.b].as_float == regs[inst.c].as_float); dst.type = TYPE(BOOL); break;
+      case AS_OP_NE_FLOAT:    dst.as_int = (regs[inst.b].as_float != regs[inst.c].as_float); dst.type = TYPE(BOOL); break;
+      case AS_OP_LT_FLOAT:    dst.as_int = (regs[inst.b].as_float < regs[inst.c].as_float); dst.type = TYPE(BOOL); break;
+      case AS_OP_LE_FLOAT:    dst.as_int = (regs[inst.b].as_float <= regs[inst.c].as_float); dst.type = TYPE(BOOL); break;
+      case AS_OP_GT_FLOAT:    dst.as_int = (regs[inst.b].as_float > regs[inst.c].as_float); dst.type = TYPE(BOOL); break;
+      case AS_OP_GE_FLOAT:    dst.as_int = (regs[inst.b].as_float >= regs[inst.c].as_float); dst.type = TYPE(BOOL); break;
+
+      // Bool and string operations
+      case AS_OP_NOT_BOOL:    dst.as_int = !regs[inst.b].as_int; dst.type = TYPE(BOOL); break;
+      case AS_OP_AND_BOOL:    dst.as_int = (regs[inst.b].as_int && regs[inst.c].as_int); dst.type = TYPE(BOOL); break;
+      case AS_OP_OR_BOOL:     dst.as_int = (regs[inst.b].as_int || regs[inst.c].as_int); dst.type = TYPE(BOOL); break;
+      case AS_OP_EQ_BOOL:     dst.as_int = (regs[inst.b].as_int == regs[inst.c].as_int); dst.type = TYPE(BOOL); break;
+      case AS_OP_NE_BOOL:     dst.as_int = (regs[inst.b].as_int != regs[inst.c].as_int); dst.type = TYPE(BOOL); break;
+      case AS_OP_ADD_STRING:
+        {
+          cString* str = new cString(stringOf(regs[inst.b]) + stringOf(regs[inst.c]));
+          release(dst);
+          dst.as_string = str;
+          dst.type = TYPE(STRING);
+        }
+        break;
+      case AS_OP_EQ_STRING:
+        dst.as_int = (stringOf(regs[inst.b]) == stringOf(regs[inst.c]));
+        dst.type = TYPE(BOOL);
+        break;
+      case AS_OP_NE_STRING:
+        dst.as_int = (stringOf(regs[inst.b]) != stringOf(regs[inst.c]));
+        dst.type = TYPE(BOOL);
+        break;
+
+      // Runtime typed operations
+      case AS_OP_BINARY_ANY:
+        {
+          sValue value;
+          binaryAny((ASToken_t)inst.aux, regs[inst.b], regs[inst.c], value, *func.positions[pc - 1]);
+          release(dst);
+          dst = value;
+        }
+        break;
+      case AS_OP_NEG_ANY:
+      case AS_OP_BIT_NOT_ANY:
+        {
+          const cASFilePosition& fp = *func.positions[pc - 1];
+          const bool neg = (inst.op == AS_OP_NEG_ANY);
+          const sValue& src = regs[inst.b];
+          sValue value;
+          value.type = src.type;
+          value.info = NULL;
+          switch (src.type) {
+            case TYPE(CHAR):  value.as_int = (char)(neg ? -src.as_int : ~src.as_int); break;
+            case TYPE(INT):   value.as_int = neg ? -src.as_int : ~src.as_int; break;
+            case TYPE(FLOAT):
+              if (!neg) INTERPRET_ERROR(UNDEFINED_TYPE_OP, mapToken(TOKEN(OP_BIT_NOT)), mapType(src.type));
+              value.as_float = -src.as_float;
+              break;
+
+            default:
+              INTERPRET_ERROR(UNDEFINED_TYPE_OP, mapToken(neg ? TOKEN(OP_SUB) : TOKEN(OP_BIT_NOT)), mapType(src.type));
+          }
+          release(dst);
+          dst = value;
+        }
+        break;
+
+      // Control flow
+      case AS_OP_JUMP:
+        pc = inst.b;
+        break;
+      case AS_OP_JUMP_FALSE:
+        if (!dst.as_int) pc = inst.b;
+        break;
+      case AS_OP_JUMP_TRUE:
+        if (dst.as_int) pc = inst.b;
+        break;
+      case AS_OP_CHECK_SIZE:
+        if (dst.as_int < 0) reportError(AS_DIRECT_INTERPRET_ERR_INVALID_ARRAY_SIZE, *func.positions[pc - 1], __LINE__);
+        break;
+
+      case AS_OP_CALL:
+        {
+          const cASBytecode::sFunction& callee = *m_program->functions[inst.c];
+          const int callee_base = base + func.num_regs;
+          if (m_stack.GetSize() < callee_base + callee.num_regs) {
+            m_stack.Resize(callee_base + callee.num_regs);
+            regs = &m_stack[base];
+          }
+          initFrame(callee, callee_base);
+
+          // Arguments move into the parameter registers, the caller clears its copies without releasing them
+          sValue* callee_regs = &m_stack[callee_base];
+          for (int i = 0; i < callee.params.GetSize(); i++) {
+            callee_regs[callee.params[i]] = regs[inst.b + i];
+            regs[inst.b + i].type = TYPE(INVALID);
+          }
+
+          sValue rvalue = execute(callee, callee_base);
+          releaseFrame(callee, callee_base);
+          regs = &m_stack[base];
+
+          release(regs[inst.a]);
+          regs[inst.a] = rvalue;
+        }
+        break;
+
+      case AS_OP_CALL_LIBRARY:
+        {
+          const cASFunction* lib_func = m_program->library[inst.c];
+          cASCPPParameter args[MAX_NATIVE_ARGS];
+          for (int i = 0; i < lib_func->GetArity(); i++) {
+            setParameter(args[i], regs[inst.b + i], lib_func->GetArgumentType(i).type);
+          }
+
+          cASCPPParameter rvalue = lib_func->Call(args);
+          setReturn(dst, rvalue, lib_func->GetReturnType(), *func.positions[pc - 1]);
+        }
+        break;
+
+      case AS_OP_CALL_METHOD:
+        {
+          const cASFilePosition& fp = *func.positions[pc - 1];
+          const sValue& obj = regs[inst.b];
+          if (obj.type != TYPE(OBJECT_REF)) INTERPRET_ERROR(TYPE_CAST, mapType(obj.type), mapType(TYPE(OBJECT_REF)));
+          cASNativeObject* nobj = obj.as_nobj;
+          if (!nobj) INTERPRET_ERROR(INTERNAL);
+
+          // Method lookup is cached per call site, keyed on the native type of the object
+          cASBytecode::sMethodSite& site = m_program->sites[inst.c];
+          const char* type_key = nobj->GetType();
+          if (site.type_key != type_key) {
+            int mid = -1;
+            if (!nobj->LookupMethod(site.name, mid)) {
+              INTERPRET_ERROR(NOBJ_METHOD_LOOKUP_FAILED, (const char*)site.name, (obj.info) ? (const char*)obj.info->info : type_key);
+            }
+            site.type_key = type_key;
+            site.mid = mid;
+          }
+          const int mid = site.mid;
+
+          const int arity = nobj->GetArity(mid);
+          if (arity > site.num_args || arity > MAX_NATIVE_ARGS) INTERPRET_ERROR(INTERNAL);
+
+          sValue conv[MAX_NATIVE_ARGS];
+          cASCPPParameter args[MAX_NATIVE_ARGS];
+          for (int i = 0; i < arity; i++) {
+            ASType_t arg_type = nobj->GetArgumentType(mid, i).type;
+            switch (arg_type) {
+              case TYPE(BOOL):
+              case TYPE(CHAR):
+              case TYPE(FLOAT):
+              case TYPE(INT):
+              case TYPE(STRING):
+                cast(regs[site.first_arg + i], arg_type, NULL, conv[i], fp);
+                setParameter(args[i], conv[i], arg_type);
+                break;
+
+              default:
+                INTERPRET_ERROR(INTERNAL);
+            }
+          }
+
+          cASCPPParameter rvalue = nobj->CallMethod(mid, args);
+          for (int i = 0; i < arity; i++) release(conv[i]);
+
+          setReturn(dst, rvalue, nobj->GetReturnType(mid), fp);
+        }
+        break;
+
+      case AS_OP_RETURN:
+        {
+          sValue rvalue = dst;
+          dst.type = TYPE(INVALID);   // Ownership moves to the caller
+          return rvalue;
+        }
+
+      case AS_OP_RETURN_NONE:
+        {
+          sValue rvalue;
+          rvalue.type = func.rtype.type;
+          rvalue.info = &func.rtype;
+          switch (rvalue.type) {
+            case TYPE(FLOAT):       rvalue.as_float = 0.0; break;
+            case TYPE(STRING):      rvalue.as_string = NULL; break;
+            case TYPE(OBJECT_REF):  rvalue.as_nobj = NULL; break;
+            default:                rvalue.as_int = 0; break;
+          }
+          return rvalue;
+        }
+
+      default:
+        reportError(AS_DIRECT_INTERPRET_ERR_INTERNAL, *func.positions[pc - 1], __LINE__);
+    }
+  }
+}
+
+
+void cBytecodeInterpreter::initFrame(const cASBytecode::sFunction& func, int base)
+{
+  sValue* regs = &m_stack[base];
+  const int num_vars = func.var_types.GetSize();
+  for (int i = 0; i < num_vars; i++) {
+    regs[i].type = func.var_types[i]->type;
+    regs[i].info = func.var_types[i];
+    switch (regs[i].type) {
+      case TYPE(FLOAT):       regs[i].as_float = 0.0; break;
+      case TYPE(STRING):      regs[i].as_string = NULL; break;
+      case TYPE(OBJECT_REF):  regs[i].as_nobj = NULL; break;
+      default:                regs[i].as_int = 0; break;
+    }
+  }
+  for (int i = num_vars; i < func.num_regs; i++) {
+    regs[i].type = TYPE(INVALID);
+    regs[i].info = NULL;
+  }
+}
+
+
+void cBytecodeInterpreter::releaseFrame(const cASBytecode::sFunction& func, int base)
+{
+  sValue* regs = &m_stack[base];
+  for (int i = 0; i < func.num_regs; i++) {
+    release(regs[i]);
+    regs[i].type = TYPE(INVALID);
+  }
+}
+
+
+inline void cBytecodeInterpreter::release(sValue& value)
+{
+  switch (value.type) {
+    case TYPE(STRING):
+      delete value.as_string;
+      value.as_string = NULL;
+      break;
+    case TYPE(OBJECT_REF):
+      if (value.as_nobj) value.as_nobj->RemoveReference();
+      value.as_nobj = NULL;
+      break;
+
+    default:
+      break;
+  }
+}
+
+
+inline const cString& cBytecodeInterpreter::stringOf(const sValue& value)
+{
+  return (value.as_string) ? *value.as_string : s_empty_string;
+}
+
+
+inline void cBytecodeInterpreter::copyValue(sValue& dst, const sValue& src)
+{
+  sValue value = src;
+  if (src.type == TYPE(STRING)) value.as_string = new cString(stringOf(src));
+  else if (src.type == TYPE(OBJECT_REF) && src.as_nobj) src.as_nobj->GetReference();
+  release(dst);
+  dst = value;
+}
+
+
+void cBytecodeInterpreter::cast(const sValue& src, ASType_t type, const sASTypeInfo* info, sValue& dst,
+                                const cASFilePosition& fp)
+{
+  dst.type = type;
+  dst.info = NULL;
+
+  switch (type) {
+    case TYPE(BOOL):
+      switch (src.type) {
+        case TYPE(BOOL):
+        case TYPE(CHAR):
+        case TYPE(INT):     dst.as_int = (src.as_int != 0); break;
+        case TYPE(FLOAT):   dst.as_int = (src.as_float != 0); break;
+        case TYPE(STRING):  dst.as_int = (stringOf(src) != ""); break;
+
+        case TYPE(OBJECT_REF): // @AS_TODO - implement asBool
+          INTERPRET_ERROR(INTERNAL);
+
+        default:
+          INTERPRET_ERROR(TYPE_CAST, mapType(src.type), mapType(TYPE(BOOL)));
+      }
+      break;
+
+    case TYPE(CHAR):
+      switch (src.type) {
+        case TYPE(BOOL):
+        case TYPE(CHAR):    dst.as_int = src.as_int; break;
+        case TYPE(INT):     dst.as_int = (char)src.as_int; break;
+
+        default:
+          INTERPRET_ERROR(TYPE_CAST, mapType(src.type), mapType(TYPE(CHAR)));
+      }
+      break;
+
+    case TYPE(INT):
+      switch (src.type) {
+        case TYPE(BOOL):
+        case TYPE(CHAR):
+        case TYPE(INT):     dst.as_int = src.as_int; break;
+        case TYPE(FLOAT):   dst.as_int = (int)src.as_float; break;
+        case TYPE(STRING):  dst.as_int = stringOf(src).AsInt(); break;
+
+        default:
+          INTERPRET_ERROR(TYPE_CAST, mapType(src.type), mapType(TYPE(INT)));
+      }
+      break;
+
+    case TYPE(FLOAT):
+      switch (src.type) {
+        case TYPE(BOOL):
+        case TYPE(CHAR):
+        case TYPE(INT):     dst.as_float = (double)src.as_int; break;
+        case TYPE(FLOAT):   dst.as_float = src.as_float; break;
+        case TYPE(STRING):  dst.as_float = stringOf(src).AsDouble(); break;
+
+        default:
+          INTERPRET_ERROR(TYPE_CAST, mapType(src.type), mapType(TYPE(FLOAT)));
+      }
+      break;
+
+    case TYPE(STRING):
+      switch (src.type) {
+        case TYPE(BOOL):    dst.as_string = new cString(cStringUtil::Convert(src.as_int != 0)); break;
+        case TYPE(CHAR):    dst.as_string = new cString(1); (*dst.as_string)[0] = (char)src.as_int; break;
+        case TYPE(INT):     dst.as_string = new cString(cStringUtil::Convert(src.as_int)); break;
+        case TYPE(FLOAT):   dst.as_string = new cString(cStringUtil::Convert(src.as_float)); break;
+        case TYPE(STRING):  dst.as_string = new cString(stringOf(src)); break;
+
+        case TYPE(OBJECT_REF):
+          if (!src.as_nobj) INTERPRET_ERROR(INTERNAL);
+          dst.as_string = new cString(cStringUtil::Stringf("< %s object @ %p >", src.as_nobj->GetType(), src.as_nobj));
+          break;
+
+        default:
+          INTERPRET_ERROR(TYPE_CAST, mapType(src.type), mapType(TYPE(STRING)));
+      }
+      break;
+
+    case TYPE(OBJECT_REF):
+      if (src.type != TYPE(OBJECT_REF)) INTERPRET_ERROR(TYPE_CAST, mapType(src.type), mapType(TYPE(OBJECT_REF)));
+      if (!src.info || src.info->info != info->info) {
+        INTERPRET_ERROR(NOBJ_TYPE_MISMATCH, (const char*)info->info, (src.info) ? (const char*)src.info->info : "");
+      }
+      dst.as_nobj = src.as_nobj;
+      if (dst.as_nobj) dst.as_nobj->GetReference();
+      dst.info = info;
+      break;
+
+    default:
+      INTERPRET_ERROR(INTERNAL);
+  }
+}
+
+
+void cBytecodeInterpreter::binaryAny(ASToken_t op, const sValue& lhs, const sValue& rhs, sValue& dst,
+                                     const cASFilePosition& fp)
+{
+  dst.info = NULL;
+
+  switch (op) {
+    case TOKEN(OP_EQ):
+    case TOKEN(OP_NEQ):
+    case TOKEN(OP_LE):
+    case TOKEN(OP_GE):
+    case TOKEN(OP_LT):
+    case TOKEN(OP_GT):
+      {
+        ASType_t comptype = getRuntimeType(lhs.type, rhs.type);
+        const bool equality = (op == TOKEN(OP_EQ) || op == TOKEN(OP_NEQ));
+        if (comptype == TYPE(CHAR)) comptype = TYPE(INT);   // Handle both char and int as integers
+        if ((comptype == TYPE(BOOL) && !equality) || (comptype != TYPE(BOOL) && comptype != TYPE(INT) && comptype != TYPE(FLOAT))) {
+          INTERPRET_ERROR(UNDEFINED_TYPE_OP, mapToken(op), mapType(comptype));
+        }
+
+        sValue l, r;
+        cast(lhs, comptype, NULL, l, fp);
+        cast(rhs, comptype, NULL, r, fp);
+
+        double lv = (comptype == TYPE(FLOAT)) ? l.as_float : l.as_int;
+        double rv = (comptype == TYPE(FLOAT)) ? r.as_float : r.as_int;
+        switch (op) {
+          case TOKEN(OP_EQ):  dst.as_int = (lv == rv); break;
+          case TOKEN(OP_NEQ): dst.as_int = (lv != rv); break;
+          case TOKEN(OP_LE):  dst.as_int = (lv <= rv); break;
+          case TOKEN(OP_GE):  dst.as_int = (lv >= rv); break;
+          case TOKEN(OP_LT):  dst.as_int = (lv < rv); break;
+          default:            dst.as_int = (lv > rv); break;
+        }
+        dst.type = TYPE(BOOL);
+      }
+      break;
+
+    case TOKEN(OP_BIT_AND):
+    case TOKEN(OP_BIT_OR):
+    case TOKEN(OP_ADD):
+    case TOKEN(OP_SUB):
+    case TOKEN(OP_MUL):
+    case TOKEN(OP_DIV):
+    case TOKEN(OP_MOD):
+      {
+        const bool bitwise = (op == TOKEN(OP_BIT_AND) || op == TOKEN(OP_BIT_OR));
+        ASType_t rettype = getRuntimeType(lhs.type, rhs.type, (op == TOKEN(OP_ADD)));
+        if ((bitwise && rettype != TYPE(CHAR) && rettype != TYPE(INT)) ||
+            (rettype != TYPE(CHAR) && rettype != TYPE(INT) && rettype != TYPE(FLOAT) && rettype != TYPE(STRING))) {
+          INTERPRET_ERROR(UNDEFINED_TYPE_OP, mapToken(op), mapType(rettype));
+        }
+
+        sValue l, r;
+        cast(lhs, rettype, NULL, l, fp);
+        cast(rhs, rettype, NULL, r, fp);
+        dst.type = rettype;
+
+        if (rettype == TYPE(STRING)) {
+          dst.as_string = new cString(*l.as_string + *r.as_string);
+          release(l);
+          release(r);
+        } else if (rettype == TYPE(FLOAT)) {
+          if ((op == TOKEN(OP_DIV) || op == TOKEN(OP_MOD)) && r.as_float == 0.0) INTERPRET_ERROR(DIVISION_BY_ZERO);
+          switch (op) {
+            case TOKEN(OP_ADD): dst.as_float = l.as_float + r.as_float; break;
+            case TOKEN(OP_SUB): dst.as_float = l.as_float - r.as_float; break;
+            case TOKEN(OP_MUL): dst.as_float = l.as_float * r.as_float; break;
+            case TOKEN(OP_DIV): dst.as_float = l.as_float / r.as_float; break;
+            default:            dst.as_float = fmod(l.as_float, r.as_float); break;
+          }
+        } else {
+          if ((op == TOKEN(OP_DIV) || op == TOKEN(OP_MOD)) && r.as_int == 0) INTERPRET_ERROR(DIVISION_BY_ZERO);
+          switch (op) {
+            case TOKEN(OP_BIT_AND): dst.as_int = l.as_int & r.as_int; break;
+            case TOKEN(OP_BIT_OR):  dst.as_int = l.as_int | r.as_int; break;
+            case TOKEN(OP_ADD):     dst.as_int = l.as_int + r.as_int; break;
+            case TOKEN(OP_SUB):     dst.as_int = l.as_int - r.as_int; break;
+            case TOKEN(OP_MUL):     dst.as_int = l.as_int * r.as_int; break;
+            case TOKEN(OP_DIV):     dst.as_int = l.as_int / r.as_int; break;
+            default:                dst.as_int = l.as_int % r.as_int; break;
+          }
+          if (rettype == TYPE(CHAR)) dst.as_int = (char)dst.as_int;
+        }
+      }
+      break;
+
+    case TOKEN(OP_LOGIC_AND):
+    case TOKEN(OP_LOGIC_OR):
+      {
+        sValue l, r;
+        cast(lhs, TYPE(BOOL), NULL, l, fp);
+        cast(rhs, TYPE(BOOL), NULL, r, fp);
+        dst.as_int = (op == TOKEN(OP_LOGIC_AND)) ? (l.as_int && r.as_int) : (l.as_int || r.as_int);
+        dst.type = TYPE(BOOL);
+      }
+      break;
+
+    default:
+      INTERPRET_ERROR(INTERNAL);
+  }
+}
+
+
+void cBytecodeInterpreter::setParameter(cASCPPParameter& param, sValue& value, ASType_t type)
+{
+  // Strings and objects are borrowed from the register for the duration of the call
+  switch (type) {
+    case TYPE(BOOL):        param.Set((bool)value.as_int); break;
+    case TYPE(CHAR):        param.Set((char)value.as_int); break;
+    case TYPE(INT):         param.Set(value.as_int); break;
+    case TYPE(FLOAT):       param.Set(value.as_float); break;
+    case TYPE(STRING):
+      if (!value.as_string) value.as_string = new cString;
+      param.Set(value.as_string);
+      break;
+    case TYPE(OBJECT_REF):  param.Set(value.as_nobj); break;
+
+    default:
+      break;
+  }
+}
+
+
+void cBytecodeInterpreter::setReturn(sValue& dst, const cASCPPParameter& rvalue, const sASTypeInfo& rtype,
+                                     const cASFilePosition& fp)
+{
+  release(dst);
+  dst.type = rtype.type;
+  dst.info = NULL;
+
+  switch (rtype.type) {
+    case TYPE(BOOL):        dst.as_int = rvalue.Get<bool>(); break;
+    case TYPE(CHAR):        dst.as_int = rvalue.Get<char>(); break;
+    case TYPE(FLOAT):       dst.as_float = rvalue.Get<double>(); break;
+    case TYPE(INT):         dst.as_int = rvalue.Get<int>(); break;
+    case TYPE(STRING):      dst.as_string = rvalue.Get<cString*>(); break;
+    case TYPE(OBJECT_REF):
+      dst.as_nobj = rvalue.Get<cASNativeObject*>();
+      dst.info = &rtype;
+      break;
+    case TYPE(VOID):
+      dst.type = TYPE(INVALID);
+      break;
+
+    default:
+      INTERPRET_ERROR(INTERNAL);
+  }
+}
+
+
+void cBytecodeInterpreter::reportError(ASDirectInterpretError_t err, const cASFilePosition& fp, const int line, ...)
+{
+#if DEBUG_AS_BYTECODE_INTERPRET
+# define ERR_ENDL "  (cBytecodeInterpreter.cc:" << line << ")" << std::endl
+#else
+# define ERR_ENDL std::endl
+#endif
+
+#define VA_ARG_STR va_arg(vargs, const char*)
+
+  std::cerr << fp.GetFilename() << ":" << fp.GetLineNumber() << ": error: ";
+
+  va_list vargs;
+  va_start(vargs, line);
+  switch (err) {
+    case AS_DIRECT_INTERPRET_ERR_DIVISION_BY_ZERO:
+      std::cerr << "division by zero" << ERR_ENDL;
+      break;
+    case AS_DIRECT_INTERPRET_ERR_INVALID_ARRAY_SIZE:
+      std::cerr << "invalid array dimension" << ERR_ENDL;
+      break;
+    case AS_DIRECT_INTERPRET_ERR_NOBJ_METHOD_LOOKUP_FAILED:
+      {
+        const char* meth = VA_ARG_STR;
+        const char* itype = VA_ARG_STR;
+        std::cerr << "method '" << meth << "' not supported by '" << itype << "'" << ERR_ENDL;
+      }
+      break;
+    case AS_DIRECT_INTERPRET_ERR_NOBJ_TYPE_MISMATCH:
+      {
+        const char* otype = VA_ARG_STR;
+        const char* itype = VA_ARG_STR;
+        std::cerr << "expected object of type '" << otype << "', received '" << itype << "'" << ERR_ENDL;
+      }
+      break;
+    case AS_DIRECT_INTERPRET_ERR_TYPE_CAST:
+      {
+        const char* type1 = VA_ARG_STR;
+        const char* type2 = VA_ARG_STR;
+        std::cerr << "cannot convert '" << type1 << "' to '" << type2 << "'" << ERR_ENDL;
+      }
+      break;
+    case AS_DIRECT_INTERPRET_ERR_UNDEFINED_TYPE_OP:
+      {
+        const char* op = VA_ARG_STR;
+        const char* type = VA_ARG_STR;
+        std::cerr << "'" << op << "' operation undefined for type '" << type << "'" << ERR_ENDL;
+      }
+      break;
+
+    case AS_DIRECT_INTERPRET_ERR_INTERNAL:
+      std::cerr << "internal interpreter error at cBytecodeInterpreter.cc:" << line << std::endl;
+      break;
+    case AS_DIRECT_INTERPRET_ERR_UNKNOWN:
+    default:
+      std::cerr << "unknown error" << std::endl;
+  }
+  va_end(vargs);
+
+  exit(AS_EXIT_FAIL_INTERPRET);
+
+#undef ERR_ENDL
+#undef VA_ARG_STR
+}
+
+#undef INTERPRET_ERROR
+#undef MAX_NATIVE_ARGS
+#undef TOKEN
+#undef TYPE
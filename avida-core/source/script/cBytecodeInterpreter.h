@@ -0,0 +1,88 @@
+/*
+ *  cBytecodeInterpreter.h
+ *  Avida
+ *
+ *  Copyright 2026 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef cBytecodeInterpreter_h
+#define cBytecodeInterpreter_h
+
+#include "cASBytecode.h"
+
+class cASCPPParameter;
+class cASNativeObject;
+
+
+// cBytecodeInterpreter - runs a program compiled by cBytecodeCompileASTVisitor
+// --------------------------------------------------------------------------------------------------------------
+//
+//  Executes the same semantics as cDirectInterpretASTVisitor, including its conversions and error messages, over a
+//  single register stack.  Runtime errors are reported as 'file:line: error: ...' and exit the process with
+//  AS_EXIT_FAIL_INTERPRET, as the tree interpreter does.
+
+class cBytecodeInterpreter
+{
+private:
+  struct sValue
+  {
+    union {
+      int as_int;                 // Also holds bool and char values
+      double as_float;
+      cString* as_string;         // NULL reads as the empty string
+      cASNativeObject* as_nobj;
+    };
+    ASType_t type;
+    const sASTypeInfo* info;      // Object type, for object references
+  };
+
+  cASBytecode* m_program;
+  Apto::Array<sValue, Apto::Smart> m_stack;
+
+
+  // --------  Private Constructors  --------
+  cBytecodeInterpreter(const cBytecodeInterpreter&); // @not_implemented
+  cBytecodeInterpreter& operator=(const cBytecodeInterpreter&); // @not_implemented
+
+
+public:
+  cBytecodeInterpreter(cASBytecode* program);
+  ~cBytecodeInterpreter();
+
+  int Run();
+
+
+private:
+  // --------  Internal Utility Methods  --------
+  sValue execute(const cASBytecode::sFunction& func, int base);
+
+  void initFrame(const cASBytecode::sFunction& func, int base);
+  void releaseFrame(const cASBytecode::sFunction& func, int base);
+
+  static inline void release(sValue& value);
+  static inline const cString& stringOf(const sValue& value);
+  static inline void copyValue(sValue& dst, const sValue& src);
+
+  void cast(const sValue& src, ASType_t type, const sASTypeInfo* info, sValue& dst, const cASFilePosition& fp);
+  void binaryAny(ASToken_t op, const sValue& lhs, const sValue& rhs, sValue& dst, const cASFilePosition& fp);
+  void setParameter(cASCPPParameter& param, sValue& value, ASType_t type);
+  void setReturn(sValue& dst, const cASCPPParameter& rvalue, const sASTypeInfo& rtype, const cASFilePosition& fp);
+
+  void reportError(ASDirectInterpretError_t err, const cASFilePosition& fp, const int line, ...);
+};
+
+#endif
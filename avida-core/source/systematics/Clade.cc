@@ -50,7 +50,7 @@ void Avida::Systematics::Clade::Initialize()
 
 
 Avida::Systematics::Clade::Clade(CladeArbiterPtr mgr, GroupID in_id, const Apto::String& name, bool create_empty)
-: Group(in_id)
+: Group(in_id, InternRole(mgr->Role()))
 , m_mgr(mgr)
 , m_handle(NULL)
 , m_name(name)
@@ -40,7 +40,7 @@ Avida::Systematics::GenomeTestMetrics::GenomeTestMetrics(cWorld* world, cAvidaCo
   Apto::SmartPtr<cTestCPU> testcpu(world->GetHardwareManager().CreateTestCPU(ctx));
   
   cCPUTestInfo test_info;
-  testcpu->TestGenome(ctx, test_info, Genome(g->Properties().Get("genome").StringValue()));
+  testcpu->TestGenome(ctx, test_info, Genome(*g->RepresentativeGenome()));
   
   m_is_viable = test_info.IsViable();
   
@@ -69,7 +69,7 @@ Avida::Systematics::GenomeTestMetricsPtr Avida::Systematics::GenomeTestMetrics::
                                                                                            GroupPtr g)
 {
   GenomeTestMetricsPtr metrics = g->GetData<GenomeTestMetrics>();
-  if (!metrics && g->Properties().Has("genome")) {
+  if (!metrics && g->RepresentativeGenome()) {
     metrics = GenomeTestMetricsPtr(new GenomeTestMetrics(world, ctx, g));
     assert(metrics);
     g->AttachData(metrics);
@@ -127,7 +127,7 @@ void Avida::Systematics::Genotype::Initialize()
 
 Avida::Systematics::Genotype::Genotype(GenotypeArbiterPtr mgr, GroupID in_id, UnitPtr founder, Update update,
                              ConstGroupMembershipPtr parents)
-  : Group(in_id)
+  : Group(in_id, InternRole(mgr->Role()))
   , m_mgr(mgr)
   , m_handle(NULL)
   , m_src(founder->UnitSource())
@@ -185,7 +185,7 @@ Avida::Systematics::Genotype::Genotype(GenotypeArbiterPtr mgr, GroupID in_id, Un
 
 
 Avida::Systematics::Genotype::Genotype(GenotypeArbiterPtr mgr, GroupID in_id, void* prop_p)
-: Group(in_id)
+: Group(in_id, InternRole(mgr->Role()))
 , m_mgr(mgr)
 , m_handle(NULL)
 , m_name("001-no_name")
@@ -337,6 +337,11 @@ const Avida::PropertyMap& Avida::Systematics::Genotype::Properties() const
   return *m_prop_map;
 }
 
+const Avida::Genome* Avida::Systematics::Genotype::RepresentativeGenome() const
+{
+  return &m_genome;
+}
+
 int Avida::Systematics::Genotype::Depth() const
 {
   return m_depth;
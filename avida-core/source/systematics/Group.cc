@@ -24,13 +24,97 @@
 
 #include "avida/systematics/Group.h"
 
+#include "apto/core/Atomic.h"
+
 #include <cassert>
 
 
+namespace {
+  // Process wide role table, shared by all worlds.  The first MAX_PUBLISHED roles are also kept in an append-only
+  // array indexed by atom.  A slot is written before the published count is raised past it and is never changed
+  // afterwards, so FindRole can scan the published roles without taking the lock.
+  class RoleTable
+  {
+  public:
+    static const int MAX_PUBLISHED = 32;
+    
+    Apto::Mutex mutex;
+    Apto::Map<Avida::Systematics::RoleID, Avida::Systematics::RoleAtom> atoms;
+    int num_atoms;
+    
+    Avida::Systematics::RoleID published[MAX_PUBLISHED];
+    volatile int num_published;
+    
+    RoleTable() : num_atoms(0), num_published(0)
+    {
+      // Built-in roles, in the order of their fixed atoms
+      add("genotype");
+      add("clade");
+    }
+    
+    Avida::Systematics::RoleAtom findPublished(const Avida::Systematics::RoleID& role) const
+    {
+      const int count = Apto::Atomic::Get(&num_published);
+      for (int i = 0; i < count; i++) if (published[i] == role) return i;
+      return -1;
+    }
+    
+    // Caller must hold the mutex (or be the constructor)
+    Avida::Systematics::RoleAtom add(const Avida::Systematics::RoleID& role)
+    {
+      const Avida::Systematics::RoleAtom atom = num_atoms++;
+      atoms.Set(role, atom);
+      if (atom < MAX_PUBLISHED) {
+        published[atom] = role;
+        Apto::Atomic::Set(&num_published, atom + 1);
+      }
+      return atom;
+    }
+  };
+  
+  RoleTable& roleTable()
+  {
+    static RoleTable table;
+    return table;
+  }
+}
+
+
+Avida::Systematics::RoleAtom Avida::Systematics::InternRole(const RoleID& role)
+{
+  RoleTable& table = roleTable();
+  RoleAtom atom = table.findPublished(role);
+  if (atom >= 0) return atom;
+  
+  Apto::MutexAutoLock lock(table.mutex);
+  if (!table.atoms.Get(role, atom)) atom = table.add(role);
+  return atom;
+}
+
+
+Avida::Systematics::RoleAtom Avida::Systematics::FindRole(const RoleID& role)
+{
+  RoleTable& table = roleTable();
+  RoleAtom atom = table.findPublished(role);
+  if (atom >= 0 || Apto::Atomic::Get(&table.num_published) < RoleTable::MAX_PUBLISHED) return atom;
+  
+  // Only roles beyond the published ones need the lock
+  Apto::MutexAutoLock lock(table.mutex);
+  if (!table.atoms.Get(role, atom)) return -1;
+  return atom;
+}
+
+
 Avida::Systematics::Group::~Group() { ; }
 Avida::Systematics::GroupData::~GroupData() { ; }
 
 
+const Avida::Genome* Avida::Systematics::Group::RepresentativeGenome() const
+{
+  return NULL;
+}
+
+
 bool Avida::Systematics::Group::Serialize(ArchivePtr) const
 {
   // @TODO - serialize attached data
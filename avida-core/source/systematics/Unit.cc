@@ -66,7 +66,14 @@ Avida::Systematics::Unit::~Unit()
 
 Avida::Systematics::GroupPtr Avida::Systematics::Unit::SystematicsGroup(const RoleID& role) const
 {
-  for (int i = 0; i < m_groups->GetSize(); i++) if (m_groups->Get(i)->Role() == role) return m_groups->Get(i);
+  const RoleAtom atom = FindRole(role);
+  if (atom < 0) return GroupPtr();
+  return SystematicsGroup(atom);
+}
+
+Avida::Systematics::GroupPtr Avida::Systematics::Unit::SystematicsGroup(RoleAtom role) const
+{
+  for (int i = 0; i < m_groups->GetSize(); i++) if (m_groups->Get(i)->InternedRole() == role) return m_groups->Get(i);
   return GroupPtr();
 }
 
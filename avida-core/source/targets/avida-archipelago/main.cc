@@ -0,0 +1,180 @@
+/*
+ *  avida-archipelago/main.cc
+ *  Avida
+ *
+ *  Copyright 2026 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "apto/core/FileSystem.h"
+#include "apto/core/Thread.h"
+#include "apto/platform.h"
+#include "avida/Avida.h"
+#include "avida/core/World.h"
+#include "avida/output/Manager.h"
+#include "avida/util/CmdLine.h"
+
+#include "cArchipelago.h"
+#include "cArchipelagoWorld.h"
+#include "cAvidaConfig.h"
+#include "cString.h"
+#include "cStringUtil.h"
+#include "cUserFeedback.h"
+
+#include "Avida2Driver.h"
+
+#include <ctime>
+#include <iostream>
+
+using namespace std;
+
+
+// Runs a single island to completion, then releases the other islands from waiting on it
+class IslandThread : public Apto::Thread
+{
+private:
+  Avida2Driver* m_driver;
+  cArchipelago* m_archipelago;
+  int m_island;
+
+protected:
+  void Run()
+  {
+    m_driver->Run();
+    m_archipelago->Leave(m_island);
+  }
+
+public:
+  IslandThread(Avida2Driver* driver, cArchipelago* archipelago, int island)
+    : m_driver(driver), m_archipelago(archipelago), m_island(island) { ; }
+};
+
+
+// Drivers own their worlds, which in turn own their configurations
+static void DeleteDrivers(Apto::Array<Avida2Driver*>& drivers, int count)
+{
+  for (int island = 0; island < count; island++) delete drivers[island];
+}
+
+
+static void PrintArchipelagoUsage(const char* name)
+{
+  cout << "Usage: " << name << " [-islands <n>] [avida options]" << endl << endl;
+  cout << "  -islands <n>     Number of worlds, each run on its own thread (default: number of CPUs)" << endl;
+  cout << "  -islands-help    Print this message" << endl << endl;
+  cout << "Island i uses RANDOM_SEED + i and writes to DATA_DIR_i.  Migration follows BIRTH_METHOD as in avida-mp," << endl;
+  cout << "with migrants exchanged every MP_MIGRATION_INTERVAL updates.  All other options are passed through to" << endl;
+  cout << "the Avida configuration of every island, see '" << name << " -h'." << endl;
+}
+
+
+int main(int argc, char * argv[])
+{
+  int num_islands = Apto::Platform::AvailableCPUs();
+
+  // Strip archipelago specific options, passing all others through to the standard command line processing
+  Apto::Array<char*> avida_argv;
+  avida_argv.Push(argv[0]);
+  for (int i = 1; i < argc; i++) {
+    cString cur_arg(argv[i]);
+    if (cur_arg == "-islands-help") {
+      PrintArchipelagoUsage(argv[0]);
+      return 0;
+    } else if (cur_arg == "-islands" && i + 1 < argc) {
+      num_islands = cString(argv[++i]).AsInt();
+    } else {
+      avida_argv.Push(argv[i]);
+    }
+  }
+
+  if (num_islands < 1) {
+    cerr << "error: the number of islands must be at least 1" << endl;
+    return -1;
+  }
+
+  Avida::Initialize();
+
+  cout << Avida::Version::Banner() << endl;
+
+  cArchipelago archipelago(num_islands);
+  Apto::Array<Avida2Driver*> drivers(num_islands);
+  int base_seed = -1;
+
+  for (int island = 0; island < num_islands; island++) {
+    // Every island gets its own configuration object, as worlds take ownership of theirs
+    Apto::Map<Apto::String, Apto::String> defs;
+    cAvidaConfig* cfg = new cAvidaConfig();
+    Avida::Util::ProcessCmdLineArgs(avida_argv.GetSize(), &avida_argv[0], cfg, defs);
+
+    if (island == 0) {
+      if (cfg->ANALYZE_MODE.Get() > 0) {
+        cerr << "error: analyze mode is not supported by " << argv[0] << endl;
+        delete cfg;
+        return -1;
+      }
+      if (cfg->BIRTH_METHOD.Get() == POSITION_OFFSPRING_RANDOM && archipelago.GetDimension() == 0) {
+        cerr << "error: spatial migration (BIRTH_METHOD 0) requires a square number of islands" << endl;
+        delete cfg;
+        return -1;
+      }
+      base_seed = cfg->RANDOM_SEED.Get();
+      if (base_seed < 0) base_seed = static_cast<int>(time(NULL));
+    }
+
+    cfg->ENABLE_MP.Set(1);
+    cfg->RANDOM_SEED.Set(base_seed + island);
+    cfg->DATA_DIR.Set(cStringUtil::Stringf("%s_%d", (const char*)cfg->DATA_DIR.Get(), island));
+    if (island > 0) cfg->VERBOSITY.Set(VERBOSE_SILENT);
+
+    cUserFeedback feedback;
+    Avida::World* new_world = new Avida::World();
+    cWorld* world = cArchipelagoWorld::Initialize(cfg, cString(Apto::FileSystem::GetCWD()), new_world, &archipelago, island,
+                                                  &feedback, &defs);
+
+    for (int i = 0; i < feedback.GetNumMessages(); i++) {
+      switch (feedback.GetMessageType(i)) {
+        case cUserFeedback::UF_ERROR:    cerr << "error: "; break;
+        case cUserFeedback::UF_WARNING:  cerr << "warning: "; break;
+        default: break;
+      };
+      cerr << "island " << island << ": " << feedback.GetMessage(i) << endl;
+    }
+
+    if (!world) {
+      DeleteDrivers(drivers, island);
+      return -1;
+    }
+
+    cout << "Island " << island << ": Random Seed " << world->GetRandom().Seed()
+         << ", Data Directory " << Avida::Output::Manager::Of(new_world)->OutputPath() << endl;
+
+    drivers[island] = new Avida2Driver(world, new_world);
+  }
+  cout << endl;
+
+  Apto::Array<IslandThread*> threads(num_islands);
+  for (int island = 0; island < num_islands; island++) {
+    threads[island] = new IslandThread(drivers[island], &archipelago, island);
+    threads[island]->Start();
+  }
+  for (int island = 0; island < num_islands; island++) {
+    threads[island]->Join();
+    delete threads[island];
+  }
+  DeleteDrivers(drivers, num_islands);
+
+  return 0;
+}
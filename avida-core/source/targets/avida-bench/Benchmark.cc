@@ -0,0 +1,123 @@
+/*
+ *  Benchmark.cc
+ *  avida-bench
+ *
+ *  Copyright 2026 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "Benchmark.h"
+
+#include "cAvidaContext.h"
+#include "cHighResTimer.h"
+#include "cString.h"
+
+#include <iomanip>
+
+using namespace std;
+
+
+static const int MAX_CALIBRATION_ITERATIONS = 1 << 30;
+
+
+BenchmarkRunner::~BenchmarkRunner()
+{
+  for (int i = 0; i < m_benchmarks.GetSize(); i++) delete m_benchmarks[i];
+}
+
+
+void BenchmarkRunner::Run(cAvidaContext& ctx, Apto::Array<Result>& results, std::ostream& progress)
+{
+  const double min_time_ns = m_min_time * 1.0e9;
+
+  for (int b = 0; b < m_benchmarks.GetSize(); b++) {
+    Benchmark* benchmark = m_benchmarks[b];
+    if (!matchesFilter(benchmark->Name())) continue;
+
+    progress << "running " << benchmark->Name() << "..." << flush;
+
+    // Calibrate - grow the iteration count until a single repetition takes at least the minimum time
+    int iterations = 1;
+    double elapsed = timeRepetition(ctx, benchmark, iterations);
+    while (elapsed < min_time_ns && iterations < MAX_CALIBRATION_ITERATIONS) {
+      double scale = (elapsed > 0.0) ? (1.4 * min_time_ns / elapsed) : 10.0;
+      if (scale > 10.0) scale = 10.0;
+      if (scale < 2.0) scale = 2.0;
+      iterations = (static_cast<double>(iterations) * scale < MAX_CALIBRATION_ITERATIONS) ?
+        static_cast<int>(iterations * scale) : MAX_CALIBRATION_ITERATIONS;
+      elapsed = timeRepetition(ctx, benchmark, iterations);
+    }
+
+    // Timed repetitions, reported as the median to reject scheduling noise
+    Apto::Array<double> samples(m_repetitions);
+    for (int r = 0; r < m_repetitions; r++) {
+      samples[r] = timeRepetition(ctx, benchmark, iterations) / static_cast<double>(iterations);
+    }
+    Apto::QSort(samples);
+
+    Result result;
+    result.name = benchmark->Name();
+    result.iterations = iterations;
+    result.repetitions = m_repetitions;
+    result.min_ns = samples[0];
+    result.max_ns = samples[m_repetitions - 1];
+    result.median_ns = (m_repetitions % 2) ? samples[m_repetitions / 2] :
+      (samples[m_repetitions / 2 - 1] + samples[m_repetitions / 2]) / 2.0;
+    results.Push(result);
+
+    progress << " " << setprecision(6) << result.median_ns << " ns/op" << endl;
+  }
+}
+
+
+void BenchmarkRunner::PrintHeader(std::ostream& out)
+{
+  out << "# Avida Benchmark Results" << endl;
+  out << "# 1: Benchmark Name" << endl;
+  out << "# 2: Iterations per Repetition" << endl;
+  out << "# 3: Repetitions" << endl;
+  out << "# 4: Median ns/op" << endl;
+  out << "# 5: Min ns/op" << endl;
+  out << "# 6: Max ns/op" << endl;
+  out << endl;
+}
+
+
+void BenchmarkRunner::PrintResult(std::ostream& out, const Result& result)
+{
+  out << result.name << " " << result.iterations << " " << result.repetitions << " ";
+  out << fixed << setprecision(3) << result.median_ns << " " << result.min_ns << " " << result.max_ns << endl;
+  out.unsetf(ios::fixed);
+}
+
+
+double BenchmarkRunner::timeRepetition(cAvidaContext& ctx, Benchmark* benchmark, int iterations)
+{
+  benchmark->Setup(ctx);
+  cHighResTimer timer;
+  benchmark->Run(ctx, iterations);
+  const double elapsed = static_cast<double>(timer.Elapsed());
+  benchmark->Teardown(ctx);
+
+  return elapsed;
+}
+
+
+bool BenchmarkRunner::matchesFilter(const Apto::String& name) const
+{
+  if (!m_filter.GetSize()) return true;
+  return (cString((const char*)name).Find((const char*)m_filter) >= 0);
+}
@@ -0,0 +1,110 @@
+/*
+ *  Benchmark.h
+ *  avida-bench
+ *
+ *  Copyright 2026 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef Benchmark_h
+#define Benchmark_h
+
+#include "apto/core.h"
+
+#include <iostream>
+
+class cAvidaContext;
+class cWorld;
+
+
+// Benchmark - a single timed operation
+// --------------------------------------------------------------------------------------------------------------
+//
+// Run() must perform exactly 'iterations' repetitions of the operation being measured.  Any work that should not
+// be attributed to the operation belongs in Setup() and Teardown(), which are called once per timed repetition.
+
+class Benchmark
+{
+protected:
+  Apto::String m_name;
+
+public:
+  Benchmark(const Apto::String& name) : m_name(name) { ; }
+  virtual ~Benchmark() { ; }
+
+  const Apto::String& Name() const { return m_name; }
+
+  virtual void Setup(cAvidaContext& ctx) { (void)ctx; }
+  virtual void Run(cAvidaContext& ctx, int iterations) = 0;
+  virtual void Teardown(cAvidaContext& ctx) { (void)ctx; }
+};
+
+
+// BenchmarkRunner - calibrates, repeats and reports registered benchmarks
+// --------------------------------------------------------------------------------------------------------------
+
+class BenchmarkRunner
+{
+public:
+  struct Result
+  {
+    Apto::String name;
+    int iterations;
+    int repetitions;
+    double median_ns;
+    double min_ns;
+    double max_ns;
+  };
+
+private:
+  Apto::Array<Benchmark*> m_benchmarks;
+  Apto::String m_filter;
+  int m_repetitions;
+  double m_min_time;
+
+
+  BenchmarkRunner(const BenchmarkRunner&); // @not_implemented
+  BenchmarkRunner& operator=(const BenchmarkRunner&); // @not_implemented
+
+public:
+  BenchmarkRunner() : m_repetitions(5), m_min_time(0.1) { ; }
+  ~BenchmarkRunner();
+
+  void SetFilter(const Apto::String& filter) { m_filter = filter; }
+  void SetRepetitions(int reps) { m_repetitions = (reps > 0) ? reps : 1; }
+  void SetMinTime(double seconds) { m_min_time = (seconds > 0.0) ? seconds : 0.001; }
+
+  // Takes ownership of the supplied benchmark
+  void Register(Benchmark* benchmark) { m_benchmarks.Push(benchmark); }
+
+  void Run(cAvidaContext& ctx, Apto::Array<Result>& results, std::ostream& progress);
+
+  static void PrintHeader(std::ostream& out);
+  static void PrintResult(std::ostream& out, const Result& result);
+
+private:
+  double timeRepetition(cAvidaContext& ctx, Benchmark* benchmark, int iterations);
+  bool matchesFilter(const Apto::String& name) const;
+};
+
+
+// Registration of the standard benchmark set, see CoreBenchmarks.cc
+void RegisterCoreBenchmarks(BenchmarkRunner& runner, cWorld* world);
+
+// Checks the sampling distribution of cMeritSchedule against Apto::Scheduler::Probabilistic, see CoreBenchmarks.cc
+bool ValidateMeritSchedule(int num_cells, int draws, std::ostream& out);
+
+#endif
@@ -0,0 +1,562 @@
+/*
+ *  CoreBenchmarks.cc
+ *  avida-bench
+ *
+ *  Copyright 2026 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "Benchmark.h"
+
+#include "avida/core/Genome.h"
+#include "avida/core/InstructionSequence.h"
+#include "avida/core/Properties.h"
+#include "avida/systematics/Arbiter.h"
+#include "avida/systematics/Group.h"
+#include "avida/systematics/Manager.h"
+#include "avida/systematics/Unit.h"
+
+#include "apto/rng.h"
+#include "apto/scheduler.h"
+
+#include "cAvidaContext.h"
+#include "cEnvironment.h"
+#include "cHardwareBase.h"
+#include "cHardwareManager.h"
+#include "cInstSet.h"
+#include "cMeritSchedule.h"
+#include "cOrganism.h"
+#include "cPopulation.h"
+#include "cPopulationCell.h"
+#include "cReactionResult.h"
+#include "cSpatialResCount.h"
+#include "cTaskContext.h"
+#include "cWorld.h"
+#include "nGeometry.h"
+#include "tBuffer.h"
+#include "tList.h"
+
+#include <cmath>
+
+using namespace Avida;
+
+
+// All genomes are generated from a fixed seed so that successive benchmark runs measure identical work
+static const int BENCHMARK_SEED = 1001;
+static const int BENCHMARK_GENOME_LENGTH = 100;
+
+
+static Genome BuildRandomGenome(const cInstSet& is, Apto::Random& rng, int length)
+{
+  HashPropertyMap props;
+  cHardwareManager::SetupPropertyMap(props, (const char*)is.GetInstSetName());
+  InstructionSequencePtr seq(new InstructionSequence(length));
+  for (int i = 0; i < length; i++) (*seq)[i] = Instruction(rng.GetUInt(is.GetSize()));
+  return Genome(is.GetHardwareType(), props, seq);
+}
+
+
+// Hardware - SingleProcess for each loaded instruction set (and thus each configured hardware type)
+// --------------------------------------------------------------------------------------------------------------
+
+class HardwareSingleProcessBenchmark : public Benchmark
+{
+private:
+  cWorld* m_world;
+  Genome m_genome;
+  int m_cell_id;
+
+public:
+  HardwareSingleProcessBenchmark(cWorld* world, const cInstSet& is)
+    : Benchmark(Apto::FormatStr("hardware.%s.SingleProcess", (const char*)is.GetInstSetName())), m_world(world)
+    , m_cell_id(world->GetPopulation().GetSize() / 2)
+  {
+    Apto::RNG::AvidaRNG rng(BENCHMARK_SEED);
+    m_genome = BuildRandomGenome(is, rng, BENCHMARK_GENOME_LENGTH);
+  }
+
+  void Setup(cAvidaContext& ctx) { inject(ctx); }
+
+  void Run(cAvidaContext& ctx, int iterations)
+  {
+    cPopulationCell& cell = m_world->GetPopulation().GetCell(m_cell_id);
+    for (int i = 0; i < iterations; i++) {
+      // Organisms may die or be replaced by their offspring, keep the cell occupied
+      if (!cell.IsOccupied()) inject(ctx);
+      cell.GetOrganism()->GetHardware().SingleProcess(ctx);
+    }
+  }
+
+  void Teardown(cAvidaContext& ctx)
+  {
+    cPopulation& pop = m_world->GetPopulation();
+    for (int i = 0; i < pop.GetSize(); i++) if (pop.GetCell(i).IsOccupied()) pop.KillOrganism(pop.GetCell(i), ctx);
+  }
+
+private:
+  void inject(cAvidaContext& ctx)
+  {
+    m_world->GetPopulation().Inject(m_genome, Systematics::Source(Systematics::DIVISION, "benchmark", true), ctx, m_cell_id);
+  }
+};
+
+
+// Scheduler - Next and AdjustPriority for each scheduler selectable via SLICING_METHOD
+// --------------------------------------------------------------------------------------------------------------
+
+class SchedulerBenchmark : public Benchmark
+{
+public:
+  enum SchedulerType { ROUND_ROBIN, INTEGRATED, PROBABILISTIC, PROBABILISTIC_INTEGRATED, MERIT_TREE };
+  enum Operation { OP_NEXT, OP_ADJUST };
+
+private:
+  SchedulerType m_type;
+  Operation m_op;
+  int m_size;
+  Apto::PriorityScheduler* m_scheduler;
+  Apto::Array<int> m_ids;
+  Apto::Array<double> m_merits;
+
+public:
+  SchedulerBenchmark(SchedulerType type, Operation op, int size)
+    : Benchmark(Apto::FormatStr("scheduler.%s.%s", typeName(type), (op == OP_NEXT) ? "Next" : "AdjustPriority"))
+    , m_type(type), m_op(op), m_size(size), m_scheduler(NULL), m_ids(size), m_merits(size)
+  {
+    Apto::RNG::AvidaRNG rng(BENCHMARK_SEED);
+    for (int i = 0; i < size; i++) {
+      m_ids[i] = rng.GetUInt(size);
+      m_merits[i] = 1.0 + rng.GetDouble(1000.0);
+    }
+  }
+  ~SchedulerBenchmark() { delete m_scheduler; }
+
+  void Setup(cAvidaContext&)
+  {
+    delete m_scheduler;
+    switch (m_type) {
+      case ROUND_ROBIN:   m_scheduler = new Apto::Scheduler::RoundRobin(m_size); break;
+      case INTEGRATED:    m_scheduler = new Apto::Scheduler::Integrated(m_size); break;
+      case PROBABILISTIC:
+      {
+        Apto::SmartPtr<Apto::Random> rng(new Apto::RNG::AvidaRNG(BENCHMARK_SEED));
+        m_scheduler = new Apto::Scheduler::Probabilistic(m_size, rng);
+      }
+        break;
+      case PROBABILISTIC_INTEGRATED:
+      {
+        Apto::SmartPtr<Apto::Random> rng(new Apto::RNG::AvidaRNG(BENCHMARK_SEED));
+        m_scheduler = new Apto::Scheduler::ProbabilisticIntegrated(m_size, rng);
+      }
+        break;
+      case MERIT_TREE:
+      {
+        Apto::SmartPtr<Apto::Random> rng(new Apto::RNG::AvidaRNG(BENCHMARK_SEED));
+        m_scheduler = new cMeritSchedule(m_size, rng);
+      }
+        break;
+    }
+    for (int i = 0; i < m_size; i++) m_scheduler->AdjustPriority(i, m_merits[i]);
+  }
+
+  void Run(cAvidaContext&, int iterations)
+  {
+    int sink = 0;
+    if (m_op == OP_NEXT) {
+      for (int i = 0; i < iterations; i++) sink += m_scheduler->Next();
+    } else {
+      for (int i = 0, j = 0; i < iterations; i++, j = (j + 1 < m_size) ? j + 1 : 0) {
+        m_scheduler->AdjustPriority(m_ids[j], m_merits[m_size - j - 1]);
+      }
+    }
+    m_sink = sink;
+  }
+
+private:
+  static volatile int m_sink;
+
+  static const char* typeName(SchedulerType type)
+  {
+    switch (type) {
+      case ROUND_ROBIN:               return "RoundRobin";
+      case INTEGRATED:                return "Integrated";
+      case PROBABILISTIC:             return "Probabilistic";
+      case PROBABILISTIC_INTEGRATED:  return "ProbabilisticIntegrated";
+      case MERIT_TREE:                return "MeritTree";
+    }
+    return "unknown";
+  }
+};
+
+volatile int SchedulerBenchmark::m_sink = 0;
+
+
+// Resources - cSpatialResCount::FlowAll over a full world sized grid
+// --------------------------------------------------------------------------------------------------------------
+
+class SpatialFlowBenchmark : public Benchmark
+{
+private:
+  cSpatialResCount m_res;
+
+public:
+  SpatialFlowBenchmark(int world_x, int world_y)
+    : Benchmark(Apto::FormatStr("resources.cSpatialResCount.FlowAll.%dx%d", world_x, world_y))
+    , m_res(world_x, world_y, nGeometry::TORUS, 0.1, 0.1, 0.01, 0.01)
+  {
+    ;
+  }
+
+  void Setup(cAvidaContext&)
+  {
+    // Deterministic non-uniform initial state so that every cell pair exchanges matter
+    Apto::RNG::AvidaRNG rng(BENCHMARK_SEED);
+    for (int i = 0; i < m_res.GetSize(); i++) m_res.SetCellAmount(i, rng.GetDouble(100.0));
+  }
+
+  void Run(cAvidaContext&, int iterations)
+  {
+    for (int i = 0; i < iterations; i++) {
+      m_res.FlowAll();
+      m_res.StateAll();
+    }
+  }
+};
+
+
+// Environment - cEnvironment::TestOutput against the configured task library
+// --------------------------------------------------------------------------------------------------------------
+
+class EnvironmentTestOutputBenchmark : public Benchmark
+{
+private:
+  cWorld* m_world;
+  Apto::Array<int> m_inputs;
+  Apto::Array<int> m_outputs;
+
+public:
+  EnvironmentTestOutputBenchmark(cWorld* world)
+    : Benchmark("environment.cEnvironment.TestOutput"), m_world(world) { ; }
+
+  void Setup(cAvidaContext& ctx)
+  {
+    m_world->GetEnvironment().SetupInputs(ctx, m_inputs);
+
+    // Cycle through a mix of outputs that do and do not complete the standard logic tasks
+    Apto::RNG::AvidaRNG rng(BENCHMARK_SEED);
+    m_outputs.Resize(64);
+    for (int i = 0; i < m_outputs.GetSize(); i++) {
+      const int a = m_inputs[rng.GetUInt(m_inputs.GetSize())];
+      const int b = m_inputs[rng.GetUInt(m_inputs.GetSize())];
+      switch (i % 4) {
+        case 0: m_outputs[i] = ~a; break;
+        case 1: m_outputs[i] = ~(a & b); break;
+        case 2: m_outputs[i] = a ^ b; break;
+        default: m_outputs[i] = rng.GetInt(0x7FFFFFFF); break;
+      }
+    }
+  }
+
+  void Run(cAvidaContext& ctx, int iterations)
+  {
+    const cEnvironment& env = m_world->GetEnvironment();
+    const int num_resources = env.GetResourceLib().GetSize();
+    const int num_tasks = env.GetNumTasks();
+    const int num_reactions = env.GetReactionLib().GetSize();
+
+    tBuffer<int> input_buf(m_inputs.GetSize());
+    for (int i = 0; i < m_inputs.GetSize(); i++) input_buf.Add(m_inputs[i]);
+    tBuffer<int> output_buf(1);
+    tList<tBuffer<int> > other_inputs;
+    tList<tBuffer<int> > other_outputs;
+    Apto::Array<int, Apto::Smart> ext_mem;
+    Apto::Map<void*, cTaskState*> task_states;
+
+    Apto::Array<int> task_count(num_tasks);
+    task_count.SetAll(0);
+    Apto::Array<int> reaction_count(num_reactions);
+    reaction_count.SetAll(0);
+    Apto::Array<double> res_in(num_resources);
+    res_in.SetAll(0.0);
+    Apto::Array<double> rbins_in(num_resources);
+    rbins_in.SetAll(0.0);
+
+    cReactionResult result(num_resources, num_tasks, num_reactions);
+
+    for (int i = 0; i < iterations; i++) {
+      output_buf.Clear();
+      output_buf.Add(m_outputs[i & 63]);
+      cTaskContext taskctx(NULL, input_buf, output_buf, other_inputs, other_outputs, ext_mem);
+      taskctx.SetTaskStates(&task_states);
+      if (!env.TestOutput(ctx, result, taskctx, task_count, reaction_count, res_in, rbins_in)) result.Invalidate();
+    }
+  }
+};
+
+
+// Systematics - GenotypeArbiter::ClassifyNewUnit for a unit matching an existing genotype (the true-breeding case)
+// --------------------------------------------------------------------------------------------------------------
+
+class GenotypeClassifyBenchmark : public Benchmark
+{
+private:
+  cWorld* m_world;
+  Genome m_genome;
+  int m_cell_id;
+  Systematics::UnitPtr m_unit;
+  Systematics::ArbiterPtr m_arbiter;
+
+public:
+  GenotypeClassifyBenchmark(cWorld* world)
+    : Benchmark("systematics.GenotypeArbiter.ClassifyNewUnit"), m_world(world), m_cell_id(0)
+  {
+    Apto::RNG::AvidaRNG rng(BENCHMARK_SEED);
+    m_genome = BuildRandomGenome(world->GetHardwareManager().GetDefaultInstSet(), rng, BENCHMARK_GENOME_LENGTH);
+  }
+
+  void Setup(cAvidaContext& ctx)
+  {
+    m_world->GetPopulation().Inject(m_genome, Systematics::Source(Systematics::DIVISION, "benchmark", true), ctx, m_cell_id);
+    cOrganism* org = m_world->GetPopulation().GetCell(m_cell_id).GetOrganism();
+    m_unit = Systematics::UnitPtr(org);
+    org->AddReference(); // creating new smart pointer to org, explicitly add reference
+    m_arbiter = Systematics::Manager::Of(m_world->GetNewWorld())->ArbiterForRole("genotype");
+  }
+
+  void Run(cAvidaContext&, int iterations)
+  {
+    for (int i = 0; i < iterations; i++) {
+      Systematics::GroupPtr grp = m_arbiter->ClassifyNewUnit(m_unit);
+      grp->RemoveUnit();
+    }
+  }
+
+  void Teardown(cAvidaContext& ctx)
+  {
+    m_unit = Systematics::UnitPtr(NULL);
+    m_arbiter = Systematics::ArbiterPtr(NULL);
+    m_world->GetPopulation().KillOrganism(m_world->GetPopulation().GetCell(m_cell_id), ctx);
+  }
+};
+
+
+// Genetic distance - InstructionSequence distance metrics between a genome and a mutant
+// --------------------------------------------------------------------------------------------------------------
+
+class SequenceDistanceBenchmark : public Benchmark
+{
+public:
+  enum Metric { HAMMING, EDIT, SLIDING };
+
+private:
+  Metric m_metric;
+  InstructionSequence m_seq1;
+  InstructionSequence m_seq2;
+
+public:
+  SequenceDistanceBenchmark(Metric metric, int length)
+    : Benchmark(Apto::FormatStr("genome.InstructionSequence.%s.%d", metricName(metric), length)), m_metric(metric)
+    , m_seq1(length), m_seq2(length)
+  {
+    Apto::RNG::AvidaRNG rng(BENCHMARK_SEED);
+    for (int i = 0; i < length; i++) m_seq1[i] = Instruction(rng.GetUInt(26));
+    m_seq2 = m_seq1;
+
+    // Roughly five percent point mutations, plus one insertion and one deletion for the alignment based metrics
+    for (int i = 0; i < length / 20; i++) m_seq2[rng.GetUInt(length)] = Instruction(rng.GetUInt(26));
+    if (metric != HAMMING) {
+      m_seq2.Insert(rng.GetUInt(length), Instruction(rng.GetUInt(26)));
+      m_seq2.Remove(rng.GetUInt(m_seq2.GetSize()));
+    }
+  }
+
+  void Run(cAvidaContext&, int iterations)
+  {
+    int sink = 0;
+    for (int i = 0; i < iterations; i++) {
+      switch (m_metric) {
+        case HAMMING: sink += InstructionSequence::FindHammingDistance(m_seq1, m_seq2); break;
+        case EDIT:    sink += InstructionSequence::FindEditDistance(m_seq1, m_seq2); break;
+        case SLIDING: sink += InstructionSequence::FindSlidingDistance(m_seq1, m_seq2); break;
+      }
+    }
+    m_sink = sink;
+  }
+
+private:
+  static volatile int m_sink;
+
+  static const char* metricName(Metric metric)
+  {
+    switch (metric) {
+      case HAMMING: return "FindHammingDistance";
+      case EDIT:    return "FindEditDistance";
+      case SLIDING: return "FindSlidingDistance";
+    }
+    return "unknown";
+  }
+};
+
+volatile int SequenceDistanceBenchmark::m_sink = 0;
+
+
+// Population - birth/death churn through Inject (which kills any occupant of the target cell)
+// --------------------------------------------------------------------------------------------------------------
+
+class BirthDeathChurnBenchmark : public Benchmark
+{
+private:
+  cWorld* m_world;
+  Apto::Array<Genome> m_genomes;
+  Apto::Array<int> m_cells;
+
+public:
+  BirthDeathChurnBenchmark(cWorld* world)
+    : Benchmark("population.cPopulation.InjectKill"), m_world(world), m_genomes(16), m_cells(1024)
+  {
+    Apto::RNG::AvidaRNG rng(BENCHMARK_SEED);
+    const cInstSet& is = world->GetHardwareManager().GetDefaultInstSet();
+    for (int i = 0; i < m_genomes.GetSize(); i++) m_genomes[i] = BuildRandomGenome(is, rng, BENCHMARK_GENOME_LENGTH);
+    for (int i = 0; i < m_cells.GetSize(); i++) m_cells[i] = rng.GetUInt(world->GetPopulation().GetSize());
+  }
+
+  void Run(cAvidaContext& ctx, int iterations)
+  {
+    cPopulation& pop = m_world->GetPopulation();
+    const Systematics::Source src(Systematics::DIVISION, "benchmark", true);
+    for (int i = 0; i < iterations; i++) {
+      pop.Inject(m_genomes[i & 15], src, ctx, m_cells[i & 1023]);
+    }
+  }
+
+  void Teardown(cAvidaContext& ctx)
+  {
+    cPopulation& pop = m_world->GetPopulation();
+    for (int i = 0; i < pop.GetSize(); i++) if (pop.GetCell(i).IsOccupied()) pop.KillOrganism(pop.GetCell(i), ctx);
+  }
+};
+
+
+
+void RegisterCoreBenchmarks(BenchmarkRunner& runner, cWorld* world)
+{
+  cHardwareManager& hwm = world->GetHardwareManager();
+  for (int i = 0; i < hwm.GetNumInstSets(); i++) runner.Register(new HardwareSingleProcessBenchmark(world, hwm.GetInstSet(i)));
+
+  const int num_cells = world->GetPopulation().GetSize();
+  for (int t = SchedulerBenchmark::ROUND_ROBIN; t <= SchedulerBenchmark::MERIT_TREE; t++) {
+    SchedulerBenchmark::SchedulerType type = static_cast<SchedulerBenchmark::SchedulerType>(t);
+    runner.Register(new SchedulerBenchmark(type, SchedulerBenchmark::OP_NEXT, num_cells));
+    runner.Register(new SchedulerBenchmark(type, SchedulerBenchmark::OP_ADJUST, num_cells));
+  }
+
+  runner.Register(new SpatialFlowBenchmark(world->GetConfig().WORLD_X.Get(), world->GetConfig().WORLD_Y.Get()));
+  runner.Register(new EnvironmentTestOutputBenchmark(world));
+  runner.Register(new GenotypeClassifyBenchmark(world));
+
+  runner.Register(new SequenceDistanceBenchmark(SequenceDistanceBenchmark::HAMMING, 100));
+  runner.Register(new SequenceDistanceBenchmark(SequenceDistanceBenchmark::SLIDING, 100));
+  runner.Register(new SequenceDistanceBenchmark(SequenceDistanceBenchmark::EDIT, 100));
+  runner.Register(new SequenceDistanceBenchmark(SequenceDistanceBenchmark::EDIT, 1000));
+
+  runner.Register(new BirthDeathChurnBenchmark(world));
+}
+
+
+// Compares the entry frequencies of cMeritSchedule and Apto::Scheduler::Probabilistic against the expected merit
+// proportions with a chi-square test, and checks that block draws reproduce the sequence of single draws
+bool ValidateMeritSchedule(int num_cells, int draws, std::ostream& out)
+{
+  Apto::RNG::AvidaRNG merit_rng(BENCHMARK_SEED);
+  Apto::Array<double> merits(num_cells);
+  double total_merit = 0.0;
+  int num_positive = 0;
+  for (int i = 0; i < num_cells; i++) {
+    // Leave a quarter of the cells empty, as in a partially filled population
+    merits[i] = (merit_rng.GetUInt(4) == 0) ? 0.0 : 1.0 + merit_rng.GetDouble(1000.0);
+    total_merit += merits[i];
+    if (merits[i] > 0.0) num_positive++;
+  }
+  if (num_positive < 2) {
+    out << "error: world too small to validate the scheduler" << std::endl;
+    return false;
+  }
+
+  Apto::SmartPtr<Apto::Random> prob_rng(new Apto::RNG::AvidaRNG(BENCHMARK_SEED));
+  Apto::SmartPtr<Apto::Random> tree_rng(new Apto::RNG::AvidaRNG(BENCHMARK_SEED));
+  Apto::Scheduler::Probabilistic prob(num_cells, prob_rng);
+  cMeritSchedule tree(num_cells, tree_rng);
+  for (int i = 0; i < num_cells; i++) {
+    prob.AdjustPriority(i, merits[i]);
+    tree.AdjustPriority(i, merits[i]);
+  }
+  tree.ResetStats();
+
+  Apto::Array<int> prob_counts(num_cells);
+  Apto::Array<int> tree_counts(num_cells);
+  prob_counts.SetAll(0);
+  tree_counts.SetAll(0);
+  for (int i = 0; i < draws; i++) {
+    prob_counts[prob.Next()]++;
+    tree_counts[tree.Next()]++;
+  }
+
+  bool valid = true;
+  const double df = num_positive - 1;
+  const char* names[2] = { "Probabilistic", "MeritTree" };
+  const Apto::Array<int>* counts[2] = { &prob_counts, &tree_counts };
+  for (int s = 0; s < 2; s++) {
+    double chi_sq = 0.0;
+    int zero_hits = 0;
+    for (int i = 0; i < num_cells; i++) {
+      if (merits[i] == 0.0) {
+        zero_hits += (*counts[s])[i];
+        continue;
+      }
+      const double expected = draws * merits[i] / total_merit;
+      const double diff = (*counts[s])[i] - expected;
+      chi_sq += diff * diff / expected;
+    }
+    const double z = (chi_sq - df) / sqrt(2.0 * df);
+    const bool pass = (zero_hits == 0 && z < 5.0 && z > -5.0);
+    out << names[s] << ": chi-square " << chi_sq << " (df " << df << ", z " << z << "), empty cell draws "
+        << zero_hits << ((pass) ? "  ok" : "  FAILED") << std::endl;
+    valid = valid && pass;
+  }
+
+  const cMeritSchedule::sStats& stats = tree.GetStats();
+  out << "MeritTree: " << ((double)stats.draw_nodes / stats.draws) << " nodes per draw" << std::endl;
+
+  // Block draws must consume the generator exactly as single draws do
+  Apto::SmartPtr<Apto::Random> single_rng(new Apto::RNG::AvidaRNG(BENCHMARK_SEED));
+  Apto::SmartPtr<Apto::Random> block_rng(new Apto::RNG::AvidaRNG(BENCHMARK_SEED));
+  cMeritSchedule single(num_cells, single_rng);
+  cMeritSchedule block(num_cells, block_rng);
+  block.BeginBatch();
+  for (int i = 0; i < num_cells; i++) {
+    single.AdjustPriority(i, merits[i]);
+    block.AdjustPriority(i, merits[i]);
+  }
+  block.EndBatch();
+
+  Apto::Array<int> ids;
+  block.Next(num_cells, ids);
+  int mismatches = 0;
+  for (int i = 0; i < num_cells; i++) if (single.Next() != ids[i]) mismatches++;
+  out << "MeritTree: block draw mismatches " << mismatches << ((mismatches == 0) ? "  ok" : "  FAILED") << std::endl;
+
+  return valid && mismatches == 0;
+}
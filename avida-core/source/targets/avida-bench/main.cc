@@ -0,0 +1,141 @@
+/*
+ *  main.cc
+ *  avida-bench
+ *
+ *  Copyright 2026 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "apto/core/FileSystem.h"
+#include "avida/Avida.h"
+#include "avida/core/World.h"
+#include "avida/util/CmdLine.h"
+
+#include "cAvidaConfig.h"
+#include "cString.h"
+#include "cUserFeedback.h"
+#include "cWorld.h"
+
+#include "Avida2Driver.h"
+#include "Benchmark.h"
+
+#include <fstream>
+#include <iostream>
+
+using namespace std;
+
+
+static void PrintBenchmarkUsage(const char* name)
+{
+  cout << "Usage: " << name << " [benchmark options] [avida options]" << endl << endl;
+  cout << "Benchmark Options:" << endl;
+  cout << "  -bench-filter <substr>  Only run benchmarks whose name contains <substr>" << endl;
+  cout << "  -bench-reps <n>         Timed repetitions per benchmark (default: 5)" << endl;
+  cout << "  -bench-time <seconds>   Minimum duration of a single repetition (default: 0.1)" << endl;
+  cout << "  -bench-out <file>       Write results to <file> instead of standard output" << endl;
+  cout << "  -bench-check-sched <n>  Validate the merit tree scheduler with <n> draws instead of benchmarking" << endl;
+  cout << "  -bench-help             Print this message" << endl << endl;
+  cout << "All other options are passed through to the Avida configuration, see '" << name << " -h'." << endl;
+}
+
+
+int main(int argc, char * argv[])
+{
+  BenchmarkRunner runner;
+  cString out_filename;
+  int check_sched_draws = 0;
+
+  // Strip benchmark specific options, passing all others through to the standard command line processing
+  Apto::Array<char*> avida_argv;
+  avida_argv.Push(argv[0]);
+  for (int i = 1; i < argc; i++) {
+    cString cur_arg(argv[i]);
+    const bool has_value = (i + 1 < argc);
+    if (cur_arg == "-bench-help") {
+      PrintBenchmarkUsage(argv[0]);
+      return 0;
+    } else if (cur_arg == "-bench-filter" && has_value) {
+      runner.SetFilter(argv[++i]);
+    } else if (cur_arg == "-bench-reps" && has_value) {
+      runner.SetRepetitions(cString(argv[++i]).AsInt());
+    } else if (cur_arg == "-bench-time" && has_value) {
+      runner.SetMinTime(cString(argv[++i]).AsDouble());
+    } else if (cur_arg == "-bench-out" && has_value) {
+      out_filename = argv[++i];
+    } else if (cur_arg == "-bench-check-sched" && has_value) {
+      check_sched_draws = cString(argv[++i]).AsInt();
+    } else if (cur_arg.IsSubstring("-bench-", 0)) {
+      cerr << "error: unknown or incomplete benchmark option '" << cur_arg << "'" << endl;
+      PrintBenchmarkUsage(argv[0]);
+      return -1;
+    } else {
+      avida_argv.Push(argv[i]);
+    }
+  }
+
+  Avida::Initialize();
+
+  Apto::Map<Apto::String, Apto::String> defs;
+  cAvidaConfig* cfg = new cAvidaConfig();
+  Avida::Util::ProcessCmdLineArgs(avida_argv.GetSize(), &avida_argv[0], cfg, defs);
+
+  cUserFeedback feedback;
+  Avida::World* new_world = new Avida::World();
+  cWorld* world = cWorld::Initialize(cfg, cString(Apto::FileSystem::GetCWD()), new_world, &feedback, &defs);
+
+  for (int i = 0; i < feedback.GetNumMessages(); i++) {
+    switch (feedback.GetMessageType(i)) {
+      case cUserFeedback::UF_ERROR:    cerr << "error: "; break;
+      case cUserFeedback::UF_WARNING:  cerr << "warning: "; break;
+      default: break;
+    };
+    cerr << feedback.GetMessage(i) << endl;
+  }
+
+  if (!world) return -1;
+
+  // The driver is never run, it only supplies the world with abort handling and feedback
+  Avida2Driver* driver = new Avida2Driver(world, new_world);
+
+  if (check_sched_draws > 0) {
+    const bool valid = ValidateMeritSchedule(world->GetPopulation().GetSize(), check_sched_draws, cout);
+    delete driver;
+    return (valid) ? 0 : -1;
+  }
+
+  RegisterCoreBenchmarks(runner, world);
+
+  Apto::Array<BenchmarkRunner::Result> results;
+  runner.Run(world->GetDefaultContext(), results, cerr);
+
+  ofstream out_file;
+  if (out_filename.GetSize()) {
+    out_file.open(out_filename);
+    if (!out_file.good()) {
+      cerr << "error: unable to open output file '" << out_filename << "'" << endl;
+      delete driver;
+      return -1;
+    }
+  }
+  ostream& out = (out_filename.GetSize()) ? out_file : cout;
+
+  BenchmarkRunner::PrintHeader(out);
+  for (int i = 0; i < results.GetSize(); i++) BenchmarkRunner::PrintResult(out, results[i]);
+
+  delete driver;
+
+  return 0;
+}
@@ -26,7 +26,10 @@
 #include "ASAvidaLib.h"
 #include "ASAnalyzeLib.h"
 
+#include "cASBytecode.h"
 #include "cASLibrary.h"
+#include "cBytecodeCompileASTVisitor.h"
+#include "cBytecodeInterpreter.h"
 #include "cDirectInterpretASTVisitor.h"
 #include "cDumpASTVisitor.h"
 #include "cFile.h"
@@ -34,6 +37,7 @@
 #include "cSemanticASTVisitor.h"
 #include "cSymbolTable.h"
 
+#include <cstring>
 #include <iostream>
 
 
@@ -41,6 +45,12 @@ int main (int argc, char * const argv[])
 {
   Avida::Initialize();
 
+  // Scripts are interpreted directly from the tree unless the bytecode interpreter is requested
+  bool interpret_bytecode = false;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "-b") == 0 || strcmp(argv[i], "--interpret-bytecode") == 0) interpret_bytecode = true;
+  }
+
   Avida::PrintVersionBanner();
 
   cASLibrary* lib = new cASLibrary;  
@@ -69,8 +79,25 @@ int main (int argc, char * const argv[])
         exit(AS_EXIT_FAIL_SEMANTIC);
       }
       
-      cDirectInterpretASTVisitor interpeter(&global_symtbl);
-      int exit_code = interpeter.Interpret(tree);
+      cASBytecode* program = NULL;
+      if (interpret_bytecode) {
+        cBytecodeCompileASTVisitor compiler(&global_symtbl);
+        program = compiler.Compile(tree);
+        if (!program) {
+          std::cerr << "error: script not supported by the bytecode interpreter ("
+                    << compiler.GetUnsupportedConstruct() << ")" << std::endl;
+          exit(AS_EXIT_FAIL_INTERPRET);
+        }
+      }
+      
+      int exit_code = AS_EXIT_UNKNOWN;
+      if (program) {
+        cBytecodeInterpreter interpreter(program);
+        exit_code = interpreter.Run();
+      } else {
+        cDirectInterpretASTVisitor interpeter(&global_symtbl);
+        exit_code = interpeter.Interpret(tree);
+      }
       
       exit(exit_code);
     } else {
@@ -0,0 +1,47 @@
+/*
+ *  avida-series2dat/main.cc
+ *  Avida
+ *
+ *  Copyright 2026 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "avida/output/SeriesReader.h"
+
+#include <iostream>
+
+
+int main(int argc, char* argv[])
+{
+  if (argc != 3) {
+    std::cerr << "Usage: " << argv[0] << " <series file> <dat file>" << std::endl;
+    std::cerr << "  Converts a binary data series file (see the RecordDataSeries action) to the text .dat layout." << std::endl;
+    return 1;
+  }
+  
+  Avida::Output::SeriesReader reader;
+  if (!reader.Open(argv[1])) {
+    std::cerr << "error: unable to read series file '" << argv[1] << "'" << std::endl;
+    return 1;
+  }
+  
+  if (!reader.ExportDat(argv[2])) {
+    std::cerr << "error: unable to write '" << argv[2] << "'" << std::endl;
+    return 1;
+  }
+  
+  return 0;
+}
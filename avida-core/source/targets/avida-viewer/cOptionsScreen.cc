@@ -87,6 +87,9 @@ void cOptionsScreen::Draw(cAvidaContext& ctx)
   case SLICE_INTEGRATED_MERIT:
     Print(1, 55, "Integrated");
     break;
+  case SLICE_PROB_MERIT_TREE:
+    Print(1, 55, "Probablistic Tree");
+    break;
   }
 
   switch(info.GetConfig().BASE_MERIT_METHOD.Get()) {
@@ -126,7 +126,7 @@ void cStatsScreen::Update(cAvidaContext& ctx)
   PrintDouble(2, 62, metrics->GetFitness());
   PrintDouble(3, 62, metrics->GetMerit());
   PrintDouble(4, 62, metrics->GetGestationTime());
-  Genome gen(best_gen->Properties().Get("genome").StringValue());
+  Genome gen(*best_gen->RepresentativeGenome());
   InstructionSequencePtr seq;
   seq.DynamicCastFrom(gen.Representation());
   Print(5, 62, "%7d", seq->GetSize());
@@ -22,7 +22,7 @@ char cSymbolUtil::GetBasicSymbol(const cPopulationCell & cell)
   if (cell.IsOccupied() == false) return ' ';
   const cOrganism & organism = *(cell.GetOrganism());
   
-  Systematics::GroupPtr bg = organism.SystematicsGroup("genotype");
+  Systematics::GroupPtr bg = organism.SystematicsGroup(Systematics::ROLE_GENOTYPE);
   Apto::SmartPtr<sGenotypeViewInfo> view_info = bg->GetData<sGenotypeViewInfo>();
   if (!view_info) {
     view_info = Apto::SmartPtr<sGenotypeViewInfo>(new sGenotypeViewInfo);
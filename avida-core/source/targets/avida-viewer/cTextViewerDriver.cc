@@ -86,6 +86,7 @@ void cTextViewerDriver::Run()
     // Process the update.
     const int UD_size = ave_time_slice * population.GetNumOrganisms();
     const double step_size = 1.0 / (double) UD_size;
+    population.BeginUpdateSchedule(UD_size);
     
     if (m_pause) {
       m_view->Pause();
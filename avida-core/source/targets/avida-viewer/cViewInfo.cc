@@ -190,7 +190,7 @@ void cViewInfo::DisEngageStepMode()
 Systematics::GroupPtr cViewInfo::GetActiveGenotype()
 {
   if (active_cell != NULL && active_cell->IsOccupied()) {
-    return active_cell->GetOrganism()->SystematicsGroup("genotype");
+    return active_cell->GetOrganism()->SystematicsGroup(Systematics::ROLE_GENOTYPE);
   }
 
   return Systematics::GroupPtr(NULL);
@@ -422,7 +422,7 @@ void cZoomScreen::UpdateStats(cHardwareBase& hardware)
   PrintDouble(8, 14, phenotype.GetEnergyBonus());
   PrintDouble(9, 14, phenotype.GetMerit().GetDouble());
   PrintDouble(10, 14, cur_merit.GetDouble());
-  Genome gen(genotype->Properties().Get("genome").StringValue());
+  Genome gen(*genotype->RepresentativeGenome());
   InstructionSequencePtr seq;
   seq.DynamicCastFrom(gen.Representation());
   Print(11, 15, "%6d ", genotype ? seq->GetSize() : 0);
@@ -929,7 +929,7 @@ void cZoomScreen::UpdateGenotype(cAvidaContext& ctx)
     Systematics::GroupPtr genotype = info.GetActiveGenotype();
     Systematics::GenomeTestMetricsPtr metrics = Systematics::GenomeTestMetrics::GetMetrics(m_world, ctx, genotype);
     Print(5, 12, "%9d", genotype->NumUnits());
-    Genome gen(genotype->Properties().Get("genome").StringValue());
+    Genome gen(*genotype->RepresentativeGenome());
     InstructionSequencePtr seq;
     seq.DynamicCastFrom(gen.Representation());
     Print(6, 12, "%9d", seq->GetSize());
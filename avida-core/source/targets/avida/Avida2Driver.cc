@@ -36,6 +36,7 @@
 #include "cPopulation.h"
 #include "cPopulationCell.h"
 #include "cStats.h"
+#include "cUpdateProfiler.h"
 #include "cWorld.h"
 
 #include <cstdio>
@@ -88,18 +89,29 @@ void Avida2Driver::Run()
   cAvidaContext& ctx = m_world->GetDefaultContext();
   Avida::Context new_ctx(this, &m_world->GetRandom());
   
+  cUpdateProfiler& profiler = m_world->GetUpdateProfiler();
+  
   while (!m_done) {
-    m_world->GetEvents(ctx);
+    cUpdateProfiler::Scope profile_update(profiler, cUpdateProfiler::PHASE_UPDATE);
+    
+    {
+      cUpdateProfiler::Scope profile(profiler, cUpdateProfiler::PHASE_EVENTS);
+      m_world->GetEvents(ctx);
+    }
     if(m_done == true) break;
     
     // Increment the Update.
     stats.IncCurrentUpdate();
     
-    population.ProcessPreUpdate();
+    {
+      cUpdateProfiler::Scope profile(profiler, cUpdateProfiler::PHASE_PRE_UPDATE);
+      population.ProcessPreUpdate();
+    }
 
     // Handle all data collection for previous update.
     if (stats.GetUpdate() > 0) {
       // Tell the stats object to do update calculations and printing.
+      cUpdateProfiler::Scope profile(profiler, cUpdateProfiler::PHASE_STATS);
       stats.ProcessUpdate();
     }
     
@@ -108,20 +120,27 @@ void Avida2Driver::Run()
     const int UD_size = m_world->CalculateUpdateSize();
     const double step_size = 1.0 / (double) UD_size;
     
-    for (int i = 0; i < UD_size; i++) {
-      if(population.GetNumOrganisms() == 0) {
-        break;
+    {
+      cUpdateProfiler::Scope profile(profiler, cUpdateProfiler::PHASE_CPU_CYCLES);
+      population.BeginUpdateSchedule(UD_size);
+      for (int i = 0; i < UD_size; i++) {
+        if(population.GetNumOrganisms() == 0) {
+          break;
+        }
+        (population.*ActiveProcessStep)(ctx, step_size, population.ScheduleOrganism());
       }
-      (population.*ActiveProcessStep)(ctx, step_size, population.ScheduleOrganism());
     }
     
     // end of update stats...
-    population.ProcessPostUpdate(ctx);
-    
-		m_world->ProcessPostUpdate(ctx);
+    {
+      cUpdateProfiler::Scope profile(profiler, cUpdateProfiler::PHASE_POST_UPDATE);
+      population.ProcessPostUpdate(ctx);
+      m_world->ProcessPostUpdate(ctx);
+    }
         
     // No viewer; print out status for this update....
     if (m_world->GetVerbosity() > VERBOSE_SILENT) {
+      cUpdateProfiler::Scope profile(profiler, cUpdateProfiler::PHASE_OUTPUT);
       cout.setf(ios::left);
       cout.setf(ios::showpoint);
       cout << "UD: " << setw(6) << stats.GetUpdate() << "  ";
@@ -145,6 +164,7 @@ void Avida2Driver::Run()
     
     // Do Point Mutations
     if (point_mut_prob > 0 ) {
+      cUpdateProfiler::Scope profile(profiler, cUpdateProfiler::PHASE_POINT_MUTATIONS);
       for (int i = 0; i < population.GetSize(); i++) {
         if (population.GetCell(i).IsOccupied()) {
           int num_mut = population.GetCell(i).GetOrganism()->GetHardware().PointMutate(ctx);
@@ -153,7 +173,10 @@ void Avida2Driver::Run()
       }
     }
     
-    m_new_world->PerformUpdate(new_ctx, stats.GetUpdate());
+    {
+      cUpdateProfiler::Scope profile(profiler, cUpdateProfiler::PHASE_WORLD_UPDATE);
+      m_new_world->PerformUpdate(new_ctx, stats.GetUpdate());
+    }
     
     // Exit conditons...
     if((population.GetNumOrganisms()==0) && m_world->AllowsEarlyExit()) {
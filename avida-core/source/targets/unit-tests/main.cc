@@ -313,6 +313,1283 @@ protected:
 
 
 
+#include "cDoubleSum.h"
+#include "cRunningStats.h"
+#include "cWorkerPool.h"
+
+#include <cmath>
+
+// Values with a large common offset, so that merging moments from slices with different means is exercised
+static double StatsTestValue(int i)
+{
+  return 1000.0 + ((i * 7919) % 1013) / 7.0 - ((i % 3 == 0) ? 50.0 : 0.0);
+}
+
+static bool StatsTestClose(double a, double b, double tolerance)
+{
+  double scale = fabs(a) > fabs(b) ? fabs(a) : fabs(b);
+  if (scale < 1.0) scale = 1.0;
+  return fabs(a - b) <= tolerance * scale;
+}
+
+class cDoubleSumTests : public cUnitTest
+{
+public:
+  const char* GetUnitName() { return "cDoubleSum"; }
+protected:
+  void RunTests()
+  {
+    const int num_values = 1000;
+    cDoubleSum sequential;
+    for (int i = 0; i < num_values; i++) sequential.Add(StatsTestValue(i));
+
+    // Uneven slices, including an empty one
+    const int bounds[] = { 0, 1, 1, 250, 731, num_values };
+    cDoubleSum merged;
+    for (int p = 0; p < 5; p++) {
+      cDoubleSum part;
+      for (int i = bounds[p]; i < bounds[p + 1]; i++) part.Add(StatsTestValue(i));
+      merged.Merge(part);
+    }
+
+    ReportTestResult("Merge - Count", merged.Count() == sequential.Count());
+    ReportTestResult("Merge - Sum", StatsTestClose(merged.Sum(), sequential.Sum(), 1e-12));
+    ReportTestResult("Merge - Average", StatsTestClose(merged.Average(), sequential.Average(), 1e-12));
+    ReportTestResult("Merge - Variance", StatsTestClose(merged.Variance(), sequential.Variance(), 1e-8));
+    ReportTestResult("Merge - Max", merged.Max() == sequential.Max());
+
+    cDoubleSum empty;
+    empty.Merge(sequential);
+    ReportTestResult("Merge into empty", empty.Count() == sequential.Count() && empty.Sum() == sequential.Sum() &&
+                     empty.Max() == sequential.Max());
+  }
+};
+
+class cRunningStatsTests : public cUnitTest
+{
+public:
+  const char* GetUnitName() { return "cRunningStats"; }
+protected:
+  void RunTests()
+  {
+    const int num_values = 1000;
+    cRunningStats sequential;
+    for (int i = 0; i < num_values; i++) sequential.Push(StatsTestValue(i));
+
+    const int bounds[] = { 0, 1, 1, 250, 731, num_values };
+    cRunningStats merged;
+    for (int p = 0; p < 5; p++) {
+      cRunningStats part;
+      for (int i = bounds[p]; i < bounds[p + 1]; i++) part.Push(StatsTestValue(i));
+      merged.Merge(part);
+    }
+
+    ReportTestResult("Merge - N", merged.N() == sequential.N());
+    ReportTestResult("Merge - Mean", StatsTestClose(merged.Mean(), sequential.Mean(), 1e-12));
+    ReportTestResult("Merge - Variance", StatsTestClose(merged.Variance(), sequential.Variance(), 1e-9));
+    ReportTestResult("Merge - Skewness", StatsTestClose(merged.Skewness(), sequential.Skewness(), 1e-6));
+    ReportTestResult("Merge - Kurtosis", StatsTestClose(merged.Kurtosis(), sequential.Kurtosis(), 1e-6));
+
+    cRunningStats empty;
+    sequential.Merge(empty);
+    ReportTestResult("Merge of empty", sequential.N() == num_values);
+  }
+};
+
+class cWorkerPoolTests : public cUnitTest
+{
+private:
+  // Each part accumulates its own slice, the slices are merged in part order afterwards
+  class cSumJob : public cWorkerPool::Job
+  {
+  public:
+    int m_num_values;
+    int m_num_parts;
+    cRunningStats m_parts[8];
+
+    cSumJob(int num_values, int num_parts) : m_num_values(num_values), m_num_parts(num_parts) { ; }
+
+    void Run(int part)
+    {
+      const int begin = m_num_values * part / m_num_parts;
+      const int end = m_num_values * (part + 1) / m_num_parts;
+      for (int i = begin; i < end; i++) m_parts[part].Push(StatsTestValue(i));
+    }
+  };
+
+public:
+  const char* GetUnitName() { return "cWorkerPool"; }
+protected:
+  void RunTests()
+  {
+    const int num_values = 10000;
+    cRunningStats sequential;
+    for (int i = 0; i < num_values; i++) sequential.Push(StatsTestValue(i));
+
+    cWorkerPool pool(4);
+    ReportTestResult("GetNumThreads", pool.GetNumThreads() == 4);
+
+    cSumJob job(num_values, 8);
+    pool.Run(job, 8);
+    cRunningStats merged;
+    for (int p = 0; p < 8; p++) merged.Merge(job.m_parts[p]);
+    ReportTestResult("Run - all parts executed", merged.N() == num_values);
+    ReportTestResult("Run - merged slices match sequential pass",
+                     StatsTestClose(merged.Mean(), sequential.Mean(), 1e-12) &&
+                     StatsTestClose(merged.Variance(), sequential.Variance(), 1e-9));
+
+    // Running the same job twice must give bit identical results regardless of which thread ran each part
+    cSumJob job2(num_values, 8);
+    pool.Run(job2, 8);
+    cRunningStats merged2;
+    for (int p = 0; p < 8; p++) merged2.Merge(job2.m_parts[p]);
+    ReportTestResult("Run - deterministic", merged2.Mean() == merged.Mean() && merged2.Variance() == merged.Variance());
+  }
+};
+
+
+
+#include "avida/core/Feedback.h"
+#include "apto/rng.h"
+#include "cMigrationMatrix.h"
+
+#include <cstdio>
+#include <fstream>
+
+class cMigrationMatrixTests : public cUnitTest
+{
+private:
+  class cSilentFeedback : public Avida::Feedback
+  {
+  public:
+    int m_errors;
+    cSilentFeedback() : m_errors(0) { ; }
+    void Error(const char*, ...) { m_errors++; }
+    void Warning(const char*, ...) { ; }
+    void Notify(const char*, ...) { ; }
+  };
+
+  // The dense row scan that the sparse sampling must reproduce draw for draw
+  static int DenseSample(const double weights[][6], const double* row_sums, int from, Apto::Random& rng)
+  {
+    double value = rng.GetDouble(row_sums[from]);
+    for (int col = 0; col < 6; col++) {
+      value -= weights[from][col];
+      if (value <= 0.0) return col;
+    }
+    return -1;
+  }
+
+public:
+  const char* GetUnitName() { return "cMigrationMatrix"; }
+protected:
+  void RunTests()
+  {
+    // Integer weights place many draws exactly on connection boundaries
+    double weights[6][6] = {
+      { 0.0, 1.0, 0.0, 0.0, 2.0, 1.0 },
+      { 3.0, 0.0, 0.25, 0.0, 0.0, 0.0 },
+      { 0.0, 0.0, 0.0, 7.5, 0.0, 0.0 },
+      { 1.0, 1.0, 1.0, 1.0, 1.0, 1.0 },
+      { 0.1, 0.2, 0.3, 0.4, 0.5, 0.6 },
+      { 0.0, 0.0, 0.0, 0.0, 0.0, 1e-3 }
+    };
+    double row_sums[6];
+
+    const char* filename = "unit-tests-migration.mat";
+    std::ofstream outfile(filename);
+    outfile.precision(17);
+    for (int row = 0; row < 6; row++) {
+      row_sums[row] = 0.0;
+      for (int col = 0; col < 6; col++) {
+        outfile << weights[row][col] << ((col < 5) ? "," : "\n");
+        row_sums[row] += weights[row][col];
+      }
+    }
+    outfile.close();
+
+    cMigrationMatrix matrix;
+    cSilentFeedback feedback;
+    const bool loaded = matrix.Load(6, filename, ".", true, true, false, feedback);
+    remove(filename);
+    ReportTestResult("Load", loaded && feedback.m_errors == 0);
+    if (!loaded) return;
+
+    Apto::RNG::AvidaRNG dense_rng(17);
+    Apto::RNG::AvidaRNG sparse_rng(17);
+    int dense_counts[6][6];
+    for (int row = 0; row < 6; row++) for (int col = 0; col < 6; col++) dense_counts[row][col] = 0;
+
+    bool same = true;
+    for (int i = 0; i < 60000; i++) {
+      const int from = i % 6;
+      const int dense = DenseSample(weights, row_sums, from, dense_rng);
+      const int sparse = matrix.GetProbabilisticDemeID(from, sparse_rng, false);
+      if (dense != sparse) same = false;
+      if (dense >= 0) dense_counts[from][dense]++;
+    }
+    ReportTestResult("GetProbabilisticDemeID - matches dense scan", same);
+
+    bool counts = true;
+    for (int row = 0; row < 6; row++) {
+      for (int col = 0; col < 6; col++) {
+        if (matrix.GetOffspringCountAt(row, col) != dense_counts[row][col]) counts = false;
+      }
+    }
+    ReportTestResult("GetOffspringCountAt - counts sampled connections", counts);
+
+    // Alterations change the row sum incrementally, exactly as the dense matrix did
+    matrix.AlterConnectionWeight(2, 0, 2.5);
+    weights[2][0] += 2.5;
+    row_sums[2] += 2.5;
+    matrix.AlterConnectionWeight(4, 5, -0.6);
+    weights[4][5] += -0.6;
+    row_sums[4] += -0.6;
+    same = true;
+    for (int i = 0; i < 60000; i++) {
+      const int from = i % 6;
+      if (DenseSample(weights, row_sums, from, dense_rng) != matrix.GetProbabilisticDemeID(from, sparse_rng, true)) same = false;
+    }
+    ReportTestResult("AlterConnectionWeight - matches dense scan", same);
+    ReportTestResult("GetParasiteCountAt - new connection used", matrix.GetParasiteCountAt(2, 0) > 0);
+  }
+};
+
+
+
+
+#include "avida/core/Genome.h"
+#include "cAnalyzeGenotype.h"
+#include "cFlexVar.h"
+#include "cGenotypeBatch.h"
+
+class cGenotypeBatchTests : public cUnitTest
+{
+private:
+  typedef tListPlus<cAnalyzeGenotype> tGenotypeList;
+
+  // Many ties in every column, so the first-match rules of the list are exercised
+  static cAnalyzeGenotype* MakeGenotype(int i)
+  {
+    cAnalyzeGenotype* genotype = new cAnalyzeGenotype(NULL, Avida::Genome());
+    genotype->SetID(100 + i);
+    genotype->SetParentID((i > 0) ? 100 + (i - 1) / 2 : -1);
+    genotype->SetNumCPUs((i * 7) % 5);
+    genotype->SetTotalCPUs((i * 3) % 11);
+    genotype->SetUpdateBorn(i / 4);
+    genotype->SetGestTime(300 + (i * 17) % 13);
+    genotype->SetFitness(((i * 13) % 9) * 0.5);
+    genotype->SetMerit((i % 6) * 1.25);
+    return genotype;
+  }
+
+  static void Fill(cGenotypeBatch& batch, tGenotypeList& reference, int num_genotypes)
+  {
+    for (int i = 0; i < num_genotypes; i++) {
+      batch.List().PushRear(MakeGenotype(i));
+      reference.PushRear(MakeGenotype(i));
+    }
+  }
+
+  static void Clear(tGenotypeList& reference)
+  {
+    while (reference.GetSize() > 0) delete reference.Pop();
+  }
+
+  static bool SameIDs(cGenotypeBatch& batch, tGenotypeList& reference)
+  {
+    if (batch.GetSize() != reference.GetSize()) return false;
+    tListIterator<cAnalyzeGenotype> batch_it(batch.List());
+    tListIterator<cAnalyzeGenotype> ref_it(reference);
+    cAnalyzeGenotype* genotype = NULL;
+    while ((genotype = batch_it.Next()) != NULL) {
+      if (genotype->GetID() != ref_it.Next()->GetID()) return false;
+    }
+    return true;
+  }
+
+  // The list path of FILTER: compare the data entry value against the test string as cFlexVars
+  template<typename V> static void ListFilter(tGenotypeList& reference, V (cAnalyzeGenotype::*fun)() const,
+                                              const cString& test_value, const bool rel_ok[3])
+  {
+    tListIterator<cAnalyzeGenotype> it(reference);
+    cAnalyzeGenotype* genotype = NULL;
+    while ((genotype = it.Next()) != NULL) {
+      const cFlexVar value((genotype->*fun)());
+      const cFlexVar test(test_value);
+      const int compare = (value == test) ? 1 : ((value > test) ? 2 : 0);
+      if (!rel_ok[compare]) delete it.Remove();
+    }
+  }
+
+  static bool SamePop(cAnalyzeGenotype* from_batch, cAnalyzeGenotype* from_list)
+  {
+    const bool same = (from_batch == NULL) ? (from_list == NULL) : (from_list && from_batch->GetID() == from_list->GetID());
+    delete from_batch;
+    delete from_list;
+    return same;
+  }
+
+public:
+  const char* GetUnitName() { return "cGenotypeBatch"; }
+protected:
+  void RunTests()
+  {
+    const bool greater_equal[3] = { false, true, true };
+    const bool less[3] = { true, false, false };
+    const bool not_equal[3] = { true, false, true };
+
+    cGenotypeBatch batch;
+    tGenotypeList reference;
+    Fill(batch, reference, 64);
+
+    bool same = true;
+    same = batch.FilterColumn("fitness", 1.5, greater_equal) && same;
+    ListFilter(reference, &cAnalyzeGenotype::GetFitness, "1.5", greater_equal);
+    same = SameIDs(batch, reference) && same;
+    same = batch.FilterColumn("total_cpus", 9, less) && same;
+    ListFilter(reference, &cAnalyzeGenotype::GetTotalCPUs, "9", less);
+    same = SameIDs(batch, reference) && same;
+    same = batch.FilterColumn("merit", 2.5, not_equal) && same;
+    ListFilter(reference, &cAnalyzeGenotype::GetMerit, "2.5", not_equal);
+    same = SameIDs(batch, reference) && same;
+    ReportTestResult("FilterColumn - matches list filter", same);
+    ReportTestResult("FilterColumn - unstored stat rejected", !batch.FilterColumn("length", 0, less));
+
+    // Finds are copies, the batch is unchanged
+    const int mid_id = reference.GetPos(reference.GetSize() / 2)->GetID();
+    same = SamePop(batch.FindGenotypeNumCPUs(), new cAnalyzeGenotype(*reference.FindMax(&cAnalyzeGenotype::GetNumCPUs)));
+    same = SamePop(batch.FindGenotypeFitness(), new cAnalyzeGenotype(*reference.FindMax(&cAnalyzeGenotype::GetFitness))) && same;
+    same = SamePop(batch.FindGenotypeID(mid_id), new cAnalyzeGenotype(*reference.FindValue(&cAnalyzeGenotype::GetID, mid_id))) && same;
+    ReportTestResult("FindGenotype - matches list FindMax/FindValue", same && SameIDs(batch, reference));
+
+    // Repeated pops out of the same columns, as FIND_GENOTYPE does with several descriptors
+    same = true;
+    for (int i = 0; i < 4; i++) {
+      same = SamePop(batch.RemoveGenotypeMax(cGenotypeColumns::COL_NUM_CPUS), reference.PopMax(&cAnalyzeGenotype::GetNumCPUs)) && same;
+      same = SamePop(batch.RemoveGenotypeMax(cGenotypeColumns::COL_TOTAL_CPUS), reference.PopMax(&cAnalyzeGenotype::GetTotalCPUs)) && same;
+      same = SamePop(batch.RemoveGenotypeMax(cGenotypeColumns::COL_MERIT), reference.PopMax(&cAnalyzeGenotype::GetMerit)) && same;
+      same = SamePop(batch.RemoveGenotypeMax(cGenotypeColumns::COL_FITNESS), reference.PopMax(&cAnalyzeGenotype::GetFitness)) && same;
+      same = SamePop(batch.RemoveGenotypePos(i * 3), reference.PopPos(i * 3)) && same;
+    }
+    same = SamePop(batch.RemoveGenotypeID(mid_id), reference.PopValue(&cAnalyzeGenotype::GetID, mid_id)) && same;
+    same = SamePop(batch.RemoveGenotypeID(999), reference.PopValue(&cAnalyzeGenotype::GetID, 999)) && same;
+    ReportTestResult("RemoveGenotype - matches list PopMax/PopValue/PopPos", same && SameIDs(batch, reference));
+
+    // Walking a lineage by parent id, as FIND_LINEAGE does
+    same = true;
+    cAnalyzeGenotype* batch_gen = batch.RemoveGenotypeMax(cGenotypeColumns::COL_FITNESS);
+    cAnalyzeGenotype* ref_gen = reference.PopMax(&cAnalyzeGenotype::GetFitness);
+    while (batch_gen && ref_gen) {
+      const int next_id = batch_gen->GetParentID();
+      same = SamePop(batch_gen, ref_gen) && same;
+      batch_gen = batch.RemoveGenotypeID(next_id);
+      ref_gen = reference.PopValue(&cAnalyzeGenotype::GetID, next_id);
+    }
+    same = SamePop(batch_gen, ref_gen) && same;
+    ReportTestResult("RemoveGenotypeID - lineage walk matches list", same && SameIDs(batch, reference));
+
+    // Changes made through the list are seen by the next column query
+    cAnalyzeGenotype* fittest = MakeGenotype(500);
+    fittest->SetFitness(1000.0);
+    batch.List().PushRear(fittest);
+    cAnalyzeGenotype* found = batch.FindGenotypeFitness();
+    ReportTestResult("List - invalidates columns", found && found->GetID() == 600);
+    delete found;
+    batch.List().GetPos(0)->SetNumCPUs(1000);
+    found = batch.FindGenotypeNumCPUs();
+    ReportTestResult("List - genotype changes invalidate columns", found && found->GetNumCPUs() == 1000);
+    delete found;
+
+    Clear(reference);
+  }
+};
+
+
+
+#include "avida/core/InstructionSequence.h"
+#include "cCPUMemory.h"
+
+class cInstructionSequenceTests : public cUnitTest
+{
+private:
+  static void Fill(Avida::InstructionSequence& seq, int first_op)
+  {
+    for (int i = 0; i < seq.GetSize(); i++) seq[i].SetOp(first_op + i);
+  }
+  
+  static bool HasOps(const Avida::InstructionSequence& seq, int size, int first_op)
+  {
+    if (seq.GetSize() != size) return false;
+    for (int i = 0; i < size; i++) if (seq[i].GetOp() != first_op + i) return false;
+    return true;
+  }
+  
+public:
+  const char* GetUnitName() { return "InstructionSequence"; }
+protected:
+  void RunTests()
+  {
+    // Detach on write
+    Avida::InstructionArray base(10);
+    for (int i = 0; i < 10; i++) base.SetInst(i, Avida::Instruction(i + 1));
+    const unsigned int base_hash = base.Hash(10);
+    const Avida::InstructionArray& const_base = base;
+    
+    Avida::InstructionArray copy(base);
+    ReportTestResult("Copy - shares storage", copy.SharesStorage(base));
+    ReportTestResult("Copy - carries hash", copy.HasHash(10) && copy.Hash(10) == base_hash);
+    
+    const Avida::InstructionArray& const_copy = copy;
+    bool same = true;
+    for (int i = 0; i < 10; i++) same = same && const_copy[i] == const_base[i] && const_copy.GetData()[i] == const_base[i];
+    ReportTestResult("Const reads - keep sharing", same && copy.SharesStorage(base) && copy.HasHash(10));
+    
+    copy[3].SetOp(50);
+    ReportTestResult("Write - detaches", !copy.SharesStorage(base));
+    ReportTestResult("Write - original untouched", const_base[3].GetOp() == 4 && base.HasHash(10) && base.Hash(10) == base_hash);
+    ReportTestResult("Write - drops hash", !copy.HasHash(10) && copy.Hash(10) != base_hash);
+    
+    Avida::InstructionArray assigned;
+    assigned = base;
+    Avida::Instruction* data = assigned.GetWritableData();
+    data[0].SetOp(60);
+    data[9].SetOp(61);
+    ReportTestResult("Writable data - detaches once", !assigned.SharesStorage(base) && const_base[0].GetOp() == 1 &&
+                     const_base[9].GetOp() == 10 && assigned[0].GetOp() == 60 && assigned[9].GetOp() == 61);
+    
+    
+    // Resize while shared
+    Avida::InstructionSequence seq(10);
+    Fill(seq, 1);
+    
+    Avida::InstructionSequence grown(seq);
+    grown.Resize(15);
+    bool grown_ok = grown.GetSize() == 15;
+    for (int i = 0; i < 15; i++) grown_ok = grown_ok && grown[i].GetOp() == ((i < 10) ? i + 1 : 0);
+    ReportTestResult("Resize while shared - grow", grown_ok && HasOps(seq, 10, 1));
+    
+    Avida::InstructionSequence shrunk(seq);
+    shrunk.Resize(4);
+    ReportTestResult("Resize while shared - shrink", HasOps(shrunk, 4, 1) && HasOps(seq, 10, 1));
+    shrunk[0].SetOp(70);
+    shrunk.Resize(10);
+    ReportTestResult("Resize while shared - write after shrink", HasOps(seq, 10, 1) && shrunk[0].GetOp() == 70 &&
+                     shrunk[9].GetOp() == 0);
+    
+    Avida::InstructionSequence inserted(seq);
+    inserted.Insert(2, Avida::Instruction(80));
+    inserted.Remove(0);
+    ReportTestResult("Insert/Remove while shared", HasOps(seq, 10, 1) && inserted.GetSize() == 10 &&
+                     inserted[1].GetOp() == 80 && inserted[2].GetOp() == 3);
+    
+    cCPUMemory memory(seq);
+    memory.Resize(20);
+    memory[12].SetOp(90);
+    ReportTestResult("CPU memory - resize while shared", HasOps(seq, 10, 1) && memory.GetSize() == 20 &&
+                     memory[9].GetOp() == 10 && memory[12].GetOp() == 90);
+    
+    
+    // Equality and hashing
+    Avida::InstructionSequence same_ops(10);
+    Fill(same_ops, 1);
+    Avida::InstructionSequence other_ops(10);
+    Fill(other_ops, 2);
+    ReportTestResult("Hash - equal content", same_ops.Hash() == seq.Hash());
+    ReportTestResult("Equality - shared, equal and different", Avida::InstructionSequence(seq) == seq &&
+                     same_ops == seq && !(other_ops == seq));
+    ReportTestResult("Crop - copies content", HasOps(seq.Crop(2, 7), 5, 3));
+    
+    
+    // Hash caching around mutable references
+    ReportTestResult("Exposure - SetInst does not expose, operator[] does", !base.IsExposed() && copy.IsExposed());
+    Avida::InstructionArray held(10);
+    for (int i = 0; i < 10; i++) held.SetInst(i, Avida::Instruction(i + 1));
+    Avida::Instruction& ref = held[4];
+    const unsigned int held_hash = held.Hash(10);
+    Avida::InstructionArray held_copy(held);
+    ref = Avida::Instruction(99);
+    Avida::InstructionArray expected(10);
+    for (int i = 0; i < 10; i++) expected.SetInst(i, Avida::Instruction((i == 4) ? 99 : i + 1));
+    ReportTestResult("Held reference - hash not kept", held.IsExposed() && !held.HasHash(10) && held_hash == base_hash &&
+                     held.Hash(10) == expected.Hash(10) && expected.HasHash(10));
+    ReportTestResult("Held reference - copy not hashed stale", !held_copy.HasHash(10) &&
+                     held_copy.Hash(10) == expected.Hash(10));
+    
+    Avida::InstructionSequence held_seq(10);
+    Avida::InstructionSequence expected_seq(10);
+    for (int i = 0; i < 10; i++) {
+      held_seq.SetInst(i, Avida::Instruction(i + 1));
+      expected_seq.SetInst(i, Avida::Instruction((i == 4) ? 99 : i + 1));
+    }
+    Avida::Instruction& seq_ref = held_seq[4];
+    held_seq.Hash();
+    expected_seq.Hash();
+    seq_ref = Avida::Instruction(99);
+    ReportTestResult("Held reference - equality sees the write", held_seq == expected_seq && expected_seq == held_seq);
+  }
+};
+
+
+
+#include "cCellConnections.h"
+
+class cCellConnectionsTests : public cUnitTest
+{
+private:
+  // The connection lists only store cell pointers, so slots of a plain array stand in for the cells
+  char m_slots[8];
+  
+  cPopulationCell* Cell(int i) { return reinterpret_cast<cPopulationCell*>(&m_slots[i]); }
+  
+  // Facing order starting from the given cell, wrapping within first..first + size - 1
+  bool Faces(const cCellConnections& connections, int first, int size, int faced)
+  {
+    if (connections.GetSize() != size) return false;
+    for (int i = 0; i < size; i++) if (connections.GetPos(i) != Cell(first + (faced - first + i) % size)) return false;
+    return true;
+  }
+  
+  static bool Same(const Apto::Array<cPopulationCell*>& table, const Apto::Array<cPopulationCell*>& packed)
+  {
+    if (table.GetSize() != packed.GetSize()) return false;
+    for (int i = 0; i < table.GetSize(); i++) if (table[i] != packed[i]) return false;
+    return true;
+  }
+  
+  // Neighbors are read from the span at offset, with the facing as an index into it
+  static bool ReadsSpan(const cCellConnections& connections, const Apto::Array<cPopulationCell*>& table, int offset)
+  {
+    const int size = connections.GetSize();
+    for (int i = 0; i < size; i++) {
+      if (connections.GetPos(i) != table[offset + (connections.GetFacing() + i) % size]) return false;
+    }
+    return true;
+  }
+  
+public:
+  const char* GetUnitName() { return "cCellConnections"; }
+protected:
+  void RunTests()
+  {
+    // Building the lists
+    cCellConnections lists[3];
+    const int offsets[3] = { 0, 3, 5 };
+    const int sizes[3] = { 3, 2, 3 };
+    for (int l = 0; l < 3; l++) for (int i = 0; i < sizes[l]; i++) lists[l].PushRear(Cell(offsets[l] + i));
+    ReportTestResult("PushRear - keeps facing", Faces(lists[0], 0, 3, 0) && Faces(lists[2], 5, 3, 5));
+    
+    cCellConnections pushed;
+    pushed.Push(Cell(1));
+    pushed.Push(Cell(0));
+    ReportTestResult("Push - faces new cell", pushed.GetFirst() == Cell(0) && pushed.GetPos(1) == Cell(1));
+    
+    
+    // Packing into one compressed sparse row table, as cPopulation does after building the topology
+    Apto::Array<cPopulationCell*> table(8);
+    for (int l = 0; l < 3; l++) lists[l].PackInto(&table[offsets[l]]);
+    bool spans_ok = true;
+    for (int l = 0; l < 3; l++) {
+      for (int i = 0; i < sizes[l]; i++) spans_ok = spans_ok && lists[l].Find(table[offsets[l] + i]) == i;
+    }
+    ReportTestResult("Pack - one span per cell", spans_ok);
+    ReportTestResult("Pack - order kept", Faces(lists[0], 0, 3, 0) && Faces(lists[1], 3, 2, 3) && Faces(lists[2], 5, 3, 5));
+    ReportTestResult("Pack - reads table", ReadsSpan(lists[0], table, 0) && ReadsSpan(lists[1], table, 3) &&
+                     ReadsSpan(lists[2], table, 5));
+    
+    Apto::Array<cPopulationCell*> packed(table);
+    
+    
+    // Turning only moves the facing index
+    lists[2].CircNext();
+    lists[2].CircNext();
+    lists[2].CircNext();
+    lists[0].CircPrev();
+    ReportTestResult("Turn - wraps around", Faces(lists[2], 5, 3, 5) && Faces(lists[0], 0, 3, 2));
+    lists[0].SetFacing(lists[0].Find(Cell(1)));
+    ReportTestResult("Turn - face found cell", Faces(lists[0], 0, 3, 1) && lists[0].Find(Cell(6)) == -1);
+    ReportTestResult("Turn - table untouched", Same(table, packed) && ReadsSpan(lists[0], table, 0));
+    
+    
+    // Edits move a span into private storage, leaving the table (and its other spans) alone
+    lists[1].SetFacing(lists[1].Find(Cell(4)));
+    ReportTestResult("Remove - returns cell", lists[1].Remove(Cell(4)) == Cell(4) && lists[1].Remove(Cell(7)) == NULL);
+    ReportTestResult("Remove - faced cell moves on", lists[1].GetSize() == 1 && lists[1].GetFirst() == Cell(3));
+    lists[1].PushRear(Cell(7));
+    ReportTestResult("Edit after pack - private copy", lists[1].GetFirst() == Cell(3) && lists[1].GetPos(1) == Cell(7) &&
+                     Same(table, packed) && ReadsSpan(lists[2], table, 5));
+    
+    cCellConnections copy(lists[2]);
+    copy.Remove(Cell(6));
+    ReportTestResult("Copy - private storage", copy.GetSize() == 2 && Faces(lists[2], 5, 3, 5) && Same(table, packed));
+    
+    lists[0].Clear();
+    ReportTestResult("Clear - table untouched", lists[0].GetSize() == 0 && lists[0].GetFirst() == NULL && Same(table, packed));
+  }
+};
+
+
+#include "cCellNeighborhoods.h"
+#include "cMutationRates.h"
+#include "cPopulationCell.h"
+
+#include <set>
+
+class cCellNeighborhoodsTests : public cUnitTest
+{
+private:
+  Apto::Array<cPopulationCell> m_cells;
+  
+  void Connect(int from, int to) { m_cells[from].ConnectionList().PushRear(&m_cells[to]); }
+  
+  // The cells the recursive walk finds, without the cell itself, as BroadcastMessage used to send to them
+  bool MatchesWalk(const Apto::Array<int>& neighborhood, int cell_id, int depth)
+  {
+    std::set<cPopulationCell*> cell_set;
+    m_cells[cell_id].GetNeighboringCells(cell_set, depth);
+    cell_set.erase(&m_cells[cell_id]);
+    if (neighborhood.GetSize() != static_cast<int>(cell_set.size())) return false;
+    int i = 0;
+    for (std::set<cPopulationCell*>::iterator it = cell_set.begin(); it != cell_set.end(); ++it, i++) {
+      if ((*it)->GetID() != neighborhood[i]) return false;
+    }
+    return true;
+  }
+  
+  static bool Holds(const Apto::Array<int>& neighborhood, int size, const int* ids)
+  {
+    if (neighborhood.GetSize() != size) return false;
+    for (int i = 0; i < size; i++) if (neighborhood[i] != ids[i]) return false;
+    return true;
+  }
+  
+public:
+  const char* GetUnitName() { return "cCellNeighborhoods"; }
+protected:
+  void RunTests()
+  {
+    // 0 -> 1 2, 1 -> 2 0, 2 -> 3, 3 -> 4, 4 -> 5 0; cell 2 is one hop from 0, but the walk first finds it through 1
+    const int num_cells = 6;
+    cMutationRates rates;
+    m_cells.Resize(num_cells);
+    for (int i = 0; i < num_cells; i++) m_cells[i].Setup(NULL, i, rates, i, 0);
+    Connect(0, 1); Connect(0, 2);
+    Connect(1, 2); Connect(1, 0);
+    Connect(2, 3);
+    Connect(3, 4);
+    Connect(4, 5); Connect(4, 0);
+    
+    cCellNeighborhoods neighborhoods(m_cells);
+    
+    const int hop_one[] = { 1, 2 };
+    ReportTestResult("Get - one hop", Holds(neighborhoods.Get(0, 1), 2, hop_one));
+    ReportTestResult("Get - depth below one is one hop", &neighborhoods.Get(0, 0) == &neighborhoods.Get(0, 1));
+    ReportTestResult("Get - first path only", Holds(neighborhoods.Get(0, 2), 2, hop_one));
+    const int back_home[] = { 0, 2, 3 };
+    ReportTestResult("Get - excludes the cell itself", Holds(neighborhoods.Get(1, 2), 3, back_home));
+    
+    bool walk_ok = true;
+    for (int depth = 1; depth <= num_cells; depth++) {
+      for (int i = 0; i < num_cells; i++) walk_ok = walk_ok && MatchesWalk(neighborhoods.Get(i, depth), i, depth);
+    }
+    ReportTestResult("Get - matches GetNeighboringCells", walk_ok);
+    ReportTestResult("Get - cached", &neighborhoods.Get(3, 2) == &neighborhoods.Get(3, 2));
+    
+    
+    // Cached neighborhoods are kept until cleared, as cPopulation::ConnectionsChanged() does after an edit
+    Connect(0, 5);
+    ReportTestResult("Connect - cache kept", Holds(neighborhoods.Get(0, 1), 2, hop_one));
+    neighborhoods.Clear();
+    const int connected[] = { 1, 2, 5 };
+    ReportTestResult("Clear - sees new connection", Holds(neighborhoods.Get(0, 1), 3, connected));
+    
+    m_cells[1].ConnectionList().Remove(&m_cells[2]);
+    neighborhoods.Clear();
+    const int severed[] = { 0, 2, 5 };
+    ReportTestResult("Clear - sees removed connection", Holds(neighborhoods.Get(1, 2), 3, severed) &&
+                     MatchesWalk(neighborhoods.Get(1, 2), 1, 2));
+    
+    walk_ok = true;
+    for (int depth = 1; depth <= num_cells; depth++) {
+      for (int i = 0; i < num_cells; i++) walk_ok = walk_ok && MatchesWalk(neighborhoods.Get(i, depth), i, depth);
+    }
+    ReportTestResult("Clear - matches GetNeighboringCells", walk_ok);
+  }
+};
+
+
+
+#include "cOrgMessage.h"
+#include "cOrgMessageBox.h"
+
+class cOrgMessageBoxTests : public cUnitTest
+{
+private:
+  static cOrgMessage Message(unsigned int data)
+  {
+    cOrgMessage msg;
+    msg.SetData(data);
+    return msg;
+  }
+  
+  // Messages oldest first are first, first + 1, ...
+  static bool Holds(const cOrgMessageBox& box, int size, unsigned int first)
+  {
+    if (box.GetSize() != size) return false;
+    for (int i = 0; i < size; i++) if (box[i].GetData() != first + i) return false;
+    return true;
+  }
+  
+public:
+  const char* GetUnitName() { return "cOrgMessageBox"; }
+protected:
+  void RunTests()
+  {
+    cOrgMessageBox box(3);
+    for (unsigned int i = 0; i < 3; i++) box.PushBack(Message(i));
+    ReportTestResult("PushBack - fills", Holds(box, 3, 0) && box.IsFull() && box.Back().GetData() == 2);
+    box.PushBack(Message(3));
+    box.PushBack(Message(4));
+    ReportTestResult("PushBack - full drops oldest", Holds(box, 3, 2) && box.Front().GetData() == 2);
+    
+    box.PopFront();
+    ReportTestResult("PopFront - removes oldest", Holds(box, 2, 3) && !box.IsFull());
+    box.PushBack(Message(5));
+    box.PushBack(Message(6));
+    ReportTestResult("PushBack - wraps after pop", Holds(box, 3, 4) && box.IsFull());
+    while (box.GetSize()) box.PopFront();
+    box.PushBack(Message(7));
+    ReportTestResult("PopFront - empties", Holds(box, 1, 7) && box.Front().GetData() == box.Back().GetData());
+    box.Clear();
+    ReportTestResult("Clear - empties", box.GetSize() == 0 && !box.IsFull());
+    
+    
+    cOrgMessageBox unbounded(-1);
+    unbounded.PushBack(Message(0));
+    unbounded.PushBack(Message(1));
+    unbounded.PopFront();
+    for (unsigned int i = 2; i < 40; i++) unbounded.PushBack(Message(i));
+    ReportTestResult("Unbounded - grows in order", Holds(unbounded, 39, 1) && !unbounded.IsFull());
+    
+    cOrgMessageBox none(0);
+    none.PushBack(Message(0));
+    ReportTestResult("Capacity 0 - keeps nothing", none.GetSize() == 0 && none.IsFull());
+    
+    cOrgMessageBox negative(-5);
+    negative.PushBack(Message(0));
+    ReportTestResult("Capacity below -1 - keeps nothing", negative.GetCapacity() == 0 && negative.GetSize() == 0);
+  }
+};
+
+
+
+#include "avida/core/World.h"
+#include "avida/output/Manager.h"
+#include "avida/output/SeriesFile.h"
+#include "avida/output/SeriesReader.h"
+
+#include <climits>
+#include <cstring>
+#include <string>
+
+class cSeriesFileTests : public cUnitTest
+{
+private:
+  static const int NUM_ROWS = 7;
+  
+  // The test series, with three rows per chunk.  Unset values repeat the previous row's, also across chunk boundaries.
+  static int RowUpdate(int row) { const int updates[NUM_ROWS] = { 0, 1, 2, 5, 5, 9, 10 }; return updates[row]; }
+  static bool IntSet(int row) { return row != 3; }
+  static int IntValue(int row)
+  {
+    const int values[NUM_ROWS] = { 3, -7, INT_MAX, 0, INT_MIN, -1, 42 };
+    return (IntSet(row)) ? values[row] : IntValue(row - 1);
+  }
+  static bool DoubleSet(int row) { return row != 1 && row != 6; }
+  static double DoubleValue(int row)
+  {
+    const double values[NUM_ROWS] = { 0.5, 0.0, -1.25, 1e300, 2.0 / 3.0, -0.0, 0.0 };
+    return (DoubleSet(row)) ? values[row] : DoubleValue(row - 1);
+  }
+  
+  // Checks every row and value of the series written by RunTests, reading it a chunk at a time
+  static bool ReadsBack(const Avida::Output::SeriesReader& reader, bool& updates_ok, bool& ints_ok, bool& doubles_ok)
+  {
+    updates_ok = ints_ok = doubles_ok = true;
+    int row = 0;
+    for (int chunk = 0; chunk < reader.NumChunks(); chunk++) {
+      Apto::Array<Avida::Update> updates;
+      Apto::Array<double> ints;
+      Apto::Array<double> doubles;
+      if (!reader.ReadUpdates(chunk, updates) || !reader.ReadColumn(chunk, 0, ints) || !reader.ReadColumn(chunk, 1, doubles)) {
+        return false;
+      }
+      for (int i = 0; i < updates.GetSize(); i++, row++) {
+        if (row >= NUM_ROWS) return false;
+        const double expected = DoubleValue(row);
+        updates_ok = updates_ok && updates[i] == RowUpdate(row);
+        ints_ok = ints_ok && ints[i] == IntValue(row);
+        doubles_ok = doubles_ok && memcmp(&doubles[i], &expected, sizeof(double)) == 0;  // Exact, including -0.0
+      }
+    }
+    return row == NUM_ROWS;
+  }
+  
+  static std::string ReadFile(const char* filename)
+  {
+    std::ifstream fp(filename, std::ios::in | std::ios::binary);
+    return std::string((std::istreambuf_iterator<char>(fp)), std::istreambuf_iterator<char>());
+  }
+  
+public:
+  const char* GetUnitName() { return "SeriesFile"; }
+protected:
+  void RunTests()
+  {
+    Avida::World world;
+    Avida::Output::ManagerPtr output_mgr(new Avida::Output::Manager("."));
+    output_mgr->AttachTo(&world);
+    
+    // Three rows per chunk, so the last chunk is short
+    const char* filename = "unit-tests-series.avts";
+    {
+      Avida::Output::SeriesFilePtr series = Avida::Output::SeriesFile::CreateWithPath(&world, "./unit-tests-series.avts", NULL, 3);
+      ReportTestResult("Write - create", series && series->Good());
+      if (!series) return;
+      
+      const int int_col = series->AddColumn("count", Avida::Output::SERIES_INT);
+      const int double_col = series->AddColumn("mean", Avida::Output::SERIES_DOUBLE);
+      for (int row = 0; row < NUM_ROWS; row++) {
+        series->BeginRow(RowUpdate(row));
+        if (IntSet(row)) series->SetValue(int_col, IntValue(row));
+        if (DoubleSet(row)) series->SetValue(double_col, DoubleValue(row));
+        series->EndRow();
+      }
+    }
+    
+    Avida::Output::SeriesReader reader;
+    const bool opened = reader.Open(filename);
+    ReportTestResult("Read - open", opened);
+    if (!opened) {
+      remove(filename);
+      return;
+    }
+    ReportTestResult("Read - columns", reader.NumColumns() == 2 && reader.ColumnName(0) == "count" &&
+                     reader.ColumnType(0) == Avida::Output::SERIES_INT && reader.ColumnName(1) == "mean" &&
+                     reader.ColumnType(1) == Avida::Output::SERIES_DOUBLE);
+    ReportTestResult("Read - chunk index", reader.NumRows() == NUM_ROWS && reader.NumChunks() == 3 &&
+                     reader.ChunkNumRows(2) == 1 && reader.ChunkFirstUpdate(1) == 5 && reader.ChunkLastUpdate(1) == 9);
+    ReportTestResult("Read - find chunk", reader.FindChunk(0) == 0 && reader.FindChunk(3) == 1 && reader.FindChunk(9) == 1 &&
+                     reader.FindChunk(10) == 2 && reader.FindChunk(11) == -1);
+    
+    bool updates_ok, ints_ok, doubles_ok;
+    const bool read_ok = ReadsBack(reader, updates_ok, ints_ok, doubles_ok);
+    ReportTestResult("Round trip - updates", read_ok && updates_ok);
+    ReportTestResult("Round trip - int values", read_ok && ints_ok);
+    ReportTestResult("Round trip - double values", read_ok && doubles_ok);
+    
+    
+    // Export to the text layout
+    const char* dat_filename = "unit-tests-series.dat";
+    const bool exported = reader.ExportDat(dat_filename);
+    std::ifstream dat(dat_filename);
+    std::string line;
+    int header_lines = 0;
+    int data_lines = 0;
+    std::string first_row;
+    while (std::getline(dat, line)) {
+      if (line.size() == 0 || line[0] == '#') header_lines++;
+      else if (data_lines++ == 0) first_row = line;
+    }
+    dat.close();
+    remove(dat_filename);
+    ReportTestResult("Export - dat rows", exported && header_lines == 5 && data_lines == NUM_ROWS && first_row == "0 3 0.5 ");
+    reader.Close();
+    
+    
+    // A run interrupted before the index was written is read by walking the chunk headers
+    const std::string contents = ReadFile(filename);
+    remove(filename);
+    unsigned long long index_offset = 0;
+    for (int i = 0; i < 8 && contents.size() >= 12; i++) {
+      index_offset |= static_cast<unsigned long long>(static_cast<unsigned char>(contents[contents.size() - 12 + i])) << (8 * i);
+    }
+    ReportTestResult("Index - trailer", contents.size() > 12 && index_offset < contents.size());
+    if (index_offset >= contents.size()) return;
+    
+    const char* truncated_filename = "unit-tests-series-truncated.avts";
+    std::ofstream truncated(truncated_filename, std::ios::out | std::ios::binary);
+    truncated.write(contents.data(), index_offset);
+    truncated.close();
+    
+    const bool scanned = reader.Open(truncated_filename);
+    const bool scanned_ok = scanned && ReadsBack(reader, updates_ok, ints_ok, doubles_ok);
+    ReportTestResult("No index - chunks scanned", scanned_ok && reader.NumChunks() == 3 && updates_ok && ints_ok && doubles_ok);
+    reader.Close();
+    remove(truncated_filename);
+  }
+};
+
+
+#include "cMeritSchedule.h"
+
+class cMeritScheduleTests : public cUnitTest
+{
+private:
+  enum { NUM_ENTRIES = 11 };   // Not a power of two, so some leaves of the tree are padding
+
+  static cMeritSchedule* Build(const double* priorities, int seed)
+  {
+    cMeritSchedule* schedule = new cMeritSchedule(NUM_ENTRIES, Apto::SmartPtr<Apto::Random>(new Apto::RNG::AvidaRNG(seed)));
+    for (int i = 0; i < NUM_ENTRIES; i++) schedule->AdjustPriority(i, priorities[i]);
+    return schedule;
+  }
+
+  // Trees holding the same sums descend identically, so they draw the same entries from the same seed
+  static bool MatchesBuilt(cMeritSchedule& schedule, const double* priorities, int seed)
+  {
+    cMeritSchedule* built = Build(priorities, seed);
+    bool same = true;
+    for (int i = 0; i < 2000; i++) if (schedule.Next() != built->Next()) same = false;
+    if (schedule.GetTotalPriority() != built->GetTotalPriority()) same = false;
+    for (int i = 0; i < NUM_ENTRIES; i++) if (schedule.GetPriority(i) != priorities[i]) same = false;
+    delete built;
+    return same;
+  }
+
+  // Chi-square statistic of the draws against the priorities, with at most NUM_ENTRIES - 1 degrees of freedom
+  static double ChiSquare(cMeritSchedule& schedule, const double* priorities, int draws, bool& zero_drawn)
+  {
+    double total = 0.0;
+    int counts[NUM_ENTRIES];
+    for (int i = 0; i < NUM_ENTRIES; i++) {
+      total += priorities[i];
+      counts[i] = 0;
+    }
+
+    zero_drawn = false;
+    for (int i = 0; i < draws; i++) {
+      const int id = schedule.Next();
+      if (id < 0 || id >= NUM_ENTRIES || priorities[id] == 0.0) zero_drawn = true;
+      else counts[id]++;
+    }
+
+    double chi_square = 0.0;
+    for (int i = 0; i < NUM_ENTRIES; i++) {
+      if (priorities[i] == 0.0) continue;
+      const double expected = draws * priorities[i] / total;
+      chi_square += (counts[i] - expected) * (counts[i] - expected) / expected;
+    }
+    return chi_square;
+  }
+
+public:
+  const char* GetUnitName() { return "cMeritSchedule"; }
+protected:
+  void RunTests()
+  {
+    // 40 is beyond the 0.9999 quantile for 10 degrees of freedom; the seeds are fixed, so the results are too
+    const double max_chi_square = 40.0;
+    bool zero_drawn = false;
+
+    double priorities[NUM_ENTRIES] = { 1.0, 0.0, 2.0, 3.0, 0.0, 5.0, 1.0, 4.0, 0.0, 2.0, 6.0 };
+    cMeritSchedule* schedule = Build(priorities, 3);
+    const double initial_chi_square = ChiSquare(*schedule, priorities, 100000, zero_drawn);
+    ReportTestResult("Next - frequencies follow priorities", initial_chi_square < max_chi_square && !zero_drawn);
+    delete schedule;
+
+    // Individual changes, including ones to zero, from zero and to the current value
+    double adjusted[NUM_ENTRIES];
+    for (int i = 0; i < NUM_ENTRIES; i++) adjusted[i] = priorities[i];
+    adjusted[5] = 0.0;
+    adjusted[1] = 7.0;
+    adjusted[10] = 0.5;
+    schedule = Build(priorities, 5);
+    schedule->AdjustPriority(5, 0.0);
+    schedule->AdjustPriority(1, 7.0);
+    schedule->AdjustPriority(10, 0.5);
+    schedule->AdjustPriority(3, 3.0);
+    ReportTestResult("AdjustPriority - tree matches one built from the new priorities", MatchesBuilt(*schedule, adjusted, 5));
+    delete schedule;
+
+    schedule = Build(priorities, 7);
+    for (int i = 0; i < NUM_ENTRIES; i++) schedule->AdjustPriority(i, adjusted[i]);
+    const double adjusted_chi_square = ChiSquare(*schedule, adjusted, 100000, zero_drawn);
+    ReportTestResult("AdjustPriority - frequencies follow new priorities", adjusted_chi_square < max_chi_square && !zero_drawn);
+    delete schedule;
+
+    // A batch of three changes sums their paths (3 * 4 levels < 16 leaves), a larger one rebuilds the tree
+    schedule = Build(priorities, 9);
+    schedule->BeginBatch();
+    schedule->AdjustPriority(5, 0.0);
+    schedule->AdjustPriority(1, 7.0);
+    schedule->AdjustPriority(10, 0.5);
+    schedule->EndBatch();
+    ReportTestResult("EndBatch - paths summed", schedule->GetStats().batches == 1 && schedule->GetStats().rebuilds == 0);
+    ReportTestResult("EndBatch - tree matches one built from the new priorities", MatchesBuilt(*schedule, adjusted, 9));
+    delete schedule;
+
+    double batched[NUM_ENTRIES] = { 0.0, 0.0, 8.0, 3.0, 1.5, 5.0, 0.0, 4.0, 2.0, 0.0, 6.0 };
+    schedule = Build(priorities, 11);
+    schedule->BeginBatch();
+    schedule->AdjustPriority(0, 3.0);
+    schedule->AdjustPriority(2, 8.0);
+    schedule->AdjustPriority(4, 1.5);
+    schedule->AdjustPriority(6, 0.0);
+    schedule->AdjustPriority(8, 2.0);
+    schedule->AdjustPriority(9, 0.0);
+    schedule->AdjustPriority(0, 0.0);
+    const bool leaves_only = schedule->InBatch() && schedule->GetPriority(2) == 8.0;
+    schedule->EndBatch();
+    ReportTestResult("EndBatch - tree rebuilt", leaves_only && schedule->GetStats().rebuilds == 1);
+    ReportTestResult("EndBatch - rebuilt tree matches one built from the new priorities", MatchesBuilt(*schedule, batched, 11));
+    delete schedule;
+
+    // Drawing while a batch is open ends it first
+    schedule = Build(priorities, 13);
+    schedule->BeginBatch();
+    for (int i = 0; i < NUM_ENTRIES; i++) schedule->AdjustPriority(i, batched[i]);
+    const bool draws_match = MatchesBuilt(*schedule, batched, 13);
+    ReportTestResult("Next - ends an open batch", draws_match && !schedule->InBatch());
+    delete schedule;
+
+    schedule = Build(batched, 15);
+    const double batched_chi_square = ChiSquare(*schedule, batched, 100000, zero_drawn);
+    ReportTestResult("EndBatch - frequencies follow new priorities", batched_chi_square < max_chi_square && !zero_drawn);
+    delete schedule;
+
+    // Block draws consume the generator exactly as single draws do
+    schedule = Build(batched, 17);
+    cMeritSchedule* single = Build(batched, 17);
+    Apto::Array<int> ids;
+    bool blocks_match = true;
+    for (int block = 1; block <= 64; block++) {
+      schedule->Next(block, ids);
+      if (ids.GetSize() != block) blocks_match = false;
+      for (int i = 0; i < ids.GetSize(); i++) if (ids[i] != single->Next()) blocks_match = false;
+    }
+    ReportTestResult("Next(count) - matches repeated Next()", blocks_match);
+    delete single;
+
+    // With every priority zero nothing can be drawn
+    for (int i = 0; i < NUM_ENTRIES; i++) schedule->AdjustPriority(i, 0.0);
+    schedule->Next(3, ids);
+    const bool none_drawn = schedule->Next() == -1 && ids.GetSize() == 3 && ids[0] == -1 && ids[1] == -1 && ids[2] == -1;
+    ReportTestResult("Next - empty schedule draws nothing", none_drawn && schedule->GetTotalPriority() == 0.0);
+    delete schedule;
+  }
+};
+
+
+
+#include "cResourceCount.h"
+
+class cResourceCountTests : public cUnitTest
+{
+private:
+  // The per-step recurrence, carried in extended precision so that its own rounding stays below the tolerance
+  static long double Stepped(double amount, double step_decay, double step_inflow, long long num_steps)
+  {
+    long double x = amount;
+    for (long long i = 0; i < num_steps; i++) x = x * step_decay + step_inflow;
+    return x;
+  }
+
+  static bool MatchesStepped(double decay, const long long* gaps, int num_gaps)
+  {
+    const double amounts[] = { 0.0, 250.0 };
+    const double inflows[] = { 0.0, 0.75 };
+    const double step_decay = cResourceCount::IntegrateSteps(1.0, decay, 0.0, 1);
+
+    bool same = true;
+    for (int g = 0; g < num_gaps; g++) {
+      for (int a = 0; a < 2; a++) {
+        for (int f = 0; f < 2; f++) {
+          const long double stepped = Stepped(amounts[a], step_decay, inflows[f], gaps[g]);
+          const double closed = cResourceCount::IntegrateSteps(amounts[a], decay, inflows[f], gaps[g]);
+          const long double scale = (fabsl(stepped) > 1.0L) ? fabsl(stepped) : 1.0L;
+          if (fabsl(closed - stepped) > 1.0e-9L * scale) same = false;
+        }
+      }
+    }
+    return same;
+  }
+
+public:
+  const char* GetUnitName() { return "cResourceCount"; }
+protected:
+  void RunTests()
+  {
+    // Gaps up to PRECALC_DISTANCE (100) are read from the tables in a run, longer ones are integrated in closed form
+    const long long small_gaps[] = { 1, 2, 7, 100 };
+    const long long large_gaps[] = { 101, 1000, 250000 };
+
+    const double decays[] = { 0.0, 1.0, 1.0 - 1.0e-9, 0.99, 0.5 };
+    const char* names[] = { "decay 0", "decay 1", "decay near 1", "decay 0.99", "decay 0.5" };
+    for (int d = 0; d < 5; d++) {
+      ReportTestResult((cString("IntegrateSteps - ") + names[d] + ", small gaps").GetData(), MatchesStepped(decays[d], small_gaps, 4));
+      ReportTestResult((cString("IntegrateSteps - ") + names[d] + ", large gaps").GetData(), MatchesStepped(decays[d], large_gaps, 3));
+    }
+
+    // One update is 10000 steps, over which the amount decays by exactly the per update rate
+    const double decayed = cResourceCount::IntegrateSteps(250.0, 0.99, 0.0, 10000);
+    ReportTestResult("IntegrateSteps - one update decays by the update rate", fabs(decayed - 250.0 * 0.99) < 1.0e-9);
+  }
+};
+
+
+
+#ifdef AVD_UNIT_TESTS_SCRIPT
+#include "ASCoreLib.h"
+#include "ASTree.h"
+#include "AvidaScript.h"
+#include "cASBytecode.h"
+#include "cASLibrary.h"
+#include "cBytecodeCompileASTVisitor.h"
+#include "cBytecodeInterpreter.h"
+#include "cDirectInterpretASTVisitor.h"
+#include "cFile.h"
+#include "cParser.h"
+#include "cSemanticASTVisitor.h"
+#include "cSymbolTable.h"
+
+#include <sstream>
+
+class cBytecodeInterpreterTests : public cUnitTest
+{
+private:
+  struct sScript
+  {
+    const char* name;
+    const char* source;
+    const char* output;   // Expected output of both interpreters, NULL if they need only agree (e.g. float formatting)
+    int exit_code;
+  };
+  
+  // Runs the script through one of the interpreters, returning the exit code and capturing what it prints
+  int Run(cASLibrary* lib, const char* source, bool bytecode, std::string& output)
+  {
+    const char* filename = "unit-tests-script.asl";
+    std::ofstream outfile(filename);
+    outfile << source;
+    outfile.close();
+    
+    cParser parser;
+    cFile file;
+    const bool parsed = file.Open(filename) && parser.Parse(file);
+    file.Close();
+    remove(filename);
+    if (!parsed) return AS_EXIT_FAIL_PARSE;
+    
+    // The global symbol table takes ownership of the tree
+    cSymbolTable global_symtbl;
+    cASTNode* tree = parser.ExtractTree();
+    cSemanticASTVisitor semantic_check(lib, &global_symtbl, tree);
+    tree->Accept(semantic_check);
+    semantic_check.PostCheck();
+    if (!semantic_check.WasSuccessful()) return AS_EXIT_FAIL_SEMANTIC;
+    
+    std::ostringstream captured;
+    std::streambuf* stdout_buf = std::cout.rdbuf(captured.rdbuf());
+    int exit_code = AS_EXIT_FAIL_INTERPRET;
+    if (bytecode) {
+      cBytecodeCompileASTVisitor compiler(&global_symtbl);
+      cASBytecode* program = compiler.Compile(tree);
+      if (program) {
+        {
+          cBytecodeInterpreter interpreter(program);
+          exit_code = interpreter.Run();
+        }
+        delete program;
+      }
+    } else {
+      cDirectInterpretASTVisitor interpreter(&global_symtbl);
+      exit_code = interpreter.Interpret(tree);
+    }
+    std::cout.rdbuf(stdout_buf);
+    
+    output = captured.str();
+    return exit_code;
+  }
+  
+public:
+  const char* GetUnitName() { return "cBytecodeInterpreter"; }
+protected:
+  void RunTests()
+  {
+    const sScript scripts[] = {
+      { "Math",
+        "int foo = 3 * 3 * 3 * 3 * 3 + 5 / 6 / 2 - 4 - 12;\n"
+        "int bar = 5 * (4 - 2) + 6 / 3;\n"
+        "float y = 0.1;\n"
+        "float z = y * 3 + 7 / 2;\n"
+        "println(asstring(foo) + \" \" + asstring(bar) + \" \" + asstring(17 % 5) + \" \" + asstring(-bar));\n"
+        "println(asstring(6 & 3) + \" \" + asstring(6 | 3) + \" \" + asstring(~6) + \" \" + asstring(foo >= bar));\n"
+        "println(asstring(z) + \" \" + asstring(-y) + \" \" + asstring(7.5 / 2) + \" \" + asstring(y < z));\n",
+        NULL, 0 },
+      { "Control",
+        "int y = 4;\n"
+        "if (y > 5) {\n"
+        "  println(\"big\");\n"
+        "} elseif (y == 4) {\n"
+        "  println(\"four\");\n"
+        "} else {\n"
+        "  println(\"small\");\n"
+        "}\n"
+        "foreach int i (1:4) {\n"
+        "  println(asstring(i * i));\n"
+        "}\n"
+        "foreach int j (3:1) { print(asstring(j)); }\n"
+        "foreach char c ('x' ^ 2) { print(asstring(c)); }\n"
+        "println(\"\");\n"
+        "int n = 0;\n"
+        "while (n < 5 && !(n == 3)) { n = n + 1; }\n"
+        "println(asstring(n));\n",
+        "four\n1\n4\n9\n16\n321xx\n3\n", 0 },
+      { "Functions",
+        "int calls = 0;\n"
+        "function int fib(int n)\n"
+        "{\n"
+        "  calls = calls + 1;\n"
+        "  if (n < 2) {\n"
+        "    return n;\n"
+        "  }\n"
+        "  return fib(n - 1) + fib(n - 2);\n"
+        "}\n"
+        "function string label(string name, int count = 2)\n"
+        "{\n"
+        "  return name + \":\" + asstring(count);\n"
+        "}\n"
+        "println(asstring(fib(10)) + \" in \" + asstring(calls) + \" calls\");\n"
+        "println(label(\"a\") + \" \" + label(\"b\", 5));\n"
+        "char c = 'q';\n"
+        "println(asstring(c) + \" \" + asstring(asbool(3)) + \" \" + asstring(asint(2.75)));\n"
+        "return fib(6);\n",
+        "55 in 177 calls\na:2 b:5\nq 1 2\n", 8 }
+    };
+    
+    cASLibrary* lib = new cASLibrary;
+    RegisterASCoreLib(lib);
+    
+    for (unsigned int i = 0; i < sizeof(scripts) / sizeof(scripts[0]); i++) {
+      std::string tree_output;
+      std::string bytecode_output;
+      const int tree_exit = Run(lib, scripts[i].source, false, tree_output);
+      const int bytecode_exit = Run(lib, scripts[i].source, true, bytecode_output);
+      
+      const std::string name(scripts[i].name);
+      ReportTestResult((name + " - tree interpreter").c_str(), tree_exit == scripts[i].exit_code &&
+                       (scripts[i].output == NULL || tree_output == scripts[i].output));
+      ReportTestResult((name + " - bytecode matches tree").c_str(), bytecode_exit == tree_exit &&
+                       bytecode_output == tree_output && tree_output.size() > 0);
+    }
+    
+    delete lib;
+  }
+};
+#endif
+
+
 
 #define TEST(CLASS) \
 tester = new CLASS ## Tests(); \
@@ -333,6 +1610,21 @@ int main(int argc, const char* argv[])
   
   TEST(cRawBitArray);
   TEST(cBitArray);
+  TEST(cDoubleSum);
+  TEST(cRunningStats);
+  TEST(cWorkerPool);
+  TEST(cMigrationMatrix);
+  TEST(cGenotypeBatch);
+  TEST(cInstructionSequence);
+  TEST(cCellConnections);
+  TEST(cCellNeighborhoods);
+  TEST(cOrgMessageBox);
+  TEST(cSeriesFile);
+  TEST(cMeritSchedule);
+  TEST(cResourceCount);
+#ifdef AVD_UNIT_TESTS_SCRIPT
+  TEST(cBytecodeInterpreter);
+#endif
   
   if (failed == 0)
     cout << "All unit tests passed." << endl;
@@ -0,0 +1,98 @@
+/*
+ *  cHighResTimer.h
+ *  Avida
+ *
+ *  Copyright 2026 Michigan State University. All rights reserved.
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef cHighResTimer_h
+#define cHighResTimer_h
+
+#include "apto/platform.h"
+
+#if APTO_PLATFORM(WINDOWS)
+# include <windows.h>
+#elif APTO_PLATFORM(APPLE)
+# include <mach/mach_time.h>
+#else
+# include <time.h>
+#endif
+
+#if defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+# include <intrin.h>
+# define AVIDA_HAS_RDTSC 1
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__i386__) || defined(__x86_64__))
+# include <x86intrin.h>
+# define AVIDA_HAS_RDTSC 1
+#else
+# define AVIDA_HAS_RDTSC 0
+#endif
+
+
+// cHighResTimer - monotonic wall clock with nanosecond resolution (where supported by the platform)
+// --------------------------------------------------------------------------------------------------------------
+
+class cHighResTimer
+{
+private:
+  long long m_start;
+
+public:
+  inline cHighResTimer() : m_start(Now()) { ; }
+
+  inline void Reset() { m_start = Now(); }
+  inline long long Elapsed() const { return Now() - m_start; }
+  inline double ElapsedSeconds() const { return static_cast<double>(Elapsed()) * 1.0e-9; }
+
+  // Returns the current value of the monotonic clock in nanoseconds.  Only differences between values are meaningful.
+  static inline long long Now();
+
+  // Returns the processor time stamp counter where available (x86), otherwise the monotonic clock in nanoseconds.
+  // Cheaper than Now(), but ticks are not calibrated and only meaningful relative to one another.
+  static inline unsigned long long Cycles();
+  static inline bool CyclesAreTicks() { return AVIDA_HAS_RDTSC; }
+};
+
+
+inline long long cHighResTimer::Now()
+{
+#if APTO_PLATFORM(WINDOWS)
+  static LARGE_INTEGER freq = { 0 };
+  if (freq.QuadPart == 0) QueryPerformanceFrequency(&freq);
+  LARGE_INTEGER count;
+  QueryPerformanceCounter(&count);
+  return static_cast<long long>(static_cast<double>(count.QuadPart) * (1.0e9 / static_cast<double>(freq.QuadPart)));
+#elif APTO_PLATFORM(APPLE)
+  static mach_timebase_info_data_t timebase = { 0, 0 };
+  if (timebase.denom == 0) mach_timebase_info(&timebase);
+  return static_cast<long long>(mach_absolute_time() * timebase.numer / timebase.denom);
+#else
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return static_cast<long long>(ts.tv_sec) * 1000000000LL + static_cast<long long>(ts.tv_nsec);
+#endif
+}
+
+inline unsigned long long cHighResTimer::Cycles()
+{
+#if AVIDA_HAS_RDTSC
+  return static_cast<unsigned long long>(__rdtsc());
+#else
+  return static_cast<unsigned long long>(Now());
+#endif
+}
+
+#endif
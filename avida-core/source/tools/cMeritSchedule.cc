@@ -0,0 +1,158 @@
+/*
+ *  cMeritSchedule.cc
+ *  Avida
+ *
+ *  Copyright 2026 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "cMeritSchedule.h"
+
+#include <cassert>
+
+
+cMeritSchedule::cMeritSchedule(int num_entries, Apto::SmartPtr<Apto::Random> rng)
+  : m_size(num_entries), m_leaves(1), m_rng(rng), m_in_batch(false)
+{
+  while (m_leaves < m_size) m_leaves <<= 1;
+  m_tree.Resize(2 * m_leaves);
+  m_tree.SetAll(0.0);
+}
+
+cMeritSchedule::~cMeritSchedule()
+{
+}
+
+
+void cMeritSchedule::AdjustPriority(int entry_id, double priority)
+{
+  assert(entry_id >= 0 && entry_id < m_size);
+  assert(priority >= 0.0);
+
+  m_stats.adjustments++;
+
+  const int leaf = m_leaves + entry_id;
+  if (m_tree[leaf] == priority) return;
+  m_tree[leaf] = priority;
+
+  if (m_in_batch) m_dirty.Push(leaf);
+  else updatePath(leaf >> 1);
+}
+
+
+int cMeritSchedule::Next()
+{
+  if (m_in_batch) EndBatch();
+
+  const double total = m_tree[1];
+  if (total <= 0.0) return -1;
+
+  m_stats.draws++;
+  return descend(m_rng->GetDouble(total));
+}
+
+
+void cMeritSchedule::Next(int count, Apto::Array<int>& ids)
+{
+  if (m_in_batch) EndBatch();
+
+  ids.Resize(count);
+  if (count <= 0) return;
+
+  const double total = m_tree[1];
+  if (total <= 0.0) {
+    ids.SetAll(-1);
+    return;
+  }
+
+  // Draw every position first, in the order Next() would, then walk all of them down the tree one level at a time
+  // so that each level is read in a single pass and the independent descents can overlap
+  m_positions.Resize(count);
+  for (int i = 0; i < count; i++) {
+    m_positions[i] = m_rng->GetDouble(total);
+    ids[i] = 1;
+  }
+
+  int levels = 0;
+  for (int width = 1; width < m_leaves; width <<= 1) {
+    levels++;
+    for (int i = 0; i < count; i++) {
+      const int left = ids[i] << 1;
+      const double left_weight = m_tree[left];
+      if (m_positions[i] < left_weight || m_tree[left + 1] == 0.0) {
+        ids[i] = left;
+      } else {
+        m_positions[i] -= left_weight;
+        ids[i] = left + 1;
+      }
+    }
+  }
+
+  for (int i = 0; i < count; i++) ids[i] -= m_leaves;
+
+  m_stats.draws += count;
+  m_stats.draw_nodes += (long long)count * levels;
+}
+
+
+void cMeritSchedule::EndBatch()
+{
+  m_in_batch = false;
+  if (m_dirty.GetSize() == 0) return;
+
+  // Updating each path separately costs about log2(N) nodes per change, rebuilding costs N
+  int depth = 0;
+  for (int width = 1; width < m_leaves; width <<= 1) depth++;
+
+  if ((long long)m_dirty.GetSize() * depth >= m_leaves) {
+    for (int node = m_leaves - 1; node >= 1; node--) m_tree[node] = m_tree[node << 1] + m_tree[(node << 1) + 1];
+    m_stats.adjust_nodes += m_leaves - 1;
+    m_stats.rebuilds++;
+  } else {
+    for (int i = 0; i < m_dirty.GetSize(); i++) updatePath(m_dirty[i] >> 1);
+  }
+
+  m_dirty.Resize(0);
+  m_stats.batches++;
+}
+
+
+inline void cMeritSchedule::updatePath(int node)
+{
+  for (; node >= 1; node >>= 1) {
+    m_tree[node] = m_tree[node << 1] + m_tree[(node << 1) + 1];
+    m_stats.adjust_nodes++;
+  }
+}
+
+
+inline int cMeritSchedule::descend(double position)
+{
+  // Never step into an empty right subtree, so that rounding in the sums cannot select a zero priority entry
+  int node = 1;
+  while (node < m_leaves) {
+    const int left = node << 1;
+    const double left_weight = m_tree[left];
+    if (position < left_weight || m_tree[left + 1] == 0.0) {
+      node = left;
+    } else {
+      position -= left_weight;
+      node = left + 1;
+    }
+    m_stats.draw_nodes++;
+  }
+  return node - m_leaves;
+}
@@ -0,0 +1,103 @@
+/*
+ *  cMeritSchedule.h
+ *  Avida
+ *
+ *  Copyright 2026 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef cMeritSchedule_h
+#define cMeritSchedule_h
+
+#include "apto/core.h"
+#include "apto/rng.h"
+#include "apto/scheduler.h"
+
+
+// cMeritSchedule - probabilistic merit scheduler over a flat sum tree
+// --------------------------------------------------------------------------------------------------------------
+//
+//  Each entry is drawn with probability proportional to its priority, as with Apto::Scheduler::Probabilistic.  The
+//  priorities are the leaves of a complete binary tree stored in a single array (node i has children 2i and 2i + 1),
+//  so both AdjustPriority and Next cost O(log N) without recursion.  Internal nodes are always recomputed as the sum of
+//  their two children rather than adjusted by the change in priority, so rounding error never accumulates and an
+//  entry with zero priority can never be drawn.
+//
+//  Between BeginBatch() and EndBatch() priority changes only touch the leaves, and the affected paths are summed once
+//  when the batch ends (the whole tree is rebuilt when that is cheaper).  Drawing while a batch is open ends it first.
+//
+//  Next(count, ids) draws a block of entries in one call.  It consumes random numbers in the same order as repeated
+//  calls to Next(), so both produce the same sequence from the same generator state.
+
+class cMeritSchedule : public Apto::PriorityScheduler
+{
+public:
+  struct sStats
+  {
+    long long draws;              // Entries drawn, by either form of Next
+    long long draw_nodes;         // Tree nodes visited while drawing
+    long long adjustments;        // Calls to AdjustPriority
+    long long adjust_nodes;       // Internal nodes recomputed, including batch flushes
+    long long batches;            // Completed batches
+    long long rebuilds;           // Batches resolved by rebuilding the whole tree
+
+    sStats() : draws(0), draw_nodes(0), adjustments(0), adjust_nodes(0), batches(0), rebuilds(0) { ; }
+  };
+
+private:
+  int m_size;
+  int m_leaves;                                 // Power of two >= m_size, first leaf node
+  Apto::Array<double> m_tree;                   // [1, m_leaves) internal sums, [m_leaves, 2 * m_leaves) priorities
+  Apto::SmartPtr<Apto::Random> m_rng;
+
+  bool m_in_batch;
+  Apto::Array<int, Apto::Smart> m_dirty;        // Leaves changed during the current batch
+
+  Apto::Array<double, Apto::Smart> m_positions; // Scratch for block draws
+
+  sStats m_stats;
+
+
+  cMeritSchedule(); // @not_implemented
+  cMeritSchedule(const cMeritSchedule&); // @not_implemented
+  cMeritSchedule& operator=(const cMeritSchedule&); // @not_implemented
+
+public:
+  cMeritSchedule(int num_entries, Apto::SmartPtr<Apto::Random> rng);
+  ~cMeritSchedule();
+
+  void AdjustPriority(int entry_id, double priority);
+  int Next();
+
+  void Next(int count, Apto::Array<int>& ids);
+
+  void BeginBatch() { m_in_batch = true; }
+  void EndBatch();
+  bool InBatch() const { return m_in_batch; }
+
+  int GetSize() const { return m_size; }
+  double GetPriority(int entry_id) const { return m_tree[m_leaves + entry_id]; }
+  double GetTotalPriority() { if (m_in_batch) EndBatch(); return m_tree[1]; }
+
+  const sStats& GetStats() const { return m_stats; }
+  void ResetStats() { m_stats = sStats(); }
+
+private:
+  inline void updatePath(int node);
+  inline int descend(double position);
+};
+
+#endif
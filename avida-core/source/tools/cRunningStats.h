@@ -40,6 +40,7 @@ public:
   inline void Clear() { m_n = 0.0; m_m1 = 0.0; m_m2 = 0.0; m_m3 = 0.0; m_m4 = 0.0; }
   
   inline void Push(double x);
+  inline void Merge(const cRunningStats& other);
 
   inline double N() const { return m_n; }
   inline double Mean() const { return m_m1; }
@@ -64,4 +65,34 @@ inline void cRunningStats::Push(double x)
   m_m1 += d_n;
 }
 
+// Combine with the moments of a disjoint set of values (pairwise update of Chan et al., extended to the third and
+// fourth moments by Pebay)
+inline void cRunningStats::Merge(const cRunningStats& other)
+{
+  if (other.m_n == 0.0) return;
+  if (m_n == 0.0) {
+    *this = other;
+    return;
+  }
+
+  const double na = m_n;
+  const double nb = other.m_n;
+  const double n = na + nb;
+  const double d = other.m_m1 - m_m1;
+  const double d2 = d * d;
+  const double d3 = d2 * d;
+  const double d4 = d2 * d2;
+
+  const double m4 = m_m4 + other.m_m4 + d4 * na * nb * (na * na - na * nb + nb * nb) / (n * n * n)
+    + 6.0 * d2 * (na * na * other.m_m2 + nb * nb * m_m2) / (n * n) + 4.0 * d * (na * other.m_m3 - nb * m_m3) / n;
+  const double m3 = m_m3 + other.m_m3 + d3 * na * nb * (na - nb) / (n * n) + 3.0 * d * (na * other.m_m2 - nb * m_m2) / n;
+  const double m2 = m_m2 + other.m_m2 + d2 * na * nb / n;
+
+  m_n = n;
+  m_m1 += d * nb / n;
+  m_m2 = m2;
+  m_m3 = m3;
+  m_m4 = m4;
+}
+
 #endif
@@ -0,0 +1,118 @@
+/*
+ *  cWorkerPool.cc
+ *  Avida
+ *
+ *  Copyright 2026 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "cWorkerPool.h"
+
+#include "apto/platform.h"
+
+
+cWorkerPool::cWorkerPool(int num_threads)
+  : m_job(NULL), m_num_parts(0), m_next_part(0), m_parts_done(0), m_generation(0), m_shutdown(false)
+{
+  if (num_threads < 1) num_threads = Apto::Platform::AvailableCPUs();
+
+  m_workers.Resize(num_threads - 1);
+  for (int i = 0; i < m_workers.GetSize(); i++) {
+    m_workers[i] = new Worker(this);
+    m_workers[i]->Start();
+  }
+}
+
+cWorkerPool::~cWorkerPool()
+{
+  m_mutex.Lock();
+  m_shutdown = true;
+  m_mutex.Unlock();
+  m_work_cond.Broadcast();
+
+  for (int i = 0; i < m_workers.GetSize(); i++) {
+    m_workers[i]->Join();
+    delete m_workers[i];
+  }
+}
+
+
+void cWorkerPool::Run(Job& job, int num_parts)
+{
+  if (num_parts <= 0) return;
+
+  if (m_workers.GetSize() == 0 || num_parts == 1) {
+    for (int i = 0; i < num_parts; i++) job.Run(i);
+    return;
+  }
+
+  m_mutex.Lock();
+  m_job = &job;
+  m_num_parts = num_parts;
+  m_next_part = 0;
+  m_parts_done = 0;
+  m_generation++;
+  m_mutex.Unlock();
+  m_work_cond.Broadcast();
+
+  runParts();
+
+  m_mutex.Lock();
+  while (m_parts_done < m_num_parts) m_done_cond.Wait(m_mutex);
+  m_job = NULL;
+  m_mutex.Unlock();
+}
+
+
+void cWorkerPool::runParts()
+{
+  while (true) {
+    m_mutex.Lock();
+    if (m_job == NULL || m_next_part >= m_num_parts) {
+      m_mutex.Unlock();
+      break;
+    }
+    Job* job = m_job;
+    const int part = m_next_part++;
+    m_mutex.Unlock();
+
+    job->Run(part);
+
+    m_mutex.Lock();
+    const bool finished = (++m_parts_done == m_num_parts);
+    m_mutex.Unlock();
+    if (finished) m_done_cond.Signal();
+  }
+}
+
+
+void cWorkerPool::Worker::Run()
+{
+  int last_generation = 0;
+
+  while (true) {
+    m_pool->m_mutex.Lock();
+    while (!m_pool->m_shutdown && m_pool->m_generation == last_generation) m_pool->m_work_cond.Wait(m_pool->m_mutex);
+    if (m_pool->m_shutdown) {
+      m_pool->m_mutex.Unlock();
+      break;
+    }
+    last_generation = m_pool->m_generation;
+    m_pool->m_mutex.Unlock();
+
+    m_pool->runParts();
+  }
+}
@@ -0,0 +1,89 @@
+/*
+ *  cWorkerPool.h
+ *  Avida
+ *
+ *  Copyright 2026 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef cWorkerPool_h
+#define cWorkerPool_h
+
+#include "apto/core.h"
+#include "apto/core/Thread.h"
+
+
+// cWorkerPool - persistent threads for fork/join execution of work split into numbered parts
+// --------------------------------------------------------------------------------------------------------------
+//
+//  Run() blocks until every part of the job has completed.  The calling thread participates in the work, so a pool
+//  constructed for N threads starts N - 1 workers.  Which thread executes a given part is not defined; jobs that need
+//  deterministic results should write each part's output to its own slot and combine the slots in part order.
+
+class cWorkerPool
+{
+public:
+  class Job
+  {
+  public:
+    virtual ~Job() { ; }
+    virtual void Run(int part) = 0;
+  };
+
+private:
+  class Worker : public Apto::Thread
+  {
+  private:
+    cWorkerPool* m_pool;
+
+    void Run();
+
+  public:
+    Worker(cWorkerPool* pool) : m_pool(pool) { ; }
+  };
+  friend class Worker;
+
+  Apto::Array<Worker*> m_workers;
+
+  Apto::Mutex m_mutex;
+  Apto::ConditionVariable m_work_cond;
+  Apto::ConditionVariable m_done_cond;
+
+  Job* m_job;
+  int m_num_parts;
+  int m_next_part;
+  int m_parts_done;
+  int m_generation;
+  bool m_shutdown;
+
+
+  void runParts();
+
+  cWorkerPool(); // @not_implemented
+  cWorkerPool(const cWorkerPool&); // @not_implemented
+  cWorkerPool& operator=(const cWorkerPool&); // @not_implemented
+
+public:
+  // num_threads < 1 uses all available CPUs
+  explicit cWorkerPool(int num_threads);
+  ~cWorkerPool();
+
+  int GetNumThreads() const { return m_workers.GetSize() + 1; }
+
+  void Run(Job& job, int num_parts);
+};
+
+#endif
@@ -134,6 +134,7 @@ void Avida::CoreView::Driver::Run()
     // Process the update.
     const int UD_size = ave_time_slice * population.GetNumOrganisms();
     const double step_size = 1.0 / (double) UD_size;
+    population.BeginUpdateSchedule(UD_size);
     
     
     // Are we stepping through an organism?
@@ -379,6 +379,7 @@ void Avida::Viewer::Driver::Run()
       // Process the update.
       const int UD_size = ave_time_slice * population.GetNumOrganisms();
       const double step_size = 1.0 / (double) UD_size;
+      population.BeginUpdateSchedule(UD_size);
       
       
       // Are we stepping through an organism?
@@ -454,6 +455,8 @@ void Avida::Viewer::Driver::Run()
       }
       
       m_mutex.Lock();
+      // Bring the map modes that are not displayed up to date, so that switching modes while paused shows current data
+      if (m_map && !m_done && m_pause_state == DRIVER_PAUSED) m_map->UpdateMaps(population, true);
       while (!m_done && m_pause_state != DRIVER_UNPAUSED) {
         m_paused = true;
         m_pause_cv.Wait(m_mutex);
@@ -28,6 +28,7 @@
 
 #include "cEnvironment.h"
 #include "cOrganism.h"
+#include "cPhenotype.h"
 #include "cPopulation.h"
 #include "cPopulationCell.h"
 #include "cStringUtil.h"
@@ -58,6 +59,9 @@ private:
   Apto::Array<int> m_color_count;
   Apto::Array<DiscreteScale::Entry> m_scale_labels;
   
+  Apto::Array<double> m_cell_value;   // Property value of each cell's occupant, as of its last change
+  Apto::Array<bool> m_cell_occupied;
+  
   double m_cur_min;
   double m_cur_max;
   double m_target_max;
@@ -92,7 +96,7 @@ public:
   bool SetProperty(const Apto::String&, const Apto::String&) { return false; }
   Apto::String GetProperty(const Apto::String&) const { return ""; }
   
-  void Update(cPopulation& pop);
+  void Update(cPopulation& pop, const Apto::Array<int>& changed_cells);
   
   
   // DiscreteScale Interface
@@ -104,9 +108,19 @@ public:
 const double DoublePropMapMode::RESCALE_TOLERANCE = 0.1;
 const double DoublePropMapMode::MAX_RESCALE_FACTOR = 0.03;
 
-void DoublePropMapMode::Update(cPopulation& pop)
+void DoublePropMapMode::Update(cPopulation& pop, const Apto::Array<int>& changed_cells)
 {
   m_color_grid.Resize(pop.GetSize());
+  m_cell_value.Resize(pop.GetSize());
+  m_cell_occupied.Resize(pop.GetSize());
+  
+  // Only look up the property of organisms that are new to their cell or have divided
+  for (int c = 0; c < changed_cells.GetSize(); c++) {
+    const int i = changed_cells[c];
+    cOrganism* org = pop.GetCell(i).GetOrganism();
+    m_cell_occupied[i] = (org != NULL);
+    m_cell_value[i] = (org) ? static_cast<double>(org->Properties().Get(m_prop_id)) : 0.0;
+  }
   
   // Keep track of how many times each color was assigned.
   m_color_count.SetAll(0);
@@ -115,10 +129,9 @@ void DoublePropMapMode::Update(cPopulation& pop)
   double max_fit = 0.0;
   double min_fit = 0.0;
   
-  for (int i = 0; i < pop.GetSize(); i++) {
-    cOrganism* org = pop.GetCell(i).GetOrganism();
-    if (org == NULL) continue;
-    double fit = org->Properties().Get(m_prop_id);
+  for (int i = 0; i < m_cell_value.GetSize(); i++) {
+    if (!m_cell_occupied[i]) continue;
+    double fit = m_cell_value[i];
     if (fit == 0.0) continue;
     if (fit > max_fit) max_fit = fit;
     if (fit < min_fit) min_fit = fit;
@@ -166,15 +179,14 @@ void DoublePropMapMode::Update(cPopulation& pop)
   }
   
   // Now fill out the color grid.
-  for (int i = 0; i < pop.GetSize(); i++) {
-    cOrganism* org = pop.GetCell(i).GetOrganism();
-    if (org == NULL) {
+  for (int i = 0; i < m_cell_value.GetSize(); i++) {
+    if (!m_cell_occupied[i]) {
       m_color_grid[i] = Avida::Viewer::MAP_RESERVED_COLOR_BLACK;
       m_color_count[Avida::Viewer::MAP_RESERVED_COLORS - Avida::Viewer::MAP_RESERVED_COLOR_BLACK]++;
       continue;
     }
     
-    double fit = org->Properties().Get(m_prop_id);
+    double fit = m_cell_value[i];
     if (fit == 0.0) {
       m_color_grid[i] = Avida::Viewer::MAP_RESERVED_COLOR_DARK_GRAY;
       m_color_count[Avida::Viewer::MAP_RESERVED_COLORS - Avida::Viewer::MAP_RESERVED_COLOR_DARK_GRAY]++;
@@ -214,12 +226,16 @@ private:
 private:
   const Apto::String m_role_id;
   const Apto::String m_role_desc;
+  const Systematics::RoleAtom m_role_atom;
   
   Avida::Viewer::ClassificationInfo* m_info;
   Apto::Array<int> m_color_grid;
   Apto::Array<int> m_color_count;
   Apto::Array<DiscreteScale::Entry> m_scale_labels;
   
+  Apto::Array<Systematics::GroupPtr> m_cell_group;  // Group of each cell's occupant, as of its last change
+  Apto::Array<bool> m_cell_occupied;
+  
 public:
   ClassificationMapMode(cWorld* world, const Apto::String& role_id, const Apto::String& role_desc);
   virtual ~ClassificationMapMode() { delete m_info; }
@@ -239,7 +255,7 @@ public:
   bool SetProperty(const Apto::String&, const Apto::String&) { return false; }
   Apto::String GetProperty(const Apto::String&) const { return ""; }
   
-  void Update(cPopulation& pop);
+  void Update(cPopulation& pop, const Apto::Array<int>& changed_cells);
   
   
   // DiscreteScale Interface
@@ -250,7 +266,7 @@ public:
 };
 
 ClassificationMapMode::ClassificationMapMode(cWorld* world, const Apto::String& role_id, const Apto::String& role_desc)
-: m_role_id(role_id), m_role_desc(role_desc)
+: m_role_id(role_id), m_role_desc(role_desc), m_role_atom(Systematics::InternRole(role_id))
 , m_info(new Avida::Viewer::ClassificationInfo(world->GetNewWorld(), role_id, NUM_COLORS, NUM_COLORS))
 , m_color_count(NUM_COLORS + Avida::Viewer::MAP_RESERVED_COLORS)
 , m_scale_labels(NUM_COLORS + Avida::Viewer::MAP_RESERVED_COLORS)
@@ -268,18 +284,28 @@ ClassificationMapMode::ClassificationMapMode(cWorld* world, const Apto::String&
   m_color_grid.SetAll(-4);
 }
 
-void ClassificationMapMode::Update(cPopulation& pop)
+void ClassificationMapMode::Update(cPopulation& pop, const Apto::Array<int>& changed_cells)
 {
   m_info->Update();
   m_color_grid.Resize(pop.GetSize());
-  m_color_count.SetAll(0);            // reset all color counts
-  for (int i = 0; i < pop.GetSize(); i++) {
+  m_cell_group.Resize(pop.GetSize());
+  m_cell_occupied.Resize(pop.GetSize());
+  
+  for (int c = 0; c < changed_cells.GetSize(); c++) {
+    const int i = changed_cells[c];
     cOrganism* org = pop.GetCell(i).GetOrganism();
-    if (org == NULL) {
+    m_cell_occupied[i] = (org != NULL);
+    m_cell_group[i] = (org) ? org->SystematicsGroup(m_role_atom) : Systematics::GroupPtr();
+  }
+  
+  // Group colors are reassigned as the classification changes, so every cell is recolored
+  m_color_count.SetAll(0);            // reset all color counts
+  for (int i = 0; i < m_cell_group.GetSize(); i++) {
+    if (!m_cell_occupied[i]) {
       m_color_grid[i] = -4;
       m_color_count[0]++;
     } else {
-      Systematics::GroupPtr bg = org->SystematicsGroup(m_role_id);
+      Systematics::GroupPtr bg = m_cell_group[i];
       if (bg) {
         Avida::Viewer::ClassificationInfo::MapColorPtr mapcolor = bg->GetData<Avida::Viewer::ClassificationInfo::MapColor>();
         if (mapcolor) {
@@ -331,7 +357,7 @@ public:
   bool SetProperty(const Apto::String& property, const Apto::String& value);
   Apto::String GetProperty(const Apto::String& property) const;
   
-  void Update(cPopulation& pop);
+  void Update(cPopulation& pop, const Apto::Array<int>& changed_cells);
   
   
   // DiscreteScale Interface
@@ -402,26 +428,29 @@ Apto::String EnvActionMapMode::GetProperty(const Apto::String& property) const
   return "";
 }
 
-void EnvActionMapMode::Update(cPopulation& pop)
+void EnvActionMapMode::Update(cPopulation& pop, const Apto::Array<int>& changed_cells)
 {
   cAvidaContext ctx(&m_world->GetDriver(), m_world->GetRandom());
 
   m_action_grid.Resize(pop.GetSize());
-  m_raw_action_counts.Resize(pop.GetSize());
-  for (int i = 0; i < m_raw_action_counts.GetSize(); i++) m_raw_action_counts[i].Resize(m_action_ids.GetSize());
+  if (m_raw_action_counts.GetSize() != pop.GetSize()) {
+    m_raw_action_counts.Resize(pop.GetSize());
+    for (int i = 0; i < m_raw_action_counts.GetSize(); i++) m_raw_action_counts[i].Resize(m_action_ids.GetSize());
+  }
   m_action_counts.SetAll(0);            // reset all color counts
   
-  for (int i = 0; i < pop.GetSize(); i++) {
+  for (int c = 0; c < changed_cells.GetSize(); c++) {
+    const int i = changed_cells[c];
     cOrganism* org = pop.GetCell(i).GetOrganism();
     if (org == NULL) {
       m_raw_action_counts[i].SetAll(0);
     } else {
+      Systematics::GroupPtr genotype = org->SystematicsGroup(Systematics::ROLE_GENOTYPE);
+      Systematics::GenomeTestMetricsPtr metrics(Systematics::GenomeTestMetrics::GetMetrics(m_world, ctx, genotype));
+      const Apto::Array<int>& task_counts = metrics->GetTaskCounts();
       for (int task_id = 0; task_id < m_action_ids.GetSize(); task_id++) {
 //        if (org->GetPhenotype().GetLastTaskCount()[task_id] > 0) m_raw_action_counts[i][task_id] = 1;
 //        else if (org->GetPhenotype().GetCurTaskCount()[task_id] > 0) m_raw_action_counts[i][task_id] = 2;
-        Systematics::GroupPtr genotype = org->SystematicsGroup("genotype");
-        Systematics::GenomeTestMetricsPtr metrics(Systematics::GenomeTestMetrics::GetMetrics(m_world, ctx, genotype));
-        const Apto::Array<int>& task_counts = metrics->GetTaskCounts();
         if (task_counts[task_id] > 0) m_raw_action_counts[i][task_id] = 1;
         else m_raw_action_counts[i][task_id] = 0;
       }
@@ -464,6 +493,12 @@ Avida::Viewer::Map::Map(cWorld* world)
   , m_color_mode(0)
   , m_symbol_mode(-1)
   , m_tag_mode(4)
+  , m_update_serial(0)
+  , m_front(0)
+  , m_ready(1)
+  , m_back(2)
+  , m_ready_fresh(false)
+  , m_readers(0)
 {
   // Setup the available view modes...
   m_view_modes.Resize(5);
@@ -473,6 +508,11 @@ Avida::Viewer::Map::Map(cWorld* world)
   m_view_modes[2] = new DoublePropMapMode(world, "last_metabolic_rate", "Metabolic Rate");
   m_view_modes[3] = new ClassificationMapMode(world, "clade", "Ancestor Organism");
   m_view_modes[4] = new EnvActionMapMode(world);
+  m_mode_serial.Resize(m_view_modes.GetSize());
+  m_mode_serial.SetAll(0);
+  
+  // Publish the initial (empty) state of the default modes
+  publishFrame();
 
   
 //  AddViewMode("Genome Length",  &cViewer_Map::SetColors_Length,   VIEW_COLOR, COLORS_SCALE);
@@ -499,32 +539,147 @@ Avida::Viewer::Map::~Map()
 
 bool Avida::Viewer::Map::SetModeProperty(int idx, const Apto::String& property, const Apto::String& value)
 {
-  m_rw_lock.WriteLock();
+  m_update_mutex.Lock();
   bool rval = m_view_modes[idx]->SetProperty(property, value);
-  m_rw_lock.WriteUnlock();
+  if (rval && isActiveMode(idx)) publishFrame();
+  m_update_mutex.Unlock();
   return rval;
 }
 
-void Avida::Viewer::Map::UpdateMaps(cPopulation& pop)
+void Avida::Viewer::Map::UpdateMaps(cPopulation& pop, bool all_modes)
 {
-  m_rw_lock.WriteLock();
+  m_update_mutex.Lock();
   
   m_width = pop.GetWorldX();
   m_height = pop.GetWorldY();
   
-  for (int i = 0; i < m_view_modes.GetSize(); i++) m_view_modes[i]->Update(pop);
+  scanCells(pop);
+  for (int i = 0; i < m_view_modes.GetSize(); i++) {
+    if (all_modes || isActiveMode(i)) updateMap(pop, i);
+  }
+  publishFrame();
   
-  m_rw_lock.WriteUnlock();
+  m_update_mutex.Unlock();
 }
 
 
 void Avida::Viewer::Map::SetMode(int mode)
 {
+  m_update_mutex.Lock();
   int type = m_view_modes[mode]->GetSupportedTypes();
   if (type == MAP_GRID_VIEW_COLOR) m_color_mode = mode;
   else if (type == MAP_GRID_VIEW_SYMBOLS) m_symbol_mode = mode;
   else if (type == MAP_GRID_VIEW_TAGS) m_tag_mode = mode;
   else assert(false);
+  
+  // A mode that was not displayed holds the results of the last update it was computed for (current while the
+  // driver is paused), and is brought up to date by the next UpdateMaps
+  if (m_mode_serial[mode] > 0) publishFrame();
+  m_update_mutex.Unlock();
+}
+
+
+void Avida::Viewer::Map::Retain()
+{
+  m_frame_mutex.Lock();
+  if (m_readers == 0 && m_ready_fresh) {
+    int tmp = m_front;
+    m_front = m_ready;
+    m_ready = tmp;
+    m_ready_fresh = false;
+  }
+  m_readers++;
+  m_frame_mutex.Unlock();
+}
+
+void Avida::Viewer::Map::Release()
+{
+  m_frame_mutex.Lock();
+  m_readers--;
+  m_frame_mutex.Unlock();
+}
+
+
+void Avida::Viewer::Map::scanCells(cPopulation& pop)
+{
+  const int num_cells = pop.GetSize();
+  m_update_serial++;
+  
+  if (m_cell_org_id.GetSize() != num_cells) {
+    // Population resized (or first update), every mode must be fully recomputed
+    m_cell_org_id.Resize(num_cells);
+    m_cell_divides.Resize(num_cells);
+    m_cell_changed_at.Resize(num_cells);
+    m_cell_org_id.SetAll(-1);
+    m_cell_divides.SetAll(0);
+    m_cell_changed_at.SetAll(m_update_serial);
+    m_mode_serial.SetAll(0);
+  }
+  
+  for (int i = 0; i < num_cells; i++) {
+    cOrganism* org = pop.GetCell(i).GetOrganism();
+    const int org_id = (org) ? org->GetID() : -1;
+    const int divides = (org) ? org->GetPhenotype().GetNumDivides() : 0;
+    if (org_id != m_cell_org_id[i] || divides != m_cell_divides[i]) {
+      m_cell_org_id[i] = org_id;
+      m_cell_divides[i] = divides;
+      m_cell_changed_at[i] = m_update_serial;
+    }
+  }
+}
+
+
+void Avida::Viewer::Map::updateMap(cPopulation& pop, int map_id)
+{
+  const int last_serial = m_mode_serial[map_id];
+  m_changed_cells.Resize(0);
+  for (int i = 0; i < m_cell_changed_at.GetSize(); i++) {
+    if (last_serial == 0 || m_cell_changed_at[i] > last_serial) m_changed_cells.Push(i);
+  }
+  
+  m_view_modes[map_id]->Update(pop, m_changed_cells);
+  m_mode_serial[map_id] = m_update_serial;
+}
+
+
+void Avida::Viewer::Map::publishFrame()
+{
+  Frame& frame = m_frames[m_back];
+  frame.width = m_width;
+  frame.height = m_height;
+  fillLayer(frame.color, m_color_mode);
+  fillLayer(frame.symbol, m_symbol_mode);
+  fillLayer(frame.tag, m_tag_mode);
+  
+  m_frame_mutex.Lock();
+  int tmp = m_ready;
+  m_ready = m_back;
+  m_back = tmp;
+  m_ready_fresh = true;
+  m_frame_mutex.Unlock();
+}
+
+
+void Avida::Viewer::Map::fillLayer(FrameLayer& layer, int map_id)
+{
+  if (map_id < 0) {
+    layer.values.Resize(0);
+    layer.counts.Resize(0);
+    layer.scale = FrameScale();
+    layer.scale_label = "";
+    return;
+  }
+  
+  const MapMode& mode = *m_view_modes[map_id];
+  layer.values = mode.GetGridValues();
+  layer.counts = mode.GetValueCounts();
+  
+  const DiscreteScale& scale = mode.GetScale();
+  layer.scale.m_range = scale.GetScaleRange();
+  layer.scale.m_categorical = scale.IsCategorical();
+  layer.scale.m_entries.Resize(scale.GetNumLabeledEntries());
+  for (int i = 0; i < layer.scale.m_entries.GetSize(); i++) layer.scale.m_entries[i] = scale.GetEntry(i);
+  layer.scale_label = mode.GetScaleLabel();
 }
 
 